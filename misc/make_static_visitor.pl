@@ -0,0 +1,141 @@
+# Generate a statically dispatched version of one of the visitor or transform
+# APIs which maketea generates for an IR.
+#
+# Use
+#
+#   perl make_static_visitor.pl <dir> <IR> <visitor|transform>
+#
+# For example, "perl make_static_visitor.pl src/generated MIR visitor" reads
+# MIR_visitor.h and MIR_visitor.cpp, and writes MIR_static_visitor.h, which
+# defines the class template MIR::Static_visitor<Derived>.
+#
+# The template has exactly the same methods, with the same bodies, as the
+# maketea-generated class, but none of them are virtual. Instead, every call
+# from one method to another goes through the Derived class (the "curiously
+# recurring template pattern"), so a pass which derives from
+# Static_visitor<My_pass> has its methods called directly, and they can be
+# inlined.
+
+use strict;
+use warnings;
+
+my ($dir, $ir, $kind) = @ARGV;
+die "usage: $0 <dir> <IR> <visitor|transform>\n"
+	unless defined $kind and ($kind eq "visitor" or $kind eq "transform");
+
+my $class = $kind eq "visitor" ? "Visitor" : "Transform";
+my $static_class = "Static_$kind";
+my $header = "$dir/${ir}_$kind.h";
+my $source = "$dir/${ir}_$kind.cpp";
+my $output = "$dir/${ir}_static_$kind.h";
+my $guard = "_" . uc ("${ir}_static_$kind") . "_H_";
+
+# Read the method definitions. The key is the declaration, without the class
+# name.
+my %bodies;
+my %methods;
+open (SOURCE, "<", $source) or die "Cannot open $source: $!\n";
+my @source = <SOURCE>;
+close (SOURCE);
+
+for (my $i = 0; $i < @source; $i++)
+{
+	next unless $source[$i] =~ /^(.*?)\b${class}::(\w+)\((.*)\)$/;
+	my ($ret, $name, $params) = ($1, $2, $3);
+
+	$i++;
+	die "Expected '{' at $source:" . ($i + 1) . "\n" unless $source[$i] =~ /^\{$/;
+
+	my @body;
+	for ($i++; $source[$i] !~ /^\}$/; $i++)
+	{
+		push @body, $source[$i];
+	}
+
+	next if $name eq "~$class";
+
+	$bodies{"$ret$name($params)"} = \@body;
+	$methods{$name} = 1;
+}
+
+# Calls to other methods of the class go through the derived class.
+sub translate
+{
+	my ($line) = @_;
+	$line =~ s/(?<![\w>.:])(\w+)\(/exists $methods{$1} ? "derived()->$1(" : "$1("/ge;
+	return $line;
+}
+
+open (HEADER, "<", $header) or die "Cannot open $header: $!\n";
+my @header = <HEADER>;
+close (HEADER);
+
+open (OUTPUT, ">", $output) or die "Cannot open $output: $!\n";
+
+print OUTPUT "#ifndef $guard\n";
+print OUTPUT "#define $guard\n";
+print OUTPUT "\n";
+print OUTPUT "/* Generated from ${ir}_$kind.h and ${ir}_$kind.cpp by misc/make_static_visitor.pl */\n";
+
+my $in_class = 0;
+foreach my $line (@header)
+{
+	# Keep the guard from the original header out
+	next if $line =~ /^#(ifndef|define|endif)\s/ or $line =~ /^#endif$/;
+
+	if ($line =~ /^class $class$/)
+	{
+		$in_class = 1;
+		print OUTPUT "/*\n";
+		print OUTPUT " * The same as $class, but dispatched statically: methods are called on the\n";
+		print OUTPUT " * Derived class, which hides the methods it wants to replace. Since the\n";
+		print OUTPUT " * methods are not virtual, a method which hides one overload of a name hides\n";
+		print OUTPUT " * them all; bring the rest back with a using declaration.\n";
+		print OUTPUT " */\n";
+		print OUTPUT "template <class Derived>\n";
+		print OUTPUT "class $static_class\n";
+		next;
+	}
+
+	if ($in_class and $line =~ /^\};$/)
+	{
+		print OUTPUT "protected:\n";
+		print OUTPUT "    Derived* derived()\n";
+		print OUTPUT "    {\n";
+		print OUTPUT "    \treturn static_cast<Derived*>(this);\n";
+		print OUTPUT "    }\n";
+		print OUTPUT $line;
+		$in_class = 0;
+		next;
+	}
+
+	if ($in_class and $line =~ /^    virtual (.*);$/)
+	{
+		my $decl = $1;
+		next if $decl =~ /^~/;
+
+		die "No definition for '$decl' in $source\n" unless exists $bodies{$decl};
+
+		print OUTPUT "    $decl\n";
+		print OUTPUT "    {\n";
+		foreach my $body_line (@{$bodies{$decl}})
+		{
+			if ($body_line =~ /^\s*$/)
+			{
+				print OUTPUT $body_line;
+			}
+			else
+			{
+				print OUTPUT "    " . translate ($body_line);
+			}
+		}
+		print OUTPUT "    }\n";
+		print OUTPUT "\n";
+		next;
+	}
+
+	print OUTPUT $line;
+}
+
+print OUTPUT "#endif\n";
+close (OUTPUT);
@@ -0,0 +1,110 @@
+#!/usr/bin/env php
+<?php
+
+	/* Summarise a trace written by phc --wpa-trace=FILENAME: the time taken
+	 * by each iteration and the analyses which had not converged, and the
+	 * most expensive functions. */
+
+	if ($argc < 2)
+		die ("Usage: wpa_trace_summary.php TRACE [N]\n");
+
+	$filename = $argv[1];
+	$top = isset ($argv[2]) ? (int)$argv[2] : 10;
+
+	$lines = file ($filename);
+	if ($lines === false)
+		die ("Cannot read $filename\n");
+
+	$iterations = array ();
+	$functions = array ();
+	$contexts = array ();
+	$failure = NULL;
+	$last_iteration = 0;
+
+	foreach ($lines as $num => $line)
+	{
+		$record = json_decode ($line, true);
+		if ($record === NULL)
+		{
+			// The last line may be incomplete if phc crashed.
+			echo "Ignoring line " . ($num+1) . ": not valid JSON\n";
+			continue;
+		}
+
+		$last_iteration = max ($last_iteration, $record["iteration"]);
+
+		switch ($record["event"])
+		{
+			case "iteration":
+				$iterations[] = $record;
+				break;
+
+			case "failed":
+				$failure = $record;
+				break;
+
+			case "function":
+				add_function ($functions, $record["function"], $record);
+				add_function ($contexts, $record["function"] . " " . $record["context"], $record);
+				break;
+		}
+	}
+
+	function add_function (&$table, $key, $record)
+	{
+		if (!isset ($table[$key]))
+		{
+			$table[$key] = array (
+				"calls" => 0,
+				"self_time" => 0,
+				"blocks" => 0,
+				"worklist_max" => 0,
+				"points_to" => 0);
+		}
+
+		$entry = &$table[$key];
+		$entry["calls"]++;
+		$entry["self_time"] += $record["self_time"];
+		$entry["blocks"] += $record["blocks"];
+		$entry["worklist_max"] = max ($entry["worklist_max"], $record["worklist_max"]);
+		$entry["points_to"] = max ($entry["points_to"],
+			$record["points_to"]["nodes"] + $record["points_to"]["edges"]);
+	}
+
+	function print_top ($title, $table, $field, $top)
+	{
+		uasort ($table, create_function ('$a, $b',
+			"return \$b['$field'] < \$a['$field'] ? -1 : (\$b['$field'] > \$a['$field'] ? 1 : 0);"));
+
+		echo "\n$title:\n";
+		printf ("  %-50s %6s %10s %8s %8s %10s\n", "", "calls", "self (s)", "blocks", "wl max", "ptg size");
+		foreach (array_slice ($table, 0, $top, true) as $key => $entry)
+		{
+			printf ("  %-50s %6d %10.3f %8d %8d %10d\n",
+				$key, $entry["calls"], $entry["self_time"], $entry["blocks"],
+				$entry["worklist_max"], $entry["points_to"]);
+		}
+	}
+
+	echo "Iterations:\n";
+	foreach ($iterations as $it)
+	{
+		printf ("  %2d %10.3fs  %s\n", $it["iteration"], $it["time"],
+			$it["converged"] ? "converged" : "unconverged: " . implode (", ", $it["unconverged"]));
+	}
+
+	print_top ("Functions by self time", $functions, "self_time", $top);
+	print_top ("Functions by blocks evaluated", $functions, "blocks", $top);
+	print_top ("Functions by worklist size", $functions, "worklist_max", $top);
+	print_top ("Functions by points-to graph size", $functions, "points_to", $top);
+	print_top ("Contexts by self time", $contexts, "self_time", $top);
+
+	echo "\n";
+	if ($failure)
+		echo "Failed in iteration {$failure["iteration"]}: {$failure["reason"]}\n";
+	else if (count ($iterations) == 0 || !$iterations[count ($iterations) - 1]["converged"])
+		echo "Trace is incomplete: stopped in iteration $last_iteration\n";
+	else
+		echo "Converged after " . count ($iterations) . " iterations\n";
+
+?>
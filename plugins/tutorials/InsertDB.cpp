@@ -22,8 +22,13 @@ public:
 
    void post_method(Method* in)
    {
+      // Names are shared, so give the method a new name rather than
+      // changing the old one
       if(uses_dbx)
-         in->signature->method_name->value->append("_DB");
+      {
+         String* name = in->signature->method_name->value;
+         in->signature->method_name->value = intern(*name + "_DB");
+      }
    }
 
    void post_method_invocation(Method_invocation* in)
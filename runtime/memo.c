@@ -0,0 +1,125 @@
+/*
+ * Memoization of pure functions (--memoize). Results are cached in a single
+ * table, keyed by the function name and the values of its arguments. Only
+ * scalar arguments can form part of a key; calls with other arguments are
+ * not cached.
+ */
+
+#define PHC_MEMO_MAX_ENTRIES 4096
+
+static HashTable *phc_memo_table = NULL;
+
+static void
+phc_memo_append (char **p_key, int *p_length, const void *data, int length)
+{
+  *p_key = erealloc (*p_key, *p_length + length);
+  memcpy (*p_key + *p_length, data, length);
+  *p_length += length;
+}
+
+/*
+ * Build the key for a call to FN with ARGS into P_KEY and P_LENGTH. Returns 0
+ * (and no key) if the arguments cannot be cached.
+ */
+static int
+phc_memo_key (const char *fn, zval ** args, int num_args, char **p_key,
+	      int *p_length)
+{
+  int i;
+  *p_key = NULL;
+  *p_length = 0;
+
+  phc_memo_append (p_key, p_length, fn, strlen (fn) + 1);
+
+  for (i = 0; i < num_args; i++)
+    {
+      zval *zvp = args[i];
+      char type = Z_TYPE_P (zvp);
+
+      phc_memo_append (p_key, p_length, &type, sizeof (type));
+      switch (Z_TYPE_P (zvp))
+	{
+	case IS_NULL:
+	  break;
+	case IS_BOOL:
+	case IS_LONG:
+	  phc_memo_append (p_key, p_length, &Z_LVAL_P (zvp), sizeof (long));
+	  break;
+	case IS_DOUBLE:
+	  phc_memo_append (p_key, p_length, &Z_DVAL_P (zvp), sizeof (double));
+	  break;
+	case IS_STRING:
+	  phc_memo_append (p_key, p_length, &Z_STRLEN_P (zvp), sizeof (int));
+	  phc_memo_append (p_key, p_length, Z_STRVAL_P (zvp), Z_STRLEN_P (zvp));
+	  break;
+	default:
+	  efree (*p_key);
+	  *p_key = NULL;
+	  *p_length = 0;
+	  return 0;
+	}
+    }
+
+  return 1;
+}
+
+/*
+ * If a result is cached for KEY, copy it into RETURN_VALUE and return 1.
+ */
+static int
+phc_memo_lookup (char *key, int length, zval * return_value)
+{
+  zval **p_result;
+
+  if (phc_memo_table == NULL)
+    return 0;
+
+  if (zend_hash_find (phc_memo_table, key, length, (void **) &p_result) !=
+      SUCCESS)
+    return 0;
+
+  zval_dtor (return_value);
+  *return_value = **p_result;
+  zval_copy_ctor (return_value);
+  return 1;
+}
+
+/*
+ * Cache RETURN_VALUE as the result for KEY. Once the table is full, new
+ * results are not cached.
+ */
+static void
+phc_memo_store (char *key, int length, zval * return_value)
+{
+  zval *result;
+
+  if (phc_memo_table == NULL)
+    {
+      ALLOC_HASHTABLE (phc_memo_table);
+      zend_hash_init (phc_memo_table, 64, NULL, ZVAL_PTR_DTOR, 0);
+    }
+
+  if (zend_hash_num_elements (phc_memo_table) >= PHC_MEMO_MAX_ENTRIES)
+    return;
+
+  ALLOC_ZVAL (result);
+  *result = *return_value;
+  zval_copy_ctor (result);
+  INIT_PZVAL (result);
+
+  // A recursive call may have cached it already
+  if (zend_hash_add (phc_memo_table, key, length, &result, sizeof (zval *),
+		     NULL) != SUCCESS)
+    zval_ptr_dtor (&result);
+}
+
+static void
+phc_memo_finalize ()
+{
+  if (phc_memo_table == NULL)
+    return;
+
+  zend_hash_destroy (phc_memo_table);
+  FREE_HASHTABLE (phc_memo_table);
+  phc_memo_table = NULL;
+}
@@ -193,6 +193,27 @@ assign_expr_bin_op (token LHS, node LEFT, node RIGHT, string OP_FN)
     zval_dtor (&old);
 @@@
 
+// Arithmetic on longs, where the optimizer has proven that the result will
+// not overflow into a double (see VRP). OP is "+", "-" or "*", which has the
+// same meaning in C.
+assign_expr_long_bin_op (token LHS, node LEFT, node RIGHT, token OP)
+@@@
+  \get_st_entry ("LOCAL", "p_lhs", LHS);
+  \read_rvalue ("left", LEFT);
+  \read_rvalue ("right", RIGHT);
+  assert (Z_TYPE_P (left) == IS_LONG && Z_TYPE_P (right) == IS_LONG);
+  long result = Z_LVAL_P (left) $OP Z_LVAL_P (right);
+  if (in_copy_on_write (*p_lhs))
+    {
+      zval_ptr_dtor (p_lhs);
+      ALLOC_INIT_ZVAL (*p_lhs);
+    }
+
+  zval old = **p_lhs;
+  ZVAL_LONG (*p_lhs, result);
+  zval_dtor (&old);
+@@@
+
 /*
  * Unary-ops
  */
@@ -223,6 +244,15 @@ pre_op (token VAR, string OP_FN)
    $OP_FN (*p_var);
 @@@
 
+// ++ or -- on a long which the optimizer has proven will not overflow.
+long_pre_op (token VAR, token OP)
+@@@
+   \get_st_entry ("LOCAL", "p_var", VAR);
+   sep_copy_on_write (p_var);
+   assert (Z_TYPE_PP (p_var) == IS_LONG);
+   $OP Z_LVAL_PP (p_var);
+@@@
+
 /*
  * Return
  */
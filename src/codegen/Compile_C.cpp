@@ -45,6 +45,8 @@ bool Compile_C::pass_is_enabled (Pass_manager* pm)
 
 void Compile_C::run (IR::PHP_script* in, Pass_manager* pm)
 {
+	pm->changed_nothing ();
+
 	// Find PHP installation path
 	const char* php_path;
 	if(pm->args_info->with_php_given)
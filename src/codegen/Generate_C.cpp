@@ -44,6 +44,7 @@
 #include "codegen/Generate_C_annotations.h"
 #include "process_mir/MIR_to_AST.h"
 #include "pass_manager/Pass_manager.h"
+#include "pass_manager/Pass_timer.h"
 
 #include "Generate_C.h"
 #include "parsing/MICG_parser.h"
@@ -849,6 +850,14 @@ protected:
 		foreach (String* iter, *iterators)
 			buf << "HashPosition " << *iter << ";\n";
 
+		if (is_memoized ())
+		{
+			buf
+			<< "char* memo_key = NULL;\n"
+			<< "int memo_key_length = 0;\n"
+			;
+		}
+
 		// debug_argument_stack();
 
 		// TODO: the same variable may be used twice in the signature. This leads to a memory leak.
@@ -929,14 +938,52 @@ protected:
 
 				index++;
 			}
+
+			if (is_memoized ())
+			{
+				buf << "if (ZEND_NUM_ARGS () == num_args)\n";
+				memo_lookup ("params", "num_args");
+			}
 				
 			buf << "}\n";
 
 		}
+		else if (is_memoized ())
+		{
+			buf << "if (ZEND_NUM_ARGS () == 0)\n";
+			memo_lookup ("NULL", "0");
+		}
 		
 		buf << "// Function body\n";
 	}
 
+	// Only pure functions are memoized. Their results depend only on
+	// their arguments, and they have no other effects, so a cached result
+	// can be returned without running them.
+	bool is_memoized ()
+	{
+		return args_info.memoize_flag
+			&& not args_info.extension_given
+			&& signature->attrs->is_true ("phc.optimize.pure")
+			&& *signature->method_name->value != "__MAIN__";
+	}
+
+	void memo_lookup (string args, string num_args)
+	{
+		buf
+		<< "{\n"
+		<< "	if (phc_memo_key (\"" << *signature->method_name->value->to_lower () << "\", "
+		<<				args << ", " << num_args << ", &memo_key, &memo_key_length)\n"
+		<< "		&& phc_memo_lookup (memo_key, memo_key_length, return_value))\n"
+		<< "	{\n"
+		<< "		efree (memo_key);\n"
+		<< "		memo_key = NULL;\n"
+		<< "		goto end_of_function;\n"
+		<< "	}\n"
+		<< "}\n"
+		;
+	}
+
 	void method_exit()
 	{
 		buf
@@ -945,6 +992,16 @@ protected:
 		<< "end_of_function:__attribute__((unused));\n"
 		;
 
+		if (is_memoized ())
+		{
+			buf
+			<< "if (memo_key != NULL)\n"
+			<< "{\n"
+			<< "	phc_memo_store (memo_key, memo_key_length, return_value);\n"
+			<< "	efree (memo_key);\n"
+			<< "}\n"
+			;
+		}
 
 		if (*signature->method_name->value != "__MAIN__"
 			&& not signature->method_name->attrs->is_true ("phc.codegen.st_entry_not_required"))
@@ -1269,6 +1326,15 @@ public:
 		assert (op_functions.has (*op->value->value));
 		assert (!agn->is_ref);
 
+		// The optimizer has proven the operands are longs, and that the
+		// result does not overflow.
+		if (op->value->attrs->is_true ("phc.optimize.no_overflow"))
+		{
+			INST (buf, "assign_expr_long_bin_op",
+					lhs->value, left->value, right->value, op->value);
+			return;
+		}
+
 		string op_fn = op_functions[*op->value->value];
 
 		INST (buf, "assign_expr_bin_op",
@@ -2319,6 +2385,12 @@ public:
 	{
 		assert (op_functions.has (*op->value->value));
 
+		if (op->value->attrs->is_true ("phc.optimize.no_overflow"))
+		{
+			INST (buf, "long_pre_op", var->value, op->value);
+			return;
+		}
+
 		string op_fn = op_functions[*op->value->value]; 
 
 		INST (buf, "pre_op",
@@ -2627,7 +2699,11 @@ void include_file (ostream& out, String* filename)
 
 void Generate_C::pre_php_script(PHP_script* in)
 {
+	micg.timer = pm->timer;
+
+	Pass_timer_scope timing (pm->timer, "codegen", "micg-parse");
 	micg.add_macro_def (read_file (s("templates/templates_new.c")), "templates/templates_new.c");
+	timing.stop ();
 
 	prologue << "// BEGIN INCLUDED FILES" << endl;
 
@@ -2645,8 +2721,14 @@ void Generate_C::pre_php_script(PHP_script* in)
 
 	include_file (prologue, s("builtin_functions.c"));
 
+	if (args_info.memoize_flag)
+		include_file (prologue, s("memo.c"));
+
 	prologue << "// END INCLUDED FILES" << endl;
 
+	if (args_info.memoize_flag)
+		finalizations << "phc_memo_finalize ();\n";
+
 	// We need to save refcounts for functions returned by reference, where the
 	// PHP engine destroys the refcount for no good reason.
 	prologue << "int saved_refcount;\n";
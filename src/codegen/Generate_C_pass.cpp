@@ -25,6 +25,8 @@ bool Generate_C_pass::pass_is_enabled (Pass_manager* pm)
 
 void Generate_C_pass::run (IR::PHP_script* in, Pass_manager* pm)
 {
+	pm->changed_nothing ();
+
 	if (not PHP::is_available ())
 	{
 		// TODO would be better if we checked for these at run-time if they
@@ -5,11 +5,16 @@
  * macro-inlined code generator (pronounced 'mig', like wig)
  */
 
+#include <typeinfo>
+
 #include "MICG_gen.h"
 #include "MICG_checker.h"
 #include "MICG.h"
+#include "MICG_visitor.h"
 #include "MIR.h"
+#include "parsing/Bin_parser.h"
 #include "parsing/MICG_parser.h"
+#include "pass_manager/Pass_timer.h"
 #include "process_ir/General.h"
 #include "lib/String.h"
 
@@ -17,6 +22,12 @@ using namespace MICG;
 using namespace std;
 using namespace boost;
 
+MICG_gen::MICG_gen ()
+: timer (NULL)
+, nesting (0)
+{
+}
+
 void
 MICG_gen::add_macro (MICG::Macro* in)
 {
@@ -36,27 +47,257 @@ MICG_gen::add_macro (MICG::Macro* in)
 	// inheritence hierarchy. We don't want to check the names are the same, as
 	// they provide context.
 
+	store_macro (in);
+}
+
+// Macros of the same name may name their parameters differently, so rules
+// refer to parameters by position and type.
+static string
+param_key (PARAM_NAME* param_name, Macro* macro)
+{
+	stringstream ss;
+	int index = 0;
+	foreach (Formal_parameter* fp, *macro->signature->formal_parameters)
+	{
+		if (*fp->param_name->value == *param_name->value)
+		{
+			ss << "$" << index << ":" << *fp->type_name->value;
+			return ss.str ();
+		}
+		index++;
+	}
+
+	// This is an error, which is reported when the rule is evaluated.
+	ss << "$" << *param_name->value;
+	return ss.str ();
+}
+
+static string
+expr_key (Expr* in, Macro* macro)
+{
+	stringstream ss;
+
+	// As in get_expr, isa and dyc are used in place of dynamic_cast.
+	if (isa<STRING> (in))
+	{
+		String* value = dyc<STRING> (in)->value;
+		ss << "\"" << value->size () << ":" << *value;
+	}
+	else if (isa<Lookup> (in))
+	{
+		Lookup* lookup = dyc<Lookup> (in);
+		ss << param_key (lookup->param_name, macro) << "." << *lookup->attr_name->value;
+	}
+	else if (isa<Param> (in))
+	{
+		Param* param = dyc<Param> (in);
+		ss << param_key (param->param_name, macro);
+		foreach (ATTR_NAME* an, *param->attr_names)
+			ss << "#" << *an->value;
+	}
+	else if (isa<Macro_call> (in) || isa<Callback> (in))
+	{
+		MACRO_NAME* macro_name;
+		Expr_list* exprs;
+		if (isa<Macro_call> (in))
+		{
+			macro_name = dyc<Macro_call> (in)->macro_name;
+			exprs = dyc<Macro_call> (in)->exprs;
+			ss << "\\";
+		}
+		else
+		{
+			macro_name = dyc<Callback> (in)->macro_name;
+			exprs = dyc<Callback> (in)->exprs;
+			ss << "\\cb:";
+		}
+
+		ss << *macro_name->value << "(";
+		foreach (Expr* e, *exprs)
+			ss << expr_key (e, macro) << ",";
+		ss << ")";
+	}
+	else
+		phc_unreachable ();
+
+	return ss.str ();
+}
+
+// The same rule in different macros of the same name has the same key.
+static string
+rule_key (Rule* in, Macro* macro)
+{
+	if (Lookup* l = dynamic_cast<Lookup*> (in))
+		return expr_key (l, macro);
+
+	if (Equals* e = dynamic_cast<Equals*> (in))
+		return expr_key (e->left, macro) + "==" + expr_key (e->right, macro);
+
+	phc_unreachable ();
+}
+
+class Attr_name_collector : public Visitor, virtual public GC_obj
+{
+public:
+	Set<string>* attr_names;
+
+	Attr_name_collector (Set<string>* attr_names)
+	: attr_names (attr_names)
+	{
+	}
+
+	void pre_attr_name (ATTR_NAME* in)
+	{
+		attr_names->insert (*in->value);
+	}
+};
+
+void
+MICG_gen::store_macro (Macro* in)
+{
+	string name = *in->signature->macro_name->value;
 	macros[name].push_back (in);
+
+	foreach (Rule* rule, *in->rules)
+		rule_keys[rule] = rule_key (rule, in);
+
+	in->visit (new Attr_name_collector (&attr_names));
+
+	// Rebuild the decision tree when it is next needed, and forget
+	// instantiations which might now be different.
+	decisions.erase (name);
+	instantiations.clear ();
+}
+
+Macro_candidate::Macro_candidate (Macro* macro, Rule_list* rules)
+: macro (macro)
+, rules (rules)
+{
 }
 
-// Iterate through the macros til we find one whose rules match the PARAMS.
-// Fail otherwise.
+Macro_decision::Macro_decision (List<Macro_candidate*>* candidates)
+: candidates (candidates)
+, if_true (NULL)
+, if_false (NULL)
+{
+}
+
+// Find the first macro whose rules match the PARAMS. Fail if there is none.
+//
+// Macros of the same name often share rules, such as the
+// VAR.st_entry_not_required in each of the read_rvalue macros. So rather than
+// checking each macro's rules in turn, we walk a decision tree, which tests
+// each rule at most once. It finds the same macro that checking the macros in
+// order would.
 Macro*
 MICG_gen::get_macro (string name, Object_list* params)
 {
-	foreach (Macro* m, macros[name])
+	if (!decisions.has (name))
 	{
-		if (suitable (m, params))
-			return m;
+		List<Macro_candidate*>* candidates = new List<Macro_candidate*>;
+		foreach (Macro* m, macros[name])
+			candidates->push_back (new Macro_candidate (m, m->rules));
+
+		decisions[name] = new Macro_decision (candidates);
+	}
+
+	Macro_decision* decision = decisions[name];
+
+	// Rules use the parameter names of their own macro.
+	Macro* symtable_macro = NULL;
+	Symtable* symtable = NULL;
+
+	while (decision->candidates->size () > 0)
+	{
+		Macro_candidate* first = decision->candidates->front ();
+		if (first->rules->size () == 0)
+			return first->macro;
+
+		if (symtable_macro != first->macro)
+		{
+			symtable_macro = first->macro;
+			symtable = get_symtable (first->macro, params);
+		}
+
+		if (rule_holds (first->rules->front (), symtable))
+		{
+			if (decision->if_true == NULL)
+				decision->if_true = branch (decision, true);
+
+			decision = decision->if_true;
+		}
+		else
+		{
+			if (decision->if_false == NULL)
+				decision->if_false = branch (decision, false);
+
+			decision = decision->if_false;
+		}
 	}
 
 	phc_internal_error ("No macro named %s matches the params: ", name.c_str ());
 	phc_unreachable ();
 }
 
+// The branch of DECISION taken when its rule is known to hold (or not).
+Macro_decision*
+MICG_gen::branch (Macro_decision* decision, bool rule_held)
+{
+	string key = rule_keys[decision->candidates->front ()->rules->front ()];
+
+	List<Macro_candidate*>* candidates = new List<Macro_candidate*>;
+	foreach (Macro_candidate* candidate, *decision->candidates)
+	{
+		Rule_list* rules = new Rule_list;
+		bool has_rule = false;
+		foreach (Rule* rule, *candidate->rules)
+		{
+			if (rule_keys[rule] == key)
+				has_rule = true;
+			else
+				rules->push_back (rule);
+		}
+
+		if (has_rule && !rule_held)
+			continue;
+
+		candidates->push_back (new Macro_candidate (candidate->macro, rules));
+	}
+
+	return new Macro_decision (candidates);
+}
+
+MICG_precompiled* MICG_precompiled::first = NULL;
+
+MICG_precompiled::MICG_precompiled (const char* filename, unsigned long long source_hash,
+												const char* data, size_t size)
+: filename (filename)
+, source_hash (source_hash)
+, data (data)
+, size (size)
+{
+	// This runs during static initialization, so it must not allocate.
+	next = first;
+	first = this;
+}
+
 void
 MICG_gen::add_macro_def (string str, string filename)
 {
+	unsigned long long hash = stable_hash (str.data (), str.size ());
+	for (MICG_precompiled* p = MICG_precompiled::first; p != NULL; p = p->next)
+	{
+		if (filename != p->filename || hash != p->source_hash)
+			continue;
+
+		// These were checked by add_macro when they were compiled.
+		All* all = dyc<All> ((new Bin_parser)->parse_bin_node (p->data, p->size));
+		foreach (Macro* m, *all->macros)
+			store_macro (m);
+
+		return;
+	}
+
 	MICG_parser parser;
 	foreach (Macro* m, *parser.parse (str, filename))
 		add_macro (m);
@@ -64,6 +305,18 @@ MICG_gen::add_macro_def (string str, string filename)
 
 string
 MICG_gen::instantiate (string macro_name, Object_list* params, Node* anchor)
+{
+	Pass_timer_scope timing (nesting == 0 ? timer : NULL, "codegen", "micg");
+
+	nesting++;
+	string result = instantiate_macro (macro_name, params, anchor);
+	nesting--;
+
+	return result;
+}
+
+string
+MICG_gen::instantiate_macro (string macro_name, Object_list* params, Node* anchor)
 {
 	if (anchor == NULL)
 	{
@@ -111,44 +364,135 @@ MICG_gen::instantiate (string macro_name, Object_list* params, Node* anchor)
 	stringstream ss;
 	foreach (Object_list* actual_params, *this->expand_list_params (first_macro, params))
 	{
+		// The same macro is often instantiated with the same parameters, such as
+		// \get_st_entry for a variable used throughout a function.
+		stringstream key;
+		key << macro_name << ":";
+		bool cacheable = write_signature (actual_params, key);
+
+		if (cacheable && instantiations.has (key.str ()))
+		{
+			ss << instantiations[key.str ()];
+			continue;
+		}
+
 		Macro* m = get_macro (macro_name, actual_params);
 		DEBUG ("Entering " << macro_name << ":" << m->get_line_number () << *to_string_rep (actual_params));
 		Symtable* symtable = get_symtable (m, actual_params);
-		ss << instantiate_body (m->body, symtable);
+		string result = instantiate_body (m->body, symtable);
 		DEBUG ("Exiting " << macro_name << ":" << m->get_line_number () << *to_string_rep (actual_params));
+
+		if (cacheable)
+			instantiations[key.str ()] = result;
+
+		ss << result;
 	}
 	return ss.str ();
 }
 
+// Macros see strings, the values of identifiers and literals, the types of
+// nodes (through callbacks like is_literal), and the attributes they name.
 bool
-MICG_gen::suitable (Macro* macro, Object_list* params)
+MICG_gen::write_signature (Object* in, ostream& os)
 {
-	Symtable* symtable = get_symtable (macro, params);
+	if (in == NULL)
+		os << "N;";
 
-	// Check if the rules match.
-	foreach (Rule* rule, *macro->rules)
+	else if (Boolean* b = dynamic_cast<Boolean*> (in))
+		os << (b->value () ? "T;" : "F;");
+
+	else if (::Integer* i = dynamic_cast< ::Integer*> (in))
+		os << "I" << i->value () << ";";
+
+	else if (String* str = dynamic_cast<String*> (in))
+		os << "S" << str->size () << ":" << *str;
+
+	else if (Object_list* list = dynamic_cast<Object_list*> (in))
 	{
-		if (Lookup* l = dynamic_cast <Lookup*> (rule))
+		os << "L" << list->size () << "(";
+		foreach (Object* obj, *list)
 		{
-			String* str = dyc<String> (symtable->get_lookup (l, true));
-			if (*str == MICG_FALSE)
+			if (!write_signature (obj, os))
 				return false;
 		}
-		else if (Equals* e = dynamic_cast<Equals*> (rule))
+		os << ")";
+	}
+
+	else if (MIR::Node* node = dynamic_cast<MIR::Node*> (in))
+	{
+		os << "M" << typeid (*node).name () << ";";
+
+		// REALs are written out bytewise, so their strings aren't precise
+		// enough.
+		if (MIR::REAL* real = dynamic_cast<MIR::REAL*> (node))
+			os.write ((const char*) &real->value, sizeof (real->value));
+
+		else if (isa<MIR::Identifier> (node) || isa<MIR::Literal> (node))
 		{
-			String* left = dyc<String> (get_expr (e->left, symtable, true));
-			String* right = dyc<String> (get_expr (e->right, symtable, true));
+			String* value = isa<MIR::Identifier> (node)
+				? dyc<MIR::Identifier> (node)->get_value_as_string ()
+				: dyc<MIR::Literal> (node)->get_value_as_string ();
 
-			if (*left != *right)
-				return false;
+			os << "V" << value->size () << ":" << *value;
 		}
-		else
-			phc_unreachable ();
+
+		// As in Symtable::get_lookup
+		foreach (string attr_name, attr_names)
+		{
+			string keys[] = {"phc.codegen." + attr_name, "phc.optimize." + attr_name};
+			foreach (string key, keys)
+			{
+				if (!node->attrs->has (key))
+					continue;
+
+				os << key << "=";
+				if (!write_signature (node->attrs->get (key), os))
+					return false;
+			}
+		}
+		os << ";";
+	}
+
+	else
+		return false;
+
+	return true;
+}
+
+bool
+MICG_gen::suitable (Macro* macro, Object_list* params)
+{
+	Symtable* symtable = get_symtable (macro, params);
+
+	// Check if the rules match.
+	foreach (Rule* rule, *macro->rules)
+	{
+		if (!rule_holds (rule, symtable))
+			return false;
 	}
 
 	return true;
 }
 
+bool
+MICG_gen::rule_holds (Rule* rule, Symtable* symtable)
+{
+	if (Lookup* l = dynamic_cast <Lookup*> (rule))
+	{
+		String* str = dyc<String> (symtable->get_lookup (l, true));
+		return *str != MICG_FALSE;
+	}
+	else if (Equals* e = dynamic_cast<Equals*> (rule))
+	{
+		String* left = dyc<String> (get_expr (e->left, symtable, true));
+		String* right = dyc<String> (get_expr (e->right, symtable, true));
+
+		return *left == *right;
+	}
+
+	phc_unreachable ();
+}
+
 void
 MICG_gen::register_callback (string name, callback_t callback, int param_count)
 {
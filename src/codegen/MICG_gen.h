@@ -12,6 +12,9 @@
 
 #include "lib/String.h"
 #include "lib/Map.h"
+#include "lib/Set.h"
+
+class Pass_timer;
 
 #define MICG_TRUE "TRUE"
 #define MICG_FALSE "FALSE"
@@ -44,11 +47,65 @@ public:
 	void check_param (PARAM_NAME* name);
 };
 
+/* A macro which might still match, with those of its rules which are not yet
+ * known to hold. */
+class Macro_candidate : public virtual GC_obj
+{
+public:
+	Macro_candidate (Macro* macro, Rule_list* rules);
+
+	Macro* macro;
+	Rule_list* rules;
+};
+
+/* A node in the decision tree for the macros with one name (see
+ * MICG_gen::get_macro). It tests the first rule of the first candidate. Its
+ * branches are built the first time they are taken. */
+class Macro_decision : public virtual GC_obj
+{
+public:
+	Macro_decision (List<Macro_candidate*>* candidates);
+
+	List<Macro_candidate*>* candidates;
+	Macro_decision* if_true;
+	Macro_decision* if_false;
+};
+
 }
 
+/*
+ * Macros which were parsed and checked when phc was built, by micg_compile,
+ * and stored in phc's binary format (see process_ir/Bin_unparser.h). The
+ * source which micg_compile generates defines one of these for each file.
+ * add_macro_def uses them in place of parsing the file, as long as the file
+ * has not changed since.
+ */
+class MICG_precompiled
+{
+public:
+	MICG_precompiled (const char* filename, unsigned long long source_hash,
+							const char* data, size_t size);
+
+	const char* filename;
+
+	// The stable_hash of the file's contents
+	unsigned long long source_hash;
+
+	const char* data;
+	size_t size;
+
+	MICG_precompiled* next;
+	static MICG_precompiled* first;
+};
+
 class MICG_gen : public virtual GC_obj
 {
 public:
+	MICG_gen ();
+
+	// If set, the outermost instantiations are timed (for --time-passes).
+	Pass_timer* timer;
+
 	// callback_t: A function which takes a string and returns a string.
 	typedef string (*callback_t)(Object_list*);
 
@@ -67,13 +124,39 @@ private:
 	Map<string, std::pair<callback_t, int> > callbacks;
 	Map<string, MICG::Macro_list> macros;
 
+	// The rules of the macros with each name, compiled into a decision tree.
+	Map<string, MICG::Macro_decision*> decisions;
+
+	// The same rule in different macros has the same key (see rule_key).
+	Map<MICG::Rule*, string> rule_keys;
+
+	// The attributes which the macros refer to.
+	Set<string> attr_names;
+
+	// The results of instantiations, keyed by the macro name and the
+	// signature of the parameters.
+	Map<string, string> instantiations;
+
+	// Store a macro which has been checked.
+	void store_macro (MICG::Macro*);
+
 public:
 	void add_macro (MICG::Macro*);
+
+	// Add the macros in STR, which is the contents of FILENAME.
 	void add_macro_def (string str, string filename);
 
 
 	string instantiate (string macro_name, Object_list* params, MICG::Node* anchor = NULL);
 
+private:
+	// The depth of nested instantiations.
+	int nesting;
+
+	string instantiate_macro (string macro_name, Object_list* params, MICG::Node* anchor);
+
+public:
+
 	// Check that the signature matches (its not called 'matches' to avoid
 	// overloading the word 'match', which is generated by maketea).
 	bool suitable (MICG::Macro* sig, Object_list* params);
@@ -81,6 +164,17 @@ public:
 	// Get the macro named NAME, whose rules match PARAMs.
 	MICG::Macro* get_macro (string name, Object_list* params);
 
+	bool rule_holds (MICG::Rule* rule, MICG::Symtable* symtable);
+
+private:
+	MICG::Macro_decision* branch (MICG::Macro_decision* decision, bool rule_held);
+
+	// Write everything an instantiation can see of IN to OS. Returns false if
+	// IN cannot be summarized, in which case the instantiation is not cached.
+	bool write_signature (Object* in, std::ostream& os);
+
+public:
+
 
 	// Look through PARAMS, finding any lists which are not declared with the
 	// 'list' type. These are intended to be iterated through at call-time.
@@ -102,6 +196,9 @@ public:
 
 
 	string callback (MICG::MACRO_NAME* macro, Object_list* params);
+
+	// Instantiations are cached, so a callback's result must depend only on
+	// what write_signature records of its parameters.
 	void register_callback (string name, callback_t callback, int param_count);
 
 	// Wrappers around common calls. The parameters are fetched from SYMTABLE
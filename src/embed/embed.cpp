@@ -59,9 +59,27 @@ void PHP::shutdown_php ()
 
 unsigned long PHP::get_hash (String* string)
 {
-	return zend_get_hash_value (
+	// The same identifiers are hashed over and over during code generation,
+	// so cache the hash on interned names.
+	Symbol* symbol = NULL;
+	if (string->is_interned ())
+	{
+		symbol = static_cast<Symbol*> (string);
+		if (symbol->has_hash)
+			return symbol->hash;
+	}
+
+	unsigned long result = zend_get_hash_value (
 		const_cast <char*> (string->c_str ()), 
 		string->size () + 1);
+
+	if (symbol)
+	{
+		symbol->hash = result;
+		symbol->has_hash = true;
+	}
+
+	return result;
 }
 
 AST::Literal* PHP::convert_token (AST::Literal *in)
@@ -313,7 +331,7 @@ PHP::convert_token (AST::Literal *token)
 			{
 				assert(errno == 0);
 				AST::INT* i = new AST::INT (LONG_MAX, in->get_source_rep ());
-				i->attrs->set("phc.line_number", in->attrs->get("phc.line_number"));
+				i->attrs->set_line_number (in->attrs->get_line_number ());
 				return i;
 			}
 			else
@@ -324,7 +342,7 @@ PHP::convert_token (AST::Literal *token)
 					assert (errno == 0);
 					// Why LONG_MIN + 1? Well. Ask the PHP folks :)
 					AST::INT* i = new AST::INT (LONG_MIN + 1, in->get_source_rep ());
-					i->attrs->set("phc.line_number", in->attrs->get("phc.line_number"));
+					i->attrs->set_line_number (in->attrs->get_line_number ());
 					return i;
 				}
 				else
@@ -336,7 +354,7 @@ PHP::convert_token (AST::Literal *token)
 					double value = static_cast<double>(strtoll(in->get_source_rep ()->c_str(), NULL, 16));
 					assert (errno == 0);
 					AST::REAL* r = new AST::REAL (value, in->get_source_rep ());
-					r->attrs->set ("phc.line_number", in->attrs->get ("phc.line_number"));
+					r->attrs->set_line_number (in->attrs->get_line_number ());
 					return r;
 				}
 			}
@@ -346,7 +364,7 @@ PHP::convert_token (AST::Literal *token)
 		double value = strtod(in->get_source_rep ()->c_str(), (char **)NULL);
 		assert(errno == 0);
 		AST::REAL* r = new AST::REAL (value, in->get_source_rep ());
-		r->attrs->set ("phc.line_number", in->attrs->get ("phc.line_number"));
+		r->attrs->set_line_number (in->attrs->get_line_number ());
 		return r;
 	}
 	else
@@ -0,0 +1,750 @@
+/*
+ * phc -- the open source PHP compiler
+ * See doc/license/README.license for licensing information
+ *
+ * Constant folding of MIR literals with PHP 5 semantics, without going
+ * through the PHP interpreter. This follows zend_operators.c. Anything which
+ * is not modelled precisely returns NULL, so that the interpreter is used
+ * instead.
+ */
+
+#include <limits>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "embed.h"
+#include "fold.h"
+#include "process_ir/General.h"
+
+using namespace MIR;
+using namespace std;
+
+/*
+ * Numbers
+ */
+
+class Number
+{
+public:
+	bool is_long;
+	long lval;
+	double dval;
+
+	Number () : is_long (true), lval (0), dval (0.0) {}
+	Number (long lval) : is_long (true), lval (lval), dval (0.0) {}
+	Number (double dval) : is_long (false), lval (0), dval (dval) {}
+
+	double as_double () { return is_long ? (double) lval : dval; }
+};
+
+enum Numeric_kind { NOT_NUMERIC, NUMERIC, NUMERIC_UNSURE };
+
+static bool
+is_php_whitespace (char c)
+{
+	return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\v' || c == '\f';
+}
+
+/*
+ * Model is_numeric_string. If STR starts with a number, put it in RESULT and
+ * set COMPLETE if nothing follows it. Hexadecimal strings and longs which
+ * might overflow are not modelled.
+ */
+static Numeric_kind
+parse_numeric (String* str, Number& result, bool& complete)
+{
+	size_t n = str->size ();
+	size_t i = 0;
+
+	while (i < n && is_php_whitespace ((*str)[i]))
+		i++;
+
+	size_t start = i;
+	if (i < n && ((*str)[i] == '-' || (*str)[i] == '+'))
+		i++;
+
+	if (i + 1 < n && (*str)[i] == '0' && ((*str)[i+1] == 'x' || (*str)[i+1] == 'X'))
+		return NUMERIC_UNSURE;
+
+	size_t int_start = i;
+	while (i < n && isdigit ((*str)[i]))
+		i++;
+
+	size_t int_end = i;
+	bool is_double = false;
+
+	if (i < n && (*str)[i] == '.'
+		&& (int_end > int_start || (i + 1 < n && isdigit ((*str)[i+1]))))
+	{
+		is_double = true;
+		i++;
+		while (i < n && isdigit ((*str)[i]))
+			i++;
+	}
+	else if (int_end == int_start)
+		return NOT_NUMERIC;
+
+	if (i < n && ((*str)[i] == 'e' || (*str)[i] == 'E'))
+	{
+		size_t j = i + 1;
+		if (j < n && ((*str)[j] == '-' || (*str)[j] == '+'))
+			j++;
+
+		if (j < n && isdigit ((*str)[j]))
+		{
+			is_double = true;
+			i = j;
+			while (i < n && isdigit ((*str)[i]))
+				i++;
+		}
+	}
+
+	complete = (i == n);
+	string num = str->substr (start, i - start);
+
+	if (is_double)
+	{
+		result = Number (strtod (num.c_str (), NULL));
+		if (!finite (result.dval))
+			return NUMERIC_UNSURE;
+
+		return NUMERIC;
+	}
+
+	// Leading zeros dont count towards overflow
+	size_t significant = int_start;
+	while (significant < int_end && (*str)[significant] == '0')
+		significant++;
+
+	if (int_end - significant > (size_t) numeric_limits<long>::digits10)
+		return NUMERIC_UNSURE;
+
+	result = Number (strtol (num.c_str (), NULL, 10));
+	return NUMERIC;
+}
+
+/*
+ * Conversions. Each returns false if the result is unknown.
+ */
+
+// zendi_convert_scalar_to_number
+static bool
+to_number (Literal* lit, Number& result)
+{
+	if (isa<NIL> (lit))
+		result = Number (0L);
+	else if (BOOL* b = dynamic_cast<BOOL*> (lit))
+		result = Number ((long) b->value);
+	else if (INT* i = dynamic_cast<INT*> (lit))
+		result = Number (i->value);
+	else if (REAL* r = dynamic_cast<REAL*> (lit))
+		result = Number (r->value);
+	else if (STRING* s = dynamic_cast<STRING*> (lit))
+	{
+		bool complete;
+		switch (parse_numeric (s->value, result, complete))
+		{
+			case NOT_NUMERIC:
+				result = Number (0L);
+				break;
+			case NUMERIC:
+				break;
+			case NUMERIC_UNSURE:
+				return false;
+		}
+	}
+	else
+		return false;
+
+	if (!result.is_long && !finite (result.dval))
+		return false;
+
+	return true;
+}
+
+// zend_dval_to_lval. Out-of-range values differ between versions and
+// platforms.
+static bool
+double_to_long (double d, long& result)
+{
+	if (!finite (d)
+		|| d < (double) numeric_limits<long>::min ()
+		|| d >= -(double) numeric_limits<long>::min ())
+		return false;
+
+	result = (long) d;
+	return true;
+}
+
+// convert_to_long
+static bool
+to_long (Literal* lit, long& result)
+{
+	if (STRING* s = dynamic_cast<STRING*> (lit))
+	{
+		result = strtol (s->value->c_str (), NULL, 10);
+		return true;
+	}
+
+	if (REAL* r = dynamic_cast<REAL*> (lit))
+		return double_to_long (r->value, result);
+
+	Number num;
+	if (!to_number (lit, num))
+		return false;
+
+	assert (num.is_long);
+	result = num.lval;
+	return true;
+}
+
+// convert_to_double
+static bool
+to_double (Literal* lit, double& result)
+{
+	if (STRING* s = dynamic_cast<STRING*> (lit))
+	{
+		// zend_strtod's handling of leading whitespace, INF and NAN is not
+		// modelled.
+		String* str = s->value;
+		size_t i = 0;
+		if (i < str->size () && ((*str)[i] == '-' || (*str)[i] == '+'))
+			i++;
+
+		if (i < str->size () && (is_php_whitespace ((*str)[0]) || isalpha ((*str)[i])))
+			return false;
+	}
+
+	Number num;
+	if (!to_number (lit, num))
+		return false;
+
+	result = num.as_double ();
+	return true;
+}
+
+// PHP uses its own %G, with the "precision" .ini setting. It only agrees with
+// C for non-exponential forms with the default precision.
+static bool
+double_to_string (double d, string& result)
+{
+	if (!finite (d) || (d == 0.0 && signbit (d)))
+		return false;
+
+	if (PHP::altered_ini_entries.has ("precision"))
+		return false;
+
+	char buf[64];
+	snprintf (buf, sizeof (buf), "%.14G", d);
+	if (strchr (buf, 'E'))
+		return false;
+
+	result = buf;
+	return true;
+}
+
+// convert_to_string
+static bool
+to_string (Literal* lit, string& result)
+{
+	if (isa<NIL> (lit))
+		result = "";
+	else if (BOOL* b = dynamic_cast<BOOL*> (lit))
+		result = b->value ? "1" : "";
+	else if (INT* i = dynamic_cast<INT*> (lit))
+	{
+		char buf[64];
+		snprintf (buf, sizeof (buf), "%ld", i->value);
+		result = buf;
+	}
+	else if (REAL* r = dynamic_cast<REAL*> (lit))
+		return double_to_string (r->value, result);
+	else if (STRING* s = dynamic_cast<STRING*> (lit))
+		result = *s->value;
+	else
+		return false;
+
+	return true;
+}
+
+bool
+native_is_true (Literal* lit)
+{
+	if (BOOL* b = dynamic_cast<BOOL*> (lit))
+		return b->value;
+
+	if (INT* i = dynamic_cast<INT*> (lit))
+		return i->value != 0;
+
+	if (REAL* r = dynamic_cast<REAL*> (lit))
+		return r->value != 0.0;
+
+	if (STRING* s = dynamic_cast<STRING*> (lit))
+		return not (*s->value == "" || *s->value == "0");
+
+	assert (isa<NIL> (lit));
+	return false;
+}
+
+static Literal*
+number_to_literal (Number num)
+{
+	if (num.is_long)
+		return new INT (num.lval);
+
+	if (!finite (num.dval))
+		return NULL;
+
+	return new REAL (num.dval);
+}
+
+/*
+ * Arithmetic
+ */
+
+static Literal*
+fold_arithmetic (Literal* left, string op, Literal* right)
+{
+	Number l, r;
+	if (!to_number (left, l) || !to_number (right, r))
+		return NULL;
+
+	if (op == "/")
+	{
+		if (r.as_double () == 0.0)
+			return NULL; // Division by zero warning
+
+		if (l.is_long && r.is_long)
+		{
+			if (l.lval == numeric_limits<long>::min () && r.lval == -1)
+				return NULL;
+
+			if (l.lval % r.lval == 0)
+				return new INT (l.lval / r.lval);
+		}
+
+		return number_to_literal (Number (l.as_double () / r.as_double ()));
+	}
+
+	if (l.is_long && r.is_long)
+	{
+		long a = l.lval;
+		long b = r.lval;
+		long max = numeric_limits<long>::max ();
+		long min = numeric_limits<long>::min ();
+
+		// Overflow gives a double
+		if (op == "+")
+		{
+			if ((b > 0 && a > max - b) || (b < 0 && a < min - b))
+				return number_to_literal (Number ((double) a + (double) b));
+
+			return new INT (a + b);
+		}
+
+		if (op == "-")
+		{
+			if ((b < 0 && a > max + b) || (b > 0 && a < min + b))
+				return number_to_literal (Number ((double) a - (double) b));
+
+			return new INT (a - b);
+		}
+
+		if (op == "*")
+		{
+			double product = (double) a * (double) b;
+			if (product < (double) min || product >= -(double) min)
+				return number_to_literal (Number (product));
+
+			return new INT (a * b);
+		}
+	}
+
+	double a = l.as_double ();
+	double b = r.as_double ();
+
+	if (op == "+")
+		return number_to_literal (Number (a + b));
+
+	if (op == "-")
+		return number_to_literal (Number (a - b));
+
+	if (op == "*")
+		return number_to_literal (Number (a * b));
+
+	return NULL;
+}
+
+static Literal*
+fold_integer_op (Literal* left, string op, Literal* right)
+{
+	// Bitwise operations on two strings work on the characters.
+	STRING* ls = dynamic_cast<STRING*> (left);
+	STRING* rs = dynamic_cast<STRING*> (right);
+	if (ls && rs && (op == "&" || op == "|" || op == "^"))
+	{
+		const string& a = *ls->value;
+		const string& b = *rs->value;
+		string result;
+
+		if (op == "|")
+		{
+			result = a.size () > b.size () ? a : b;
+			const string& shorter = a.size () > b.size () ? b : a;
+			for (size_t i = 0; i < shorter.size (); i++)
+				result[i] = result[i] | shorter[i];
+		}
+		else
+		{
+			size_t length = min (a.size (), b.size ());
+			result = a.substr (0, length);
+			for (size_t i = 0; i < length; i++)
+			{
+				if (op == "&")
+					result[i] = a[i] & b[i];
+				else
+					result[i] = a[i] ^ b[i];
+			}
+		}
+
+		return new STRING (s(result));
+	}
+
+	long a, b;
+	if (!to_long (left, a) || !to_long (right, b))
+		return NULL;
+
+	if (op == "%")
+	{
+		if (b == 0)
+			return NULL; // Division by zero warning
+
+		if (b == -1)
+			return new INT (0L);
+
+		return new INT (a % b);
+	}
+
+	if (op == "&")
+		return new INT (a & b);
+
+	if (op == "|")
+		return new INT (a | b);
+
+	if (op == "^")
+		return new INT (a ^ b);
+
+	// Shifts outside the width of a long are undefined in C, and so in PHP.
+	if (b < 0 || b >= (long) (sizeof (long) * 8))
+		return NULL;
+
+	if (op == "<<")
+		return new INT ((long) ((unsigned long) a << b));
+
+	if (op == ">>")
+		return new INT (a >> b);
+
+	return NULL;
+}
+
+/*
+ * Comparison
+ */
+
+static int
+normalize (double d)
+{
+	return d > 0 ? 1 : (d < 0 ? -1 : 0);
+}
+
+// zend_binary_strcmp
+static int
+binary_strcmp (const string& a, const string& b)
+{
+	int result = memcmp (a.data (), b.data (), min (a.size (), b.size ()));
+	if (result == 0)
+		return normalize ((double) a.size () - (double) b.size ());
+
+	return normalize (result);
+}
+
+static bool
+compare_numbers (Number l, Number r, int& result)
+{
+	if (l.is_long && r.is_long)
+		result = l.lval > r.lval ? 1 : (l.lval < r.lval ? -1 : 0);
+	else
+		result = normalize (l.as_double () - r.as_double ());
+
+	return true;
+}
+
+// compare_function, with RESULT being -1, 0 or 1.
+static bool
+compare (Literal* left, Literal* right, int& result)
+{
+	STRING* ls = dynamic_cast<STRING*> (left);
+	STRING* rs = dynamic_cast<STRING*> (right);
+
+	// zendi_smart_strcmp: compare numerically if both are numeric
+	if (ls && rs)
+	{
+		Number l, r;
+		bool lcomplete = false, rcomplete = false;
+		Numeric_kind lkind = parse_numeric (ls->value, l, lcomplete);
+		Numeric_kind rkind = parse_numeric (rs->value, r, rcomplete);
+
+		if ((lkind == NUMERIC_UNSURE && (rkind != NOT_NUMERIC && rcomplete))
+			|| (rkind == NUMERIC_UNSURE && (lkind != NOT_NUMERIC && lcomplete))
+			|| (lkind == NUMERIC_UNSURE && rkind == NUMERIC_UNSURE))
+			return false;
+
+		if (lkind == NUMERIC && lcomplete && rkind == NUMERIC && rcomplete)
+			return compare_numbers (l, r, result);
+
+		result = binary_strcmp (*ls->value, *rs->value);
+		return true;
+	}
+
+	if (isa<NIL> (left) && rs)
+	{
+		result = binary_strcmp ("", *rs->value);
+		return true;
+	}
+
+	if (ls && isa<NIL> (right))
+	{
+		result = binary_strcmp (*ls->value, "");
+		return true;
+	}
+
+	// NULL and BOOL compare as booleans
+	if (isa<NIL> (left) || isa<BOOL> (left) || isa<NIL> (right) || isa<BOOL> (right))
+	{
+		result = (int) native_is_true (left) - (int) native_is_true (right);
+		return true;
+	}
+
+	Number l, r;
+	if (!to_number (left, l) || !to_number (right, r))
+		return false;
+
+	return compare_numbers (l, r, result);
+}
+
+bool
+native_literals_identical (Literal* a, Literal* b)
+{
+	if (a->classid () != b->classid ())
+		return false;
+
+	if (isa<NIL> (a))
+		return true;
+
+	if (BOOL* ab = dynamic_cast<BOOL*> (a))
+		return ab->value == dyc<BOOL> (b)->value;
+
+	if (INT* ai = dynamic_cast<INT*> (a))
+		return ai->value == dyc<INT> (b)->value;
+
+	if (REAL* ar = dynamic_cast<REAL*> (a))
+	{
+		double bd = dyc<REAL> (b)->value;
+		return ar->value == bd || (isnan (ar->value) && isnan (bd));
+	}
+
+	if (STRING* as = dynamic_cast<STRING*> (a))
+		return *as->value == *dyc<STRING> (b)->value;
+
+	return false;
+}
+
+static Literal*
+fold_comparison (Literal* left, string op, Literal* right)
+{
+	if (op == "===")
+		return new BOOL (native_literals_identical (left, right));
+
+	if (op == "!==")
+		return new BOOL (!native_literals_identical (left, right));
+
+	int result;
+
+	// PHP implements > and >= by swapping the operands.
+	if (op == ">" || op == ">=")
+	{
+		if (!compare (right, left, result))
+			return NULL;
+
+		return new BOOL (op == ">" ? result < 0 : result <= 0);
+	}
+
+	if (!compare (left, right, result))
+		return NULL;
+
+	if (op == "==")
+		return new BOOL (result == 0);
+
+	if (op == "!=" || op == "<>")
+		return new BOOL (result != 0);
+
+	if (op == "<")
+		return new BOOL (result < 0);
+
+	if (op == "<=")
+		return new BOOL (result <= 0);
+
+	return NULL;
+}
+
+/*
+ * Interface
+ */
+
+Literal*
+native_fold_bin_op (Literal* left, string op, Literal* right)
+{
+	if (op == "+" || op == "-" || op == "*" || op == "/")
+		return fold_arithmetic (left, op, right);
+
+	if (op == "%" || op == "&" || op == "|" || op == "^" || op == "<<" || op == ">>")
+		return fold_integer_op (left, op, right);
+
+	if (op == "==" || op == "!=" || op == "<>" || op == "===" || op == "!=="
+		|| op == "<" || op == "<=" || op == ">" || op == ">=")
+		return fold_comparison (left, op, right);
+
+	if (op == ".")
+	{
+		string l, r;
+		if (!to_string (left, l) || !to_string (right, r))
+			return NULL;
+
+		return new STRING (s(l + r));
+	}
+
+	if (op == "xor")
+		return new BOOL (native_is_true (left) != native_is_true (right));
+
+	if (op == "and" || op == "&&")
+		return new BOOL (native_is_true (left) && native_is_true (right));
+
+	if (op == "or" || op == "||")
+		return new BOOL (native_is_true (left) || native_is_true (right));
+
+	return NULL;
+}
+
+Literal*
+native_fold_unary_op (string op, Literal* lit)
+{
+	if (op == "!")
+		return new BOOL (!native_is_true (lit));
+
+	// PHP compiles -X as 0 - X, and +X as 0 + X
+	if (op == "-" || op == "+")
+		return fold_arithmetic (new INT (0L), op, lit);
+
+	if (op == "~")
+	{
+		if (STRING* str = dynamic_cast<STRING*> (lit))
+		{
+			string result = *str->value;
+			for (size_t i = 0; i < result.size (); i++)
+				result[i] = ~result[i];
+
+			return new STRING (s(result));
+		}
+
+		long value;
+		if (INT* i = dynamic_cast<INT*> (lit))
+			return new INT (~i->value);
+
+		// ~ is an error on anything else
+		if (REAL* r = dynamic_cast<REAL*> (lit))
+			if (double_to_long (r->value, value))
+				return new INT (~value);
+	}
+
+	return NULL;
+}
+
+Literal*
+native_fold_pre_op (Literal* lit, string op)
+{
+	// Incrementing strings is not modelled
+	if (op == "++")
+	{
+		if (isa<NIL> (lit))
+			return new INT (1L);
+
+		if (INT* i = dynamic_cast<INT*> (lit))
+			return fold_arithmetic (i, "+", new INT (1L));
+
+		if (REAL* r = dynamic_cast<REAL*> (lit))
+			return number_to_literal (Number (r->value + 1.0));
+	}
+	else if (op == "--")
+	{
+		if (isa<NIL> (lit))
+			return new NIL;
+
+		if (INT* i = dynamic_cast<INT*> (lit))
+			return fold_arithmetic (i, "-", new INT (1L));
+
+		if (REAL* r = dynamic_cast<REAL*> (lit))
+			return number_to_literal (Number (r->value - 1.0));
+	}
+
+	// Booleans are unaffected
+	if (isa<BOOL> (lit))
+		return lit->clone ();
+
+	return NULL;
+}
+
+Literal*
+native_fold_string_index (Literal* array, Literal* index)
+{
+	STRING* str = dynamic_cast<STRING*> (array);
+	INT* i = dynamic_cast<INT*> (index);
+	if (str == NULL || i == NULL)
+		return NULL;
+
+	// Out of range is a notice
+	if (i->value < 0 || i->value >= (long) str->value->size ())
+		return NULL;
+
+	return new STRING (s(str->value->substr (i->value, 1)));
+}
+
+Literal*
+native_cast_to (string type, Literal* lit)
+{
+	if (type == "integer" || type == "int")
+	{
+		long result;
+		if (to_long (lit, result))
+			return new INT (result);
+	}
+	else if (type == "real" || type == "double" || type == "float")
+	{
+		double result;
+		if (to_double (lit, result))
+			return number_to_literal (Number (result));
+	}
+	else if (type == "string" || type == "binary")
+	{
+		string result;
+		if (to_string (lit, result))
+			return new STRING (s(result));
+	}
+	else if (type == "bool" || type == "boolean")
+		return new BOOL (native_is_true (lit));
+	else if (type == "unset")
+		return new NIL;
+
+	return NULL;
+}
@@ -0,0 +1,31 @@
+/*
+ * phc -- the open source PHP compiler
+ * See doc/license/README.license for licensing information
+ *
+ * Constant folding of MIR literals with PHP 5 semantics, without going
+ * through the PHP interpreter.
+ *
+ * Each function returns NULL when it cannot be sure of the answer PHP would
+ * give: when PHP would warn, or the result depends on the platform or .ini
+ * settings. In that case the caller should ask the interpreter.
+ */
+
+#ifndef PHC_EMBED_FOLD_H
+#define PHC_EMBED_FOLD_H
+
+#include <string>
+#include "MIR.h"
+
+MIR::Literal* native_fold_bin_op (MIR::Literal* left, std::string op, MIR::Literal* right);
+MIR::Literal* native_fold_unary_op (std::string op, MIR::Literal* lit);
+MIR::Literal* native_fold_pre_op (MIR::Literal* lit, std::string op);
+MIR::Literal* native_fold_string_index (MIR::Literal* array, MIR::Literal* index);
+MIR::Literal* native_cast_to (std::string type, MIR::Literal* lit);
+
+// PHP's conversion to bool never fails.
+bool native_is_true (MIR::Literal* lit);
+
+// Are A and B the same literal (as in ===, except that NAN is NAN)?
+bool native_literals_identical (MIR::Literal* a, MIR::Literal* b);
+
+#endif // PHC_EMBED_FOLD_H
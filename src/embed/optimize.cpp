@@ -3,34 +3,44 @@
  * See doc/license/README.license for licensing information
  *
  * Optimization through the PHP interpreter.
+ *
+ * Folding is done natively where possible (see fold.cpp). The interpreter
+ * is used for anything the native folder does not model, and, with
+ * --check-folding, to check every natively folded result.
  */
 
 #include "embed.h"
+#include "fold.h"
 #include "util.h"
 #include "lib/String.h"
+#include "lib/error.h"
 #include "process_ir/General.h"
 #include "MIR.h"
 #include "process_mir/MIR_unparser.h"
 #include "optimize/Method_info.h"
 #include "optimize/Class_info.h"
+#include "cmdline.h"
 
 using namespace MIR;
 
+extern struct gengetopt_args_info args_info;
+
+Literal* eval_to_literal (stringstream& code, String* prep = NULL);
+
 #if !HAVE_EMBED
 
 #define FAIL(SIG) SIG { phc_error ("Optimizations require the PHP SAPI"); }
 
-FAIL (Literal* PHP::fold_unary_op (OP*, Literal*))
-FAIL (bool PHP::is_true (Literal*));
-FAIL (Literal* PHP::cast_to (CAST*, Literal*))
-FAIL (String* PHP::get_string_value (Literal* lit))
-FAIL (Literal* PHP::fold_bin_op (Literal* left, OP* op, Literal* right))
-FAIL (Literal* PHP::fold_pre_op (Literal* use, OP* op))
-FAIL (Literal* PHP::fold_constant (Constant* in))
-FAIL (Literal* PHP::fold_string_index (Literal* array, Literal* index))
-
 FAIL (Method_info* PHP::get_method_info (String*))
 FAIL (Literal* PHP::call_function (METHOD_NAME*, Literal_list*))
+FAIL (Literal* PHP::fold_constant (Constant* in))
+
+Literal*
+eval_to_literal (stringstream& code, String* prep)
+{
+	phc_error ("Optimizations require the PHP SAPI");
+	return NULL;
+}
 
 #else // HAVE_EMBED
 
@@ -45,7 +55,7 @@ extern void ***tsrm_ls;
 
 
 Literal*
-eval_to_literal (stringstream& code, String* prep = NULL)
+eval_to_literal (stringstream& code, String* prep)
 {
 	String* code_str = s(code.str());
 
@@ -60,45 +70,88 @@ eval_to_literal (stringstream& code, String* prep = NULL)
 		return NULL;
 }
 
+#endif // HAVE_EMBED
+
+
+/*
+ * Folding
+ */
+
+static bool
+use_native (Literal* native)
+{
+	return native != NULL && not args_info.check_folding_flag;
+}
+
+// NATIVE may be NULL if it wasnt modelled. Otherwise it must agree with the
+// interpreter.
+static Literal*
+check_fold (Literal* native, Literal* interpreted, string expr)
+{
+	if (native && not (interpreted && native_literals_identical (native, interpreted)))
+	{
+		phc_internal_error ("Native folding of '%s' gives %s, but PHP gives %s",
+			expr.c_str (),
+			unparse (native).c_str (),
+			interpreted ? unparse (interpreted).c_str () : "an error");
+	}
+
+	return interpreted;
+}
+
 Literal*
 PHP::fold_unary_op (OP* op, Literal* lit)
 {
+	Literal* result = native_fold_unary_op (*op->value, lit);
+	if (use_native (result))
+		return result;
+
 	stringstream ss;
 	ss << unparse (op) << unparse (lit);
 
-	return eval_to_literal (ss);
+	return check_fold (result, eval_to_literal (ss), ss.str ());
 }
 
 Literal*
 PHP::fold_bin_op (Literal* left, OP* op, Literal* right)
 {
+	Literal* result = native_fold_bin_op (left, *op->value, right);
+	if (use_native (result))
+		return result;
+
 	stringstream ss;
 	ss << unparse (left) << " " << unparse (op) << " " << unparse (right);
 
-	return eval_to_literal (ss);
+	return check_fold (result, eval_to_literal (ss), ss.str ());
 }
 
 Literal*
 PHP::fold_string_index (Literal* array, Literal* index)
 {
+	Literal* result = native_fold_string_index (array, index);
+	if (use_native (result))
+		return result;
+
 	string prep = "$temp = " + unparse (array) + ";";
 
 	stringstream code;
 	code  << "$temp[" << unparse (index) << "];";
 
-	return eval_to_literal (code, s(prep));
+	return check_fold (result, eval_to_literal (code, s(prep)), prep + code.str ());
 }
 
 
 bool
 PHP::is_true (Literal* lit)
 {
+	bool result = native_is_true (lit);
+	if (not args_info.check_folding_flag)
+		return result;
+
 	stringstream ss;
 	ss << "(bool)(" << unparse (lit) << ")";
 
-	Literal* result = eval_to_literal (ss);
-
-	return dyc<BOOL> (result)->value;
+	return dyc<BOOL> (check_fold (new BOOL (result), eval_to_literal (ss), ss.str ()))->value;
 }
 
 String*
@@ -125,15 +178,39 @@ PHP::cast_to (CAST* cast, Literal* lit)
 		|| type == "boolean"
 		|| type == "unset") // NULL
 	{
+		Literal* result = native_cast_to (type, lit);
+		if (use_native (result))
+			return result;
+
 		stringstream ss;
 		ss << "(" << type << ")" << unparse (lit);
 
-		return eval_to_literal (ss);
+		return check_fold (result, eval_to_literal (ss), ss.str ());
 	}
 
 	return NULL;
 }
 
+Literal*
+PHP::fold_pre_op (Literal* use, OP* op)
+{
+	Literal* result = native_fold_pre_op (use, *op->value);
+	if (use_native (result))
+		return result;
+
+	stringstream prep;
+	prep
+	<< "$temp = " << unparse (use) << ";"
+	<< unparse (op) << "$temp;";
+
+	stringstream ss;
+	ss << "$temp";
+
+	return check_fold (result, eval_to_literal (ss, s(prep.str ())), prep.str ());
+}
+
+#if HAVE_EMBED
+
 Literal*
 PHP::call_function (METHOD_NAME* name, Literal_list* params)
 {
@@ -152,20 +229,6 @@ PHP::call_function (METHOD_NAME* name, Literal_list* params)
 	return eval_to_literal (ss);
 }
 
-Literal*
-PHP::fold_pre_op (Literal* use, OP* op)
-{
-	stringstream prep;
-	prep
-	<< "$temp = " << unparse (use) << ";"
-	<< unparse (op) << "$temp;";
-
-	stringstream ss;
-	ss << "$temp";
-
-	return eval_to_literal (ss, s(prep.str ()));
-}
-
 
 Literal*
 PHP::fold_constant (Constant* in)
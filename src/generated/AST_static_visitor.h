@@ -0,0 +1,3572 @@
+#ifndef _AST_STATIC_VISITOR_H_
+#define _AST_STATIC_VISITOR_H_
+
+/* Generated from AST_visitor.h and AST_visitor.cpp by misc/make_static_visitor.pl */
+
+#include <iostream>
+#include <sstream>
+#include <iomanip>
+#include "lib/error.h"
+#include "lib/Object.h"
+#include "lib/List.h"
+#include "lib/String.h"
+#include "lib/Boolean.h"
+#include "lib/Integer.h"
+#include "lib/AttrMap.h"
+#include "process_ir/IR.h"
+#include "process_ir/Foreach.h"
+#include <list>
+#include <string>
+#include <cstring>
+#include <cassert>
+
+
+#include "AST.h"
+
+namespace AST{
+/*
+ * The same as Visitor, but dispatched statically: methods are called on the
+ * Derived class, which hides the methods it wants to replace. Since the
+ * methods are not virtual, a method which hides one overload of a name hides
+ * them all; bring the rest back with a using declaration.
+ */
+template <class Derived>
+class Static_visitor
+{
+public:
+/* Invoked before the children are visited */
+public:
+    void pre_node(Node* in)
+    {
+    }
+
+    void pre_php_script(PHP_script* in)
+    {
+    }
+
+    void pre_statement(Statement* in)
+    {
+    }
+
+    void pre_class_def(Class_def* in)
+    {
+    }
+
+    void pre_class_mod(Class_mod* in)
+    {
+    }
+
+    void pre_interface_def(Interface_def* in)
+    {
+    }
+
+    void pre_member(Member* in)
+    {
+    }
+
+    void pre_method(Method* in)
+    {
+    }
+
+    void pre_signature(Signature* in)
+    {
+    }
+
+    void pre_method_mod(Method_mod* in)
+    {
+    }
+
+    void pre_formal_parameter(Formal_parameter* in)
+    {
+    }
+
+    void pre_type(Type* in)
+    {
+    }
+
+    void pre_attribute(Attribute* in)
+    {
+    }
+
+    void pre_attr_mod(Attr_mod* in)
+    {
+    }
+
+    void pre_name_with_default(Name_with_default* in)
+    {
+    }
+
+    void pre_if(If* in)
+    {
+    }
+
+    void pre_while(While* in)
+    {
+    }
+
+    void pre_do(Do* in)
+    {
+    }
+
+    void pre_for(For* in)
+    {
+    }
+
+    void pre_foreach(Foreach* in)
+    {
+    }
+
+    void pre_switch(Switch* in)
+    {
+    }
+
+    void pre_switch_case(Switch_case* in)
+    {
+    }
+
+    void pre_break(Break* in)
+    {
+    }
+
+    void pre_continue(Continue* in)
+    {
+    }
+
+    void pre_return(Return* in)
+    {
+    }
+
+    void pre_static_declaration(Static_declaration* in)
+    {
+    }
+
+    void pre_global(Global* in)
+    {
+    }
+
+    void pre_declare(Declare* in)
+    {
+    }
+
+    void pre_directive(Directive* in)
+    {
+    }
+
+    void pre_try(Try* in)
+    {
+    }
+
+    void pre_catch(Catch* in)
+    {
+    }
+
+    void pre_throw(Throw* in)
+    {
+    }
+
+    void pre_eval_expr(Eval_expr* in)
+    {
+    }
+
+    void pre_nop(Nop* in)
+    {
+    }
+
+    void pre_expr(Expr* in)
+    {
+    }
+
+    void pre_literal(Literal* in)
+    {
+    }
+
+    void pre_assignment(Assignment* in)
+    {
+    }
+
+    void pre_op_assignment(Op_assignment* in)
+    {
+    }
+
+    void pre_list_assignment(List_assignment* in)
+    {
+    }
+
+    void pre_list_element(List_element* in)
+    {
+    }
+
+    void pre_nested_list_elements(Nested_list_elements* in)
+    {
+    }
+
+    void pre_cast(Cast* in)
+    {
+    }
+
+    void pre_unary_op(Unary_op* in)
+    {
+    }
+
+    void pre_bin_op(Bin_op* in)
+    {
+    }
+
+    void pre_conditional_expr(Conditional_expr* in)
+    {
+    }
+
+    void pre_ignore_errors(Ignore_errors* in)
+    {
+    }
+
+    void pre_constant(Constant* in)
+    {
+    }
+
+    void pre_instanceof(Instanceof* in)
+    {
+    }
+
+    void pre_variable(Variable* in)
+    {
+    }
+
+    void pre_variable_name(Variable_name* in)
+    {
+    }
+
+    void pre_reflection(Reflection* in)
+    {
+    }
+
+    void pre_target(Target* in)
+    {
+    }
+
+    void pre_pre_op(Pre_op* in)
+    {
+    }
+
+    void pre_post_op(Post_op* in)
+    {
+    }
+
+    void pre_array(Array* in)
+    {
+    }
+
+    void pre_array_elem(Array_elem* in)
+    {
+    }
+
+    void pre_method_invocation(Method_invocation* in)
+    {
+    }
+
+    void pre_method_name(Method_name* in)
+    {
+    }
+
+    void pre_actual_parameter(Actual_parameter* in)
+    {
+    }
+
+    void pre_new(New* in)
+    {
+    }
+
+    void pre_class_name(Class_name* in)
+    {
+    }
+
+    void pre_commented_node(Commented_node* in)
+    {
+    }
+
+    void pre_identifier(Identifier* in)
+    {
+    }
+
+    void pre_source_rep(Source_rep* in)
+    {
+    }
+
+    void pre_foreign(FOREIGN* in)
+    {
+    }
+
+    void pre_class_name(CLASS_NAME* in)
+    {
+    }
+
+    void pre_interface_name(INTERFACE_NAME* in)
+    {
+    }
+
+    void pre_method_name(METHOD_NAME* in)
+    {
+    }
+
+    void pre_variable_name(VARIABLE_NAME* in)
+    {
+    }
+
+    void pre_directive_name(DIRECTIVE_NAME* in)
+    {
+    }
+
+    void pre_int(INT* in)
+    {
+    }
+
+    void pre_real(REAL* in)
+    {
+    }
+
+    void pre_string(STRING* in)
+    {
+    }
+
+    void pre_bool(BOOL* in)
+    {
+    }
+
+    void pre_nil(NIL* in)
+    {
+    }
+
+    void pre_op(OP* in)
+    {
+    }
+
+    void pre_cast(CAST* in)
+    {
+    }
+
+    void pre_constant_name(CONSTANT_NAME* in)
+    {
+    }
+
+/* Invoked after the children have been visited */
+public:
+    void post_node(Node* in)
+    {
+    }
+
+    void post_php_script(PHP_script* in)
+    {
+    }
+
+    void post_statement(Statement* in)
+    {
+    }
+
+    void post_class_def(Class_def* in)
+    {
+    }
+
+    void post_class_mod(Class_mod* in)
+    {
+    }
+
+    void post_interface_def(Interface_def* in)
+    {
+    }
+
+    void post_member(Member* in)
+    {
+    }
+
+    void post_method(Method* in)
+    {
+    }
+
+    void post_signature(Signature* in)
+    {
+    }
+
+    void post_method_mod(Method_mod* in)
+    {
+    }
+
+    void post_formal_parameter(Formal_parameter* in)
+    {
+    }
+
+    void post_type(Type* in)
+    {
+    }
+
+    void post_attribute(Attribute* in)
+    {
+    }
+
+    void post_attr_mod(Attr_mod* in)
+    {
+    }
+
+    void post_name_with_default(Name_with_default* in)
+    {
+    }
+
+    void post_if(If* in)
+    {
+    }
+
+    void post_while(While* in)
+    {
+    }
+
+    void post_do(Do* in)
+    {
+    }
+
+    void post_for(For* in)
+    {
+    }
+
+    void post_foreach(Foreach* in)
+    {
+    }
+
+    void post_switch(Switch* in)
+    {
+    }
+
+    void post_switch_case(Switch_case* in)
+    {
+    }
+
+    void post_break(Break* in)
+    {
+    }
+
+    void post_continue(Continue* in)
+    {
+    }
+
+    void post_return(Return* in)
+    {
+    }
+
+    void post_static_declaration(Static_declaration* in)
+    {
+    }
+
+    void post_global(Global* in)
+    {
+    }
+
+    void post_declare(Declare* in)
+    {
+    }
+
+    void post_directive(Directive* in)
+    {
+    }
+
+    void post_try(Try* in)
+    {
+    }
+
+    void post_catch(Catch* in)
+    {
+    }
+
+    void post_throw(Throw* in)
+    {
+    }
+
+    void post_eval_expr(Eval_expr* in)
+    {
+    }
+
+    void post_nop(Nop* in)
+    {
+    }
+
+    void post_expr(Expr* in)
+    {
+    }
+
+    void post_literal(Literal* in)
+    {
+    }
+
+    void post_assignment(Assignment* in)
+    {
+    }
+
+    void post_op_assignment(Op_assignment* in)
+    {
+    }
+
+    void post_list_assignment(List_assignment* in)
+    {
+    }
+
+    void post_list_element(List_element* in)
+    {
+    }
+
+    void post_nested_list_elements(Nested_list_elements* in)
+    {
+    }
+
+    void post_cast(Cast* in)
+    {
+    }
+
+    void post_unary_op(Unary_op* in)
+    {
+    }
+
+    void post_bin_op(Bin_op* in)
+    {
+    }
+
+    void post_conditional_expr(Conditional_expr* in)
+    {
+    }
+
+    void post_ignore_errors(Ignore_errors* in)
+    {
+    }
+
+    void post_constant(Constant* in)
+    {
+    }
+
+    void post_instanceof(Instanceof* in)
+    {
+    }
+
+    void post_variable(Variable* in)
+    {
+    }
+
+    void post_variable_name(Variable_name* in)
+    {
+    }
+
+    void post_reflection(Reflection* in)
+    {
+    }
+
+    void post_target(Target* in)
+    {
+    }
+
+    void post_pre_op(Pre_op* in)
+    {
+    }
+
+    void post_post_op(Post_op* in)
+    {
+    }
+
+    void post_array(Array* in)
+    {
+    }
+
+    void post_array_elem(Array_elem* in)
+    {
+    }
+
+    void post_method_invocation(Method_invocation* in)
+    {
+    }
+
+    void post_method_name(Method_name* in)
+    {
+    }
+
+    void post_actual_parameter(Actual_parameter* in)
+    {
+    }
+
+    void post_new(New* in)
+    {
+    }
+
+    void post_class_name(Class_name* in)
+    {
+    }
+
+    void post_commented_node(Commented_node* in)
+    {
+    }
+
+    void post_identifier(Identifier* in)
+    {
+    }
+
+    void post_source_rep(Source_rep* in)
+    {
+    }
+
+    void post_foreign(FOREIGN* in)
+    {
+    }
+
+    void post_class_name(CLASS_NAME* in)
+    {
+    }
+
+    void post_interface_name(INTERFACE_NAME* in)
+    {
+    }
+
+    void post_method_name(METHOD_NAME* in)
+    {
+    }
+
+    void post_variable_name(VARIABLE_NAME* in)
+    {
+    }
+
+    void post_directive_name(DIRECTIVE_NAME* in)
+    {
+    }
+
+    void post_int(INT* in)
+    {
+    }
+
+    void post_real(REAL* in)
+    {
+    }
+
+    void post_string(STRING* in)
+    {
+    }
+
+    void post_bool(BOOL* in)
+    {
+    }
+
+    void post_nil(NIL* in)
+    {
+    }
+
+    void post_op(OP* in)
+    {
+    }
+
+    void post_cast(CAST* in)
+    {
+    }
+
+    void post_constant_name(CONSTANT_NAME* in)
+    {
+    }
+
+/* Visit the children of a node */
+public:
+    void children_php_script(PHP_script* in)
+    {
+        derived()->visit_statement_list(in->statements);
+    }
+
+    void children_class_def(Class_def* in)
+    {
+        derived()->visit_class_mod(in->class_mod);
+        derived()->visit_class_name(in->class_name);
+        derived()->visit_class_name(in->extends);
+        derived()->visit_interface_name_list(in->implements);
+        derived()->visit_member_list(in->members);
+    }
+
+    void children_class_mod(Class_mod* in)
+    {
+        derived()->visit_marker("is_abstract", in->is_abstract);
+        derived()->visit_marker("is_final", in->is_final);
+    }
+
+    void children_interface_def(Interface_def* in)
+    {
+        derived()->visit_interface_name(in->interface_name);
+        derived()->visit_interface_name_list(in->extends);
+        derived()->visit_member_list(in->members);
+    }
+
+    void children_method(Method* in)
+    {
+        derived()->visit_signature(in->signature);
+        derived()->visit_statement_list(in->statements);
+    }
+
+    void children_signature(Signature* in)
+    {
+        derived()->visit_method_mod(in->method_mod);
+        derived()->visit_marker("is_ref", in->is_ref);
+        derived()->visit_method_name(in->method_name);
+        derived()->visit_formal_parameter_list(in->formal_parameters);
+    }
+
+    void children_method_mod(Method_mod* in)
+    {
+        derived()->visit_marker("is_public", in->is_public);
+        derived()->visit_marker("is_protected", in->is_protected);
+        derived()->visit_marker("is_private", in->is_private);
+        derived()->visit_marker("is_static", in->is_static);
+        derived()->visit_marker("is_abstract", in->is_abstract);
+        derived()->visit_marker("is_final", in->is_final);
+    }
+
+    void children_formal_parameter(Formal_parameter* in)
+    {
+        derived()->visit_type(in->type);
+        derived()->visit_marker("is_ref", in->is_ref);
+        derived()->visit_name_with_default(in->var);
+    }
+
+    void children_type(Type* in)
+    {
+        derived()->visit_class_name(in->class_name);
+    }
+
+    void children_attribute(Attribute* in)
+    {
+        derived()->visit_attr_mod(in->attr_mod);
+        derived()->visit_name_with_default_list(in->vars);
+    }
+
+    void children_attr_mod(Attr_mod* in)
+    {
+        derived()->visit_marker("is_public", in->is_public);
+        derived()->visit_marker("is_protected", in->is_protected);
+        derived()->visit_marker("is_private", in->is_private);
+        derived()->visit_marker("is_static", in->is_static);
+        derived()->visit_marker("is_const", in->is_const);
+    }
+
+    void children_name_with_default(Name_with_default* in)
+    {
+        derived()->visit_variable_name(in->variable_name);
+        derived()->visit_expr(in->expr);
+    }
+
+    void children_if(If* in)
+    {
+        derived()->visit_expr(in->expr);
+        derived()->visit_statement_list(in->iftrue);
+        derived()->visit_statement_list(in->iffalse);
+    }
+
+    void children_while(While* in)
+    {
+        derived()->visit_expr(in->expr);
+        derived()->visit_statement_list(in->statements);
+    }
+
+    void children_do(Do* in)
+    {
+        derived()->visit_statement_list(in->statements);
+        derived()->visit_expr(in->expr);
+    }
+
+    void children_for(For* in)
+    {
+        derived()->visit_expr(in->init);
+        derived()->visit_expr(in->cond);
+        derived()->visit_expr(in->incr);
+        derived()->visit_statement_list(in->statements);
+    }
+
+    void children_foreach(Foreach* in)
+    {
+        derived()->visit_expr(in->expr);
+        derived()->visit_variable(in->key);
+        derived()->visit_marker("is_ref", in->is_ref);
+        derived()->visit_variable(in->val);
+        derived()->visit_statement_list(in->statements);
+    }
+
+    void children_switch(Switch* in)
+    {
+        derived()->visit_expr(in->expr);
+        derived()->visit_switch_case_list(in->switch_cases);
+    }
+
+    void children_switch_case(Switch_case* in)
+    {
+        derived()->visit_expr(in->expr);
+        derived()->visit_statement_list(in->statements);
+    }
+
+    void children_break(Break* in)
+    {
+        derived()->visit_expr(in->expr);
+    }
+
+    void children_continue(Continue* in)
+    {
+        derived()->visit_expr(in->expr);
+    }
+
+    void children_return(Return* in)
+    {
+        derived()->visit_expr(in->expr);
+    }
+
+    void children_static_declaration(Static_declaration* in)
+    {
+        derived()->visit_name_with_default_list(in->vars);
+    }
+
+    void children_global(Global* in)
+    {
+        derived()->visit_variable_name_list(in->variable_names);
+    }
+
+    void children_declare(Declare* in)
+    {
+        derived()->visit_directive_list(in->directives);
+        derived()->visit_statement_list(in->statements);
+    }
+
+    void children_directive(Directive* in)
+    {
+        derived()->visit_directive_name(in->directive_name);
+        derived()->visit_expr(in->expr);
+    }
+
+    void children_try(Try* in)
+    {
+        derived()->visit_statement_list(in->statements);
+        derived()->visit_catch_list(in->catches);
+    }
+
+    void children_catch(Catch* in)
+    {
+        derived()->visit_class_name(in->class_name);
+        derived()->visit_variable_name(in->variable_name);
+        derived()->visit_statement_list(in->statements);
+    }
+
+    void children_throw(Throw* in)
+    {
+        derived()->visit_expr(in->expr);
+    }
+
+    void children_eval_expr(Eval_expr* in)
+    {
+        derived()->visit_expr(in->expr);
+    }
+
+    void children_nop(Nop* in)
+    {
+    }
+
+    void children_assignment(Assignment* in)
+    {
+        derived()->visit_variable(in->variable);
+        derived()->visit_marker("is_ref", in->is_ref);
+        derived()->visit_expr(in->expr);
+    }
+
+    void children_op_assignment(Op_assignment* in)
+    {
+        derived()->visit_variable(in->variable);
+        derived()->visit_op(in->op);
+        derived()->visit_expr(in->expr);
+    }
+
+    void children_list_assignment(List_assignment* in)
+    {
+        derived()->visit_list_element_list(in->list_elements);
+        derived()->visit_expr(in->expr);
+    }
+
+    void children_nested_list_elements(Nested_list_elements* in)
+    {
+        derived()->visit_list_element_list(in->list_elements);
+    }
+
+    void children_cast(Cast* in)
+    {
+        derived()->visit_cast(in->cast);
+        derived()->visit_expr(in->expr);
+    }
+
+    void children_unary_op(Unary_op* in)
+    {
+        derived()->visit_op(in->op);
+        derived()->visit_expr(in->expr);
+    }
+
+    void children_bin_op(Bin_op* in)
+    {
+        derived()->visit_expr(in->left);
+        derived()->visit_op(in->op);
+        derived()->visit_expr(in->right);
+    }
+
+    void children_conditional_expr(Conditional_expr* in)
+    {
+        derived()->visit_expr(in->cond);
+        derived()->visit_expr(in->iftrue);
+        derived()->visit_expr(in->iffalse);
+    }
+
+    void children_ignore_errors(Ignore_errors* in)
+    {
+        derived()->visit_expr(in->expr);
+    }
+
+    void children_constant(Constant* in)
+    {
+        derived()->visit_class_name(in->class_name);
+        derived()->visit_constant_name(in->constant_name);
+    }
+
+    void children_instanceof(Instanceof* in)
+    {
+        derived()->visit_expr(in->expr);
+        derived()->visit_class_name(in->class_name);
+    }
+
+    void children_variable(Variable* in)
+    {
+        derived()->visit_target(in->target);
+        derived()->visit_variable_name(in->variable_name);
+        derived()->visit_expr_list(in->array_indices);
+    }
+
+    void children_reflection(Reflection* in)
+    {
+        derived()->visit_expr(in->expr);
+    }
+
+    void children_pre_op(Pre_op* in)
+    {
+        derived()->visit_op(in->op);
+        derived()->visit_variable(in->variable);
+    }
+
+    void children_post_op(Post_op* in)
+    {
+        derived()->visit_variable(in->variable);
+        derived()->visit_op(in->op);
+    }
+
+    void children_array(Array* in)
+    {
+        derived()->visit_array_elem_list(in->array_elems);
+    }
+
+    void children_array_elem(Array_elem* in)
+    {
+        derived()->visit_expr(in->key);
+        derived()->visit_marker("is_ref", in->is_ref);
+        derived()->visit_expr(in->val);
+    }
+
+    void children_method_invocation(Method_invocation* in)
+    {
+        derived()->visit_target(in->target);
+        derived()->visit_method_name(in->method_name);
+        derived()->visit_actual_parameter_list(in->actual_parameters);
+    }
+
+    void children_actual_parameter(Actual_parameter* in)
+    {
+        derived()->visit_marker("is_ref", in->is_ref);
+        derived()->visit_expr(in->expr);
+    }
+
+    void children_new(New* in)
+    {
+        derived()->visit_class_name(in->class_name);
+        derived()->visit_actual_parameter_list(in->actual_parameters);
+    }
+
+/* Tokens don't have children, so these methods do nothing by default */
+public:
+    void children_foreign(FOREIGN* in)
+    {
+    }
+
+    void children_class_name(CLASS_NAME* in)
+    {
+    }
+
+    void children_interface_name(INTERFACE_NAME* in)
+    {
+    }
+
+    void children_method_name(METHOD_NAME* in)
+    {
+    }
+
+    void children_variable_name(VARIABLE_NAME* in)
+    {
+    }
+
+    void children_directive_name(DIRECTIVE_NAME* in)
+    {
+    }
+
+    void children_int(INT* in)
+    {
+    }
+
+    void children_real(REAL* in)
+    {
+    }
+
+    void children_string(STRING* in)
+    {
+    }
+
+    void children_bool(BOOL* in)
+    {
+    }
+
+    void children_nil(NIL* in)
+    {
+    }
+
+    void children_op(OP* in)
+    {
+    }
+
+    void children_cast(CAST* in)
+    {
+    }
+
+    void children_constant_name(CONSTANT_NAME* in)
+    {
+    }
+
+/* Unparser support */
+public:
+    void visit_marker(char const* name, bool value)
+    {
+    }
+
+    void visit_null(char const* name_space, char const* type_id)
+    {
+    }
+
+    void visit_null_list(char const* name_space, char const* type_id)
+    {
+    }
+
+    void pre_list(char const* name_space, char const* type_id, int size)
+    {
+    }
+
+    void post_list(char const* name_space, char const* type_id, int size)
+    {
+    }
+
+/* Invoke the chain of pre-visit methods along the inheritance hierachy */
+/* Do not override unless you know what you are doing */
+public:
+    void pre_php_script_chain(PHP_script* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_php_script((PHP_script*) in);
+    }
+
+    void pre_class_def_chain(Class_def* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_commented_node((Commented_node*) in);
+        derived()->pre_statement((Statement*) in);
+        derived()->pre_class_def((Class_def*) in);
+    }
+
+    void pre_class_mod_chain(Class_mod* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_class_mod((Class_mod*) in);
+    }
+
+    void pre_interface_def_chain(Interface_def* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_commented_node((Commented_node*) in);
+        derived()->pre_statement((Statement*) in);
+        derived()->pre_interface_def((Interface_def*) in);
+    }
+
+    void pre_method_chain(Method* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_commented_node((Commented_node*) in);
+        derived()->pre_member((Member*) in);
+        derived()->pre_statement((Statement*) in);
+        derived()->pre_method((Method*) in);
+    }
+
+    void pre_signature_chain(Signature* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_signature((Signature*) in);
+    }
+
+    void pre_method_mod_chain(Method_mod* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_method_mod((Method_mod*) in);
+    }
+
+    void pre_formal_parameter_chain(Formal_parameter* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_formal_parameter((Formal_parameter*) in);
+    }
+
+    void pre_type_chain(Type* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_type((Type*) in);
+    }
+
+    void pre_attribute_chain(Attribute* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_commented_node((Commented_node*) in);
+        derived()->pre_member((Member*) in);
+        derived()->pre_attribute((Attribute*) in);
+    }
+
+    void pre_attr_mod_chain(Attr_mod* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_attr_mod((Attr_mod*) in);
+    }
+
+    void pre_name_with_default_chain(Name_with_default* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_name_with_default((Name_with_default*) in);
+    }
+
+    void pre_if_chain(If* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_commented_node((Commented_node*) in);
+        derived()->pre_statement((Statement*) in);
+        derived()->pre_if((If*) in);
+    }
+
+    void pre_while_chain(While* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_commented_node((Commented_node*) in);
+        derived()->pre_statement((Statement*) in);
+        derived()->pre_while((While*) in);
+    }
+
+    void pre_do_chain(Do* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_commented_node((Commented_node*) in);
+        derived()->pre_statement((Statement*) in);
+        derived()->pre_do((Do*) in);
+    }
+
+    void pre_for_chain(For* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_commented_node((Commented_node*) in);
+        derived()->pre_statement((Statement*) in);
+        derived()->pre_for((For*) in);
+    }
+
+    void pre_foreach_chain(Foreach* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_commented_node((Commented_node*) in);
+        derived()->pre_statement((Statement*) in);
+        derived()->pre_foreach((Foreach*) in);
+    }
+
+    void pre_switch_chain(Switch* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_commented_node((Commented_node*) in);
+        derived()->pre_statement((Statement*) in);
+        derived()->pre_switch((Switch*) in);
+    }
+
+    void pre_switch_case_chain(Switch_case* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_commented_node((Commented_node*) in);
+        derived()->pre_switch_case((Switch_case*) in);
+    }
+
+    void pre_break_chain(Break* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_commented_node((Commented_node*) in);
+        derived()->pre_statement((Statement*) in);
+        derived()->pre_break((Break*) in);
+    }
+
+    void pre_continue_chain(Continue* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_commented_node((Commented_node*) in);
+        derived()->pre_statement((Statement*) in);
+        derived()->pre_continue((Continue*) in);
+    }
+
+    void pre_return_chain(Return* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_commented_node((Commented_node*) in);
+        derived()->pre_statement((Statement*) in);
+        derived()->pre_return((Return*) in);
+    }
+
+    void pre_static_declaration_chain(Static_declaration* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_commented_node((Commented_node*) in);
+        derived()->pre_statement((Statement*) in);
+        derived()->pre_static_declaration((Static_declaration*) in);
+    }
+
+    void pre_global_chain(Global* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_commented_node((Commented_node*) in);
+        derived()->pre_statement((Statement*) in);
+        derived()->pre_global((Global*) in);
+    }
+
+    void pre_declare_chain(Declare* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_commented_node((Commented_node*) in);
+        derived()->pre_statement((Statement*) in);
+        derived()->pre_declare((Declare*) in);
+    }
+
+    void pre_directive_chain(Directive* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_directive((Directive*) in);
+    }
+
+    void pre_try_chain(Try* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_commented_node((Commented_node*) in);
+        derived()->pre_statement((Statement*) in);
+        derived()->pre_try((Try*) in);
+    }
+
+    void pre_catch_chain(Catch* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_commented_node((Commented_node*) in);
+        derived()->pre_catch((Catch*) in);
+    }
+
+    void pre_throw_chain(Throw* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_commented_node((Commented_node*) in);
+        derived()->pre_statement((Statement*) in);
+        derived()->pre_throw((Throw*) in);
+    }
+
+    void pre_eval_expr_chain(Eval_expr* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_commented_node((Commented_node*) in);
+        derived()->pre_statement((Statement*) in);
+        derived()->pre_eval_expr((Eval_expr*) in);
+    }
+
+    void pre_nop_chain(Nop* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_commented_node((Commented_node*) in);
+        derived()->pre_statement((Statement*) in);
+        derived()->pre_nop((Nop*) in);
+    }
+
+    void pre_assignment_chain(Assignment* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_target((Target*) in);
+        derived()->pre_expr((Expr*) in);
+        derived()->pre_assignment((Assignment*) in);
+    }
+
+    void pre_op_assignment_chain(Op_assignment* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_target((Target*) in);
+        derived()->pre_expr((Expr*) in);
+        derived()->pre_op_assignment((Op_assignment*) in);
+    }
+
+    void pre_list_assignment_chain(List_assignment* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_target((Target*) in);
+        derived()->pre_expr((Expr*) in);
+        derived()->pre_list_assignment((List_assignment*) in);
+    }
+
+    void pre_nested_list_elements_chain(Nested_list_elements* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_list_element((List_element*) in);
+        derived()->pre_nested_list_elements((Nested_list_elements*) in);
+    }
+
+    void pre_cast_chain(Cast* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_target((Target*) in);
+        derived()->pre_expr((Expr*) in);
+        derived()->pre_cast((Cast*) in);
+    }
+
+    void pre_unary_op_chain(Unary_op* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_target((Target*) in);
+        derived()->pre_expr((Expr*) in);
+        derived()->pre_unary_op((Unary_op*) in);
+    }
+
+    void pre_bin_op_chain(Bin_op* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_target((Target*) in);
+        derived()->pre_expr((Expr*) in);
+        derived()->pre_bin_op((Bin_op*) in);
+    }
+
+    void pre_conditional_expr_chain(Conditional_expr* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_target((Target*) in);
+        derived()->pre_expr((Expr*) in);
+        derived()->pre_conditional_expr((Conditional_expr*) in);
+    }
+
+    void pre_ignore_errors_chain(Ignore_errors* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_target((Target*) in);
+        derived()->pre_expr((Expr*) in);
+        derived()->pre_ignore_errors((Ignore_errors*) in);
+    }
+
+    void pre_constant_chain(Constant* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_target((Target*) in);
+        derived()->pre_expr((Expr*) in);
+        derived()->pre_constant((Constant*) in);
+    }
+
+    void pre_instanceof_chain(Instanceof* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_target((Target*) in);
+        derived()->pre_expr((Expr*) in);
+        derived()->pre_instanceof((Instanceof*) in);
+    }
+
+    void pre_variable_chain(Variable* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_list_element((List_element*) in);
+        derived()->pre_target((Target*) in);
+        derived()->pre_expr((Expr*) in);
+        derived()->pre_variable((Variable*) in);
+    }
+
+    void pre_reflection_chain(Reflection* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_variable_name((Variable_name*) in);
+        derived()->pre_method_name((Method_name*) in);
+        derived()->pre_class_name((Class_name*) in);
+        derived()->pre_reflection((Reflection*) in);
+    }
+
+    void pre_pre_op_chain(Pre_op* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_target((Target*) in);
+        derived()->pre_expr((Expr*) in);
+        derived()->pre_pre_op((Pre_op*) in);
+    }
+
+    void pre_post_op_chain(Post_op* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_target((Target*) in);
+        derived()->pre_expr((Expr*) in);
+        derived()->pre_post_op((Post_op*) in);
+    }
+
+    void pre_array_chain(Array* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_target((Target*) in);
+        derived()->pre_expr((Expr*) in);
+        derived()->pre_array((Array*) in);
+    }
+
+    void pre_array_elem_chain(Array_elem* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_array_elem((Array_elem*) in);
+    }
+
+    void pre_method_invocation_chain(Method_invocation* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_target((Target*) in);
+        derived()->pre_expr((Expr*) in);
+        derived()->pre_method_invocation((Method_invocation*) in);
+    }
+
+    void pre_actual_parameter_chain(Actual_parameter* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_actual_parameter((Actual_parameter*) in);
+    }
+
+    void pre_new_chain(New* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_target((Target*) in);
+        derived()->pre_expr((Expr*) in);
+        derived()->pre_new((New*) in);
+    }
+
+    void pre_foreign_chain(FOREIGN* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_target((Target*) in);
+        derived()->pre_expr((Expr*) in);
+        derived()->pre_commented_node((Commented_node*) in);
+        derived()->pre_statement((Statement*) in);
+        derived()->pre_foreign((FOREIGN*) in);
+    }
+
+    void pre_class_name_chain(CLASS_NAME* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_target((Target*) in);
+        derived()->pre_class_name((Class_name*) in);
+        derived()->pre_source_rep((Source_rep*) in);
+        derived()->pre_identifier((Identifier*) in);
+        derived()->pre_class_name((CLASS_NAME*) in);
+    }
+
+    void pre_interface_name_chain(INTERFACE_NAME* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_source_rep((Source_rep*) in);
+        derived()->pre_identifier((Identifier*) in);
+        derived()->pre_interface_name((INTERFACE_NAME*) in);
+    }
+
+    void pre_method_name_chain(METHOD_NAME* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_method_name((Method_name*) in);
+        derived()->pre_source_rep((Source_rep*) in);
+        derived()->pre_identifier((Identifier*) in);
+        derived()->pre_method_name((METHOD_NAME*) in);
+    }
+
+    void pre_variable_name_chain(VARIABLE_NAME* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_variable_name((Variable_name*) in);
+        derived()->pre_source_rep((Source_rep*) in);
+        derived()->pre_identifier((Identifier*) in);
+        derived()->pre_variable_name((VARIABLE_NAME*) in);
+    }
+
+    void pre_directive_name_chain(DIRECTIVE_NAME* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_source_rep((Source_rep*) in);
+        derived()->pre_identifier((Identifier*) in);
+        derived()->pre_directive_name((DIRECTIVE_NAME*) in);
+    }
+
+    void pre_int_chain(INT* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_target((Target*) in);
+        derived()->pre_expr((Expr*) in);
+        derived()->pre_source_rep((Source_rep*) in);
+        derived()->pre_literal((Literal*) in);
+        derived()->pre_int((INT*) in);
+    }
+
+    void pre_real_chain(REAL* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_target((Target*) in);
+        derived()->pre_expr((Expr*) in);
+        derived()->pre_source_rep((Source_rep*) in);
+        derived()->pre_literal((Literal*) in);
+        derived()->pre_real((REAL*) in);
+    }
+
+    void pre_string_chain(STRING* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_target((Target*) in);
+        derived()->pre_expr((Expr*) in);
+        derived()->pre_source_rep((Source_rep*) in);
+        derived()->pre_literal((Literal*) in);
+        derived()->pre_string((STRING*) in);
+    }
+
+    void pre_bool_chain(BOOL* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_target((Target*) in);
+        derived()->pre_expr((Expr*) in);
+        derived()->pre_source_rep((Source_rep*) in);
+        derived()->pre_literal((Literal*) in);
+        derived()->pre_bool((BOOL*) in);
+    }
+
+    void pre_nil_chain(NIL* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_target((Target*) in);
+        derived()->pre_expr((Expr*) in);
+        derived()->pre_source_rep((Source_rep*) in);
+        derived()->pre_literal((Literal*) in);
+        derived()->pre_nil((NIL*) in);
+    }
+
+    void pre_op_chain(OP* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_source_rep((Source_rep*) in);
+        derived()->pre_identifier((Identifier*) in);
+        derived()->pre_op((OP*) in);
+    }
+
+    void pre_cast_chain(CAST* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_source_rep((Source_rep*) in);
+        derived()->pre_identifier((Identifier*) in);
+        derived()->pre_cast((CAST*) in);
+    }
+
+    void pre_constant_name_chain(CONSTANT_NAME* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_source_rep((Source_rep*) in);
+        derived()->pre_identifier((Identifier*) in);
+        derived()->pre_constant_name((CONSTANT_NAME*) in);
+    }
+
+/* Invoke the chain of post-visit methods along the inheritance hierarchy */
+/* (invoked in opposite order to the pre-chain) */
+/* Do not override unless you know what you are doing */
+public:
+    void post_php_script_chain(PHP_script* in)
+    {
+        derived()->post_php_script((PHP_script*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_class_def_chain(Class_def* in)
+    {
+        derived()->post_class_def((Class_def*) in);
+        derived()->post_statement((Statement*) in);
+        derived()->post_commented_node((Commented_node*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_class_mod_chain(Class_mod* in)
+    {
+        derived()->post_class_mod((Class_mod*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_interface_def_chain(Interface_def* in)
+    {
+        derived()->post_interface_def((Interface_def*) in);
+        derived()->post_statement((Statement*) in);
+        derived()->post_commented_node((Commented_node*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_method_chain(Method* in)
+    {
+        derived()->post_method((Method*) in);
+        derived()->post_statement((Statement*) in);
+        derived()->post_member((Member*) in);
+        derived()->post_commented_node((Commented_node*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_signature_chain(Signature* in)
+    {
+        derived()->post_signature((Signature*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_method_mod_chain(Method_mod* in)
+    {
+        derived()->post_method_mod((Method_mod*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_formal_parameter_chain(Formal_parameter* in)
+    {
+        derived()->post_formal_parameter((Formal_parameter*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_type_chain(Type* in)
+    {
+        derived()->post_type((Type*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_attribute_chain(Attribute* in)
+    {
+        derived()->post_attribute((Attribute*) in);
+        derived()->post_member((Member*) in);
+        derived()->post_commented_node((Commented_node*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_attr_mod_chain(Attr_mod* in)
+    {
+        derived()->post_attr_mod((Attr_mod*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_name_with_default_chain(Name_with_default* in)
+    {
+        derived()->post_name_with_default((Name_with_default*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_if_chain(If* in)
+    {
+        derived()->post_if((If*) in);
+        derived()->post_statement((Statement*) in);
+        derived()->post_commented_node((Commented_node*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_while_chain(While* in)
+    {
+        derived()->post_while((While*) in);
+        derived()->post_statement((Statement*) in);
+        derived()->post_commented_node((Commented_node*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_do_chain(Do* in)
+    {
+        derived()->post_do((Do*) in);
+        derived()->post_statement((Statement*) in);
+        derived()->post_commented_node((Commented_node*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_for_chain(For* in)
+    {
+        derived()->post_for((For*) in);
+        derived()->post_statement((Statement*) in);
+        derived()->post_commented_node((Commented_node*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_foreach_chain(Foreach* in)
+    {
+        derived()->post_foreach((Foreach*) in);
+        derived()->post_statement((Statement*) in);
+        derived()->post_commented_node((Commented_node*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_switch_chain(Switch* in)
+    {
+        derived()->post_switch((Switch*) in);
+        derived()->post_statement((Statement*) in);
+        derived()->post_commented_node((Commented_node*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_switch_case_chain(Switch_case* in)
+    {
+        derived()->post_switch_case((Switch_case*) in);
+        derived()->post_commented_node((Commented_node*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_break_chain(Break* in)
+    {
+        derived()->post_break((Break*) in);
+        derived()->post_statement((Statement*) in);
+        derived()->post_commented_node((Commented_node*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_continue_chain(Continue* in)
+    {
+        derived()->post_continue((Continue*) in);
+        derived()->post_statement((Statement*) in);
+        derived()->post_commented_node((Commented_node*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_return_chain(Return* in)
+    {
+        derived()->post_return((Return*) in);
+        derived()->post_statement((Statement*) in);
+        derived()->post_commented_node((Commented_node*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_static_declaration_chain(Static_declaration* in)
+    {
+        derived()->post_static_declaration((Static_declaration*) in);
+        derived()->post_statement((Statement*) in);
+        derived()->post_commented_node((Commented_node*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_global_chain(Global* in)
+    {
+        derived()->post_global((Global*) in);
+        derived()->post_statement((Statement*) in);
+        derived()->post_commented_node((Commented_node*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_declare_chain(Declare* in)
+    {
+        derived()->post_declare((Declare*) in);
+        derived()->post_statement((Statement*) in);
+        derived()->post_commented_node((Commented_node*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_directive_chain(Directive* in)
+    {
+        derived()->post_directive((Directive*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_try_chain(Try* in)
+    {
+        derived()->post_try((Try*) in);
+        derived()->post_statement((Statement*) in);
+        derived()->post_commented_node((Commented_node*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_catch_chain(Catch* in)
+    {
+        derived()->post_catch((Catch*) in);
+        derived()->post_commented_node((Commented_node*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_throw_chain(Throw* in)
+    {
+        derived()->post_throw((Throw*) in);
+        derived()->post_statement((Statement*) in);
+        derived()->post_commented_node((Commented_node*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_eval_expr_chain(Eval_expr* in)
+    {
+        derived()->post_eval_expr((Eval_expr*) in);
+        derived()->post_statement((Statement*) in);
+        derived()->post_commented_node((Commented_node*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_nop_chain(Nop* in)
+    {
+        derived()->post_nop((Nop*) in);
+        derived()->post_statement((Statement*) in);
+        derived()->post_commented_node((Commented_node*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_assignment_chain(Assignment* in)
+    {
+        derived()->post_assignment((Assignment*) in);
+        derived()->post_expr((Expr*) in);
+        derived()->post_target((Target*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_op_assignment_chain(Op_assignment* in)
+    {
+        derived()->post_op_assignment((Op_assignment*) in);
+        derived()->post_expr((Expr*) in);
+        derived()->post_target((Target*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_list_assignment_chain(List_assignment* in)
+    {
+        derived()->post_list_assignment((List_assignment*) in);
+        derived()->post_expr((Expr*) in);
+        derived()->post_target((Target*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_nested_list_elements_chain(Nested_list_elements* in)
+    {
+        derived()->post_nested_list_elements((Nested_list_elements*) in);
+        derived()->post_list_element((List_element*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_cast_chain(Cast* in)
+    {
+        derived()->post_cast((Cast*) in);
+        derived()->post_expr((Expr*) in);
+        derived()->post_target((Target*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_unary_op_chain(Unary_op* in)
+    {
+        derived()->post_unary_op((Unary_op*) in);
+        derived()->post_expr((Expr*) in);
+        derived()->post_target((Target*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_bin_op_chain(Bin_op* in)
+    {
+        derived()->post_bin_op((Bin_op*) in);
+        derived()->post_expr((Expr*) in);
+        derived()->post_target((Target*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_conditional_expr_chain(Conditional_expr* in)
+    {
+        derived()->post_conditional_expr((Conditional_expr*) in);
+        derived()->post_expr((Expr*) in);
+        derived()->post_target((Target*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_ignore_errors_chain(Ignore_errors* in)
+    {
+        derived()->post_ignore_errors((Ignore_errors*) in);
+        derived()->post_expr((Expr*) in);
+        derived()->post_target((Target*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_constant_chain(Constant* in)
+    {
+        derived()->post_constant((Constant*) in);
+        derived()->post_expr((Expr*) in);
+        derived()->post_target((Target*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_instanceof_chain(Instanceof* in)
+    {
+        derived()->post_instanceof((Instanceof*) in);
+        derived()->post_expr((Expr*) in);
+        derived()->post_target((Target*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_variable_chain(Variable* in)
+    {
+        derived()->post_variable((Variable*) in);
+        derived()->post_expr((Expr*) in);
+        derived()->post_target((Target*) in);
+        derived()->post_list_element((List_element*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_reflection_chain(Reflection* in)
+    {
+        derived()->post_reflection((Reflection*) in);
+        derived()->post_class_name((Class_name*) in);
+        derived()->post_method_name((Method_name*) in);
+        derived()->post_variable_name((Variable_name*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_pre_op_chain(Pre_op* in)
+    {
+        derived()->post_pre_op((Pre_op*) in);
+        derived()->post_expr((Expr*) in);
+        derived()->post_target((Target*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_post_op_chain(Post_op* in)
+    {
+        derived()->post_post_op((Post_op*) in);
+        derived()->post_expr((Expr*) in);
+        derived()->post_target((Target*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_array_chain(Array* in)
+    {
+        derived()->post_array((Array*) in);
+        derived()->post_expr((Expr*) in);
+        derived()->post_target((Target*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_array_elem_chain(Array_elem* in)
+    {
+        derived()->post_array_elem((Array_elem*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_method_invocation_chain(Method_invocation* in)
+    {
+        derived()->post_method_invocation((Method_invocation*) in);
+        derived()->post_expr((Expr*) in);
+        derived()->post_target((Target*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_actual_parameter_chain(Actual_parameter* in)
+    {
+        derived()->post_actual_parameter((Actual_parameter*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_new_chain(New* in)
+    {
+        derived()->post_new((New*) in);
+        derived()->post_expr((Expr*) in);
+        derived()->post_target((Target*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_foreign_chain(FOREIGN* in)
+    {
+        derived()->post_foreign((FOREIGN*) in);
+        derived()->post_statement((Statement*) in);
+        derived()->post_commented_node((Commented_node*) in);
+        derived()->post_expr((Expr*) in);
+        derived()->post_target((Target*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_class_name_chain(CLASS_NAME* in)
+    {
+        derived()->post_class_name((CLASS_NAME*) in);
+        derived()->post_identifier((Identifier*) in);
+        derived()->post_source_rep((Source_rep*) in);
+        derived()->post_class_name((Class_name*) in);
+        derived()->post_target((Target*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_interface_name_chain(INTERFACE_NAME* in)
+    {
+        derived()->post_interface_name((INTERFACE_NAME*) in);
+        derived()->post_identifier((Identifier*) in);
+        derived()->post_source_rep((Source_rep*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_method_name_chain(METHOD_NAME* in)
+    {
+        derived()->post_method_name((METHOD_NAME*) in);
+        derived()->post_identifier((Identifier*) in);
+        derived()->post_source_rep((Source_rep*) in);
+        derived()->post_method_name((Method_name*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_variable_name_chain(VARIABLE_NAME* in)
+    {
+        derived()->post_variable_name((VARIABLE_NAME*) in);
+        derived()->post_identifier((Identifier*) in);
+        derived()->post_source_rep((Source_rep*) in);
+        derived()->post_variable_name((Variable_name*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_directive_name_chain(DIRECTIVE_NAME* in)
+    {
+        derived()->post_directive_name((DIRECTIVE_NAME*) in);
+        derived()->post_identifier((Identifier*) in);
+        derived()->post_source_rep((Source_rep*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_int_chain(INT* in)
+    {
+        derived()->post_int((INT*) in);
+        derived()->post_literal((Literal*) in);
+        derived()->post_source_rep((Source_rep*) in);
+        derived()->post_expr((Expr*) in);
+        derived()->post_target((Target*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_real_chain(REAL* in)
+    {
+        derived()->post_real((REAL*) in);
+        derived()->post_literal((Literal*) in);
+        derived()->post_source_rep((Source_rep*) in);
+        derived()->post_expr((Expr*) in);
+        derived()->post_target((Target*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_string_chain(STRING* in)
+    {
+        derived()->post_string((STRING*) in);
+        derived()->post_literal((Literal*) in);
+        derived()->post_source_rep((Source_rep*) in);
+        derived()->post_expr((Expr*) in);
+        derived()->post_target((Target*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_bool_chain(BOOL* in)
+    {
+        derived()->post_bool((BOOL*) in);
+        derived()->post_literal((Literal*) in);
+        derived()->post_source_rep((Source_rep*) in);
+        derived()->post_expr((Expr*) in);
+        derived()->post_target((Target*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_nil_chain(NIL* in)
+    {
+        derived()->post_nil((NIL*) in);
+        derived()->post_literal((Literal*) in);
+        derived()->post_source_rep((Source_rep*) in);
+        derived()->post_expr((Expr*) in);
+        derived()->post_target((Target*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_op_chain(OP* in)
+    {
+        derived()->post_op((OP*) in);
+        derived()->post_identifier((Identifier*) in);
+        derived()->post_source_rep((Source_rep*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_cast_chain(CAST* in)
+    {
+        derived()->post_cast((CAST*) in);
+        derived()->post_identifier((Identifier*) in);
+        derived()->post_source_rep((Source_rep*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_constant_name_chain(CONSTANT_NAME* in)
+    {
+        derived()->post_constant_name((CONSTANT_NAME*) in);
+        derived()->post_identifier((Identifier*) in);
+        derived()->post_source_rep((Source_rep*) in);
+        derived()->post_node((Node*) in);
+    }
+
+/* Call the pre-chain, visit children and post-chain in order */
+/* Do not override unless you know what you are doing */
+public:
+    void visit_statement_list(Statement_list* in)
+    {
+        Statement_list::const_iterator i;
+    
+        if(in == NULL)
+        	derived()->visit_null_list("AST", "Statement");
+        else
+        {
+        	derived()->pre_list("AST", "Statement", in->size());
+    
+        	for(i = in->begin(); i != in->end(); i++)
+        	{
+        		derived()->visit_statement(*i);
+        	}
+    
+        	derived()->post_list("AST", "Statement", in->size());
+        }
+    }
+
+    void visit_statement(Statement* in)
+    {
+        if(in == NULL)
+        	derived()->visit_null("AST", "Statement");
+        else
+        {
+        	derived()->pre_statement_chain(in);
+        	derived()->children_statement(in);
+        	derived()->post_statement_chain(in);
+        }
+    }
+
+    void visit_class_mod(Class_mod* in)
+    {
+        if(in == NULL)
+        	derived()->visit_null("AST", "Class_mod");
+        else
+        {
+        	derived()->pre_class_mod_chain(in);
+        	derived()->children_class_mod(in);
+        	derived()->post_class_mod_chain(in);
+        }
+    }
+
+    void visit_class_name(CLASS_NAME* in)
+    {
+        if(in == NULL)
+        	derived()->visit_null("AST", "CLASS_NAME");
+        else
+        {
+        	derived()->pre_class_name_chain(in);
+        	derived()->children_class_name(in);
+        	derived()->post_class_name_chain(in);
+        }
+    }
+
+    void visit_interface_name_list(INTERFACE_NAME_list* in)
+    {
+        INTERFACE_NAME_list::const_iterator i;
+    
+        if(in == NULL)
+        	derived()->visit_null_list("AST", "INTERFACE_NAME");
+        else
+        {
+        	derived()->pre_list("AST", "INTERFACE_NAME", in->size());
+    
+        	for(i = in->begin(); i != in->end(); i++)
+        	{
+        		derived()->visit_interface_name(*i);
+        	}
+    
+        	derived()->post_list("AST", "INTERFACE_NAME", in->size());
+        }
+    }
+
+    void visit_member_list(Member_list* in)
+    {
+        Member_list::const_iterator i;
+    
+        if(in == NULL)
+        	derived()->visit_null_list("AST", "Member");
+        else
+        {
+        	derived()->pre_list("AST", "Member", in->size());
+    
+        	for(i = in->begin(); i != in->end(); i++)
+        	{
+        		derived()->visit_member(*i);
+        	}
+    
+        	derived()->post_list("AST", "Member", in->size());
+        }
+    }
+
+    void visit_member(Member* in)
+    {
+        if(in == NULL)
+        	derived()->visit_null("AST", "Member");
+        else
+        {
+        	derived()->pre_member_chain(in);
+        	derived()->children_member(in);
+        	derived()->post_member_chain(in);
+        }
+    }
+
+    void visit_interface_name(INTERFACE_NAME* in)
+    {
+        if(in == NULL)
+        	derived()->visit_null("AST", "INTERFACE_NAME");
+        else
+        {
+        	derived()->pre_interface_name_chain(in);
+        	derived()->children_interface_name(in);
+        	derived()->post_interface_name_chain(in);
+        }
+    }
+
+    void visit_signature(Signature* in)
+    {
+        if(in == NULL)
+        	derived()->visit_null("AST", "Signature");
+        else
+        {
+        	derived()->pre_signature_chain(in);
+        	derived()->children_signature(in);
+        	derived()->post_signature_chain(in);
+        }
+    }
+
+    void visit_method_mod(Method_mod* in)
+    {
+        if(in == NULL)
+        	derived()->visit_null("AST", "Method_mod");
+        else
+        {
+        	derived()->pre_method_mod_chain(in);
+        	derived()->children_method_mod(in);
+        	derived()->post_method_mod_chain(in);
+        }
+    }
+
+    void visit_method_name(METHOD_NAME* in)
+    {
+        if(in == NULL)
+        	derived()->visit_null("AST", "METHOD_NAME");
+        else
+        {
+        	derived()->pre_method_name_chain(in);
+        	derived()->children_method_name(in);
+        	derived()->post_method_name_chain(in);
+        }
+    }
+
+    void visit_formal_parameter_list(Formal_parameter_list* in)
+    {
+        Formal_parameter_list::const_iterator i;
+    
+        if(in == NULL)
+        	derived()->visit_null_list("AST", "Formal_parameter");
+        else
+        {
+        	derived()->pre_list("AST", "Formal_parameter", in->size());
+    
+        	for(i = in->begin(); i != in->end(); i++)
+        	{
+        		derived()->visit_formal_parameter(*i);
+        	}
+    
+        	derived()->post_list("AST", "Formal_parameter", in->size());
+        }
+    }
+
+    void visit_formal_parameter(Formal_parameter* in)
+    {
+        if(in == NULL)
+        	derived()->visit_null("AST", "Formal_parameter");
+        else
+        {
+        	derived()->pre_formal_parameter_chain(in);
+        	derived()->children_formal_parameter(in);
+        	derived()->post_formal_parameter_chain(in);
+        }
+    }
+
+    void visit_type(Type* in)
+    {
+        if(in == NULL)
+        	derived()->visit_null("AST", "Type");
+        else
+        {
+        	derived()->pre_type_chain(in);
+        	derived()->children_type(in);
+        	derived()->post_type_chain(in);
+        }
+    }
+
+    void visit_name_with_default(Name_with_default* in)
+    {
+        if(in == NULL)
+        	derived()->visit_null("AST", "Name_with_default");
+        else
+        {
+        	derived()->pre_name_with_default_chain(in);
+        	derived()->children_name_with_default(in);
+        	derived()->post_name_with_default_chain(in);
+        }
+    }
+
+    void visit_attr_mod(Attr_mod* in)
+    {
+        if(in == NULL)
+        	derived()->visit_null("AST", "Attr_mod");
+        else
+        {
+        	derived()->pre_attr_mod_chain(in);
+        	derived()->children_attr_mod(in);
+        	derived()->post_attr_mod_chain(in);
+        }
+    }
+
+    void visit_name_with_default_list(Name_with_default_list* in)
+    {
+        Name_with_default_list::const_iterator i;
+    
+        if(in == NULL)
+        	derived()->visit_null_list("AST", "Name_with_default");
+        else
+        {
+        	derived()->pre_list("AST", "Name_with_default", in->size());
+    
+        	for(i = in->begin(); i != in->end(); i++)
+        	{
+        		derived()->visit_name_with_default(*i);
+        	}
+    
+        	derived()->post_list("AST", "Name_with_default", in->size());
+        }
+    }
+
+    void visit_variable_name(VARIABLE_NAME* in)
+    {
+        if(in == NULL)
+        	derived()->visit_null("AST", "VARIABLE_NAME");
+        else
+        {
+        	derived()->pre_variable_name_chain(in);
+        	derived()->children_variable_name(in);
+        	derived()->post_variable_name_chain(in);
+        }
+    }
+
+    void visit_expr(Expr* in)
+    {
+        if(in == NULL)
+        	derived()->visit_null("AST", "Expr");
+        else
+        {
+        	derived()->pre_expr_chain(in);
+        	derived()->children_expr(in);
+        	derived()->post_expr_chain(in);
+        }
+    }
+
+    void visit_variable(Variable* in)
+    {
+        if(in == NULL)
+        	derived()->visit_null("AST", "Variable");
+        else
+        {
+        	derived()->pre_variable_chain(in);
+        	derived()->children_variable(in);
+        	derived()->post_variable_chain(in);
+        }
+    }
+
+    void visit_switch_case_list(Switch_case_list* in)
+    {
+        Switch_case_list::const_iterator i;
+    
+        if(in == NULL)
+        	derived()->visit_null_list("AST", "Switch_case");
+        else
+        {
+        	derived()->pre_list("AST", "Switch_case", in->size());
+    
+        	for(i = in->begin(); i != in->end(); i++)
+        	{
+        		derived()->visit_switch_case(*i);
+        	}
+    
+        	derived()->post_list("AST", "Switch_case", in->size());
+        }
+    }
+
+    void visit_switch_case(Switch_case* in)
+    {
+        if(in == NULL)
+        	derived()->visit_null("AST", "Switch_case");
+        else
+        {
+        	derived()->pre_switch_case_chain(in);
+        	derived()->children_switch_case(in);
+        	derived()->post_switch_case_chain(in);
+        }
+    }
+
+    void visit_variable_name_list(Variable_name_list* in)
+    {
+        Variable_name_list::const_iterator i;
+    
+        if(in == NULL)
+        	derived()->visit_null_list("AST", "Variable_name");
+        else
+        {
+        	derived()->pre_list("AST", "Variable_name", in->size());
+    
+        	for(i = in->begin(); i != in->end(); i++)
+        	{
+        		derived()->visit_variable_name(*i);
+        	}
+    
+        	derived()->post_list("AST", "Variable_name", in->size());
+        }
+    }
+
+    void visit_directive_list(Directive_list* in)
+    {
+        Directive_list::const_iterator i;
+    
+        if(in == NULL)
+        	derived()->visit_null_list("AST", "Directive");
+        else
+        {
+        	derived()->pre_list("AST", "Directive", in->size());
+    
+        	for(i = in->begin(); i != in->end(); i++)
+        	{
+        		derived()->visit_directive(*i);
+        	}
+    
+        	derived()->post_list("AST", "Directive", in->size());
+        }
+    }
+
+    void visit_directive(Directive* in)
+    {
+        if(in == NULL)
+        	derived()->visit_null("AST", "Directive");
+        else
+        {
+        	derived()->pre_directive_chain(in);
+        	derived()->children_directive(in);
+        	derived()->post_directive_chain(in);
+        }
+    }
+
+    void visit_directive_name(DIRECTIVE_NAME* in)
+    {
+        if(in == NULL)
+        	derived()->visit_null("AST", "DIRECTIVE_NAME");
+        else
+        {
+        	derived()->pre_directive_name_chain(in);
+        	derived()->children_directive_name(in);
+        	derived()->post_directive_name_chain(in);
+        }
+    }
+
+    void visit_catch_list(Catch_list* in)
+    {
+        Catch_list::const_iterator i;
+    
+        if(in == NULL)
+        	derived()->visit_null_list("AST", "Catch");
+        else
+        {
+        	derived()->pre_list("AST", "Catch", in->size());
+    
+        	for(i = in->begin(); i != in->end(); i++)
+        	{
+        		derived()->visit_catch(*i);
+        	}
+    
+        	derived()->post_list("AST", "Catch", in->size());
+        }
+    }
+
+    void visit_catch(Catch* in)
+    {
+        if(in == NULL)
+        	derived()->visit_null("AST", "Catch");
+        else
+        {
+        	derived()->pre_catch_chain(in);
+        	derived()->children_catch(in);
+        	derived()->post_catch_chain(in);
+        }
+    }
+
+    void visit_op(OP* in)
+    {
+        if(in == NULL)
+        	derived()->visit_null("AST", "OP");
+        else
+        {
+        	derived()->pre_op_chain(in);
+        	derived()->children_op(in);
+        	derived()->post_op_chain(in);
+        }
+    }
+
+    void visit_list_element_list(List_element_list* in)
+    {
+        List_element_list::const_iterator i;
+    
+        if(in == NULL)
+        	derived()->visit_null_list("AST", "List_element");
+        else
+        {
+        	derived()->pre_list("AST", "List_element", in->size());
+    
+        	for(i = in->begin(); i != in->end(); i++)
+        	{
+        		derived()->visit_list_element(*i);
+        	}
+    
+        	derived()->post_list("AST", "List_element", in->size());
+        }
+    }
+
+    void visit_list_element(List_element* in)
+    {
+        if(in == NULL)
+        	derived()->visit_null("AST", "List_element");
+        else
+        {
+        	derived()->pre_list_element_chain(in);
+        	derived()->children_list_element(in);
+        	derived()->post_list_element_chain(in);
+        }
+    }
+
+    void visit_cast(CAST* in)
+    {
+        if(in == NULL)
+        	derived()->visit_null("AST", "CAST");
+        else
+        {
+        	derived()->pre_cast_chain(in);
+        	derived()->children_cast(in);
+        	derived()->post_cast_chain(in);
+        }
+    }
+
+    void visit_constant_name(CONSTANT_NAME* in)
+    {
+        if(in == NULL)
+        	derived()->visit_null("AST", "CONSTANT_NAME");
+        else
+        {
+        	derived()->pre_constant_name_chain(in);
+        	derived()->children_constant_name(in);
+        	derived()->post_constant_name_chain(in);
+        }
+    }
+
+    void visit_class_name(Class_name* in)
+    {
+        if(in == NULL)
+        	derived()->visit_null("AST", "Class_name");
+        else
+        {
+        	derived()->pre_class_name_chain(in);
+        	derived()->children_class_name(in);
+        	derived()->post_class_name_chain(in);
+        }
+    }
+
+    void visit_target(Target* in)
+    {
+        if(in == NULL)
+        	derived()->visit_null("AST", "Target");
+        else
+        {
+        	derived()->pre_target_chain(in);
+        	derived()->children_target(in);
+        	derived()->post_target_chain(in);
+        }
+    }
+
+    void visit_variable_name(Variable_name* in)
+    {
+        if(in == NULL)
+        	derived()->visit_null("AST", "Variable_name");
+        else
+        {
+        	derived()->pre_variable_name_chain(in);
+        	derived()->children_variable_name(in);
+        	derived()->post_variable_name_chain(in);
+        }
+    }
+
+    void visit_expr_list(Expr_list* in)
+    {
+        Expr_list::const_iterator i;
+    
+        if(in == NULL)
+        	derived()->visit_null_list("AST", "Expr");
+        else
+        {
+        	derived()->pre_list("AST", "Expr", in->size());
+    
+        	for(i = in->begin(); i != in->end(); i++)
+        	{
+        		derived()->visit_expr(*i);
+        	}
+    
+        	derived()->post_list("AST", "Expr", in->size());
+        }
+    }
+
+    void visit_array_elem_list(Array_elem_list* in)
+    {
+        Array_elem_list::const_iterator i;
+    
+        if(in == NULL)
+        	derived()->visit_null_list("AST", "Array_elem");
+        else
+        {
+        	derived()->pre_list("AST", "Array_elem", in->size());
+    
+        	for(i = in->begin(); i != in->end(); i++)
+        	{
+        		derived()->visit_array_elem(*i);
+        	}
+    
+        	derived()->post_list("AST", "Array_elem", in->size());
+        }
+    }
+
+    void visit_array_elem(Array_elem* in)
+    {
+        if(in == NULL)
+        	derived()->visit_null("AST", "Array_elem");
+        else
+        {
+        	derived()->pre_array_elem_chain(in);
+        	derived()->children_array_elem(in);
+        	derived()->post_array_elem_chain(in);
+        }
+    }
+
+    void visit_method_name(Method_name* in)
+    {
+        if(in == NULL)
+        	derived()->visit_null("AST", "Method_name");
+        else
+        {
+        	derived()->pre_method_name_chain(in);
+        	derived()->children_method_name(in);
+        	derived()->post_method_name_chain(in);
+        }
+    }
+
+    void visit_actual_parameter_list(Actual_parameter_list* in)
+    {
+        Actual_parameter_list::const_iterator i;
+    
+        if(in == NULL)
+        	derived()->visit_null_list("AST", "Actual_parameter");
+        else
+        {
+        	derived()->pre_list("AST", "Actual_parameter", in->size());
+    
+        	for(i = in->begin(); i != in->end(); i++)
+        	{
+        		derived()->visit_actual_parameter(*i);
+        	}
+    
+        	derived()->post_list("AST", "Actual_parameter", in->size());
+        }
+    }
+
+    void visit_actual_parameter(Actual_parameter* in)
+    {
+        if(in == NULL)
+        	derived()->visit_null("AST", "Actual_parameter");
+        else
+        {
+        	derived()->pre_actual_parameter_chain(in);
+        	derived()->children_actual_parameter(in);
+        	derived()->post_actual_parameter_chain(in);
+        }
+    }
+
+    void visit_php_script(PHP_script* in)
+    {
+        if(in == NULL)
+        	derived()->visit_null("AST", "PHP_script");
+        else
+        {
+        	derived()->pre_php_script_chain(in);
+        	derived()->children_php_script(in);
+        	derived()->post_php_script_chain(in);
+        }
+    }
+
+/* Invoke the right pre-chain (manual dispatching) */
+/* Do not override unless you know what you are doing */
+public:
+    void pre_statement_chain(Statement* in)
+    {
+        switch(in->classid())
+        {
+        case Class_def::ID:
+        	derived()->pre_class_def_chain(dynamic_cast<Class_def*>(in));
+        	break;
+        case Interface_def::ID:
+        	derived()->pre_interface_def_chain(dynamic_cast<Interface_def*>(in));
+        	break;
+        case Method::ID:
+        	derived()->pre_method_chain(dynamic_cast<Method*>(in));
+        	break;
+        case Return::ID:
+        	derived()->pre_return_chain(dynamic_cast<Return*>(in));
+        	break;
+        case Static_declaration::ID:
+        	derived()->pre_static_declaration_chain(dynamic_cast<Static_declaration*>(in));
+        	break;
+        case Global::ID:
+        	derived()->pre_global_chain(dynamic_cast<Global*>(in));
+        	break;
+        case Try::ID:
+        	derived()->pre_try_chain(dynamic_cast<Try*>(in));
+        	break;
+        case Throw::ID:
+        	derived()->pre_throw_chain(dynamic_cast<Throw*>(in));
+        	break;
+        case Eval_expr::ID:
+        	derived()->pre_eval_expr_chain(dynamic_cast<Eval_expr*>(in));
+        	break;
+        case If::ID:
+        	derived()->pre_if_chain(dynamic_cast<If*>(in));
+        	break;
+        case While::ID:
+        	derived()->pre_while_chain(dynamic_cast<While*>(in));
+        	break;
+        case Do::ID:
+        	derived()->pre_do_chain(dynamic_cast<Do*>(in));
+        	break;
+        case For::ID:
+        	derived()->pre_for_chain(dynamic_cast<For*>(in));
+        	break;
+        case Foreach::ID:
+        	derived()->pre_foreach_chain(dynamic_cast<Foreach*>(in));
+        	break;
+        case Switch::ID:
+        	derived()->pre_switch_chain(dynamic_cast<Switch*>(in));
+        	break;
+        case Break::ID:
+        	derived()->pre_break_chain(dynamic_cast<Break*>(in));
+        	break;
+        case Continue::ID:
+        	derived()->pre_continue_chain(dynamic_cast<Continue*>(in));
+        	break;
+        case Declare::ID:
+        	derived()->pre_declare_chain(dynamic_cast<Declare*>(in));
+        	break;
+        case Nop::ID:
+        	derived()->pre_nop_chain(dynamic_cast<Nop*>(in));
+        	break;
+        case FOREIGN::ID:
+        	derived()->pre_foreign_chain(dynamic_cast<FOREIGN*>(in));
+        	break;
+        }
+    }
+
+    void pre_member_chain(Member* in)
+    {
+        switch(in->classid())
+        {
+        case Method::ID:
+        	derived()->pre_method_chain(dynamic_cast<Method*>(in));
+        	break;
+        case Attribute::ID:
+        	derived()->pre_attribute_chain(dynamic_cast<Attribute*>(in));
+        	break;
+        }
+    }
+
+    void pre_expr_chain(Expr* in)
+    {
+        switch(in->classid())
+        {
+        case Assignment::ID:
+        	derived()->pre_assignment_chain(dynamic_cast<Assignment*>(in));
+        	break;
+        case Cast::ID:
+        	derived()->pre_cast_chain(dynamic_cast<Cast*>(in));
+        	break;
+        case Unary_op::ID:
+        	derived()->pre_unary_op_chain(dynamic_cast<Unary_op*>(in));
+        	break;
+        case Bin_op::ID:
+        	derived()->pre_bin_op_chain(dynamic_cast<Bin_op*>(in));
+        	break;
+        case Constant::ID:
+        	derived()->pre_constant_chain(dynamic_cast<Constant*>(in));
+        	break;
+        case Instanceof::ID:
+        	derived()->pre_instanceof_chain(dynamic_cast<Instanceof*>(in));
+        	break;
+        case Variable::ID:
+        	derived()->pre_variable_chain(dynamic_cast<Variable*>(in));
+        	break;
+        case Pre_op::ID:
+        	derived()->pre_pre_op_chain(dynamic_cast<Pre_op*>(in));
+        	break;
+        case Method_invocation::ID:
+        	derived()->pre_method_invocation_chain(dynamic_cast<Method_invocation*>(in));
+        	break;
+        case New::ID:
+        	derived()->pre_new_chain(dynamic_cast<New*>(in));
+        	break;
+        case INT::ID:
+        	derived()->pre_int_chain(dynamic_cast<INT*>(in));
+        	break;
+        case REAL::ID:
+        	derived()->pre_real_chain(dynamic_cast<REAL*>(in));
+        	break;
+        case STRING::ID:
+        	derived()->pre_string_chain(dynamic_cast<STRING*>(in));
+        	break;
+        case BOOL::ID:
+        	derived()->pre_bool_chain(dynamic_cast<BOOL*>(in));
+        	break;
+        case NIL::ID:
+        	derived()->pre_nil_chain(dynamic_cast<NIL*>(in));
+        	break;
+        case Op_assignment::ID:
+        	derived()->pre_op_assignment_chain(dynamic_cast<Op_assignment*>(in));
+        	break;
+        case List_assignment::ID:
+        	derived()->pre_list_assignment_chain(dynamic_cast<List_assignment*>(in));
+        	break;
+        case Post_op::ID:
+        	derived()->pre_post_op_chain(dynamic_cast<Post_op*>(in));
+        	break;
+        case Array::ID:
+        	derived()->pre_array_chain(dynamic_cast<Array*>(in));
+        	break;
+        case Conditional_expr::ID:
+        	derived()->pre_conditional_expr_chain(dynamic_cast<Conditional_expr*>(in));
+        	break;
+        case Ignore_errors::ID:
+        	derived()->pre_ignore_errors_chain(dynamic_cast<Ignore_errors*>(in));
+        	break;
+        case FOREIGN::ID:
+        	derived()->pre_foreign_chain(dynamic_cast<FOREIGN*>(in));
+        	break;
+        }
+    }
+
+    void pre_variable_name_chain(Variable_name* in)
+    {
+        switch(in->classid())
+        {
+        case VARIABLE_NAME::ID:
+        	derived()->pre_variable_name_chain(dynamic_cast<VARIABLE_NAME*>(in));
+        	break;
+        case Reflection::ID:
+        	derived()->pre_reflection_chain(dynamic_cast<Reflection*>(in));
+        	break;
+        }
+    }
+
+    void pre_list_element_chain(List_element* in)
+    {
+        switch(in->classid())
+        {
+        case Variable::ID:
+        	derived()->pre_variable_chain(dynamic_cast<Variable*>(in));
+        	break;
+        case Nested_list_elements::ID:
+        	derived()->pre_nested_list_elements_chain(dynamic_cast<Nested_list_elements*>(in));
+        	break;
+        }
+    }
+
+    void pre_class_name_chain(Class_name* in)
+    {
+        switch(in->classid())
+        {
+        case CLASS_NAME::ID:
+        	derived()->pre_class_name_chain(dynamic_cast<CLASS_NAME*>(in));
+        	break;
+        case Reflection::ID:
+        	derived()->pre_reflection_chain(dynamic_cast<Reflection*>(in));
+        	break;
+        }
+    }
+
+    void pre_target_chain(Target* in)
+    {
+        switch(in->classid())
+        {
+        case Assignment::ID:
+        	derived()->pre_assignment_chain(dynamic_cast<Assignment*>(in));
+        	break;
+        case Cast::ID:
+        	derived()->pre_cast_chain(dynamic_cast<Cast*>(in));
+        	break;
+        case Unary_op::ID:
+        	derived()->pre_unary_op_chain(dynamic_cast<Unary_op*>(in));
+        	break;
+        case Bin_op::ID:
+        	derived()->pre_bin_op_chain(dynamic_cast<Bin_op*>(in));
+        	break;
+        case Constant::ID:
+        	derived()->pre_constant_chain(dynamic_cast<Constant*>(in));
+        	break;
+        case Instanceof::ID:
+        	derived()->pre_instanceof_chain(dynamic_cast<Instanceof*>(in));
+        	break;
+        case Variable::ID:
+        	derived()->pre_variable_chain(dynamic_cast<Variable*>(in));
+        	break;
+        case Pre_op::ID:
+        	derived()->pre_pre_op_chain(dynamic_cast<Pre_op*>(in));
+        	break;
+        case Method_invocation::ID:
+        	derived()->pre_method_invocation_chain(dynamic_cast<Method_invocation*>(in));
+        	break;
+        case New::ID:
+        	derived()->pre_new_chain(dynamic_cast<New*>(in));
+        	break;
+        case INT::ID:
+        	derived()->pre_int_chain(dynamic_cast<INT*>(in));
+        	break;
+        case REAL::ID:
+        	derived()->pre_real_chain(dynamic_cast<REAL*>(in));
+        	break;
+        case STRING::ID:
+        	derived()->pre_string_chain(dynamic_cast<STRING*>(in));
+        	break;
+        case BOOL::ID:
+        	derived()->pre_bool_chain(dynamic_cast<BOOL*>(in));
+        	break;
+        case NIL::ID:
+        	derived()->pre_nil_chain(dynamic_cast<NIL*>(in));
+        	break;
+        case Op_assignment::ID:
+        	derived()->pre_op_assignment_chain(dynamic_cast<Op_assignment*>(in));
+        	break;
+        case List_assignment::ID:
+        	derived()->pre_list_assignment_chain(dynamic_cast<List_assignment*>(in));
+        	break;
+        case Post_op::ID:
+        	derived()->pre_post_op_chain(dynamic_cast<Post_op*>(in));
+        	break;
+        case Array::ID:
+        	derived()->pre_array_chain(dynamic_cast<Array*>(in));
+        	break;
+        case Conditional_expr::ID:
+        	derived()->pre_conditional_expr_chain(dynamic_cast<Conditional_expr*>(in));
+        	break;
+        case Ignore_errors::ID:
+        	derived()->pre_ignore_errors_chain(dynamic_cast<Ignore_errors*>(in));
+        	break;
+        case FOREIGN::ID:
+        	derived()->pre_foreign_chain(dynamic_cast<FOREIGN*>(in));
+        	break;
+        case CLASS_NAME::ID:
+        	derived()->pre_class_name_chain(dynamic_cast<CLASS_NAME*>(in));
+        	break;
+        }
+    }
+
+    void pre_method_name_chain(Method_name* in)
+    {
+        switch(in->classid())
+        {
+        case METHOD_NAME::ID:
+        	derived()->pre_method_name_chain(dynamic_cast<METHOD_NAME*>(in));
+        	break;
+        case Reflection::ID:
+        	derived()->pre_reflection_chain(dynamic_cast<Reflection*>(in));
+        	break;
+        }
+    }
+
+/* Invoke the right post-chain (manual dispatching) */
+/* Do not override unless you know what you are doing */
+public:
+    void post_statement_chain(Statement* in)
+    {
+        switch(in->classid())
+        {
+        case Class_def::ID:
+        	derived()->post_class_def_chain(dynamic_cast<Class_def*>(in));
+        	break;
+        case Interface_def::ID:
+        	derived()->post_interface_def_chain(dynamic_cast<Interface_def*>(in));
+        	break;
+        case Method::ID:
+        	derived()->post_method_chain(dynamic_cast<Method*>(in));
+        	break;
+        case Return::ID:
+        	derived()->post_return_chain(dynamic_cast<Return*>(in));
+        	break;
+        case Static_declaration::ID:
+        	derived()->post_static_declaration_chain(dynamic_cast<Static_declaration*>(in));
+        	break;
+        case Global::ID:
+        	derived()->post_global_chain(dynamic_cast<Global*>(in));
+        	break;
+        case Try::ID:
+        	derived()->post_try_chain(dynamic_cast<Try*>(in));
+        	break;
+        case Throw::ID:
+        	derived()->post_throw_chain(dynamic_cast<Throw*>(in));
+        	break;
+        case Eval_expr::ID:
+        	derived()->post_eval_expr_chain(dynamic_cast<Eval_expr*>(in));
+        	break;
+        case If::ID:
+        	derived()->post_if_chain(dynamic_cast<If*>(in));
+        	break;
+        case While::ID:
+        	derived()->post_while_chain(dynamic_cast<While*>(in));
+        	break;
+        case Do::ID:
+        	derived()->post_do_chain(dynamic_cast<Do*>(in));
+        	break;
+        case For::ID:
+        	derived()->post_for_chain(dynamic_cast<For*>(in));
+        	break;
+        case Foreach::ID:
+        	derived()->post_foreach_chain(dynamic_cast<Foreach*>(in));
+        	break;
+        case Switch::ID:
+        	derived()->post_switch_chain(dynamic_cast<Switch*>(in));
+        	break;
+        case Break::ID:
+        	derived()->post_break_chain(dynamic_cast<Break*>(in));
+        	break;
+        case Continue::ID:
+        	derived()->post_continue_chain(dynamic_cast<Continue*>(in));
+        	break;
+        case Declare::ID:
+        	derived()->post_declare_chain(dynamic_cast<Declare*>(in));
+        	break;
+        case Nop::ID:
+        	derived()->post_nop_chain(dynamic_cast<Nop*>(in));
+        	break;
+        case FOREIGN::ID:
+        	derived()->post_foreign_chain(dynamic_cast<FOREIGN*>(in));
+        	break;
+        }
+    }
+
+    void post_member_chain(Member* in)
+    {
+        switch(in->classid())
+        {
+        case Method::ID:
+        	derived()->post_method_chain(dynamic_cast<Method*>(in));
+        	break;
+        case Attribute::ID:
+        	derived()->post_attribute_chain(dynamic_cast<Attribute*>(in));
+        	break;
+        }
+    }
+
+    void post_expr_chain(Expr* in)
+    {
+        switch(in->classid())
+        {
+        case Assignment::ID:
+        	derived()->post_assignment_chain(dynamic_cast<Assignment*>(in));
+        	break;
+        case Cast::ID:
+        	derived()->post_cast_chain(dynamic_cast<Cast*>(in));
+        	break;
+        case Unary_op::ID:
+        	derived()->post_unary_op_chain(dynamic_cast<Unary_op*>(in));
+        	break;
+        case Bin_op::ID:
+        	derived()->post_bin_op_chain(dynamic_cast<Bin_op*>(in));
+        	break;
+        case Constant::ID:
+        	derived()->post_constant_chain(dynamic_cast<Constant*>(in));
+        	break;
+        case Instanceof::ID:
+        	derived()->post_instanceof_chain(dynamic_cast<Instanceof*>(in));
+        	break;
+        case Variable::ID:
+        	derived()->post_variable_chain(dynamic_cast<Variable*>(in));
+        	break;
+        case Pre_op::ID:
+        	derived()->post_pre_op_chain(dynamic_cast<Pre_op*>(in));
+        	break;
+        case Method_invocation::ID:
+        	derived()->post_method_invocation_chain(dynamic_cast<Method_invocation*>(in));
+        	break;
+        case New::ID:
+        	derived()->post_new_chain(dynamic_cast<New*>(in));
+        	break;
+        case INT::ID:
+        	derived()->post_int_chain(dynamic_cast<INT*>(in));
+        	break;
+        case REAL::ID:
+        	derived()->post_real_chain(dynamic_cast<REAL*>(in));
+        	break;
+        case STRING::ID:
+        	derived()->post_string_chain(dynamic_cast<STRING*>(in));
+        	break;
+        case BOOL::ID:
+        	derived()->post_bool_chain(dynamic_cast<BOOL*>(in));
+        	break;
+        case NIL::ID:
+        	derived()->post_nil_chain(dynamic_cast<NIL*>(in));
+        	break;
+        case Op_assignment::ID:
+        	derived()->post_op_assignment_chain(dynamic_cast<Op_assignment*>(in));
+        	break;
+        case List_assignment::ID:
+        	derived()->post_list_assignment_chain(dynamic_cast<List_assignment*>(in));
+        	break;
+        case Post_op::ID:
+        	derived()->post_post_op_chain(dynamic_cast<Post_op*>(in));
+        	break;
+        case Array::ID:
+        	derived()->post_array_chain(dynamic_cast<Array*>(in));
+        	break;
+        case Conditional_expr::ID:
+        	derived()->post_conditional_expr_chain(dynamic_cast<Conditional_expr*>(in));
+        	break;
+        case Ignore_errors::ID:
+        	derived()->post_ignore_errors_chain(dynamic_cast<Ignore_errors*>(in));
+        	break;
+        case FOREIGN::ID:
+        	derived()->post_foreign_chain(dynamic_cast<FOREIGN*>(in));
+        	break;
+        }
+    }
+
+    void post_variable_name_chain(Variable_name* in)
+    {
+        switch(in->classid())
+        {
+        case VARIABLE_NAME::ID:
+        	derived()->post_variable_name_chain(dynamic_cast<VARIABLE_NAME*>(in));
+        	break;
+        case Reflection::ID:
+        	derived()->post_reflection_chain(dynamic_cast<Reflection*>(in));
+        	break;
+        }
+    }
+
+    void post_list_element_chain(List_element* in)
+    {
+        switch(in->classid())
+        {
+        case Variable::ID:
+        	derived()->post_variable_chain(dynamic_cast<Variable*>(in));
+        	break;
+        case Nested_list_elements::ID:
+        	derived()->post_nested_list_elements_chain(dynamic_cast<Nested_list_elements*>(in));
+        	break;
+        }
+    }
+
+    void post_class_name_chain(Class_name* in)
+    {
+        switch(in->classid())
+        {
+        case CLASS_NAME::ID:
+        	derived()->post_class_name_chain(dynamic_cast<CLASS_NAME*>(in));
+        	break;
+        case Reflection::ID:
+        	derived()->post_reflection_chain(dynamic_cast<Reflection*>(in));
+        	break;
+        }
+    }
+
+    void post_target_chain(Target* in)
+    {
+        switch(in->classid())
+        {
+        case Assignment::ID:
+        	derived()->post_assignment_chain(dynamic_cast<Assignment*>(in));
+        	break;
+        case Cast::ID:
+        	derived()->post_cast_chain(dynamic_cast<Cast*>(in));
+        	break;
+        case Unary_op::ID:
+        	derived()->post_unary_op_chain(dynamic_cast<Unary_op*>(in));
+        	break;
+        case Bin_op::ID:
+        	derived()->post_bin_op_chain(dynamic_cast<Bin_op*>(in));
+        	break;
+        case Constant::ID:
+        	derived()->post_constant_chain(dynamic_cast<Constant*>(in));
+        	break;
+        case Instanceof::ID:
+        	derived()->post_instanceof_chain(dynamic_cast<Instanceof*>(in));
+        	break;
+        case Variable::ID:
+        	derived()->post_variable_chain(dynamic_cast<Variable*>(in));
+        	break;
+        case Pre_op::ID:
+        	derived()->post_pre_op_chain(dynamic_cast<Pre_op*>(in));
+        	break;
+        case Method_invocation::ID:
+        	derived()->post_method_invocation_chain(dynamic_cast<Method_invocation*>(in));
+        	break;
+        case New::ID:
+        	derived()->post_new_chain(dynamic_cast<New*>(in));
+        	break;
+        case INT::ID:
+        	derived()->post_int_chain(dynamic_cast<INT*>(in));
+        	break;
+        case REAL::ID:
+        	derived()->post_real_chain(dynamic_cast<REAL*>(in));
+        	break;
+        case STRING::ID:
+        	derived()->post_string_chain(dynamic_cast<STRING*>(in));
+        	break;
+        case BOOL::ID:
+        	derived()->post_bool_chain(dynamic_cast<BOOL*>(in));
+        	break;
+        case NIL::ID:
+        	derived()->post_nil_chain(dynamic_cast<NIL*>(in));
+        	break;
+        case Op_assignment::ID:
+        	derived()->post_op_assignment_chain(dynamic_cast<Op_assignment*>(in));
+        	break;
+        case List_assignment::ID:
+        	derived()->post_list_assignment_chain(dynamic_cast<List_assignment*>(in));
+        	break;
+        case Post_op::ID:
+        	derived()->post_post_op_chain(dynamic_cast<Post_op*>(in));
+        	break;
+        case Array::ID:
+        	derived()->post_array_chain(dynamic_cast<Array*>(in));
+        	break;
+        case Conditional_expr::ID:
+        	derived()->post_conditional_expr_chain(dynamic_cast<Conditional_expr*>(in));
+        	break;
+        case Ignore_errors::ID:
+        	derived()->post_ignore_errors_chain(dynamic_cast<Ignore_errors*>(in));
+        	break;
+        case FOREIGN::ID:
+        	derived()->post_foreign_chain(dynamic_cast<FOREIGN*>(in));
+        	break;
+        case CLASS_NAME::ID:
+        	derived()->post_class_name_chain(dynamic_cast<CLASS_NAME*>(in));
+        	break;
+        }
+    }
+
+    void post_method_name_chain(Method_name* in)
+    {
+        switch(in->classid())
+        {
+        case METHOD_NAME::ID:
+        	derived()->post_method_name_chain(dynamic_cast<METHOD_NAME*>(in));
+        	break;
+        case Reflection::ID:
+        	derived()->post_reflection_chain(dynamic_cast<Reflection*>(in));
+        	break;
+        }
+    }
+
+/* Invoke the right visit-children (manual dispatching) */
+/* Do not override unless you know what you are doing */
+public:
+    void children_statement(Statement* in)
+    {
+        switch(in->classid())
+        {
+        case Class_def::ID:
+        	derived()->children_class_def(dynamic_cast<Class_def*>(in));
+        	break;
+        case Interface_def::ID:
+        	derived()->children_interface_def(dynamic_cast<Interface_def*>(in));
+        	break;
+        case Method::ID:
+        	derived()->children_method(dynamic_cast<Method*>(in));
+        	break;
+        case Return::ID:
+        	derived()->children_return(dynamic_cast<Return*>(in));
+        	break;
+        case Static_declaration::ID:
+        	derived()->children_static_declaration(dynamic_cast<Static_declaration*>(in));
+        	break;
+        case Global::ID:
+        	derived()->children_global(dynamic_cast<Global*>(in));
+        	break;
+        case Try::ID:
+        	derived()->children_try(dynamic_cast<Try*>(in));
+        	break;
+        case Throw::ID:
+        	derived()->children_throw(dynamic_cast<Throw*>(in));
+        	break;
+        case Eval_expr::ID:
+        	derived()->children_eval_expr(dynamic_cast<Eval_expr*>(in));
+        	break;
+        case If::ID:
+        	derived()->children_if(dynamic_cast<If*>(in));
+        	break;
+        case While::ID:
+        	derived()->children_while(dynamic_cast<While*>(in));
+        	break;
+        case Do::ID:
+        	derived()->children_do(dynamic_cast<Do*>(in));
+        	break;
+        case For::ID:
+        	derived()->children_for(dynamic_cast<For*>(in));
+        	break;
+        case Foreach::ID:
+        	derived()->children_foreach(dynamic_cast<Foreach*>(in));
+        	break;
+        case Switch::ID:
+        	derived()->children_switch(dynamic_cast<Switch*>(in));
+        	break;
+        case Break::ID:
+        	derived()->children_break(dynamic_cast<Break*>(in));
+        	break;
+        case Continue::ID:
+        	derived()->children_continue(dynamic_cast<Continue*>(in));
+        	break;
+        case Declare::ID:
+        	derived()->children_declare(dynamic_cast<Declare*>(in));
+        	break;
+        case Nop::ID:
+        	derived()->children_nop(dynamic_cast<Nop*>(in));
+        	break;
+        case FOREIGN::ID:
+        	derived()->children_foreign(dynamic_cast<FOREIGN*>(in));
+        	break;
+        }
+    }
+
+    void children_member(Member* in)
+    {
+        switch(in->classid())
+        {
+        case Method::ID:
+        	derived()->children_method(dynamic_cast<Method*>(in));
+        	break;
+        case Attribute::ID:
+        	derived()->children_attribute(dynamic_cast<Attribute*>(in));
+        	break;
+        }
+    }
+
+    void children_expr(Expr* in)
+    {
+        switch(in->classid())
+        {
+        case Assignment::ID:
+        	derived()->children_assignment(dynamic_cast<Assignment*>(in));
+        	break;
+        case Cast::ID:
+        	derived()->children_cast(dynamic_cast<Cast*>(in));
+        	break;
+        case Unary_op::ID:
+        	derived()->children_unary_op(dynamic_cast<Unary_op*>(in));
+        	break;
+        case Bin_op::ID:
+        	derived()->children_bin_op(dynamic_cast<Bin_op*>(in));
+        	break;
+        case Constant::ID:
+        	derived()->children_constant(dynamic_cast<Constant*>(in));
+        	break;
+        case Instanceof::ID:
+        	derived()->children_instanceof(dynamic_cast<Instanceof*>(in));
+        	break;
+        case Variable::ID:
+        	derived()->children_variable(dynamic_cast<Variable*>(in));
+        	break;
+        case Pre_op::ID:
+        	derived()->children_pre_op(dynamic_cast<Pre_op*>(in));
+        	break;
+        case Method_invocation::ID:
+        	derived()->children_method_invocation(dynamic_cast<Method_invocation*>(in));
+        	break;
+        case New::ID:
+        	derived()->children_new(dynamic_cast<New*>(in));
+        	break;
+        case INT::ID:
+        	derived()->children_int(dynamic_cast<INT*>(in));
+        	break;
+        case REAL::ID:
+        	derived()->children_real(dynamic_cast<REAL*>(in));
+        	break;
+        case STRING::ID:
+        	derived()->children_string(dynamic_cast<STRING*>(in));
+        	break;
+        case BOOL::ID:
+        	derived()->children_bool(dynamic_cast<BOOL*>(in));
+        	break;
+        case NIL::ID:
+        	derived()->children_nil(dynamic_cast<NIL*>(in));
+        	break;
+        case Op_assignment::ID:
+        	derived()->children_op_assignment(dynamic_cast<Op_assignment*>(in));
+        	break;
+        case List_assignment::ID:
+        	derived()->children_list_assignment(dynamic_cast<List_assignment*>(in));
+        	break;
+        case Post_op::ID:
+        	derived()->children_post_op(dynamic_cast<Post_op*>(in));
+        	break;
+        case Array::ID:
+        	derived()->children_array(dynamic_cast<Array*>(in));
+        	break;
+        case Conditional_expr::ID:
+        	derived()->children_conditional_expr(dynamic_cast<Conditional_expr*>(in));
+        	break;
+        case Ignore_errors::ID:
+        	derived()->children_ignore_errors(dynamic_cast<Ignore_errors*>(in));
+        	break;
+        case FOREIGN::ID:
+        	derived()->children_foreign(dynamic_cast<FOREIGN*>(in));
+        	break;
+        }
+    }
+
+    void children_variable_name(Variable_name* in)
+    {
+        switch(in->classid())
+        {
+        case VARIABLE_NAME::ID:
+        	derived()->children_variable_name(dynamic_cast<VARIABLE_NAME*>(in));
+        	break;
+        case Reflection::ID:
+        	derived()->children_reflection(dynamic_cast<Reflection*>(in));
+        	break;
+        }
+    }
+
+    void children_list_element(List_element* in)
+    {
+        switch(in->classid())
+        {
+        case Variable::ID:
+        	derived()->children_variable(dynamic_cast<Variable*>(in));
+        	break;
+        case Nested_list_elements::ID:
+        	derived()->children_nested_list_elements(dynamic_cast<Nested_list_elements*>(in));
+        	break;
+        }
+    }
+
+    void children_class_name(Class_name* in)
+    {
+        switch(in->classid())
+        {
+        case CLASS_NAME::ID:
+        	derived()->children_class_name(dynamic_cast<CLASS_NAME*>(in));
+        	break;
+        case Reflection::ID:
+        	derived()->children_reflection(dynamic_cast<Reflection*>(in));
+        	break;
+        }
+    }
+
+    void children_target(Target* in)
+    {
+        switch(in->classid())
+        {
+        case Assignment::ID:
+        	derived()->children_assignment(dynamic_cast<Assignment*>(in));
+        	break;
+        case Cast::ID:
+        	derived()->children_cast(dynamic_cast<Cast*>(in));
+        	break;
+        case Unary_op::ID:
+        	derived()->children_unary_op(dynamic_cast<Unary_op*>(in));
+        	break;
+        case Bin_op::ID:
+        	derived()->children_bin_op(dynamic_cast<Bin_op*>(in));
+        	break;
+        case Constant::ID:
+        	derived()->children_constant(dynamic_cast<Constant*>(in));
+        	break;
+        case Instanceof::ID:
+        	derived()->children_instanceof(dynamic_cast<Instanceof*>(in));
+        	break;
+        case Variable::ID:
+        	derived()->children_variable(dynamic_cast<Variable*>(in));
+        	break;
+        case Pre_op::ID:
+        	derived()->children_pre_op(dynamic_cast<Pre_op*>(in));
+        	break;
+        case Method_invocation::ID:
+        	derived()->children_method_invocation(dynamic_cast<Method_invocation*>(in));
+        	break;
+        case New::ID:
+        	derived()->children_new(dynamic_cast<New*>(in));
+        	break;
+        case INT::ID:
+        	derived()->children_int(dynamic_cast<INT*>(in));
+        	break;
+        case REAL::ID:
+        	derived()->children_real(dynamic_cast<REAL*>(in));
+        	break;
+        case STRING::ID:
+        	derived()->children_string(dynamic_cast<STRING*>(in));
+        	break;
+        case BOOL::ID:
+        	derived()->children_bool(dynamic_cast<BOOL*>(in));
+        	break;
+        case NIL::ID:
+        	derived()->children_nil(dynamic_cast<NIL*>(in));
+        	break;
+        case Op_assignment::ID:
+        	derived()->children_op_assignment(dynamic_cast<Op_assignment*>(in));
+        	break;
+        case List_assignment::ID:
+        	derived()->children_list_assignment(dynamic_cast<List_assignment*>(in));
+        	break;
+        case Post_op::ID:
+        	derived()->children_post_op(dynamic_cast<Post_op*>(in));
+        	break;
+        case Array::ID:
+        	derived()->children_array(dynamic_cast<Array*>(in));
+        	break;
+        case Conditional_expr::ID:
+        	derived()->children_conditional_expr(dynamic_cast<Conditional_expr*>(in));
+        	break;
+        case Ignore_errors::ID:
+        	derived()->children_ignore_errors(dynamic_cast<Ignore_errors*>(in));
+        	break;
+        case FOREIGN::ID:
+        	derived()->children_foreign(dynamic_cast<FOREIGN*>(in));
+        	break;
+        case CLASS_NAME::ID:
+        	derived()->children_class_name(dynamic_cast<CLASS_NAME*>(in));
+        	break;
+        }
+    }
+
+    void children_method_name(Method_name* in)
+    {
+        switch(in->classid())
+        {
+        case METHOD_NAME::ID:
+        	derived()->children_method_name(dynamic_cast<METHOD_NAME*>(in));
+        	break;
+        case Reflection::ID:
+        	derived()->children_reflection(dynamic_cast<Reflection*>(in));
+        	break;
+        }
+    }
+
+protected:
+    Derived* derived()
+    {
+    	return static_cast<Derived*>(this);
+    }
+};
+}
+
+
+#endif
@@ -0,0 +1,2676 @@
+#ifndef _HIR_STATIC_TRANSFORM_H_
+#define _HIR_STATIC_TRANSFORM_H_
+
+/* Generated from HIR_transform.h and HIR_transform.cpp by misc/make_static_visitor.pl */
+
+#include <iostream>
+#include <sstream>
+#include <iomanip>
+#include "lib/error.h"
+#include "lib/Object.h"
+#include "lib/List.h"
+#include "lib/String.h"
+#include "lib/Boolean.h"
+#include "lib/Integer.h"
+#include "lib/AttrMap.h"
+#include "process_ir/IR.h"
+#include "process_ir/Foreach.h"
+#include <list>
+#include <string>
+#include <cstring>
+#include <cassert>
+
+
+#include "HIR.h"
+
+namespace HIR{
+/*
+ * The same as Transform, but dispatched statically: methods are called on the
+ * Derived class, which hides the methods it wants to replace. Since the
+ * methods are not virtual, a method which hides one overload of a name hides
+ * them all; bring the rest back with a using declaration.
+ */
+template <class Derived>
+class Static_transform
+{
+public:
+/* Invoked before the children are transformed */
+public:
+    PHP_script* pre_php_script(PHP_script* in)
+    {
+        return in;
+    }
+
+    void pre_class_def(Class_def* in, Statement_list* out)
+    {
+        out->push_back(in);
+    }
+
+    Class_mod* pre_class_mod(Class_mod* in)
+    {
+        return in;
+    }
+
+    void pre_interface_def(Interface_def* in, Statement_list* out)
+    {
+        out->push_back(in);
+    }
+
+    void pre_method(Method* in, Method_list* out)
+    {
+        out->push_back(in);
+    }
+
+    Signature* pre_signature(Signature* in)
+    {
+        return in;
+    }
+
+    Method_mod* pre_method_mod(Method_mod* in)
+    {
+        return in;
+    }
+
+    void pre_formal_parameter(Formal_parameter* in, Formal_parameter_list* out)
+    {
+        out->push_back(in);
+    }
+
+    Type* pre_type(Type* in)
+    {
+        return in;
+    }
+
+    void pre_attribute(Attribute* in, Member_list* out)
+    {
+        out->push_back(in);
+    }
+
+    Attr_mod* pre_attr_mod(Attr_mod* in)
+    {
+        return in;
+    }
+
+    Name_with_default* pre_name_with_default(Name_with_default* in)
+    {
+        return in;
+    }
+
+    void pre_if(If* in, Statement_list* out)
+    {
+        out->push_back(in);
+    }
+
+    void pre_loop(Loop* in, Statement_list* out)
+    {
+        out->push_back(in);
+    }
+
+    void pre_foreach(Foreach* in, Statement_list* out)
+    {
+        out->push_back(in);
+    }
+
+    void pre_break(Break* in, Statement_list* out)
+    {
+        out->push_back(in);
+    }
+
+    void pre_continue(Continue* in, Statement_list* out)
+    {
+        out->push_back(in);
+    }
+
+    void pre_return(Return* in, Statement_list* out)
+    {
+        out->push_back(in);
+    }
+
+    void pre_static_declaration(Static_declaration* in, Statement_list* out)
+    {
+        out->push_back(in);
+    }
+
+    void pre_global(Global* in, Statement_list* out)
+    {
+        out->push_back(in);
+    }
+
+    void pre_try(Try* in, Statement_list* out)
+    {
+        out->push_back(in);
+    }
+
+    void pre_catch(Catch* in, Catch_list* out)
+    {
+        out->push_back(in);
+    }
+
+    void pre_throw(Throw* in, Statement_list* out)
+    {
+        out->push_back(in);
+    }
+
+    void pre_assign_var(Assign_var* in, Statement_list* out)
+    {
+        out->push_back(in);
+    }
+
+    void pre_assign_field(Assign_field* in, Statement_list* out)
+    {
+        out->push_back(in);
+    }
+
+    void pre_assign_array(Assign_array* in, Statement_list* out)
+    {
+        out->push_back(in);
+    }
+
+    void pre_assign_var_var(Assign_var_var* in, Statement_list* out)
+    {
+        out->push_back(in);
+    }
+
+    void pre_assign_next(Assign_next* in, Statement_list* out)
+    {
+        out->push_back(in);
+    }
+
+    void pre_pre_op(Pre_op* in, Statement_list* out)
+    {
+        out->push_back(in);
+    }
+
+    void pre_eval_expr(Eval_expr* in, Statement_list* out)
+    {
+        out->push_back(in);
+    }
+
+    Expr* pre_field_access(Field_access* in)
+    {
+        return in;
+    }
+
+    Expr* pre_array_access(Array_access* in)
+    {
+        return in;
+    }
+
+    Expr* pre_array_next(Array_next* in)
+    {
+        return in;
+    }
+
+    Expr* pre_cast(Cast* in)
+    {
+        return in;
+    }
+
+    Expr* pre_unary_op(Unary_op* in)
+    {
+        return in;
+    }
+
+    Expr* pre_bin_op(Bin_op* in)
+    {
+        return in;
+    }
+
+    Constant* pre_constant(Constant* in)
+    {
+        return in;
+    }
+
+    Expr* pre_instanceof(Instanceof* in)
+    {
+        return in;
+    }
+
+    Expr* pre_method_invocation(Method_invocation* in)
+    {
+        return in;
+    }
+
+    Expr* pre_new(New* in)
+    {
+        return in;
+    }
+
+    void pre_variable_actual_parameter(Variable_actual_parameter* in, Actual_parameter_list* out)
+    {
+        out->push_back(in);
+    }
+
+    Method_name* pre_variable_method(Variable_method* in)
+    {
+        return in;
+    }
+
+    Variable_name* pre_variable_variable(Variable_variable* in)
+    {
+        return in;
+    }
+
+    Class_name* pre_variable_class(Variable_class* in)
+    {
+        return in;
+    }
+
+    Field_name* pre_variable_field(Variable_field* in)
+    {
+        return in;
+    }
+
+    Static_value* pre_static_array(Static_array* in)
+    {
+        return in;
+    }
+
+    void pre_static_array_elem(Static_array_elem* in, Static_array_elem_list* out)
+    {
+        out->push_back(in);
+    }
+
+    FOREIGN* pre_foreign(FOREIGN* in)
+    {
+        return in;
+    }
+
+    CLASS_NAME* pre_class_name(CLASS_NAME* in)
+    {
+        return in;
+    }
+
+    INTERFACE_NAME* pre_interface_name(INTERFACE_NAME* in)
+    {
+        return in;
+    }
+
+    METHOD_NAME* pre_method_name(METHOD_NAME* in)
+    {
+        return in;
+    }
+
+    VARIABLE_NAME* pre_variable_name(VARIABLE_NAME* in)
+    {
+        return in;
+    }
+
+    OP* pre_op(OP* in)
+    {
+        return in;
+    }
+
+    Literal* pre_int(INT* in)
+    {
+        return in;
+    }
+
+    Literal* pre_real(REAL* in)
+    {
+        return in;
+    }
+
+    Literal* pre_string(STRING* in)
+    {
+        return in;
+    }
+
+    Literal* pre_bool(BOOL* in)
+    {
+        return in;
+    }
+
+    Literal* pre_nil(NIL* in)
+    {
+        return in;
+    }
+
+    CAST* pre_cast(CAST* in)
+    {
+        return in;
+    }
+
+    CONSTANT_NAME* pre_constant_name(CONSTANT_NAME* in)
+    {
+        return in;
+    }
+
+    Field_name* pre_field_name(FIELD_NAME* in)
+    {
+        return in;
+    }
+
+/* Invoked after the children have been transformed */
+public:
+    PHP_script* post_php_script(PHP_script* in)
+    {
+        return in;
+    }
+
+    void post_class_def(Class_def* in, Statement_list* out)
+    {
+        out->push_back(in);
+    }
+
+    Class_mod* post_class_mod(Class_mod* in)
+    {
+        return in;
+    }
+
+    void post_interface_def(Interface_def* in, Statement_list* out)
+    {
+        out->push_back(in);
+    }
+
+    void post_method(Method* in, Method_list* out)
+    {
+        out->push_back(in);
+    }
+
+    Signature* post_signature(Signature* in)
+    {
+        return in;
+    }
+
+    Method_mod* post_method_mod(Method_mod* in)
+    {
+        return in;
+    }
+
+    void post_formal_parameter(Formal_parameter* in, Formal_parameter_list* out)
+    {
+        out->push_back(in);
+    }
+
+    Type* post_type(Type* in)
+    {
+        return in;
+    }
+
+    void post_attribute(Attribute* in, Member_list* out)
+    {
+        out->push_back(in);
+    }
+
+    Attr_mod* post_attr_mod(Attr_mod* in)
+    {
+        return in;
+    }
+
+    Name_with_default* post_name_with_default(Name_with_default* in)
+    {
+        return in;
+    }
+
+    void post_if(If* in, Statement_list* out)
+    {
+        out->push_back(in);
+    }
+
+    void post_loop(Loop* in, Statement_list* out)
+    {
+        out->push_back(in);
+    }
+
+    void post_foreach(Foreach* in, Statement_list* out)
+    {
+        out->push_back(in);
+    }
+
+    void post_break(Break* in, Statement_list* out)
+    {
+        out->push_back(in);
+    }
+
+    void post_continue(Continue* in, Statement_list* out)
+    {
+        out->push_back(in);
+    }
+
+    void post_return(Return* in, Statement_list* out)
+    {
+        out->push_back(in);
+    }
+
+    void post_static_declaration(Static_declaration* in, Statement_list* out)
+    {
+        out->push_back(in);
+    }
+
+    void post_global(Global* in, Statement_list* out)
+    {
+        out->push_back(in);
+    }
+
+    void post_try(Try* in, Statement_list* out)
+    {
+        out->push_back(in);
+    }
+
+    void post_catch(Catch* in, Catch_list* out)
+    {
+        out->push_back(in);
+    }
+
+    void post_throw(Throw* in, Statement_list* out)
+    {
+        out->push_back(in);
+    }
+
+    void post_assign_var(Assign_var* in, Statement_list* out)
+    {
+        out->push_back(in);
+    }
+
+    void post_assign_field(Assign_field* in, Statement_list* out)
+    {
+        out->push_back(in);
+    }
+
+    void post_assign_array(Assign_array* in, Statement_list* out)
+    {
+        out->push_back(in);
+    }
+
+    void post_assign_var_var(Assign_var_var* in, Statement_list* out)
+    {
+        out->push_back(in);
+    }
+
+    void post_assign_next(Assign_next* in, Statement_list* out)
+    {
+        out->push_back(in);
+    }
+
+    void post_pre_op(Pre_op* in, Statement_list* out)
+    {
+        out->push_back(in);
+    }
+
+    void post_eval_expr(Eval_expr* in, Statement_list* out)
+    {
+        out->push_back(in);
+    }
+
+    Expr* post_field_access(Field_access* in)
+    {
+        return in;
+    }
+
+    Expr* post_array_access(Array_access* in)
+    {
+        return in;
+    }
+
+    Expr* post_array_next(Array_next* in)
+    {
+        return in;
+    }
+
+    Expr* post_cast(Cast* in)
+    {
+        return in;
+    }
+
+    Expr* post_unary_op(Unary_op* in)
+    {
+        return in;
+    }
+
+    Expr* post_bin_op(Bin_op* in)
+    {
+        return in;
+    }
+
+    Constant* post_constant(Constant* in)
+    {
+        return in;
+    }
+
+    Expr* post_instanceof(Instanceof* in)
+    {
+        return in;
+    }
+
+    Expr* post_method_invocation(Method_invocation* in)
+    {
+        return in;
+    }
+
+    Expr* post_new(New* in)
+    {
+        return in;
+    }
+
+    void post_variable_actual_parameter(Variable_actual_parameter* in, Actual_parameter_list* out)
+    {
+        out->push_back(in);
+    }
+
+    Method_name* post_variable_method(Variable_method* in)
+    {
+        return in;
+    }
+
+    Variable_name* post_variable_variable(Variable_variable* in)
+    {
+        return in;
+    }
+
+    Class_name* post_variable_class(Variable_class* in)
+    {
+        return in;
+    }
+
+    Field_name* post_variable_field(Variable_field* in)
+    {
+        return in;
+    }
+
+    Static_value* post_static_array(Static_array* in)
+    {
+        return in;
+    }
+
+    void post_static_array_elem(Static_array_elem* in, Static_array_elem_list* out)
+    {
+        out->push_back(in);
+    }
+
+    FOREIGN* post_foreign(FOREIGN* in)
+    {
+        return in;
+    }
+
+    CLASS_NAME* post_class_name(CLASS_NAME* in)
+    {
+        return in;
+    }
+
+    INTERFACE_NAME* post_interface_name(INTERFACE_NAME* in)
+    {
+        return in;
+    }
+
+    METHOD_NAME* post_method_name(METHOD_NAME* in)
+    {
+        return in;
+    }
+
+    VARIABLE_NAME* post_variable_name(VARIABLE_NAME* in)
+    {
+        return in;
+    }
+
+    OP* post_op(OP* in)
+    {
+        return in;
+    }
+
+    Literal* post_int(INT* in)
+    {
+        return in;
+    }
+
+    Literal* post_real(REAL* in)
+    {
+        return in;
+    }
+
+    Literal* post_string(STRING* in)
+    {
+        return in;
+    }
+
+    Literal* post_bool(BOOL* in)
+    {
+        return in;
+    }
+
+    Literal* post_nil(NIL* in)
+    {
+        return in;
+    }
+
+    CAST* post_cast(CAST* in)
+    {
+        return in;
+    }
+
+    CONSTANT_NAME* post_constant_name(CONSTANT_NAME* in)
+    {
+        return in;
+    }
+
+    Field_name* post_field_name(FIELD_NAME* in)
+    {
+        return in;
+    }
+
+/* Transform the children of the node */
+public:
+    void children_php_script(PHP_script* in)
+    {
+        in->statements = derived()->transform_statement_list(in->statements);
+    }
+
+    void children_class_def(Class_def* in)
+    {
+        in->class_mod = derived()->transform_class_mod(in->class_mod);
+        in->class_name = derived()->transform_class_name(in->class_name);
+        in->extends = derived()->transform_class_name(in->extends);
+        in->implements = derived()->transform_interface_name_list(in->implements);
+        in->members = derived()->transform_member_list(in->members);
+    }
+
+    void children_class_mod(Class_mod* in)
+    {
+    }
+
+    void children_interface_def(Interface_def* in)
+    {
+        in->interface_name = derived()->transform_interface_name(in->interface_name);
+        in->extends = derived()->transform_interface_name_list(in->extends);
+        in->members = derived()->transform_member_list(in->members);
+    }
+
+    void children_method(Method* in)
+    {
+        in->signature = derived()->transform_signature(in->signature);
+        in->statements = derived()->transform_statement_list(in->statements);
+    }
+
+    void children_signature(Signature* in)
+    {
+        in->method_mod = derived()->transform_method_mod(in->method_mod);
+        in->method_name = derived()->transform_method_name(in->method_name);
+        in->formal_parameters = derived()->transform_formal_parameter_list(in->formal_parameters);
+    }
+
+    void children_method_mod(Method_mod* in)
+    {
+    }
+
+    void children_formal_parameter(Formal_parameter* in)
+    {
+        in->type = derived()->transform_type(in->type);
+        in->var = derived()->transform_name_with_default(in->var);
+    }
+
+    void children_type(Type* in)
+    {
+        in->class_name = derived()->transform_class_name(in->class_name);
+    }
+
+    void children_attribute(Attribute* in)
+    {
+        in->attr_mod = derived()->transform_attr_mod(in->attr_mod);
+        in->var = derived()->transform_name_with_default(in->var);
+    }
+
+    void children_attr_mod(Attr_mod* in)
+    {
+    }
+
+    void children_name_with_default(Name_with_default* in)
+    {
+        in->variable_name = derived()->transform_variable_name(in->variable_name);
+        in->default_value = derived()->transform_static_value(in->default_value);
+    }
+
+    void children_if(If* in)
+    {
+        in->variable_name = derived()->transform_variable_name(in->variable_name);
+        in->iftrue = derived()->transform_statement_list(in->iftrue);
+        in->iffalse = derived()->transform_statement_list(in->iffalse);
+    }
+
+    void children_loop(Loop* in)
+    {
+        in->statements = derived()->transform_statement_list(in->statements);
+    }
+
+    void children_foreach(Foreach* in)
+    {
+        in->arr = derived()->transform_variable_name(in->arr);
+        in->key = derived()->transform_variable_name(in->key);
+        in->val = derived()->transform_variable_name(in->val);
+        in->statements = derived()->transform_statement_list(in->statements);
+    }
+
+    void children_break(Break* in)
+    {
+        in->expr = derived()->transform_expr(in->expr);
+    }
+
+    void children_continue(Continue* in)
+    {
+        in->expr = derived()->transform_expr(in->expr);
+    }
+
+    void children_return(Return* in)
+    {
+        in->rvalue = derived()->transform_rvalue(in->rvalue);
+    }
+
+    void children_static_declaration(Static_declaration* in)
+    {
+        in->var = derived()->transform_name_with_default(in->var);
+    }
+
+    void children_global(Global* in)
+    {
+        in->variable_name = derived()->transform_variable_name(in->variable_name);
+    }
+
+    void children_try(Try* in)
+    {
+        in->statements = derived()->transform_statement_list(in->statements);
+        in->catches = derived()->transform_catch_list(in->catches);
+    }
+
+    void children_catch(Catch* in)
+    {
+        in->class_name = derived()->transform_class_name(in->class_name);
+        in->variable_name = derived()->transform_variable_name(in->variable_name);
+        in->statements = derived()->transform_statement_list(in->statements);
+    }
+
+    void children_throw(Throw* in)
+    {
+        in->variable_name = derived()->transform_variable_name(in->variable_name);
+    }
+
+    void children_assign_var(Assign_var* in)
+    {
+        in->lhs = derived()->transform_variable_name(in->lhs);
+        in->rhs = derived()->transform_expr(in->rhs);
+    }
+
+    void children_assign_field(Assign_field* in)
+    {
+        in->target = derived()->transform_target(in->target);
+        in->field_name = derived()->transform_field_name(in->field_name);
+        in->rhs = derived()->transform_rvalue(in->rhs);
+    }
+
+    void children_assign_array(Assign_array* in)
+    {
+        in->lhs = derived()->transform_variable_name(in->lhs);
+        in->index = derived()->transform_rvalue(in->index);
+        in->rhs = derived()->transform_rvalue(in->rhs);
+    }
+
+    void children_assign_var_var(Assign_var_var* in)
+    {
+        in->lhs = derived()->transform_variable_name(in->lhs);
+        in->rhs = derived()->transform_rvalue(in->rhs);
+    }
+
+    void children_assign_next(Assign_next* in)
+    {
+        in->lhs = derived()->transform_variable_name(in->lhs);
+        in->rhs = derived()->transform_rvalue(in->rhs);
+    }
+
+    void children_pre_op(Pre_op* in)
+    {
+        in->op = derived()->transform_op(in->op);
+        in->variable_name = derived()->transform_variable_name(in->variable_name);
+    }
+
+    void children_eval_expr(Eval_expr* in)
+    {
+        in->expr = derived()->transform_expr(in->expr);
+    }
+
+    void children_field_access(Field_access* in)
+    {
+        in->target = derived()->transform_target(in->target);
+        in->field_name = derived()->transform_field_name(in->field_name);
+    }
+
+    void children_array_access(Array_access* in)
+    {
+        in->variable_name = derived()->transform_variable_name(in->variable_name);
+        in->index = derived()->transform_rvalue(in->index);
+    }
+
+    void children_array_next(Array_next* in)
+    {
+        in->variable_name = derived()->transform_variable_name(in->variable_name);
+    }
+
+    void children_cast(Cast* in)
+    {
+        in->cast = derived()->transform_cast(in->cast);
+        in->variable_name = derived()->transform_variable_name(in->variable_name);
+    }
+
+    void children_unary_op(Unary_op* in)
+    {
+        in->op = derived()->transform_op(in->op);
+        in->variable_name = derived()->transform_variable_name(in->variable_name);
+    }
+
+    void children_bin_op(Bin_op* in)
+    {
+        in->left = derived()->transform_rvalue(in->left);
+        in->op = derived()->transform_op(in->op);
+        in->right = derived()->transform_rvalue(in->right);
+    }
+
+    void children_constant(Constant* in)
+    {
+        in->class_name = derived()->transform_class_name(in->class_name);
+        in->constant_name = derived()->transform_constant_name(in->constant_name);
+    }
+
+    void children_instanceof(Instanceof* in)
+    {
+        in->variable_name = derived()->transform_variable_name(in->variable_name);
+        in->class_name = derived()->transform_class_name(in->class_name);
+    }
+
+    void children_method_invocation(Method_invocation* in)
+    {
+        in->target = derived()->transform_target(in->target);
+        in->method_name = derived()->transform_method_name(in->method_name);
+        in->actual_parameters = derived()->transform_actual_parameter_list(in->actual_parameters);
+    }
+
+    void children_new(New* in)
+    {
+        in->class_name = derived()->transform_class_name(in->class_name);
+        in->actual_parameters = derived()->transform_actual_parameter_list(in->actual_parameters);
+    }
+
+    void children_variable_actual_parameter(Variable_actual_parameter* in)
+    {
+        in->target = derived()->transform_target(in->target);
+        in->variable_name = derived()->transform_variable_name(in->variable_name);
+        in->array_indices = derived()->transform_rvalue_list(in->array_indices);
+    }
+
+    void children_variable_method(Variable_method* in)
+    {
+        in->variable_name = derived()->transform_variable_name(in->variable_name);
+    }
+
+    void children_variable_variable(Variable_variable* in)
+    {
+        in->variable_name = derived()->transform_variable_name(in->variable_name);
+    }
+
+    void children_variable_class(Variable_class* in)
+    {
+        in->variable_name = derived()->transform_variable_name(in->variable_name);
+    }
+
+    void children_variable_field(Variable_field* in)
+    {
+        in->variable_name = derived()->transform_variable_name(in->variable_name);
+    }
+
+    void children_static_array(Static_array* in)
+    {
+        in->static_array_elems = derived()->transform_static_array_elem_list(in->static_array_elems);
+    }
+
+    void children_static_array_elem(Static_array_elem* in)
+    {
+        in->key = derived()->transform_static_array_key(in->key);
+        in->val = derived()->transform_static_value(in->val);
+    }
+
+/* Tokens don't have children, so these methods do nothing by default */
+public:
+    void children_foreign(FOREIGN* in)
+    {
+    }
+
+    void children_class_name(CLASS_NAME* in)
+    {
+    }
+
+    void children_interface_name(INTERFACE_NAME* in)
+    {
+    }
+
+    void children_method_name(METHOD_NAME* in)
+    {
+    }
+
+    void children_variable_name(VARIABLE_NAME* in)
+    {
+    }
+
+    void children_op(OP* in)
+    {
+    }
+
+    void children_int(INT* in)
+    {
+    }
+
+    void children_real(REAL* in)
+    {
+    }
+
+    void children_string(STRING* in)
+    {
+    }
+
+    void children_bool(BOOL* in)
+    {
+    }
+
+    void children_nil(NIL* in)
+    {
+    }
+
+    void children_cast(CAST* in)
+    {
+    }
+
+    void children_constant_name(CONSTANT_NAME* in)
+    {
+    }
+
+    void children_field_name(FIELD_NAME* in)
+    {
+    }
+
+/* Call the pre-transform, transform-children post-transform methods in order */
+/* Do not override unless you know what you are doing */
+public:
+    Statement_list* transform_statement_list(Statement_list* in)
+    {
+        Statement_list::const_iterator i;
+        Statement_list* out = new Statement_list;
+    
+        if(in == NULL)
+        	return NULL;
+    
+        for(i = in->begin(); i != in->end(); i++)
+        {
+        	out->push_back_all(derived()->transform_statement(*i));
+        }
+    
+        return out;
+    }
+
+    Statement_list* transform_statement(Statement* in)
+    {
+        Statement_list::const_iterator i;
+        Statement_list* out1 = new Statement_list;
+        Statement_list* out2 = new Statement_list;
+    
+        if(in == NULL) out1->push_back(NULL);
+        else derived()->pre_statement(in, out1);
+        for(i = out1->begin(); i != out1->end(); i++)
+        {
+        	if(*i != NULL)
+        	{
+        		derived()->children_statement(*i);
+        		derived()->post_statement(*i, out2);
+        	}
+        	else out2->push_back(NULL);
+        }
+    
+        return out2;
+    }
+
+    Class_mod* transform_class_mod(Class_mod* in)
+    {
+        if(in == NULL) return NULL;
+    
+        Class_mod* out;
+    
+        out = derived()->pre_class_mod(in);
+        if(out != NULL)
+        {
+        	derived()->children_class_mod(out);
+        	out = derived()->post_class_mod(out);
+        }
+    
+        return out;
+    }
+
+    CLASS_NAME* transform_class_name(CLASS_NAME* in)
+    {
+        if(in == NULL) return NULL;
+    
+        CLASS_NAME* out;
+    
+        out = derived()->pre_class_name(in);
+        if(out != NULL)
+        {
+        	derived()->children_class_name(out);
+        	out = derived()->post_class_name(out);
+        }
+    
+        return out;
+    }
+
+    INTERFACE_NAME_list* transform_interface_name_list(INTERFACE_NAME_list* in)
+    {
+        INTERFACE_NAME_list::const_iterator i;
+        INTERFACE_NAME_list* out = new INTERFACE_NAME_list;
+    
+        if(in == NULL)
+        	return NULL;
+    
+        for(i = in->begin(); i != in->end(); i++)
+        {
+        	out->push_back(derived()->transform_interface_name(*i));
+        }
+    
+        return out;
+    }
+
+    Member_list* transform_member_list(Member_list* in)
+    {
+        Member_list::const_iterator i;
+        Member_list* out = new Member_list;
+    
+        if(in == NULL)
+        	return NULL;
+    
+        for(i = in->begin(); i != in->end(); i++)
+        {
+        	out->push_back_all(derived()->transform_member(*i));
+        }
+    
+        return out;
+    }
+
+    Member_list* transform_member(Member* in)
+    {
+        Member_list::const_iterator i;
+        Member_list* out1 = new Member_list;
+        Member_list* out2 = new Member_list;
+    
+        if(in == NULL) out1->push_back(NULL);
+        else derived()->pre_member(in, out1);
+        for(i = out1->begin(); i != out1->end(); i++)
+        {
+        	if(*i != NULL)
+        	{
+        		derived()->children_member(*i);
+        		derived()->post_member(*i, out2);
+        	}
+        	else out2->push_back(NULL);
+        }
+    
+        return out2;
+    }
+
+    INTERFACE_NAME* transform_interface_name(INTERFACE_NAME* in)
+    {
+        if(in == NULL) return NULL;
+    
+        INTERFACE_NAME* out;
+    
+        out = derived()->pre_interface_name(in);
+        if(out != NULL)
+        {
+        	derived()->children_interface_name(out);
+        	out = derived()->post_interface_name(out);
+        }
+    
+        return out;
+    }
+
+    Signature* transform_signature(Signature* in)
+    {
+        if(in == NULL) return NULL;
+    
+        Signature* out;
+    
+        out = derived()->pre_signature(in);
+        if(out != NULL)
+        {
+        	derived()->children_signature(out);
+        	out = derived()->post_signature(out);
+        }
+    
+        return out;
+    }
+
+    Method_mod* transform_method_mod(Method_mod* in)
+    {
+        if(in == NULL) return NULL;
+    
+        Method_mod* out;
+    
+        out = derived()->pre_method_mod(in);
+        if(out != NULL)
+        {
+        	derived()->children_method_mod(out);
+        	out = derived()->post_method_mod(out);
+        }
+    
+        return out;
+    }
+
+    METHOD_NAME* transform_method_name(METHOD_NAME* in)
+    {
+        if(in == NULL) return NULL;
+    
+        METHOD_NAME* out;
+    
+        out = derived()->pre_method_name(in);
+        if(out != NULL)
+        {
+        	derived()->children_method_name(out);
+        	out = derived()->post_method_name(out);
+        }
+    
+        return out;
+    }
+
+    Formal_parameter_list* transform_formal_parameter_list(Formal_parameter_list* in)
+    {
+        Formal_parameter_list::const_iterator i;
+        Formal_parameter_list* out = new Formal_parameter_list;
+    
+        if(in == NULL)
+        	return NULL;
+    
+        for(i = in->begin(); i != in->end(); i++)
+        {
+        	out->push_back_all(derived()->transform_formal_parameter(*i));
+        }
+    
+        return out;
+    }
+
+    Formal_parameter_list* transform_formal_parameter(Formal_parameter* in)
+    {
+        Formal_parameter_list::const_iterator i;
+        Formal_parameter_list* out1 = new Formal_parameter_list;
+        Formal_parameter_list* out2 = new Formal_parameter_list;
+    
+        if(in == NULL) out1->push_back(NULL);
+        else derived()->pre_formal_parameter(in, out1);
+        for(i = out1->begin(); i != out1->end(); i++)
+        {
+        	if(*i != NULL)
+        	{
+        		derived()->children_formal_parameter(*i);
+        		derived()->post_formal_parameter(*i, out2);
+        	}
+        	else out2->push_back(NULL);
+        }
+    
+        return out2;
+    }
+
+    Type* transform_type(Type* in)
+    {
+        if(in == NULL) return NULL;
+    
+        Type* out;
+    
+        out = derived()->pre_type(in);
+        if(out != NULL)
+        {
+        	derived()->children_type(out);
+        	out = derived()->post_type(out);
+        }
+    
+        return out;
+    }
+
+    Name_with_default* transform_name_with_default(Name_with_default* in)
+    {
+        if(in == NULL) return NULL;
+    
+        Name_with_default* out;
+    
+        out = derived()->pre_name_with_default(in);
+        if(out != NULL)
+        {
+        	derived()->children_name_with_default(out);
+        	out = derived()->post_name_with_default(out);
+        }
+    
+        return out;
+    }
+
+    Attr_mod* transform_attr_mod(Attr_mod* in)
+    {
+        if(in == NULL) return NULL;
+    
+        Attr_mod* out;
+    
+        out = derived()->pre_attr_mod(in);
+        if(out != NULL)
+        {
+        	derived()->children_attr_mod(out);
+        	out = derived()->post_attr_mod(out);
+        }
+    
+        return out;
+    }
+
+    VARIABLE_NAME* transform_variable_name(VARIABLE_NAME* in)
+    {
+        if(in == NULL) return NULL;
+    
+        VARIABLE_NAME* out;
+    
+        out = derived()->pre_variable_name(in);
+        if(out != NULL)
+        {
+        	derived()->children_variable_name(out);
+        	out = derived()->post_variable_name(out);
+        }
+    
+        return out;
+    }
+
+    Static_value* transform_static_value(Static_value* in)
+    {
+        if(in == NULL) return NULL;
+    
+        Static_value* out;
+    
+        out = derived()->pre_static_value(in);
+        if(out != NULL)
+        {
+        	derived()->children_static_value(out);
+        	out = derived()->post_static_value(out);
+        }
+    
+        return out;
+    }
+
+    Expr* transform_expr(Expr* in)
+    {
+        if(in == NULL) return NULL;
+    
+        Expr* out;
+    
+        out = derived()->pre_expr(in);
+        if(out != NULL)
+        {
+        	derived()->children_expr(out);
+        	out = derived()->post_expr(out);
+        }
+    
+        return out;
+    }
+
+    Rvalue* transform_rvalue(Rvalue* in)
+    {
+        if(in == NULL) return NULL;
+    
+        Rvalue* out;
+    
+        out = derived()->pre_rvalue(in);
+        if(out != NULL)
+        {
+        	derived()->children_rvalue(out);
+        	out = derived()->post_rvalue(out);
+        }
+    
+        return out;
+    }
+
+    Variable_name* transform_variable_name(Variable_name* in)
+    {
+        if(in == NULL) return NULL;
+    
+        Variable_name* out;
+    
+        out = derived()->pre_variable_name(in);
+        if(out != NULL)
+        {
+        	derived()->children_variable_name(out);
+        	out = derived()->post_variable_name(out);
+        }
+    
+        return out;
+    }
+
+    Catch_list* transform_catch_list(Catch_list* in)
+    {
+        Catch_list::const_iterator i;
+        Catch_list* out = new Catch_list;
+    
+        if(in == NULL)
+        	return NULL;
+    
+        for(i = in->begin(); i != in->end(); i++)
+        {
+        	out->push_back_all(derived()->transform_catch(*i));
+        }
+    
+        return out;
+    }
+
+    Catch_list* transform_catch(Catch* in)
+    {
+        Catch_list::const_iterator i;
+        Catch_list* out1 = new Catch_list;
+        Catch_list* out2 = new Catch_list;
+    
+        if(in == NULL) out1->push_back(NULL);
+        else derived()->pre_catch(in, out1);
+        for(i = out1->begin(); i != out1->end(); i++)
+        {
+        	if(*i != NULL)
+        	{
+        		derived()->children_catch(*i);
+        		derived()->post_catch(*i, out2);
+        	}
+        	else out2->push_back(NULL);
+        }
+    
+        return out2;
+    }
+
+    Target* transform_target(Target* in)
+    {
+        if(in == NULL) return NULL;
+    
+        Target* out;
+    
+        out = derived()->pre_target(in);
+        if(out != NULL)
+        {
+        	derived()->children_target(out);
+        	out = derived()->post_target(out);
+        }
+    
+        return out;
+    }
+
+    Field_name* transform_field_name(Field_name* in)
+    {
+        if(in == NULL) return NULL;
+    
+        Field_name* out;
+    
+        out = derived()->pre_field_name(in);
+        if(out != NULL)
+        {
+        	derived()->children_field_name(out);
+        	out = derived()->post_field_name(out);
+        }
+    
+        return out;
+    }
+
+    OP* transform_op(OP* in)
+    {
+        if(in == NULL) return NULL;
+    
+        OP* out;
+    
+        out = derived()->pre_op(in);
+        if(out != NULL)
+        {
+        	derived()->children_op(out);
+        	out = derived()->post_op(out);
+        }
+    
+        return out;
+    }
+
+    CAST* transform_cast(CAST* in)
+    {
+        if(in == NULL) return NULL;
+    
+        CAST* out;
+    
+        out = derived()->pre_cast(in);
+        if(out != NULL)
+        {
+        	derived()->children_cast(out);
+        	out = derived()->post_cast(out);
+        }
+    
+        return out;
+    }
+
+    CONSTANT_NAME* transform_constant_name(CONSTANT_NAME* in)
+    {
+        if(in == NULL) return NULL;
+    
+        CONSTANT_NAME* out;
+    
+        out = derived()->pre_constant_name(in);
+        if(out != NULL)
+        {
+        	derived()->children_constant_name(out);
+        	out = derived()->post_constant_name(out);
+        }
+    
+        return out;
+    }
+
+    Class_name* transform_class_name(Class_name* in)
+    {
+        if(in == NULL) return NULL;
+    
+        Class_name* out;
+    
+        out = derived()->pre_class_name(in);
+        if(out != NULL)
+        {
+        	derived()->children_class_name(out);
+        	out = derived()->post_class_name(out);
+        }
+    
+        return out;
+    }
+
+    Method_name* transform_method_name(Method_name* in)
+    {
+        if(in == NULL) return NULL;
+    
+        Method_name* out;
+    
+        out = derived()->pre_method_name(in);
+        if(out != NULL)
+        {
+        	derived()->children_method_name(out);
+        	out = derived()->post_method_name(out);
+        }
+    
+        return out;
+    }
+
+    Actual_parameter_list* transform_actual_parameter_list(Actual_parameter_list* in)
+    {
+        Actual_parameter_list::const_iterator i;
+        Actual_parameter_list* out = new Actual_parameter_list;
+    
+        if(in == NULL)
+        	return NULL;
+    
+        for(i = in->begin(); i != in->end(); i++)
+        {
+        	out->push_back_all(derived()->transform_actual_parameter(*i));
+        }
+    
+        return out;
+    }
+
+    Actual_parameter_list* transform_actual_parameter(Actual_parameter* in)
+    {
+        Actual_parameter_list::const_iterator i;
+        Actual_parameter_list* out1 = new Actual_parameter_list;
+        Actual_parameter_list* out2 = new Actual_parameter_list;
+    
+        if(in == NULL) out1->push_back(NULL);
+        else derived()->pre_actual_parameter(in, out1);
+        for(i = out1->begin(); i != out1->end(); i++)
+        {
+        	if(*i != NULL)
+        	{
+        		derived()->children_actual_parameter(*i);
+        		derived()->post_actual_parameter(*i, out2);
+        	}
+        	else out2->push_back(NULL);
+        }
+    
+        return out2;
+    }
+
+    Rvalue_list* transform_rvalue_list(Rvalue_list* in)
+    {
+        Rvalue_list::const_iterator i;
+        Rvalue_list* out = new Rvalue_list;
+    
+        if(in == NULL)
+        	return NULL;
+    
+        for(i = in->begin(); i != in->end(); i++)
+        {
+        	out->push_back(derived()->transform_rvalue(*i));
+        }
+    
+        return out;
+    }
+
+    Static_array_elem_list* transform_static_array_elem_list(Static_array_elem_list* in)
+    {
+        Static_array_elem_list::const_iterator i;
+        Static_array_elem_list* out = new Static_array_elem_list;
+    
+        if(in == NULL)
+        	return NULL;
+    
+        for(i = in->begin(); i != in->end(); i++)
+        {
+        	out->push_back_all(derived()->transform_static_array_elem(*i));
+        }
+    
+        return out;
+    }
+
+    Static_array_elem_list* transform_static_array_elem(Static_array_elem* in)
+    {
+        Static_array_elem_list::const_iterator i;
+        Static_array_elem_list* out1 = new Static_array_elem_list;
+        Static_array_elem_list* out2 = new Static_array_elem_list;
+    
+        if(in == NULL) out1->push_back(NULL);
+        else derived()->pre_static_array_elem(in, out1);
+        for(i = out1->begin(); i != out1->end(); i++)
+        {
+        	if(*i != NULL)
+        	{
+        		derived()->children_static_array_elem(*i);
+        		derived()->post_static_array_elem(*i, out2);
+        	}
+        	else out2->push_back(NULL);
+        }
+    
+        return out2;
+    }
+
+    Static_array_key* transform_static_array_key(Static_array_key* in)
+    {
+        if(in == NULL) return NULL;
+    
+        Static_array_key* out;
+    
+        out = derived()->pre_static_array_key(in);
+        if(out != NULL)
+        {
+        	derived()->children_static_array_key(out);
+        	out = derived()->post_static_array_key(out);
+        }
+    
+        return out;
+    }
+
+    PHP_script* transform_php_script(PHP_script* in)
+    {
+        if(in == NULL) return NULL;
+    
+        PHP_script* out;
+    
+        out = derived()->pre_php_script(in);
+        if(out != NULL)
+        {
+        	derived()->children_php_script(out);
+        	out = derived()->post_php_script(out);
+        }
+    
+        return out;
+    }
+
+/* Invoke the right pre-transform (manual dispatching) */
+/* Do not override unless you know what you are doing */
+public:
+    void pre_statement(Statement* in, Statement_list* out)
+    {
+        switch(in->classid())
+        {
+        case Class_def::ID: 
+        	{
+        		Statement_list* local_out = new Statement_list;
+        		Statement_list::const_iterator i;
+        		derived()->pre_class_def(dynamic_cast<Class_def*>(in), local_out);
+        		for(i = local_out->begin(); i != local_out->end(); i++)
+        			out->push_back(*i);
+        	}
+        	return;
+        case Interface_def::ID: 
+        	{
+        		Statement_list* local_out = new Statement_list;
+        		Statement_list::const_iterator i;
+        		derived()->pre_interface_def(dynamic_cast<Interface_def*>(in), local_out);
+        		for(i = local_out->begin(); i != local_out->end(); i++)
+        			out->push_back(*i);
+        	}
+        	return;
+        case Method::ID: 
+        	{
+        		Method_list* local_out = new Method_list;
+        		Method_list::const_iterator i;
+        		derived()->pre_method(dynamic_cast<Method*>(in), local_out);
+        		for(i = local_out->begin(); i != local_out->end(); i++)
+        			out->push_back(*i);
+        	}
+        	return;
+        case Return::ID: 
+        	{
+        		Statement_list* local_out = new Statement_list;
+        		Statement_list::const_iterator i;
+        		derived()->pre_return(dynamic_cast<Return*>(in), local_out);
+        		for(i = local_out->begin(); i != local_out->end(); i++)
+        			out->push_back(*i);
+        	}
+        	return;
+        case Static_declaration::ID: 
+        	{
+        		Statement_list* local_out = new Statement_list;
+        		Statement_list::const_iterator i;
+        		derived()->pre_static_declaration(dynamic_cast<Static_declaration*>(in), local_out);
+        		for(i = local_out->begin(); i != local_out->end(); i++)
+        			out->push_back(*i);
+        	}
+        	return;
+        case Global::ID: 
+        	{
+        		Statement_list* local_out = new Statement_list;
+        		Statement_list::const_iterator i;
+        		derived()->pre_global(dynamic_cast<Global*>(in), local_out);
+        		for(i = local_out->begin(); i != local_out->end(); i++)
+        			out->push_back(*i);
+        	}
+        	return;
+        case Try::ID: 
+        	{
+        		Statement_list* local_out = new Statement_list;
+        		Statement_list::const_iterator i;
+        		derived()->pre_try(dynamic_cast<Try*>(in), local_out);
+        		for(i = local_out->begin(); i != local_out->end(); i++)
+        			out->push_back(*i);
+        	}
+        	return;
+        case Throw::ID: 
+        	{
+        		Statement_list* local_out = new Statement_list;
+        		Statement_list::const_iterator i;
+        		derived()->pre_throw(dynamic_cast<Throw*>(in), local_out);
+        		for(i = local_out->begin(); i != local_out->end(); i++)
+        			out->push_back(*i);
+        	}
+        	return;
+        case If::ID: 
+        	{
+        		Statement_list* local_out = new Statement_list;
+        		Statement_list::const_iterator i;
+        		derived()->pre_if(dynamic_cast<If*>(in), local_out);
+        		for(i = local_out->begin(); i != local_out->end(); i++)
+        			out->push_back(*i);
+        	}
+        	return;
+        case Loop::ID: 
+        	{
+        		Statement_list* local_out = new Statement_list;
+        		Statement_list::const_iterator i;
+        		derived()->pre_loop(dynamic_cast<Loop*>(in), local_out);
+        		for(i = local_out->begin(); i != local_out->end(); i++)
+        			out->push_back(*i);
+        	}
+        	return;
+        case Foreach::ID: 
+        	{
+        		Statement_list* local_out = new Statement_list;
+        		Statement_list::const_iterator i;
+        		derived()->pre_foreach(dynamic_cast<Foreach*>(in), local_out);
+        		for(i = local_out->begin(); i != local_out->end(); i++)
+        			out->push_back(*i);
+        	}
+        	return;
+        case Break::ID: 
+        	{
+        		Statement_list* local_out = new Statement_list;
+        		Statement_list::const_iterator i;
+        		derived()->pre_break(dynamic_cast<Break*>(in), local_out);
+        		for(i = local_out->begin(); i != local_out->end(); i++)
+        			out->push_back(*i);
+        	}
+        	return;
+        case Continue::ID: 
+        	{
+        		Statement_list* local_out = new Statement_list;
+        		Statement_list::const_iterator i;
+        		derived()->pre_continue(dynamic_cast<Continue*>(in), local_out);
+        		for(i = local_out->begin(); i != local_out->end(); i++)
+        			out->push_back(*i);
+        	}
+        	return;
+        case Assign_var::ID: 
+        	{
+        		Statement_list* local_out = new Statement_list;
+        		Statement_list::const_iterator i;
+        		derived()->pre_assign_var(dynamic_cast<Assign_var*>(in), local_out);
+        		for(i = local_out->begin(); i != local_out->end(); i++)
+        			out->push_back(*i);
+        	}
+        	return;
+        case Assign_var_var::ID: 
+        	{
+        		Statement_list* local_out = new Statement_list;
+        		Statement_list::const_iterator i;
+        		derived()->pre_assign_var_var(dynamic_cast<Assign_var_var*>(in), local_out);
+        		for(i = local_out->begin(); i != local_out->end(); i++)
+        			out->push_back(*i);
+        	}
+        	return;
+        case Assign_array::ID: 
+        	{
+        		Statement_list* local_out = new Statement_list;
+        		Statement_list::const_iterator i;
+        		derived()->pre_assign_array(dynamic_cast<Assign_array*>(in), local_out);
+        		for(i = local_out->begin(); i != local_out->end(); i++)
+        			out->push_back(*i);
+        	}
+        	return;
+        case Assign_next::ID: 
+        	{
+        		Statement_list* local_out = new Statement_list;
+        		Statement_list::const_iterator i;
+        		derived()->pre_assign_next(dynamic_cast<Assign_next*>(in), local_out);
+        		for(i = local_out->begin(); i != local_out->end(); i++)
+        			out->push_back(*i);
+        	}
+        	return;
+        case Assign_field::ID: 
+        	{
+        		Statement_list* local_out = new Statement_list;
+        		Statement_list::const_iterator i;
+        		derived()->pre_assign_field(dynamic_cast<Assign_field*>(in), local_out);
+        		for(i = local_out->begin(); i != local_out->end(); i++)
+        			out->push_back(*i);
+        	}
+        	return;
+        case Eval_expr::ID: 
+        	{
+        		Statement_list* local_out = new Statement_list;
+        		Statement_list::const_iterator i;
+        		derived()->pre_eval_expr(dynamic_cast<Eval_expr*>(in), local_out);
+        		for(i = local_out->begin(); i != local_out->end(); i++)
+        			out->push_back(*i);
+        	}
+        	return;
+        case Pre_op::ID: 
+        	{
+        		Statement_list* local_out = new Statement_list;
+        		Statement_list::const_iterator i;
+        		derived()->pre_pre_op(dynamic_cast<Pre_op*>(in), local_out);
+        		for(i = local_out->begin(); i != local_out->end(); i++)
+        			out->push_back(*i);
+        	}
+        	return;
+        case FOREIGN::ID: 
+        	out->push_back(derived()->pre_foreign(dynamic_cast<FOREIGN*>(in)));
+        	return;
+        }
+        assert(0);
+    }
+
+    void pre_member(Member* in, Member_list* out)
+    {
+        switch(in->classid())
+        {
+        case Method::ID: 
+        	{
+        		Method_list* local_out = new Method_list;
+        		Method_list::const_iterator i;
+        		derived()->pre_method(dynamic_cast<Method*>(in), local_out);
+        		for(i = local_out->begin(); i != local_out->end(); i++)
+        			out->push_back(*i);
+        	}
+        	return;
+        case Attribute::ID: 
+        	{
+        		Member_list* local_out = new Member_list;
+        		Member_list::const_iterator i;
+        		derived()->pre_attribute(dynamic_cast<Attribute*>(in), local_out);
+        		for(i = local_out->begin(); i != local_out->end(); i++)
+        			out->push_back(*i);
+        	}
+        	return;
+        }
+        assert(0);
+    }
+
+    Static_value* pre_static_value(Static_value* in)
+    {
+        switch(in->classid())
+        {
+        case INT::ID: return derived()->pre_int(dynamic_cast<INT*>(in));
+        case REAL::ID: return derived()->pre_real(dynamic_cast<REAL*>(in));
+        case STRING::ID: return derived()->pre_string(dynamic_cast<STRING*>(in));
+        case BOOL::ID: return derived()->pre_bool(dynamic_cast<BOOL*>(in));
+        case NIL::ID: return derived()->pre_nil(dynamic_cast<NIL*>(in));
+        case Static_array::ID: return derived()->pre_static_array(dynamic_cast<Static_array*>(in));
+        case Constant::ID: return derived()->pre_constant(dynamic_cast<Constant*>(in));
+        }
+        assert(0);
+    }
+
+    Expr* pre_expr(Expr* in)
+    {
+        switch(in->classid())
+        {
+        case Cast::ID: return derived()->pre_cast(dynamic_cast<Cast*>(in));
+        case Unary_op::ID: return derived()->pre_unary_op(dynamic_cast<Unary_op*>(in));
+        case Bin_op::ID: return derived()->pre_bin_op(dynamic_cast<Bin_op*>(in));
+        case Constant::ID: return derived()->pre_constant(dynamic_cast<Constant*>(in));
+        case Instanceof::ID: return derived()->pre_instanceof(dynamic_cast<Instanceof*>(in));
+        case Method_invocation::ID: return derived()->pre_method_invocation(dynamic_cast<Method_invocation*>(in));
+        case New::ID: return derived()->pre_new(dynamic_cast<New*>(in));
+        case INT::ID: return derived()->pre_int(dynamic_cast<INT*>(in));
+        case REAL::ID: return derived()->pre_real(dynamic_cast<REAL*>(in));
+        case STRING::ID: return derived()->pre_string(dynamic_cast<STRING*>(in));
+        case BOOL::ID: return derived()->pre_bool(dynamic_cast<BOOL*>(in));
+        case NIL::ID: return derived()->pre_nil(dynamic_cast<NIL*>(in));
+        case VARIABLE_NAME::ID: return derived()->pre_variable_name(dynamic_cast<VARIABLE_NAME*>(in));
+        case Variable_variable::ID: return derived()->pre_variable_variable(dynamic_cast<Variable_variable*>(in));
+        case Array_access::ID: return derived()->pre_array_access(dynamic_cast<Array_access*>(in));
+        case Field_access::ID: return derived()->pre_field_access(dynamic_cast<Field_access*>(in));
+        case Array_next::ID: return derived()->pre_array_next(dynamic_cast<Array_next*>(in));
+        case FOREIGN::ID: return derived()->pre_foreign(dynamic_cast<FOREIGN*>(in));
+        }
+        assert(0);
+    }
+
+    Rvalue* pre_rvalue(Rvalue* in)
+    {
+        switch(in->classid())
+        {
+        case INT::ID: return derived()->pre_int(dynamic_cast<INT*>(in));
+        case REAL::ID: return derived()->pre_real(dynamic_cast<REAL*>(in));
+        case STRING::ID: return derived()->pre_string(dynamic_cast<STRING*>(in));
+        case BOOL::ID: return derived()->pre_bool(dynamic_cast<BOOL*>(in));
+        case NIL::ID: return derived()->pre_nil(dynamic_cast<NIL*>(in));
+        case VARIABLE_NAME::ID: return derived()->pre_variable_name(dynamic_cast<VARIABLE_NAME*>(in));
+        }
+        assert(0);
+    }
+
+    Variable_name* pre_variable_name(Variable_name* in)
+    {
+        switch(in->classid())
+        {
+        case VARIABLE_NAME::ID: return derived()->pre_variable_name(dynamic_cast<VARIABLE_NAME*>(in));
+        case Variable_variable::ID: return derived()->pre_variable_variable(dynamic_cast<Variable_variable*>(in));
+        }
+        assert(0);
+    }
+
+    Target* pre_target(Target* in)
+    {
+        switch(in->classid())
+        {
+        case VARIABLE_NAME::ID: return derived()->pre_variable_name(dynamic_cast<VARIABLE_NAME*>(in));
+        case CLASS_NAME::ID: return derived()->pre_class_name(dynamic_cast<CLASS_NAME*>(in));
+        }
+        assert(0);
+    }
+
+    Field_name* pre_field_name(Field_name* in)
+    {
+        switch(in->classid())
+        {
+        case FIELD_NAME::ID: return derived()->pre_field_name(dynamic_cast<FIELD_NAME*>(in));
+        case Variable_field::ID: return derived()->pre_variable_field(dynamic_cast<Variable_field*>(in));
+        }
+        assert(0);
+    }
+
+    Class_name* pre_class_name(Class_name* in)
+    {
+        switch(in->classid())
+        {
+        case CLASS_NAME::ID: return derived()->pre_class_name(dynamic_cast<CLASS_NAME*>(in));
+        case Variable_class::ID: return derived()->pre_variable_class(dynamic_cast<Variable_class*>(in));
+        }
+        assert(0);
+    }
+
+    Method_name* pre_method_name(Method_name* in)
+    {
+        switch(in->classid())
+        {
+        case METHOD_NAME::ID: return derived()->pre_method_name(dynamic_cast<METHOD_NAME*>(in));
+        case Variable_method::ID: return derived()->pre_variable_method(dynamic_cast<Variable_method*>(in));
+        }
+        assert(0);
+    }
+
+    void pre_actual_parameter(Actual_parameter* in, Actual_parameter_list* out)
+    {
+        switch(in->classid())
+        {
+        case INT::ID: 
+        	out->push_back(derived()->pre_int(dynamic_cast<INT*>(in)));
+        	return;
+        case REAL::ID: 
+        	out->push_back(derived()->pre_real(dynamic_cast<REAL*>(in)));
+        	return;
+        case STRING::ID: 
+        	out->push_back(derived()->pre_string(dynamic_cast<STRING*>(in)));
+        	return;
+        case BOOL::ID: 
+        	out->push_back(derived()->pre_bool(dynamic_cast<BOOL*>(in)));
+        	return;
+        case NIL::ID: 
+        	out->push_back(derived()->pre_nil(dynamic_cast<NIL*>(in)));
+        	return;
+        case Variable_actual_parameter::ID: 
+        	{
+        		Actual_parameter_list* local_out = new Actual_parameter_list;
+        		Actual_parameter_list::const_iterator i;
+        		derived()->pre_variable_actual_parameter(dynamic_cast<Variable_actual_parameter*>(in), local_out);
+        		for(i = local_out->begin(); i != local_out->end(); i++)
+        			out->push_back(*i);
+        	}
+        	return;
+        }
+        assert(0);
+    }
+
+    Static_array_key* pre_static_array_key(Static_array_key* in)
+    {
+        switch(in->classid())
+        {
+        case INT::ID: return derived()->pre_int(dynamic_cast<INT*>(in));
+        case REAL::ID: return derived()->pre_real(dynamic_cast<REAL*>(in));
+        case STRING::ID: return derived()->pre_string(dynamic_cast<STRING*>(in));
+        case BOOL::ID: return derived()->pre_bool(dynamic_cast<BOOL*>(in));
+        case NIL::ID: return derived()->pre_nil(dynamic_cast<NIL*>(in));
+        case Constant::ID: return derived()->pre_constant(dynamic_cast<Constant*>(in));
+        }
+        assert(0);
+    }
+
+/* Invoke the right post-transform (manual dispatching) */
+/* Do not override unless you know what you are doing */
+public:
+    void post_statement(Statement* in, Statement_list* out)
+    {
+        switch(in->classid())
+        {
+        case Class_def::ID: 
+        	{
+        		Statement_list* local_out = new Statement_list;
+        		Statement_list::const_iterator i;
+        		derived()->post_class_def(dynamic_cast<Class_def*>(in), local_out);
+        		for(i = local_out->begin(); i != local_out->end(); i++)
+        			out->push_back(*i);
+        	}
+        	return;
+        case Interface_def::ID: 
+        	{
+        		Statement_list* local_out = new Statement_list;
+        		Statement_list::const_iterator i;
+        		derived()->post_interface_def(dynamic_cast<Interface_def*>(in), local_out);
+        		for(i = local_out->begin(); i != local_out->end(); i++)
+        			out->push_back(*i);
+        	}
+        	return;
+        case Method::ID: 
+        	{
+        		Method_list* local_out = new Method_list;
+        		Method_list::const_iterator i;
+        		derived()->post_method(dynamic_cast<Method*>(in), local_out);
+        		for(i = local_out->begin(); i != local_out->end(); i++)
+        			out->push_back(*i);
+        	}
+        	return;
+        case Return::ID: 
+        	{
+        		Statement_list* local_out = new Statement_list;
+        		Statement_list::const_iterator i;
+        		derived()->post_return(dynamic_cast<Return*>(in), local_out);
+        		for(i = local_out->begin(); i != local_out->end(); i++)
+        			out->push_back(*i);
+        	}
+        	return;
+        case Static_declaration::ID: 
+        	{
+        		Statement_list* local_out = new Statement_list;
+        		Statement_list::const_iterator i;
+        		derived()->post_static_declaration(dynamic_cast<Static_declaration*>(in), local_out);
+        		for(i = local_out->begin(); i != local_out->end(); i++)
+        			out->push_back(*i);
+        	}
+        	return;
+        case Global::ID: 
+        	{
+        		Statement_list* local_out = new Statement_list;
+        		Statement_list::const_iterator i;
+        		derived()->post_global(dynamic_cast<Global*>(in), local_out);
+        		for(i = local_out->begin(); i != local_out->end(); i++)
+        			out->push_back(*i);
+        	}
+        	return;
+        case Try::ID: 
+        	{
+        		Statement_list* local_out = new Statement_list;
+        		Statement_list::const_iterator i;
+        		derived()->post_try(dynamic_cast<Try*>(in), local_out);
+        		for(i = local_out->begin(); i != local_out->end(); i++)
+        			out->push_back(*i);
+        	}
+        	return;
+        case Throw::ID: 
+        	{
+        		Statement_list* local_out = new Statement_list;
+        		Statement_list::const_iterator i;
+        		derived()->post_throw(dynamic_cast<Throw*>(in), local_out);
+        		for(i = local_out->begin(); i != local_out->end(); i++)
+        			out->push_back(*i);
+        	}
+        	return;
+        case If::ID: 
+        	{
+        		Statement_list* local_out = new Statement_list;
+        		Statement_list::const_iterator i;
+        		derived()->post_if(dynamic_cast<If*>(in), local_out);
+        		for(i = local_out->begin(); i != local_out->end(); i++)
+        			out->push_back(*i);
+        	}
+        	return;
+        case Loop::ID: 
+        	{
+        		Statement_list* local_out = new Statement_list;
+        		Statement_list::const_iterator i;
+        		derived()->post_loop(dynamic_cast<Loop*>(in), local_out);
+        		for(i = local_out->begin(); i != local_out->end(); i++)
+        			out->push_back(*i);
+        	}
+        	return;
+        case Foreach::ID: 
+        	{
+        		Statement_list* local_out = new Statement_list;
+        		Statement_list::const_iterator i;
+        		derived()->post_foreach(dynamic_cast<Foreach*>(in), local_out);
+        		for(i = local_out->begin(); i != local_out->end(); i++)
+        			out->push_back(*i);
+        	}
+        	return;
+        case Break::ID: 
+        	{
+        		Statement_list* local_out = new Statement_list;
+        		Statement_list::const_iterator i;
+        		derived()->post_break(dynamic_cast<Break*>(in), local_out);
+        		for(i = local_out->begin(); i != local_out->end(); i++)
+        			out->push_back(*i);
+        	}
+        	return;
+        case Continue::ID: 
+        	{
+        		Statement_list* local_out = new Statement_list;
+        		Statement_list::const_iterator i;
+        		derived()->post_continue(dynamic_cast<Continue*>(in), local_out);
+        		for(i = local_out->begin(); i != local_out->end(); i++)
+        			out->push_back(*i);
+        	}
+        	return;
+        case Assign_var::ID: 
+        	{
+        		Statement_list* local_out = new Statement_list;
+        		Statement_list::const_iterator i;
+        		derived()->post_assign_var(dynamic_cast<Assign_var*>(in), local_out);
+        		for(i = local_out->begin(); i != local_out->end(); i++)
+        			out->push_back(*i);
+        	}
+        	return;
+        case Assign_var_var::ID: 
+        	{
+        		Statement_list* local_out = new Statement_list;
+        		Statement_list::const_iterator i;
+        		derived()->post_assign_var_var(dynamic_cast<Assign_var_var*>(in), local_out);
+        		for(i = local_out->begin(); i != local_out->end(); i++)
+        			out->push_back(*i);
+        	}
+        	return;
+        case Assign_array::ID: 
+        	{
+        		Statement_list* local_out = new Statement_list;
+        		Statement_list::const_iterator i;
+        		derived()->post_assign_array(dynamic_cast<Assign_array*>(in), local_out);
+        		for(i = local_out->begin(); i != local_out->end(); i++)
+        			out->push_back(*i);
+        	}
+        	return;
+        case Assign_next::ID: 
+        	{
+        		Statement_list* local_out = new Statement_list;
+        		Statement_list::const_iterator i;
+        		derived()->post_assign_next(dynamic_cast<Assign_next*>(in), local_out);
+        		for(i = local_out->begin(); i != local_out->end(); i++)
+        			out->push_back(*i);
+        	}
+        	return;
+        case Assign_field::ID: 
+        	{
+        		Statement_list* local_out = new Statement_list;
+        		Statement_list::const_iterator i;
+        		derived()->post_assign_field(dynamic_cast<Assign_field*>(in), local_out);
+        		for(i = local_out->begin(); i != local_out->end(); i++)
+        			out->push_back(*i);
+        	}
+        	return;
+        case Eval_expr::ID: 
+        	{
+        		Statement_list* local_out = new Statement_list;
+        		Statement_list::const_iterator i;
+        		derived()->post_eval_expr(dynamic_cast<Eval_expr*>(in), local_out);
+        		for(i = local_out->begin(); i != local_out->end(); i++)
+        			out->push_back(*i);
+        	}
+        	return;
+        case Pre_op::ID: 
+        	{
+        		Statement_list* local_out = new Statement_list;
+        		Statement_list::const_iterator i;
+        		derived()->post_pre_op(dynamic_cast<Pre_op*>(in), local_out);
+        		for(i = local_out->begin(); i != local_out->end(); i++)
+        			out->push_back(*i);
+        	}
+        	return;
+        case FOREIGN::ID: 
+        	out->push_back(derived()->post_foreign(dynamic_cast<FOREIGN*>(in)));
+        	return;
+        }
+        assert(0);
+    }
+
+    void post_member(Member* in, Member_list* out)
+    {
+        switch(in->classid())
+        {
+        case Method::ID: 
+        	{
+        		Method_list* local_out = new Method_list;
+        		Method_list::const_iterator i;
+        		derived()->post_method(dynamic_cast<Method*>(in), local_out);
+        		for(i = local_out->begin(); i != local_out->end(); i++)
+        			out->push_back(*i);
+        	}
+        	return;
+        case Attribute::ID: 
+        	{
+        		Member_list* local_out = new Member_list;
+        		Member_list::const_iterator i;
+        		derived()->post_attribute(dynamic_cast<Attribute*>(in), local_out);
+        		for(i = local_out->begin(); i != local_out->end(); i++)
+        			out->push_back(*i);
+        	}
+        	return;
+        }
+        assert(0);
+    }
+
+    Static_value* post_static_value(Static_value* in)
+    {
+        switch(in->classid())
+        {
+        case INT::ID: return derived()->post_int(dynamic_cast<INT*>(in));
+        case REAL::ID: return derived()->post_real(dynamic_cast<REAL*>(in));
+        case STRING::ID: return derived()->post_string(dynamic_cast<STRING*>(in));
+        case BOOL::ID: return derived()->post_bool(dynamic_cast<BOOL*>(in));
+        case NIL::ID: return derived()->post_nil(dynamic_cast<NIL*>(in));
+        case Static_array::ID: return derived()->post_static_array(dynamic_cast<Static_array*>(in));
+        case Constant::ID: return derived()->post_constant(dynamic_cast<Constant*>(in));
+        }
+        assert(0);
+    }
+
+    Expr* post_expr(Expr* in)
+    {
+        switch(in->classid())
+        {
+        case Cast::ID: return derived()->post_cast(dynamic_cast<Cast*>(in));
+        case Unary_op::ID: return derived()->post_unary_op(dynamic_cast<Unary_op*>(in));
+        case Bin_op::ID: return derived()->post_bin_op(dynamic_cast<Bin_op*>(in));
+        case Constant::ID: return derived()->post_constant(dynamic_cast<Constant*>(in));
+        case Instanceof::ID: return derived()->post_instanceof(dynamic_cast<Instanceof*>(in));
+        case Method_invocation::ID: return derived()->post_method_invocation(dynamic_cast<Method_invocation*>(in));
+        case New::ID: return derived()->post_new(dynamic_cast<New*>(in));
+        case INT::ID: return derived()->post_int(dynamic_cast<INT*>(in));
+        case REAL::ID: return derived()->post_real(dynamic_cast<REAL*>(in));
+        case STRING::ID: return derived()->post_string(dynamic_cast<STRING*>(in));
+        case BOOL::ID: return derived()->post_bool(dynamic_cast<BOOL*>(in));
+        case NIL::ID: return derived()->post_nil(dynamic_cast<NIL*>(in));
+        case VARIABLE_NAME::ID: return derived()->post_variable_name(dynamic_cast<VARIABLE_NAME*>(in));
+        case Variable_variable::ID: return derived()->post_variable_variable(dynamic_cast<Variable_variable*>(in));
+        case Array_access::ID: return derived()->post_array_access(dynamic_cast<Array_access*>(in));
+        case Field_access::ID: return derived()->post_field_access(dynamic_cast<Field_access*>(in));
+        case Array_next::ID: return derived()->post_array_next(dynamic_cast<Array_next*>(in));
+        case FOREIGN::ID: return derived()->post_foreign(dynamic_cast<FOREIGN*>(in));
+        }
+        assert(0);
+    }
+
+    Rvalue* post_rvalue(Rvalue* in)
+    {
+        switch(in->classid())
+        {
+        case INT::ID: return derived()->post_int(dynamic_cast<INT*>(in));
+        case REAL::ID: return derived()->post_real(dynamic_cast<REAL*>(in));
+        case STRING::ID: return derived()->post_string(dynamic_cast<STRING*>(in));
+        case BOOL::ID: return derived()->post_bool(dynamic_cast<BOOL*>(in));
+        case NIL::ID: return derived()->post_nil(dynamic_cast<NIL*>(in));
+        case VARIABLE_NAME::ID: return derived()->post_variable_name(dynamic_cast<VARIABLE_NAME*>(in));
+        }
+        assert(0);
+    }
+
+    Variable_name* post_variable_name(Variable_name* in)
+    {
+        switch(in->classid())
+        {
+        case VARIABLE_NAME::ID: return derived()->post_variable_name(dynamic_cast<VARIABLE_NAME*>(in));
+        case Variable_variable::ID: return derived()->post_variable_variable(dynamic_cast<Variable_variable*>(in));
+        }
+        assert(0);
+    }
+
+    Target* post_target(Target* in)
+    {
+        switch(in->classid())
+        {
+        case VARIABLE_NAME::ID: return derived()->post_variable_name(dynamic_cast<VARIABLE_NAME*>(in));
+        case CLASS_NAME::ID: return derived()->post_class_name(dynamic_cast<CLASS_NAME*>(in));
+        }
+        assert(0);
+    }
+
+    Field_name* post_field_name(Field_name* in)
+    {
+        switch(in->classid())
+        {
+        case FIELD_NAME::ID: return derived()->post_field_name(dynamic_cast<FIELD_NAME*>(in));
+        case Variable_field::ID: return derived()->post_variable_field(dynamic_cast<Variable_field*>(in));
+        }
+        assert(0);
+    }
+
+    Class_name* post_class_name(Class_name* in)
+    {
+        switch(in->classid())
+        {
+        case CLASS_NAME::ID: return derived()->post_class_name(dynamic_cast<CLASS_NAME*>(in));
+        case Variable_class::ID: return derived()->post_variable_class(dynamic_cast<Variable_class*>(in));
+        }
+        assert(0);
+    }
+
+    Method_name* post_method_name(Method_name* in)
+    {
+        switch(in->classid())
+        {
+        case METHOD_NAME::ID: return derived()->post_method_name(dynamic_cast<METHOD_NAME*>(in));
+        case Variable_method::ID: return derived()->post_variable_method(dynamic_cast<Variable_method*>(in));
+        }
+        assert(0);
+    }
+
+    void post_actual_parameter(Actual_parameter* in, Actual_parameter_list* out)
+    {
+        switch(in->classid())
+        {
+        case INT::ID: 
+        	out->push_back(derived()->post_int(dynamic_cast<INT*>(in)));
+        	return;
+        case REAL::ID: 
+        	out->push_back(derived()->post_real(dynamic_cast<REAL*>(in)));
+        	return;
+        case STRING::ID: 
+        	out->push_back(derived()->post_string(dynamic_cast<STRING*>(in)));
+        	return;
+        case BOOL::ID: 
+        	out->push_back(derived()->post_bool(dynamic_cast<BOOL*>(in)));
+        	return;
+        case NIL::ID: 
+        	out->push_back(derived()->post_nil(dynamic_cast<NIL*>(in)));
+        	return;
+        case Variable_actual_parameter::ID: 
+        	{
+        		Actual_parameter_list* local_out = new Actual_parameter_list;
+        		Actual_parameter_list::const_iterator i;
+        		derived()->post_variable_actual_parameter(dynamic_cast<Variable_actual_parameter*>(in), local_out);
+        		for(i = local_out->begin(); i != local_out->end(); i++)
+        			out->push_back(*i);
+        	}
+        	return;
+        }
+        assert(0);
+    }
+
+    Static_array_key* post_static_array_key(Static_array_key* in)
+    {
+        switch(in->classid())
+        {
+        case INT::ID: return derived()->post_int(dynamic_cast<INT*>(in));
+        case REAL::ID: return derived()->post_real(dynamic_cast<REAL*>(in));
+        case STRING::ID: return derived()->post_string(dynamic_cast<STRING*>(in));
+        case BOOL::ID: return derived()->post_bool(dynamic_cast<BOOL*>(in));
+        case NIL::ID: return derived()->post_nil(dynamic_cast<NIL*>(in));
+        case Constant::ID: return derived()->post_constant(dynamic_cast<Constant*>(in));
+        }
+        assert(0);
+    }
+
+/* Invoke the right transform-children (manual dispatching) */
+/* Do not override unless you what you are doing */
+public:
+    void children_statement(Statement* in)
+    {
+        switch(in->classid())
+        {
+        case Class_def::ID:
+        	derived()->children_class_def(dynamic_cast<Class_def*>(in));
+        	break;
+        case Interface_def::ID:
+        	derived()->children_interface_def(dynamic_cast<Interface_def*>(in));
+        	break;
+        case Method::ID:
+        	derived()->children_method(dynamic_cast<Method*>(in));
+        	break;
+        case Return::ID:
+        	derived()->children_return(dynamic_cast<Return*>(in));
+        	break;
+        case Static_declaration::ID:
+        	derived()->children_static_declaration(dynamic_cast<Static_declaration*>(in));
+        	break;
+        case Global::ID:
+        	derived()->children_global(dynamic_cast<Global*>(in));
+        	break;
+        case Try::ID:
+        	derived()->children_try(dynamic_cast<Try*>(in));
+        	break;
+        case Throw::ID:
+        	derived()->children_throw(dynamic_cast<Throw*>(in));
+        	break;
+        case If::ID:
+        	derived()->children_if(dynamic_cast<If*>(in));
+        	break;
+        case Loop::ID:
+        	derived()->children_loop(dynamic_cast<Loop*>(in));
+        	break;
+        case Foreach::ID:
+        	derived()->children_foreach(dynamic_cast<Foreach*>(in));
+        	break;
+        case Break::ID:
+        	derived()->children_break(dynamic_cast<Break*>(in));
+        	break;
+        case Continue::ID:
+        	derived()->children_continue(dynamic_cast<Continue*>(in));
+        	break;
+        case Assign_var::ID:
+        	derived()->children_assign_var(dynamic_cast<Assign_var*>(in));
+        	break;
+        case Assign_var_var::ID:
+        	derived()->children_assign_var_var(dynamic_cast<Assign_var_var*>(in));
+        	break;
+        case Assign_array::ID:
+        	derived()->children_assign_array(dynamic_cast<Assign_array*>(in));
+        	break;
+        case Assign_next::ID:
+        	derived()->children_assign_next(dynamic_cast<Assign_next*>(in));
+        	break;
+        case Assign_field::ID:
+        	derived()->children_assign_field(dynamic_cast<Assign_field*>(in));
+        	break;
+        case Eval_expr::ID:
+        	derived()->children_eval_expr(dynamic_cast<Eval_expr*>(in));
+        	break;
+        case Pre_op::ID:
+        	derived()->children_pre_op(dynamic_cast<Pre_op*>(in));
+        	break;
+        case FOREIGN::ID:
+        	derived()->children_foreign(dynamic_cast<FOREIGN*>(in));
+        	break;
+        }
+    }
+
+    void children_member(Member* in)
+    {
+        switch(in->classid())
+        {
+        case Method::ID:
+        	derived()->children_method(dynamic_cast<Method*>(in));
+        	break;
+        case Attribute::ID:
+        	derived()->children_attribute(dynamic_cast<Attribute*>(in));
+        	break;
+        }
+    }
+
+    void children_static_value(Static_value* in)
+    {
+        switch(in->classid())
+        {
+        case INT::ID:
+        	derived()->children_int(dynamic_cast<INT*>(in));
+        	break;
+        case REAL::ID:
+        	derived()->children_real(dynamic_cast<REAL*>(in));
+        	break;
+        case STRING::ID:
+        	derived()->children_string(dynamic_cast<STRING*>(in));
+        	break;
+        case BOOL::ID:
+        	derived()->children_bool(dynamic_cast<BOOL*>(in));
+        	break;
+        case NIL::ID:
+        	derived()->children_nil(dynamic_cast<NIL*>(in));
+        	break;
+        case Static_array::ID:
+        	derived()->children_static_array(dynamic_cast<Static_array*>(in));
+        	break;
+        case Constant::ID:
+        	derived()->children_constant(dynamic_cast<Constant*>(in));
+        	break;
+        }
+    }
+
+    void children_expr(Expr* in)
+    {
+        switch(in->classid())
+        {
+        case Cast::ID:
+        	derived()->children_cast(dynamic_cast<Cast*>(in));
+        	break;
+        case Unary_op::ID:
+        	derived()->children_unary_op(dynamic_cast<Unary_op*>(in));
+        	break;
+        case Bin_op::ID:
+        	derived()->children_bin_op(dynamic_cast<Bin_op*>(in));
+        	break;
+        case Constant::ID:
+        	derived()->children_constant(dynamic_cast<Constant*>(in));
+        	break;
+        case Instanceof::ID:
+        	derived()->children_instanceof(dynamic_cast<Instanceof*>(in));
+        	break;
+        case Method_invocation::ID:
+        	derived()->children_method_invocation(dynamic_cast<Method_invocation*>(in));
+        	break;
+        case New::ID:
+        	derived()->children_new(dynamic_cast<New*>(in));
+        	break;
+        case INT::ID:
+        	derived()->children_int(dynamic_cast<INT*>(in));
+        	break;
+        case REAL::ID:
+        	derived()->children_real(dynamic_cast<REAL*>(in));
+        	break;
+        case STRING::ID:
+        	derived()->children_string(dynamic_cast<STRING*>(in));
+        	break;
+        case BOOL::ID:
+        	derived()->children_bool(dynamic_cast<BOOL*>(in));
+        	break;
+        case NIL::ID:
+        	derived()->children_nil(dynamic_cast<NIL*>(in));
+        	break;
+        case VARIABLE_NAME::ID:
+        	derived()->children_variable_name(dynamic_cast<VARIABLE_NAME*>(in));
+        	break;
+        case Variable_variable::ID:
+        	derived()->children_variable_variable(dynamic_cast<Variable_variable*>(in));
+        	break;
+        case Array_access::ID:
+        	derived()->children_array_access(dynamic_cast<Array_access*>(in));
+        	break;
+        case Field_access::ID:
+        	derived()->children_field_access(dynamic_cast<Field_access*>(in));
+        	break;
+        case Array_next::ID:
+        	derived()->children_array_next(dynamic_cast<Array_next*>(in));
+        	break;
+        case FOREIGN::ID:
+        	derived()->children_foreign(dynamic_cast<FOREIGN*>(in));
+        	break;
+        }
+    }
+
+    void children_rvalue(Rvalue* in)
+    {
+        switch(in->classid())
+        {
+        case INT::ID:
+        	derived()->children_int(dynamic_cast<INT*>(in));
+        	break;
+        case REAL::ID:
+        	derived()->children_real(dynamic_cast<REAL*>(in));
+        	break;
+        case STRING::ID:
+        	derived()->children_string(dynamic_cast<STRING*>(in));
+        	break;
+        case BOOL::ID:
+        	derived()->children_bool(dynamic_cast<BOOL*>(in));
+        	break;
+        case NIL::ID:
+        	derived()->children_nil(dynamic_cast<NIL*>(in));
+        	break;
+        case VARIABLE_NAME::ID:
+        	derived()->children_variable_name(dynamic_cast<VARIABLE_NAME*>(in));
+        	break;
+        }
+    }
+
+    void children_variable_name(Variable_name* in)
+    {
+        switch(in->classid())
+        {
+        case VARIABLE_NAME::ID:
+        	derived()->children_variable_name(dynamic_cast<VARIABLE_NAME*>(in));
+        	break;
+        case Variable_variable::ID:
+        	derived()->children_variable_variable(dynamic_cast<Variable_variable*>(in));
+        	break;
+        }
+    }
+
+    void children_target(Target* in)
+    {
+        switch(in->classid())
+        {
+        case VARIABLE_NAME::ID:
+        	derived()->children_variable_name(dynamic_cast<VARIABLE_NAME*>(in));
+        	break;
+        case CLASS_NAME::ID:
+        	derived()->children_class_name(dynamic_cast<CLASS_NAME*>(in));
+        	break;
+        }
+    }
+
+    void children_field_name(Field_name* in)
+    {
+        switch(in->classid())
+        {
+        case FIELD_NAME::ID:
+        	derived()->children_field_name(dynamic_cast<FIELD_NAME*>(in));
+        	break;
+        case Variable_field::ID:
+        	derived()->children_variable_field(dynamic_cast<Variable_field*>(in));
+        	break;
+        }
+    }
+
+    void children_class_name(Class_name* in)
+    {
+        switch(in->classid())
+        {
+        case CLASS_NAME::ID:
+        	derived()->children_class_name(dynamic_cast<CLASS_NAME*>(in));
+        	break;
+        case Variable_class::ID:
+        	derived()->children_variable_class(dynamic_cast<Variable_class*>(in));
+        	break;
+        }
+    }
+
+    void children_method_name(Method_name* in)
+    {
+        switch(in->classid())
+        {
+        case METHOD_NAME::ID:
+        	derived()->children_method_name(dynamic_cast<METHOD_NAME*>(in));
+        	break;
+        case Variable_method::ID:
+        	derived()->children_variable_method(dynamic_cast<Variable_method*>(in));
+        	break;
+        }
+    }
+
+    void children_actual_parameter(Actual_parameter* in)
+    {
+        switch(in->classid())
+        {
+        case INT::ID:
+        	derived()->children_int(dynamic_cast<INT*>(in));
+        	break;
+        case REAL::ID:
+        	derived()->children_real(dynamic_cast<REAL*>(in));
+        	break;
+        case STRING::ID:
+        	derived()->children_string(dynamic_cast<STRING*>(in));
+        	break;
+        case BOOL::ID:
+        	derived()->children_bool(dynamic_cast<BOOL*>(in));
+        	break;
+        case NIL::ID:
+        	derived()->children_nil(dynamic_cast<NIL*>(in));
+        	break;
+        case Variable_actual_parameter::ID:
+        	derived()->children_variable_actual_parameter(dynamic_cast<Variable_actual_parameter*>(in));
+        	break;
+        }
+    }
+
+    void children_static_array_key(Static_array_key* in)
+    {
+        switch(in->classid())
+        {
+        case INT::ID:
+        	derived()->children_int(dynamic_cast<INT*>(in));
+        	break;
+        case REAL::ID:
+        	derived()->children_real(dynamic_cast<REAL*>(in));
+        	break;
+        case STRING::ID:
+        	derived()->children_string(dynamic_cast<STRING*>(in));
+        	break;
+        case BOOL::ID:
+        	derived()->children_bool(dynamic_cast<BOOL*>(in));
+        	break;
+        case NIL::ID:
+        	derived()->children_nil(dynamic_cast<NIL*>(in));
+        	break;
+        case Constant::ID:
+        	derived()->children_constant(dynamic_cast<Constant*>(in));
+        	break;
+        }
+    }
+
+protected:
+    Derived* derived()
+    {
+    	return static_cast<Derived*>(this);
+    }
+};
+}
+
+
+#endif
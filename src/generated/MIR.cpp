@@ -2253,7 +2253,7 @@ Class_def::Class_def(const char* name)
 {
     {
 		this->class_mod = new Class_mod(false, false);
-		this->class_name = new CLASS_NAME(new String(name));
+		this->class_name = new CLASS_NAME(intern (name));
 		this->extends = NULL;
 		this->implements = new INTERFACE_NAME_list;
 		this->members = new Member_list;
@@ -8962,7 +8962,7 @@ void CLASS_NAME::assert_valid()
 CLASS_NAME::CLASS_NAME(const char* name)
 {
     {
-		this->value = new String (name);
+		this->value = intern (name);
 	}
 }
 
@@ -9151,7 +9151,7 @@ void METHOD_NAME::assert_valid()
 METHOD_NAME::METHOD_NAME(const char* name)
 {
     {
-		this->value = new String (name);
+		this->value = intern (name);
 	}
 }
 
@@ -9522,7 +9522,7 @@ void FIELD_NAME::assert_valid()
 FIELD_NAME::FIELD_NAME(const char* name)
 {
     {
-		this->value = new String (name);
+		this->value = intern (name);
 	}
 }
 
@@ -9916,7 +9916,7 @@ VARIABLE_NAME::VARIABLE_NAME(String* name)
 VARIABLE_NAME::VARIABLE_NAME(const char* name)
 {
     {
-		this->value = new String (name);
+		this->value = intern (name);
 	}
 }
 
@@ -0,0 +1,3789 @@
+#ifndef _MIR_STATIC_VISITOR_H_
+#define _MIR_STATIC_VISITOR_H_
+
+/* Generated from MIR_visitor.h and MIR_visitor.cpp by misc/make_static_visitor.pl */
+
+#include <iostream>
+#include <sstream>
+#include <iomanip>
+#include "lib/error.h"
+#include "lib/Object.h"
+#include "lib/List.h"
+#include "lib/String.h"
+#include "lib/Boolean.h"
+#include "lib/Integer.h"
+#include "lib/AttrMap.h"
+#include "process_ir/IR.h"
+#include "process_ir/Foreach.h"
+#include <list>
+#include <string>
+#include <cstring>
+#include <cassert>
+
+
+#include "MIR.h"
+
+namespace MIR{
+/*
+ * The same as Visitor, but dispatched statically: methods are called on the
+ * Derived class, which hides the methods it wants to replace. Since the
+ * methods are not virtual, a method which hides one overload of a name hides
+ * them all; bring the rest back with a using declaration.
+ */
+template <class Derived>
+class Static_visitor
+{
+public:
+/* Invoked before the children are visited */
+public:
+    void pre_node(Node* in)
+    {
+    }
+
+    void pre_php_script(PHP_script* in)
+    {
+    }
+
+    void pre_statement(Statement* in)
+    {
+    }
+
+    void pre_class_def(Class_def* in)
+    {
+    }
+
+    void pre_class_mod(Class_mod* in)
+    {
+    }
+
+    void pre_interface_def(Interface_def* in)
+    {
+    }
+
+    void pre_member(Member* in)
+    {
+    }
+
+    void pre_method(Method* in)
+    {
+    }
+
+    void pre_signature(Signature* in)
+    {
+    }
+
+    void pre_method_mod(Method_mod* in)
+    {
+    }
+
+    void pre_formal_parameter(Formal_parameter* in)
+    {
+    }
+
+    void pre_type(Type* in)
+    {
+    }
+
+    void pre_attribute(Attribute* in)
+    {
+    }
+
+    void pre_attr_mod(Attr_mod* in)
+    {
+    }
+
+    void pre_name_with_default(Name_with_default* in)
+    {
+    }
+
+    void pre_class_alias(Class_alias* in)
+    {
+    }
+
+    void pre_interface_alias(Interface_alias* in)
+    {
+    }
+
+    void pre_method_alias(Method_alias* in)
+    {
+    }
+
+    void pre_return(Return* in)
+    {
+    }
+
+    void pre_static_declaration(Static_declaration* in)
+    {
+    }
+
+    void pre_global(Global* in)
+    {
+    }
+
+    void pre_try(Try* in)
+    {
+    }
+
+    void pre_catch(Catch* in)
+    {
+    }
+
+    void pre_throw(Throw* in)
+    {
+    }
+
+    void pre_assign_var(Assign_var* in)
+    {
+    }
+
+    void pre_assign_field(Assign_field* in)
+    {
+    }
+
+    void pre_assign_array(Assign_array* in)
+    {
+    }
+
+    void pre_assign_var_var(Assign_var_var* in)
+    {
+    }
+
+    void pre_assign_next(Assign_next* in)
+    {
+    }
+
+    void pre_pre_op(Pre_op* in)
+    {
+    }
+
+    void pre_eval_expr(Eval_expr* in)
+    {
+    }
+
+    void pre_unset(Unset* in)
+    {
+    }
+
+    void pre_isset(Isset* in)
+    {
+    }
+
+    void pre_expr(Expr* in)
+    {
+    }
+
+    void pre_literal(Literal* in)
+    {
+    }
+
+    void pre_rvalue(Rvalue* in)
+    {
+    }
+
+    void pre_field_access(Field_access* in)
+    {
+    }
+
+    void pre_array_access(Array_access* in)
+    {
+    }
+
+    void pre_array_next(Array_next* in)
+    {
+    }
+
+    void pre_cast(Cast* in)
+    {
+    }
+
+    void pre_unary_op(Unary_op* in)
+    {
+    }
+
+    void pre_bin_op(Bin_op* in)
+    {
+    }
+
+    void pre_constant(Constant* in)
+    {
+    }
+
+    void pre_instanceof(Instanceof* in)
+    {
+    }
+
+    void pre_target(Target* in)
+    {
+    }
+
+    void pre_method_invocation(Method_invocation* in)
+    {
+    }
+
+    void pre_new(New* in)
+    {
+    }
+
+    void pre_actual_parameter(Actual_parameter* in)
+    {
+    }
+
+    void pre_method_name(Method_name* in)
+    {
+    }
+
+    void pre_variable_name(Variable_name* in)
+    {
+    }
+
+    void pre_class_name(Class_name* in)
+    {
+    }
+
+    void pre_field_name(Field_name* in)
+    {
+    }
+
+    void pre_variable_method(Variable_method* in)
+    {
+    }
+
+    void pre_variable_variable(Variable_variable* in)
+    {
+    }
+
+    void pre_variable_class(Variable_class* in)
+    {
+    }
+
+    void pre_variable_field(Variable_field* in)
+    {
+    }
+
+    void pre_static_value(Static_value* in)
+    {
+    }
+
+    void pre_static_array(Static_array* in)
+    {
+    }
+
+    void pre_static_array_elem(Static_array_elem* in)
+    {
+    }
+
+    void pre_static_array_key(Static_array_key* in)
+    {
+    }
+
+    void pre_branch(Branch* in)
+    {
+    }
+
+    void pre_goto(Goto* in)
+    {
+    }
+
+    void pre_label(Label* in)
+    {
+    }
+
+    void pre_foreach_reset(Foreach_reset* in)
+    {
+    }
+
+    void pre_foreach_next(Foreach_next* in)
+    {
+    }
+
+    void pre_foreach_end(Foreach_end* in)
+    {
+    }
+
+    void pre_foreach_has_key(Foreach_has_key* in)
+    {
+    }
+
+    void pre_foreach_get_key(Foreach_get_key* in)
+    {
+    }
+
+    void pre_foreach_get_val(Foreach_get_val* in)
+    {
+    }
+
+    void pre_param_is_ref(Param_is_ref* in)
+    {
+    }
+
+    void pre_identifier(Identifier* in)
+    {
+    }
+
+    void pre_param_index(PARAM_INDEX* in)
+    {
+    }
+
+    void pre_foreign(FOREIGN* in)
+    {
+    }
+
+    void pre_class_name(CLASS_NAME* in)
+    {
+    }
+
+    void pre_interface_name(INTERFACE_NAME* in)
+    {
+    }
+
+    void pre_method_name(METHOD_NAME* in)
+    {
+    }
+
+    void pre_variable_name(VARIABLE_NAME* in)
+    {
+    }
+
+    void pre_op(OP* in)
+    {
+    }
+
+    void pre_int(INT* in)
+    {
+    }
+
+    void pre_real(REAL* in)
+    {
+    }
+
+    void pre_string(STRING* in)
+    {
+    }
+
+    void pre_bool(BOOL* in)
+    {
+    }
+
+    void pre_nil(NIL* in)
+    {
+    }
+
+    void pre_cast(CAST* in)
+    {
+    }
+
+    void pre_constant_name(CONSTANT_NAME* in)
+    {
+    }
+
+    void pre_field_name(FIELD_NAME* in)
+    {
+    }
+
+    void pre_label_name(LABEL_NAME* in)
+    {
+    }
+
+    void pre_ht_iterator(HT_ITERATOR* in)
+    {
+    }
+
+/* Invoked after the children have been visited */
+public:
+    void post_node(Node* in)
+    {
+    }
+
+    void post_php_script(PHP_script* in)
+    {
+    }
+
+    void post_statement(Statement* in)
+    {
+    }
+
+    void post_class_def(Class_def* in)
+    {
+    }
+
+    void post_class_mod(Class_mod* in)
+    {
+    }
+
+    void post_interface_def(Interface_def* in)
+    {
+    }
+
+    void post_member(Member* in)
+    {
+    }
+
+    void post_method(Method* in)
+    {
+    }
+
+    void post_signature(Signature* in)
+    {
+    }
+
+    void post_method_mod(Method_mod* in)
+    {
+    }
+
+    void post_formal_parameter(Formal_parameter* in)
+    {
+    }
+
+    void post_type(Type* in)
+    {
+    }
+
+    void post_attribute(Attribute* in)
+    {
+    }
+
+    void post_attr_mod(Attr_mod* in)
+    {
+    }
+
+    void post_name_with_default(Name_with_default* in)
+    {
+    }
+
+    void post_class_alias(Class_alias* in)
+    {
+    }
+
+    void post_interface_alias(Interface_alias* in)
+    {
+    }
+
+    void post_method_alias(Method_alias* in)
+    {
+    }
+
+    void post_return(Return* in)
+    {
+    }
+
+    void post_static_declaration(Static_declaration* in)
+    {
+    }
+
+    void post_global(Global* in)
+    {
+    }
+
+    void post_try(Try* in)
+    {
+    }
+
+    void post_catch(Catch* in)
+    {
+    }
+
+    void post_throw(Throw* in)
+    {
+    }
+
+    void post_assign_var(Assign_var* in)
+    {
+    }
+
+    void post_assign_field(Assign_field* in)
+    {
+    }
+
+    void post_assign_array(Assign_array* in)
+    {
+    }
+
+    void post_assign_var_var(Assign_var_var* in)
+    {
+    }
+
+    void post_assign_next(Assign_next* in)
+    {
+    }
+
+    void post_pre_op(Pre_op* in)
+    {
+    }
+
+    void post_eval_expr(Eval_expr* in)
+    {
+    }
+
+    void post_unset(Unset* in)
+    {
+    }
+
+    void post_isset(Isset* in)
+    {
+    }
+
+    void post_expr(Expr* in)
+    {
+    }
+
+    void post_literal(Literal* in)
+    {
+    }
+
+    void post_rvalue(Rvalue* in)
+    {
+    }
+
+    void post_field_access(Field_access* in)
+    {
+    }
+
+    void post_array_access(Array_access* in)
+    {
+    }
+
+    void post_array_next(Array_next* in)
+    {
+    }
+
+    void post_cast(Cast* in)
+    {
+    }
+
+    void post_unary_op(Unary_op* in)
+    {
+    }
+
+    void post_bin_op(Bin_op* in)
+    {
+    }
+
+    void post_constant(Constant* in)
+    {
+    }
+
+    void post_instanceof(Instanceof* in)
+    {
+    }
+
+    void post_target(Target* in)
+    {
+    }
+
+    void post_method_invocation(Method_invocation* in)
+    {
+    }
+
+    void post_new(New* in)
+    {
+    }
+
+    void post_actual_parameter(Actual_parameter* in)
+    {
+    }
+
+    void post_method_name(Method_name* in)
+    {
+    }
+
+    void post_variable_name(Variable_name* in)
+    {
+    }
+
+    void post_class_name(Class_name* in)
+    {
+    }
+
+    void post_field_name(Field_name* in)
+    {
+    }
+
+    void post_variable_method(Variable_method* in)
+    {
+    }
+
+    void post_variable_variable(Variable_variable* in)
+    {
+    }
+
+    void post_variable_class(Variable_class* in)
+    {
+    }
+
+    void post_variable_field(Variable_field* in)
+    {
+    }
+
+    void post_static_value(Static_value* in)
+    {
+    }
+
+    void post_static_array(Static_array* in)
+    {
+    }
+
+    void post_static_array_elem(Static_array_elem* in)
+    {
+    }
+
+    void post_static_array_key(Static_array_key* in)
+    {
+    }
+
+    void post_branch(Branch* in)
+    {
+    }
+
+    void post_goto(Goto* in)
+    {
+    }
+
+    void post_label(Label* in)
+    {
+    }
+
+    void post_foreach_reset(Foreach_reset* in)
+    {
+    }
+
+    void post_foreach_next(Foreach_next* in)
+    {
+    }
+
+    void post_foreach_end(Foreach_end* in)
+    {
+    }
+
+    void post_foreach_has_key(Foreach_has_key* in)
+    {
+    }
+
+    void post_foreach_get_key(Foreach_get_key* in)
+    {
+    }
+
+    void post_foreach_get_val(Foreach_get_val* in)
+    {
+    }
+
+    void post_param_is_ref(Param_is_ref* in)
+    {
+    }
+
+    void post_identifier(Identifier* in)
+    {
+    }
+
+    void post_param_index(PARAM_INDEX* in)
+    {
+    }
+
+    void post_foreign(FOREIGN* in)
+    {
+    }
+
+    void post_class_name(CLASS_NAME* in)
+    {
+    }
+
+    void post_interface_name(INTERFACE_NAME* in)
+    {
+    }
+
+    void post_method_name(METHOD_NAME* in)
+    {
+    }
+
+    void post_variable_name(VARIABLE_NAME* in)
+    {
+    }
+
+    void post_op(OP* in)
+    {
+    }
+
+    void post_int(INT* in)
+    {
+    }
+
+    void post_real(REAL* in)
+    {
+    }
+
+    void post_string(STRING* in)
+    {
+    }
+
+    void post_bool(BOOL* in)
+    {
+    }
+
+    void post_nil(NIL* in)
+    {
+    }
+
+    void post_cast(CAST* in)
+    {
+    }
+
+    void post_constant_name(CONSTANT_NAME* in)
+    {
+    }
+
+    void post_field_name(FIELD_NAME* in)
+    {
+    }
+
+    void post_label_name(LABEL_NAME* in)
+    {
+    }
+
+    void post_ht_iterator(HT_ITERATOR* in)
+    {
+    }
+
+/* Visit the children of a node */
+public:
+    void children_php_script(PHP_script* in)
+    {
+        derived()->visit_statement_list(in->statements);
+    }
+
+    void children_class_def(Class_def* in)
+    {
+        derived()->visit_class_mod(in->class_mod);
+        derived()->visit_class_name(in->class_name);
+        derived()->visit_class_name(in->extends);
+        derived()->visit_interface_name_list(in->implements);
+        derived()->visit_member_list(in->members);
+    }
+
+    void children_class_mod(Class_mod* in)
+    {
+        derived()->visit_marker("is_abstract", in->is_abstract);
+        derived()->visit_marker("is_final", in->is_final);
+    }
+
+    void children_interface_def(Interface_def* in)
+    {
+        derived()->visit_interface_name(in->interface_name);
+        derived()->visit_interface_name_list(in->extends);
+        derived()->visit_member_list(in->members);
+    }
+
+    void children_method(Method* in)
+    {
+        derived()->visit_signature(in->signature);
+        derived()->visit_statement_list(in->statements);
+    }
+
+    void children_signature(Signature* in)
+    {
+        derived()->visit_method_mod(in->method_mod);
+        derived()->visit_marker("pass_rest_by_ref", in->pass_rest_by_ref);
+        derived()->visit_marker("return_by_ref", in->return_by_ref);
+        derived()->visit_method_name(in->method_name);
+        derived()->visit_formal_parameter_list(in->formal_parameters);
+    }
+
+    void children_method_mod(Method_mod* in)
+    {
+        derived()->visit_marker("is_public", in->is_public);
+        derived()->visit_marker("is_protected", in->is_protected);
+        derived()->visit_marker("is_private", in->is_private);
+        derived()->visit_marker("is_static", in->is_static);
+        derived()->visit_marker("is_abstract", in->is_abstract);
+        derived()->visit_marker("is_final", in->is_final);
+    }
+
+    void children_formal_parameter(Formal_parameter* in)
+    {
+        derived()->visit_type(in->type);
+        derived()->visit_marker("is_ref", in->is_ref);
+        derived()->visit_name_with_default(in->var);
+    }
+
+    void children_type(Type* in)
+    {
+        derived()->visit_class_name(in->class_name);
+    }
+
+    void children_attribute(Attribute* in)
+    {
+        derived()->visit_attr_mod(in->attr_mod);
+        derived()->visit_name_with_default(in->var);
+    }
+
+    void children_attr_mod(Attr_mod* in)
+    {
+        derived()->visit_marker("is_public", in->is_public);
+        derived()->visit_marker("is_protected", in->is_protected);
+        derived()->visit_marker("is_private", in->is_private);
+        derived()->visit_marker("is_static", in->is_static);
+        derived()->visit_marker("is_const", in->is_const);
+    }
+
+    void children_name_with_default(Name_with_default* in)
+    {
+        derived()->visit_variable_name(in->variable_name);
+        derived()->visit_static_value(in->default_value);
+    }
+
+    void children_class_alias(Class_alias* in)
+    {
+        derived()->visit_class_name(in->alias);
+        derived()->visit_class_name(in->class_name);
+    }
+
+    void children_interface_alias(Interface_alias* in)
+    {
+        derived()->visit_interface_name(in->alias);
+        derived()->visit_interface_name(in->interface_name);
+    }
+
+    void children_method_alias(Method_alias* in)
+    {
+        derived()->visit_method_name(in->alias);
+        derived()->visit_method_name(in->method_name);
+    }
+
+    void children_return(Return* in)
+    {
+        derived()->visit_rvalue(in->rvalue);
+    }
+
+    void children_static_declaration(Static_declaration* in)
+    {
+        derived()->visit_name_with_default(in->var);
+    }
+
+    void children_global(Global* in)
+    {
+        derived()->visit_variable_name(in->variable_name);
+    }
+
+    void children_try(Try* in)
+    {
+        derived()->visit_statement_list(in->statements);
+        derived()->visit_catch_list(in->catches);
+    }
+
+    void children_catch(Catch* in)
+    {
+        derived()->visit_class_name(in->class_name);
+        derived()->visit_variable_name(in->variable_name);
+        derived()->visit_statement_list(in->statements);
+    }
+
+    void children_throw(Throw* in)
+    {
+        derived()->visit_variable_name(in->variable_name);
+    }
+
+    void children_assign_var(Assign_var* in)
+    {
+        derived()->visit_variable_name(in->lhs);
+        derived()->visit_marker("is_ref", in->is_ref);
+        derived()->visit_expr(in->rhs);
+    }
+
+    void children_assign_field(Assign_field* in)
+    {
+        derived()->visit_target(in->target);
+        derived()->visit_field_name(in->field_name);
+        derived()->visit_marker("is_ref", in->is_ref);
+        derived()->visit_rvalue(in->rhs);
+    }
+
+    void children_assign_array(Assign_array* in)
+    {
+        derived()->visit_variable_name(in->lhs);
+        derived()->visit_rvalue(in->index);
+        derived()->visit_marker("is_ref", in->is_ref);
+        derived()->visit_rvalue(in->rhs);
+    }
+
+    void children_assign_var_var(Assign_var_var* in)
+    {
+        derived()->visit_variable_name(in->lhs);
+        derived()->visit_marker("is_ref", in->is_ref);
+        derived()->visit_rvalue(in->rhs);
+    }
+
+    void children_assign_next(Assign_next* in)
+    {
+        derived()->visit_variable_name(in->lhs);
+        derived()->visit_marker("is_ref", in->is_ref);
+        derived()->visit_rvalue(in->rhs);
+    }
+
+    void children_pre_op(Pre_op* in)
+    {
+        derived()->visit_op(in->op);
+        derived()->visit_variable_name(in->variable_name);
+    }
+
+    void children_eval_expr(Eval_expr* in)
+    {
+        derived()->visit_expr(in->expr);
+    }
+
+    void children_unset(Unset* in)
+    {
+        derived()->visit_target(in->target);
+        derived()->visit_variable_name(in->variable_name);
+        derived()->visit_rvalue_list(in->array_indices);
+    }
+
+    void children_isset(Isset* in)
+    {
+        derived()->visit_target(in->target);
+        derived()->visit_variable_name(in->variable_name);
+        derived()->visit_rvalue_list(in->array_indices);
+    }
+
+    void children_field_access(Field_access* in)
+    {
+        derived()->visit_target(in->target);
+        derived()->visit_field_name(in->field_name);
+    }
+
+    void children_array_access(Array_access* in)
+    {
+        derived()->visit_variable_name(in->variable_name);
+        derived()->visit_rvalue(in->index);
+    }
+
+    void children_array_next(Array_next* in)
+    {
+        derived()->visit_variable_name(in->variable_name);
+    }
+
+    void children_cast(Cast* in)
+    {
+        derived()->visit_cast(in->cast);
+        derived()->visit_variable_name(in->variable_name);
+    }
+
+    void children_unary_op(Unary_op* in)
+    {
+        derived()->visit_op(in->op);
+        derived()->visit_variable_name(in->variable_name);
+    }
+
+    void children_bin_op(Bin_op* in)
+    {
+        derived()->visit_rvalue(in->left);
+        derived()->visit_op(in->op);
+        derived()->visit_rvalue(in->right);
+    }
+
+    void children_constant(Constant* in)
+    {
+        derived()->visit_class_name(in->class_name);
+        derived()->visit_constant_name(in->constant_name);
+    }
+
+    void children_instanceof(Instanceof* in)
+    {
+        derived()->visit_variable_name(in->variable_name);
+        derived()->visit_class_name(in->class_name);
+    }
+
+    void children_method_invocation(Method_invocation* in)
+    {
+        derived()->visit_target(in->target);
+        derived()->visit_method_name(in->method_name);
+        derived()->visit_actual_parameter_list(in->actual_parameters);
+    }
+
+    void children_new(New* in)
+    {
+        derived()->visit_class_name(in->class_name);
+        derived()->visit_actual_parameter_list(in->actual_parameters);
+    }
+
+    void children_actual_parameter(Actual_parameter* in)
+    {
+        derived()->visit_marker("is_ref", in->is_ref);
+        derived()->visit_rvalue(in->rvalue);
+    }
+
+    void children_variable_method(Variable_method* in)
+    {
+        derived()->visit_variable_name(in->variable_name);
+    }
+
+    void children_variable_variable(Variable_variable* in)
+    {
+        derived()->visit_variable_name(in->variable_name);
+    }
+
+    void children_variable_class(Variable_class* in)
+    {
+        derived()->visit_variable_name(in->variable_name);
+    }
+
+    void children_variable_field(Variable_field* in)
+    {
+        derived()->visit_variable_name(in->variable_name);
+    }
+
+    void children_static_array(Static_array* in)
+    {
+        derived()->visit_static_array_elem_list(in->static_array_elems);
+    }
+
+    void children_static_array_elem(Static_array_elem* in)
+    {
+        derived()->visit_static_array_key(in->key);
+        derived()->visit_marker("is_ref", in->is_ref);
+        derived()->visit_static_value(in->val);
+    }
+
+    void children_branch(Branch* in)
+    {
+        derived()->visit_variable_name(in->variable_name);
+        derived()->visit_label_name(in->iftrue);
+        derived()->visit_label_name(in->iffalse);
+    }
+
+    void children_goto(Goto* in)
+    {
+        derived()->visit_label_name(in->label_name);
+    }
+
+    void children_label(Label* in)
+    {
+        derived()->visit_label_name(in->label_name);
+    }
+
+    void children_foreach_reset(Foreach_reset* in)
+    {
+        derived()->visit_variable_name(in->array);
+        derived()->visit_ht_iterator(in->iter);
+    }
+
+    void children_foreach_next(Foreach_next* in)
+    {
+        derived()->visit_variable_name(in->array);
+        derived()->visit_ht_iterator(in->iter);
+    }
+
+    void children_foreach_end(Foreach_end* in)
+    {
+        derived()->visit_variable_name(in->array);
+        derived()->visit_ht_iterator(in->iter);
+    }
+
+    void children_foreach_has_key(Foreach_has_key* in)
+    {
+        derived()->visit_variable_name(in->array);
+        derived()->visit_ht_iterator(in->iter);
+    }
+
+    void children_foreach_get_key(Foreach_get_key* in)
+    {
+        derived()->visit_variable_name(in->array);
+        derived()->visit_ht_iterator(in->iter);
+    }
+
+    void children_foreach_get_val(Foreach_get_val* in)
+    {
+        derived()->visit_variable_name(in->array);
+        derived()->visit_ht_iterator(in->iter);
+    }
+
+    void children_param_is_ref(Param_is_ref* in)
+    {
+        derived()->visit_target(in->target);
+        derived()->visit_method_name(in->method_name);
+        derived()->visit_param_index(in->param_index);
+    }
+
+/* Tokens don't have children, so these methods do nothing by default */
+public:
+    void children_param_index(PARAM_INDEX* in)
+    {
+    }
+
+    void children_foreign(FOREIGN* in)
+    {
+    }
+
+    void children_class_name(CLASS_NAME* in)
+    {
+    }
+
+    void children_interface_name(INTERFACE_NAME* in)
+    {
+    }
+
+    void children_method_name(METHOD_NAME* in)
+    {
+    }
+
+    void children_variable_name(VARIABLE_NAME* in)
+    {
+    }
+
+    void children_op(OP* in)
+    {
+    }
+
+    void children_int(INT* in)
+    {
+    }
+
+    void children_real(REAL* in)
+    {
+    }
+
+    void children_string(STRING* in)
+    {
+    }
+
+    void children_bool(BOOL* in)
+    {
+    }
+
+    void children_nil(NIL* in)
+    {
+    }
+
+    void children_cast(CAST* in)
+    {
+    }
+
+    void children_constant_name(CONSTANT_NAME* in)
+    {
+    }
+
+    void children_field_name(FIELD_NAME* in)
+    {
+    }
+
+    void children_label_name(LABEL_NAME* in)
+    {
+    }
+
+    void children_ht_iterator(HT_ITERATOR* in)
+    {
+    }
+
+/* Unparser support */
+public:
+    void visit_marker(char const* name, bool value)
+    {
+    }
+
+    void visit_null(char const* name_space, char const* type_id)
+    {
+    }
+
+    void visit_null_list(char const* name_space, char const* type_id)
+    {
+    }
+
+    void pre_list(char const* name_space, char const* type_id, int size)
+    {
+    }
+
+    void post_list(char const* name_space, char const* type_id, int size)
+    {
+    }
+
+/* Invoke the chain of pre-visit methods along the inheritance hierachy */
+/* Do not override unless you know what you are doing */
+public:
+    void pre_php_script_chain(PHP_script* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_php_script((PHP_script*) in);
+    }
+
+    void pre_class_def_chain(Class_def* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_statement((Statement*) in);
+        derived()->pre_class_def((Class_def*) in);
+    }
+
+    void pre_class_mod_chain(Class_mod* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_class_mod((Class_mod*) in);
+    }
+
+    void pre_interface_def_chain(Interface_def* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_statement((Statement*) in);
+        derived()->pre_interface_def((Interface_def*) in);
+    }
+
+    void pre_method_chain(Method* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_statement((Statement*) in);
+        derived()->pre_member((Member*) in);
+        derived()->pre_method((Method*) in);
+    }
+
+    void pre_signature_chain(Signature* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_signature((Signature*) in);
+    }
+
+    void pre_method_mod_chain(Method_mod* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_method_mod((Method_mod*) in);
+    }
+
+    void pre_formal_parameter_chain(Formal_parameter* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_formal_parameter((Formal_parameter*) in);
+    }
+
+    void pre_type_chain(Type* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_type((Type*) in);
+    }
+
+    void pre_attribute_chain(Attribute* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_member((Member*) in);
+        derived()->pre_attribute((Attribute*) in);
+    }
+
+    void pre_attr_mod_chain(Attr_mod* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_attr_mod((Attr_mod*) in);
+    }
+
+    void pre_name_with_default_chain(Name_with_default* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_name_with_default((Name_with_default*) in);
+    }
+
+    void pre_class_alias_chain(Class_alias* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_statement((Statement*) in);
+        derived()->pre_class_alias((Class_alias*) in);
+    }
+
+    void pre_interface_alias_chain(Interface_alias* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_statement((Statement*) in);
+        derived()->pre_interface_alias((Interface_alias*) in);
+    }
+
+    void pre_method_alias_chain(Method_alias* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_statement((Statement*) in);
+        derived()->pre_method_alias((Method_alias*) in);
+    }
+
+    void pre_return_chain(Return* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_statement((Statement*) in);
+        derived()->pre_return((Return*) in);
+    }
+
+    void pre_static_declaration_chain(Static_declaration* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_statement((Statement*) in);
+        derived()->pre_static_declaration((Static_declaration*) in);
+    }
+
+    void pre_global_chain(Global* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_statement((Statement*) in);
+        derived()->pre_global((Global*) in);
+    }
+
+    void pre_try_chain(Try* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_statement((Statement*) in);
+        derived()->pre_try((Try*) in);
+    }
+
+    void pre_catch_chain(Catch* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_catch((Catch*) in);
+    }
+
+    void pre_throw_chain(Throw* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_statement((Statement*) in);
+        derived()->pre_throw((Throw*) in);
+    }
+
+    void pre_assign_var_chain(Assign_var* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_statement((Statement*) in);
+        derived()->pre_assign_var((Assign_var*) in);
+    }
+
+    void pre_assign_field_chain(Assign_field* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_statement((Statement*) in);
+        derived()->pre_assign_field((Assign_field*) in);
+    }
+
+    void pre_assign_array_chain(Assign_array* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_statement((Statement*) in);
+        derived()->pre_assign_array((Assign_array*) in);
+    }
+
+    void pre_assign_var_var_chain(Assign_var_var* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_statement((Statement*) in);
+        derived()->pre_assign_var_var((Assign_var_var*) in);
+    }
+
+    void pre_assign_next_chain(Assign_next* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_statement((Statement*) in);
+        derived()->pre_assign_next((Assign_next*) in);
+    }
+
+    void pre_pre_op_chain(Pre_op* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_statement((Statement*) in);
+        derived()->pre_pre_op((Pre_op*) in);
+    }
+
+    void pre_eval_expr_chain(Eval_expr* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_statement((Statement*) in);
+        derived()->pre_eval_expr((Eval_expr*) in);
+    }
+
+    void pre_unset_chain(Unset* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_statement((Statement*) in);
+        derived()->pre_unset((Unset*) in);
+    }
+
+    void pre_isset_chain(Isset* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_expr((Expr*) in);
+        derived()->pre_isset((Isset*) in);
+    }
+
+    void pre_field_access_chain(Field_access* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_expr((Expr*) in);
+        derived()->pre_field_access((Field_access*) in);
+    }
+
+    void pre_array_access_chain(Array_access* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_expr((Expr*) in);
+        derived()->pre_array_access((Array_access*) in);
+    }
+
+    void pre_array_next_chain(Array_next* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_expr((Expr*) in);
+        derived()->pre_array_next((Array_next*) in);
+    }
+
+    void pre_cast_chain(Cast* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_expr((Expr*) in);
+        derived()->pre_cast((Cast*) in);
+    }
+
+    void pre_unary_op_chain(Unary_op* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_expr((Expr*) in);
+        derived()->pre_unary_op((Unary_op*) in);
+    }
+
+    void pre_bin_op_chain(Bin_op* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_expr((Expr*) in);
+        derived()->pre_bin_op((Bin_op*) in);
+    }
+
+    void pre_constant_chain(Constant* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_expr((Expr*) in);
+        derived()->pre_static_value((Static_value*) in);
+        derived()->pre_static_array_key((Static_array_key*) in);
+        derived()->pre_constant((Constant*) in);
+    }
+
+    void pre_instanceof_chain(Instanceof* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_expr((Expr*) in);
+        derived()->pre_instanceof((Instanceof*) in);
+    }
+
+    void pre_method_invocation_chain(Method_invocation* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_expr((Expr*) in);
+        derived()->pre_method_invocation((Method_invocation*) in);
+    }
+
+    void pre_new_chain(New* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_expr((Expr*) in);
+        derived()->pre_new((New*) in);
+    }
+
+    void pre_actual_parameter_chain(Actual_parameter* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_actual_parameter((Actual_parameter*) in);
+    }
+
+    void pre_variable_method_chain(Variable_method* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_method_name((Method_name*) in);
+        derived()->pre_variable_method((Variable_method*) in);
+    }
+
+    void pre_variable_variable_chain(Variable_variable* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_expr((Expr*) in);
+        derived()->pre_variable_name((Variable_name*) in);
+        derived()->pre_variable_variable((Variable_variable*) in);
+    }
+
+    void pre_variable_class_chain(Variable_class* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_class_name((Class_name*) in);
+        derived()->pre_variable_class((Variable_class*) in);
+    }
+
+    void pre_variable_field_chain(Variable_field* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_field_name((Field_name*) in);
+        derived()->pre_variable_field((Variable_field*) in);
+    }
+
+    void pre_static_array_chain(Static_array* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_static_value((Static_value*) in);
+        derived()->pre_static_array((Static_array*) in);
+    }
+
+    void pre_static_array_elem_chain(Static_array_elem* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_static_array_elem((Static_array_elem*) in);
+    }
+
+    void pre_branch_chain(Branch* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_statement((Statement*) in);
+        derived()->pre_branch((Branch*) in);
+    }
+
+    void pre_goto_chain(Goto* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_statement((Statement*) in);
+        derived()->pre_goto((Goto*) in);
+    }
+
+    void pre_label_chain(Label* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_statement((Statement*) in);
+        derived()->pre_label((Label*) in);
+    }
+
+    void pre_foreach_reset_chain(Foreach_reset* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_statement((Statement*) in);
+        derived()->pre_foreach_reset((Foreach_reset*) in);
+    }
+
+    void pre_foreach_next_chain(Foreach_next* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_statement((Statement*) in);
+        derived()->pre_foreach_next((Foreach_next*) in);
+    }
+
+    void pre_foreach_end_chain(Foreach_end* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_statement((Statement*) in);
+        derived()->pre_foreach_end((Foreach_end*) in);
+    }
+
+    void pre_foreach_has_key_chain(Foreach_has_key* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_expr((Expr*) in);
+        derived()->pre_foreach_has_key((Foreach_has_key*) in);
+    }
+
+    void pre_foreach_get_key_chain(Foreach_get_key* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_expr((Expr*) in);
+        derived()->pre_foreach_get_key((Foreach_get_key*) in);
+    }
+
+    void pre_foreach_get_val_chain(Foreach_get_val* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_expr((Expr*) in);
+        derived()->pre_foreach_get_val((Foreach_get_val*) in);
+    }
+
+    void pre_param_is_ref_chain(Param_is_ref* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_expr((Expr*) in);
+        derived()->pre_param_is_ref((Param_is_ref*) in);
+    }
+
+    void pre_param_index_chain(PARAM_INDEX* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_param_index((PARAM_INDEX*) in);
+    }
+
+    void pre_foreign_chain(FOREIGN* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_statement((Statement*) in);
+        derived()->pre_expr((Expr*) in);
+        derived()->pre_foreign((FOREIGN*) in);
+    }
+
+    void pre_class_name_chain(CLASS_NAME* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_target((Target*) in);
+        derived()->pre_class_name((Class_name*) in);
+        derived()->pre_identifier((Identifier*) in);
+        derived()->pre_class_name((CLASS_NAME*) in);
+    }
+
+    void pre_interface_name_chain(INTERFACE_NAME* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_identifier((Identifier*) in);
+        derived()->pre_interface_name((INTERFACE_NAME*) in);
+    }
+
+    void pre_method_name_chain(METHOD_NAME* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_method_name((Method_name*) in);
+        derived()->pre_identifier((Identifier*) in);
+        derived()->pre_method_name((METHOD_NAME*) in);
+    }
+
+    void pre_variable_name_chain(VARIABLE_NAME* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_expr((Expr*) in);
+        derived()->pre_rvalue((Rvalue*) in);
+        derived()->pre_variable_name((Variable_name*) in);
+        derived()->pre_target((Target*) in);
+        derived()->pre_identifier((Identifier*) in);
+        derived()->pre_variable_name((VARIABLE_NAME*) in);
+    }
+
+    void pre_op_chain(OP* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_identifier((Identifier*) in);
+        derived()->pre_op((OP*) in);
+    }
+
+    void pre_int_chain(INT* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_expr((Expr*) in);
+        derived()->pre_rvalue((Rvalue*) in);
+        derived()->pre_static_value((Static_value*) in);
+        derived()->pre_static_array_key((Static_array_key*) in);
+        derived()->pre_literal((Literal*) in);
+        derived()->pre_int((INT*) in);
+    }
+
+    void pre_real_chain(REAL* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_expr((Expr*) in);
+        derived()->pre_rvalue((Rvalue*) in);
+        derived()->pre_static_value((Static_value*) in);
+        derived()->pre_static_array_key((Static_array_key*) in);
+        derived()->pre_literal((Literal*) in);
+        derived()->pre_real((REAL*) in);
+    }
+
+    void pre_string_chain(STRING* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_expr((Expr*) in);
+        derived()->pre_rvalue((Rvalue*) in);
+        derived()->pre_static_value((Static_value*) in);
+        derived()->pre_static_array_key((Static_array_key*) in);
+        derived()->pre_literal((Literal*) in);
+        derived()->pre_string((STRING*) in);
+    }
+
+    void pre_bool_chain(BOOL* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_expr((Expr*) in);
+        derived()->pre_rvalue((Rvalue*) in);
+        derived()->pre_static_value((Static_value*) in);
+        derived()->pre_static_array_key((Static_array_key*) in);
+        derived()->pre_literal((Literal*) in);
+        derived()->pre_bool((BOOL*) in);
+    }
+
+    void pre_nil_chain(NIL* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_expr((Expr*) in);
+        derived()->pre_rvalue((Rvalue*) in);
+        derived()->pre_static_value((Static_value*) in);
+        derived()->pre_static_array_key((Static_array_key*) in);
+        derived()->pre_literal((Literal*) in);
+        derived()->pre_nil((NIL*) in);
+    }
+
+    void pre_cast_chain(CAST* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_identifier((Identifier*) in);
+        derived()->pre_cast((CAST*) in);
+    }
+
+    void pre_constant_name_chain(CONSTANT_NAME* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_identifier((Identifier*) in);
+        derived()->pre_constant_name((CONSTANT_NAME*) in);
+    }
+
+    void pre_field_name_chain(FIELD_NAME* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_field_name((Field_name*) in);
+        derived()->pre_identifier((Identifier*) in);
+        derived()->pre_field_name((FIELD_NAME*) in);
+    }
+
+    void pre_label_name_chain(LABEL_NAME* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_identifier((Identifier*) in);
+        derived()->pre_label_name((LABEL_NAME*) in);
+    }
+
+    void pre_ht_iterator_chain(HT_ITERATOR* in)
+    {
+        derived()->pre_node((Node*) in);
+        derived()->pre_identifier((Identifier*) in);
+        derived()->pre_ht_iterator((HT_ITERATOR*) in);
+    }
+
+/* Invoke the chain of post-visit methods along the inheritance hierarchy */
+/* (invoked in opposite order to the pre-chain) */
+/* Do not override unless you know what you are doing */
+public:
+    void post_php_script_chain(PHP_script* in)
+    {
+        derived()->post_php_script((PHP_script*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_class_def_chain(Class_def* in)
+    {
+        derived()->post_class_def((Class_def*) in);
+        derived()->post_statement((Statement*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_class_mod_chain(Class_mod* in)
+    {
+        derived()->post_class_mod((Class_mod*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_interface_def_chain(Interface_def* in)
+    {
+        derived()->post_interface_def((Interface_def*) in);
+        derived()->post_statement((Statement*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_method_chain(Method* in)
+    {
+        derived()->post_method((Method*) in);
+        derived()->post_member((Member*) in);
+        derived()->post_statement((Statement*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_signature_chain(Signature* in)
+    {
+        derived()->post_signature((Signature*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_method_mod_chain(Method_mod* in)
+    {
+        derived()->post_method_mod((Method_mod*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_formal_parameter_chain(Formal_parameter* in)
+    {
+        derived()->post_formal_parameter((Formal_parameter*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_type_chain(Type* in)
+    {
+        derived()->post_type((Type*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_attribute_chain(Attribute* in)
+    {
+        derived()->post_attribute((Attribute*) in);
+        derived()->post_member((Member*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_attr_mod_chain(Attr_mod* in)
+    {
+        derived()->post_attr_mod((Attr_mod*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_name_with_default_chain(Name_with_default* in)
+    {
+        derived()->post_name_with_default((Name_with_default*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_class_alias_chain(Class_alias* in)
+    {
+        derived()->post_class_alias((Class_alias*) in);
+        derived()->post_statement((Statement*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_interface_alias_chain(Interface_alias* in)
+    {
+        derived()->post_interface_alias((Interface_alias*) in);
+        derived()->post_statement((Statement*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_method_alias_chain(Method_alias* in)
+    {
+        derived()->post_method_alias((Method_alias*) in);
+        derived()->post_statement((Statement*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_return_chain(Return* in)
+    {
+        derived()->post_return((Return*) in);
+        derived()->post_statement((Statement*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_static_declaration_chain(Static_declaration* in)
+    {
+        derived()->post_static_declaration((Static_declaration*) in);
+        derived()->post_statement((Statement*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_global_chain(Global* in)
+    {
+        derived()->post_global((Global*) in);
+        derived()->post_statement((Statement*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_try_chain(Try* in)
+    {
+        derived()->post_try((Try*) in);
+        derived()->post_statement((Statement*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_catch_chain(Catch* in)
+    {
+        derived()->post_catch((Catch*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_throw_chain(Throw* in)
+    {
+        derived()->post_throw((Throw*) in);
+        derived()->post_statement((Statement*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_assign_var_chain(Assign_var* in)
+    {
+        derived()->post_assign_var((Assign_var*) in);
+        derived()->post_statement((Statement*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_assign_field_chain(Assign_field* in)
+    {
+        derived()->post_assign_field((Assign_field*) in);
+        derived()->post_statement((Statement*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_assign_array_chain(Assign_array* in)
+    {
+        derived()->post_assign_array((Assign_array*) in);
+        derived()->post_statement((Statement*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_assign_var_var_chain(Assign_var_var* in)
+    {
+        derived()->post_assign_var_var((Assign_var_var*) in);
+        derived()->post_statement((Statement*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_assign_next_chain(Assign_next* in)
+    {
+        derived()->post_assign_next((Assign_next*) in);
+        derived()->post_statement((Statement*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_pre_op_chain(Pre_op* in)
+    {
+        derived()->post_pre_op((Pre_op*) in);
+        derived()->post_statement((Statement*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_eval_expr_chain(Eval_expr* in)
+    {
+        derived()->post_eval_expr((Eval_expr*) in);
+        derived()->post_statement((Statement*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_unset_chain(Unset* in)
+    {
+        derived()->post_unset((Unset*) in);
+        derived()->post_statement((Statement*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_isset_chain(Isset* in)
+    {
+        derived()->post_isset((Isset*) in);
+        derived()->post_expr((Expr*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_field_access_chain(Field_access* in)
+    {
+        derived()->post_field_access((Field_access*) in);
+        derived()->post_expr((Expr*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_array_access_chain(Array_access* in)
+    {
+        derived()->post_array_access((Array_access*) in);
+        derived()->post_expr((Expr*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_array_next_chain(Array_next* in)
+    {
+        derived()->post_array_next((Array_next*) in);
+        derived()->post_expr((Expr*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_cast_chain(Cast* in)
+    {
+        derived()->post_cast((Cast*) in);
+        derived()->post_expr((Expr*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_unary_op_chain(Unary_op* in)
+    {
+        derived()->post_unary_op((Unary_op*) in);
+        derived()->post_expr((Expr*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_bin_op_chain(Bin_op* in)
+    {
+        derived()->post_bin_op((Bin_op*) in);
+        derived()->post_expr((Expr*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_constant_chain(Constant* in)
+    {
+        derived()->post_constant((Constant*) in);
+        derived()->post_static_array_key((Static_array_key*) in);
+        derived()->post_static_value((Static_value*) in);
+        derived()->post_expr((Expr*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_instanceof_chain(Instanceof* in)
+    {
+        derived()->post_instanceof((Instanceof*) in);
+        derived()->post_expr((Expr*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_method_invocation_chain(Method_invocation* in)
+    {
+        derived()->post_method_invocation((Method_invocation*) in);
+        derived()->post_expr((Expr*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_new_chain(New* in)
+    {
+        derived()->post_new((New*) in);
+        derived()->post_expr((Expr*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_actual_parameter_chain(Actual_parameter* in)
+    {
+        derived()->post_actual_parameter((Actual_parameter*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_variable_method_chain(Variable_method* in)
+    {
+        derived()->post_variable_method((Variable_method*) in);
+        derived()->post_method_name((Method_name*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_variable_variable_chain(Variable_variable* in)
+    {
+        derived()->post_variable_variable((Variable_variable*) in);
+        derived()->post_variable_name((Variable_name*) in);
+        derived()->post_expr((Expr*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_variable_class_chain(Variable_class* in)
+    {
+        derived()->post_variable_class((Variable_class*) in);
+        derived()->post_class_name((Class_name*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_variable_field_chain(Variable_field* in)
+    {
+        derived()->post_variable_field((Variable_field*) in);
+        derived()->post_field_name((Field_name*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_static_array_chain(Static_array* in)
+    {
+        derived()->post_static_array((Static_array*) in);
+        derived()->post_static_value((Static_value*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_static_array_elem_chain(Static_array_elem* in)
+    {
+        derived()->post_static_array_elem((Static_array_elem*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_branch_chain(Branch* in)
+    {
+        derived()->post_branch((Branch*) in);
+        derived()->post_statement((Statement*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_goto_chain(Goto* in)
+    {
+        derived()->post_goto((Goto*) in);
+        derived()->post_statement((Statement*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_label_chain(Label* in)
+    {
+        derived()->post_label((Label*) in);
+        derived()->post_statement((Statement*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_foreach_reset_chain(Foreach_reset* in)
+    {
+        derived()->post_foreach_reset((Foreach_reset*) in);
+        derived()->post_statement((Statement*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_foreach_next_chain(Foreach_next* in)
+    {
+        derived()->post_foreach_next((Foreach_next*) in);
+        derived()->post_statement((Statement*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_foreach_end_chain(Foreach_end* in)
+    {
+        derived()->post_foreach_end((Foreach_end*) in);
+        derived()->post_statement((Statement*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_foreach_has_key_chain(Foreach_has_key* in)
+    {
+        derived()->post_foreach_has_key((Foreach_has_key*) in);
+        derived()->post_expr((Expr*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_foreach_get_key_chain(Foreach_get_key* in)
+    {
+        derived()->post_foreach_get_key((Foreach_get_key*) in);
+        derived()->post_expr((Expr*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_foreach_get_val_chain(Foreach_get_val* in)
+    {
+        derived()->post_foreach_get_val((Foreach_get_val*) in);
+        derived()->post_expr((Expr*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_param_is_ref_chain(Param_is_ref* in)
+    {
+        derived()->post_param_is_ref((Param_is_ref*) in);
+        derived()->post_expr((Expr*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_param_index_chain(PARAM_INDEX* in)
+    {
+        derived()->post_param_index((PARAM_INDEX*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_foreign_chain(FOREIGN* in)
+    {
+        derived()->post_foreign((FOREIGN*) in);
+        derived()->post_expr((Expr*) in);
+        derived()->post_statement((Statement*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_class_name_chain(CLASS_NAME* in)
+    {
+        derived()->post_class_name((CLASS_NAME*) in);
+        derived()->post_identifier((Identifier*) in);
+        derived()->post_class_name((Class_name*) in);
+        derived()->post_target((Target*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_interface_name_chain(INTERFACE_NAME* in)
+    {
+        derived()->post_interface_name((INTERFACE_NAME*) in);
+        derived()->post_identifier((Identifier*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_method_name_chain(METHOD_NAME* in)
+    {
+        derived()->post_method_name((METHOD_NAME*) in);
+        derived()->post_identifier((Identifier*) in);
+        derived()->post_method_name((Method_name*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_variable_name_chain(VARIABLE_NAME* in)
+    {
+        derived()->post_variable_name((VARIABLE_NAME*) in);
+        derived()->post_identifier((Identifier*) in);
+        derived()->post_target((Target*) in);
+        derived()->post_variable_name((Variable_name*) in);
+        derived()->post_rvalue((Rvalue*) in);
+        derived()->post_expr((Expr*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_op_chain(OP* in)
+    {
+        derived()->post_op((OP*) in);
+        derived()->post_identifier((Identifier*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_int_chain(INT* in)
+    {
+        derived()->post_int((INT*) in);
+        derived()->post_literal((Literal*) in);
+        derived()->post_static_array_key((Static_array_key*) in);
+        derived()->post_static_value((Static_value*) in);
+        derived()->post_rvalue((Rvalue*) in);
+        derived()->post_expr((Expr*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_real_chain(REAL* in)
+    {
+        derived()->post_real((REAL*) in);
+        derived()->post_literal((Literal*) in);
+        derived()->post_static_array_key((Static_array_key*) in);
+        derived()->post_static_value((Static_value*) in);
+        derived()->post_rvalue((Rvalue*) in);
+        derived()->post_expr((Expr*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_string_chain(STRING* in)
+    {
+        derived()->post_string((STRING*) in);
+        derived()->post_literal((Literal*) in);
+        derived()->post_static_array_key((Static_array_key*) in);
+        derived()->post_static_value((Static_value*) in);
+        derived()->post_rvalue((Rvalue*) in);
+        derived()->post_expr((Expr*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_bool_chain(BOOL* in)
+    {
+        derived()->post_bool((BOOL*) in);
+        derived()->post_literal((Literal*) in);
+        derived()->post_static_array_key((Static_array_key*) in);
+        derived()->post_static_value((Static_value*) in);
+        derived()->post_rvalue((Rvalue*) in);
+        derived()->post_expr((Expr*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_nil_chain(NIL* in)
+    {
+        derived()->post_nil((NIL*) in);
+        derived()->post_literal((Literal*) in);
+        derived()->post_static_array_key((Static_array_key*) in);
+        derived()->post_static_value((Static_value*) in);
+        derived()->post_rvalue((Rvalue*) in);
+        derived()->post_expr((Expr*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_cast_chain(CAST* in)
+    {
+        derived()->post_cast((CAST*) in);
+        derived()->post_identifier((Identifier*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_constant_name_chain(CONSTANT_NAME* in)
+    {
+        derived()->post_constant_name((CONSTANT_NAME*) in);
+        derived()->post_identifier((Identifier*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_field_name_chain(FIELD_NAME* in)
+    {
+        derived()->post_field_name((FIELD_NAME*) in);
+        derived()->post_identifier((Identifier*) in);
+        derived()->post_field_name((Field_name*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_label_name_chain(LABEL_NAME* in)
+    {
+        derived()->post_label_name((LABEL_NAME*) in);
+        derived()->post_identifier((Identifier*) in);
+        derived()->post_node((Node*) in);
+    }
+
+    void post_ht_iterator_chain(HT_ITERATOR* in)
+    {
+        derived()->post_ht_iterator((HT_ITERATOR*) in);
+        derived()->post_identifier((Identifier*) in);
+        derived()->post_node((Node*) in);
+    }
+
+/* Call the pre-chain, visit children and post-chain in order */
+/* Do not override unless you know what you are doing */
+public:
+    void visit_statement_list(Statement_list* in)
+    {
+        Statement_list::const_iterator i;
+    
+        if(in == NULL)
+        	derived()->visit_null_list("MIR", "Statement");
+        else
+        {
+        	derived()->pre_list("MIR", "Statement", in->size());
+    
+        	for(i = in->begin(); i != in->end(); i++)
+        	{
+        		derived()->visit_statement(*i);
+        	}
+    
+        	derived()->post_list("MIR", "Statement", in->size());
+        }
+    }
+
+    void visit_statement(Statement* in)
+    {
+        if(in == NULL)
+        	derived()->visit_null("MIR", "Statement");
+        else
+        {
+        	derived()->pre_statement_chain(in);
+        	derived()->children_statement(in);
+        	derived()->post_statement_chain(in);
+        }
+    }
+
+    void visit_class_mod(Class_mod* in)
+    {
+        if(in == NULL)
+        	derived()->visit_null("MIR", "Class_mod");
+        else
+        {
+        	derived()->pre_class_mod_chain(in);
+        	derived()->children_class_mod(in);
+        	derived()->post_class_mod_chain(in);
+        }
+    }
+
+    void visit_class_name(CLASS_NAME* in)
+    {
+        if(in == NULL)
+        	derived()->visit_null("MIR", "CLASS_NAME");
+        else
+        {
+        	derived()->pre_class_name_chain(in);
+        	derived()->children_class_name(in);
+        	derived()->post_class_name_chain(in);
+        }
+    }
+
+    void visit_interface_name_list(INTERFACE_NAME_list* in)
+    {
+        INTERFACE_NAME_list::const_iterator i;
+    
+        if(in == NULL)
+        	derived()->visit_null_list("MIR", "INTERFACE_NAME");
+        else
+        {
+        	derived()->pre_list("MIR", "INTERFACE_NAME", in->size());
+    
+        	for(i = in->begin(); i != in->end(); i++)
+        	{
+        		derived()->visit_interface_name(*i);
+        	}
+    
+        	derived()->post_list("MIR", "INTERFACE_NAME", in->size());
+        }
+    }
+
+    void visit_member_list(Member_list* in)
+    {
+        Member_list::const_iterator i;
+    
+        if(in == NULL)
+        	derived()->visit_null_list("MIR", "Member");
+        else
+        {
+        	derived()->pre_list("MIR", "Member", in->size());
+    
+        	for(i = in->begin(); i != in->end(); i++)
+        	{
+        		derived()->visit_member(*i);
+        	}
+    
+        	derived()->post_list("MIR", "Member", in->size());
+        }
+    }
+
+    void visit_member(Member* in)
+    {
+        if(in == NULL)
+        	derived()->visit_null("MIR", "Member");
+        else
+        {
+        	derived()->pre_member_chain(in);
+        	derived()->children_member(in);
+        	derived()->post_member_chain(in);
+        }
+    }
+
+    void visit_interface_name(INTERFACE_NAME* in)
+    {
+        if(in == NULL)
+        	derived()->visit_null("MIR", "INTERFACE_NAME");
+        else
+        {
+        	derived()->pre_interface_name_chain(in);
+        	derived()->children_interface_name(in);
+        	derived()->post_interface_name_chain(in);
+        }
+    }
+
+    void visit_signature(Signature* in)
+    {
+        if(in == NULL)
+        	derived()->visit_null("MIR", "Signature");
+        else
+        {
+        	derived()->pre_signature_chain(in);
+        	derived()->children_signature(in);
+        	derived()->post_signature_chain(in);
+        }
+    }
+
+    void visit_method_mod(Method_mod* in)
+    {
+        if(in == NULL)
+        	derived()->visit_null("MIR", "Method_mod");
+        else
+        {
+        	derived()->pre_method_mod_chain(in);
+        	derived()->children_method_mod(in);
+        	derived()->post_method_mod_chain(in);
+        }
+    }
+
+    void visit_method_name(METHOD_NAME* in)
+    {
+        if(in == NULL)
+        	derived()->visit_null("MIR", "METHOD_NAME");
+        else
+        {
+        	derived()->pre_method_name_chain(in);
+        	derived()->children_method_name(in);
+        	derived()->post_method_name_chain(in);
+        }
+    }
+
+    void visit_formal_parameter_list(Formal_parameter_list* in)
+    {
+        Formal_parameter_list::const_iterator i;
+    
+        if(in == NULL)
+        	derived()->visit_null_list("MIR", "Formal_parameter");
+        else
+        {
+        	derived()->pre_list("MIR", "Formal_parameter", in->size());
+    
+        	for(i = in->begin(); i != in->end(); i++)
+        	{
+        		derived()->visit_formal_parameter(*i);
+        	}
+    
+        	derived()->post_list("MIR", "Formal_parameter", in->size());
+        }
+    }
+
+    void visit_formal_parameter(Formal_parameter* in)
+    {
+        if(in == NULL)
+        	derived()->visit_null("MIR", "Formal_parameter");
+        else
+        {
+        	derived()->pre_formal_parameter_chain(in);
+        	derived()->children_formal_parameter(in);
+        	derived()->post_formal_parameter_chain(in);
+        }
+    }
+
+    void visit_type(Type* in)
+    {
+        if(in == NULL)
+        	derived()->visit_null("MIR", "Type");
+        else
+        {
+        	derived()->pre_type_chain(in);
+        	derived()->children_type(in);
+        	derived()->post_type_chain(in);
+        }
+    }
+
+    void visit_name_with_default(Name_with_default* in)
+    {
+        if(in == NULL)
+        	derived()->visit_null("MIR", "Name_with_default");
+        else
+        {
+        	derived()->pre_name_with_default_chain(in);
+        	derived()->children_name_with_default(in);
+        	derived()->post_name_with_default_chain(in);
+        }
+    }
+
+    void visit_attr_mod(Attr_mod* in)
+    {
+        if(in == NULL)
+        	derived()->visit_null("MIR", "Attr_mod");
+        else
+        {
+        	derived()->pre_attr_mod_chain(in);
+        	derived()->children_attr_mod(in);
+        	derived()->post_attr_mod_chain(in);
+        }
+    }
+
+    void visit_variable_name(VARIABLE_NAME* in)
+    {
+        if(in == NULL)
+        	derived()->visit_null("MIR", "VARIABLE_NAME");
+        else
+        {
+        	derived()->pre_variable_name_chain(in);
+        	derived()->children_variable_name(in);
+        	derived()->post_variable_name_chain(in);
+        }
+    }
+
+    void visit_static_value(Static_value* in)
+    {
+        if(in == NULL)
+        	derived()->visit_null("MIR", "Static_value");
+        else
+        {
+        	derived()->pre_static_value_chain(in);
+        	derived()->children_static_value(in);
+        	derived()->post_static_value_chain(in);
+        }
+    }
+
+    void visit_rvalue(Rvalue* in)
+    {
+        if(in == NULL)
+        	derived()->visit_null("MIR", "Rvalue");
+        else
+        {
+        	derived()->pre_rvalue_chain(in);
+        	derived()->children_rvalue(in);
+        	derived()->post_rvalue_chain(in);
+        }
+    }
+
+    void visit_variable_name(Variable_name* in)
+    {
+        if(in == NULL)
+        	derived()->visit_null("MIR", "Variable_name");
+        else
+        {
+        	derived()->pre_variable_name_chain(in);
+        	derived()->children_variable_name(in);
+        	derived()->post_variable_name_chain(in);
+        }
+    }
+
+    void visit_catch_list(Catch_list* in)
+    {
+        Catch_list::const_iterator i;
+    
+        if(in == NULL)
+        	derived()->visit_null_list("MIR", "Catch");
+        else
+        {
+        	derived()->pre_list("MIR", "Catch", in->size());
+    
+        	for(i = in->begin(); i != in->end(); i++)
+        	{
+        		derived()->visit_catch(*i);
+        	}
+    
+        	derived()->post_list("MIR", "Catch", in->size());
+        }
+    }
+
+    void visit_catch(Catch* in)
+    {
+        if(in == NULL)
+        	derived()->visit_null("MIR", "Catch");
+        else
+        {
+        	derived()->pre_catch_chain(in);
+        	derived()->children_catch(in);
+        	derived()->post_catch_chain(in);
+        }
+    }
+
+    void visit_expr(Expr* in)
+    {
+        if(in == NULL)
+        	derived()->visit_null("MIR", "Expr");
+        else
+        {
+        	derived()->pre_expr_chain(in);
+        	derived()->children_expr(in);
+        	derived()->post_expr_chain(in);
+        }
+    }
+
+    void visit_target(Target* in)
+    {
+        if(in == NULL)
+        	derived()->visit_null("MIR", "Target");
+        else
+        {
+        	derived()->pre_target_chain(in);
+        	derived()->children_target(in);
+        	derived()->post_target_chain(in);
+        }
+    }
+
+    void visit_field_name(Field_name* in)
+    {
+        if(in == NULL)
+        	derived()->visit_null("MIR", "Field_name");
+        else
+        {
+        	derived()->pre_field_name_chain(in);
+        	derived()->children_field_name(in);
+        	derived()->post_field_name_chain(in);
+        }
+    }
+
+    void visit_op(OP* in)
+    {
+        if(in == NULL)
+        	derived()->visit_null("MIR", "OP");
+        else
+        {
+        	derived()->pre_op_chain(in);
+        	derived()->children_op(in);
+        	derived()->post_op_chain(in);
+        }
+    }
+
+    void visit_rvalue_list(Rvalue_list* in)
+    {
+        Rvalue_list::const_iterator i;
+    
+        if(in == NULL)
+        	derived()->visit_null_list("MIR", "Rvalue");
+        else
+        {
+        	derived()->pre_list("MIR", "Rvalue", in->size());
+    
+        	for(i = in->begin(); i != in->end(); i++)
+        	{
+        		derived()->visit_rvalue(*i);
+        	}
+    
+        	derived()->post_list("MIR", "Rvalue", in->size());
+        }
+    }
+
+    void visit_cast(CAST* in)
+    {
+        if(in == NULL)
+        	derived()->visit_null("MIR", "CAST");
+        else
+        {
+        	derived()->pre_cast_chain(in);
+        	derived()->children_cast(in);
+        	derived()->post_cast_chain(in);
+        }
+    }
+
+    void visit_constant_name(CONSTANT_NAME* in)
+    {
+        if(in == NULL)
+        	derived()->visit_null("MIR", "CONSTANT_NAME");
+        else
+        {
+        	derived()->pre_constant_name_chain(in);
+        	derived()->children_constant_name(in);
+        	derived()->post_constant_name_chain(in);
+        }
+    }
+
+    void visit_class_name(Class_name* in)
+    {
+        if(in == NULL)
+        	derived()->visit_null("MIR", "Class_name");
+        else
+        {
+        	derived()->pre_class_name_chain(in);
+        	derived()->children_class_name(in);
+        	derived()->post_class_name_chain(in);
+        }
+    }
+
+    void visit_method_name(Method_name* in)
+    {
+        if(in == NULL)
+        	derived()->visit_null("MIR", "Method_name");
+        else
+        {
+        	derived()->pre_method_name_chain(in);
+        	derived()->children_method_name(in);
+        	derived()->post_method_name_chain(in);
+        }
+    }
+
+    void visit_actual_parameter_list(Actual_parameter_list* in)
+    {
+        Actual_parameter_list::const_iterator i;
+    
+        if(in == NULL)
+        	derived()->visit_null_list("MIR", "Actual_parameter");
+        else
+        {
+        	derived()->pre_list("MIR", "Actual_parameter", in->size());
+    
+        	for(i = in->begin(); i != in->end(); i++)
+        	{
+        		derived()->visit_actual_parameter(*i);
+        	}
+    
+        	derived()->post_list("MIR", "Actual_parameter", in->size());
+        }
+    }
+
+    void visit_actual_parameter(Actual_parameter* in)
+    {
+        if(in == NULL)
+        	derived()->visit_null("MIR", "Actual_parameter");
+        else
+        {
+        	derived()->pre_actual_parameter_chain(in);
+        	derived()->children_actual_parameter(in);
+        	derived()->post_actual_parameter_chain(in);
+        }
+    }
+
+    void visit_static_array_elem_list(Static_array_elem_list* in)
+    {
+        Static_array_elem_list::const_iterator i;
+    
+        if(in == NULL)
+        	derived()->visit_null_list("MIR", "Static_array_elem");
+        else
+        {
+        	derived()->pre_list("MIR", "Static_array_elem", in->size());
+    
+        	for(i = in->begin(); i != in->end(); i++)
+        	{
+        		derived()->visit_static_array_elem(*i);
+        	}
+    
+        	derived()->post_list("MIR", "Static_array_elem", in->size());
+        }
+    }
+
+    void visit_static_array_elem(Static_array_elem* in)
+    {
+        if(in == NULL)
+        	derived()->visit_null("MIR", "Static_array_elem");
+        else
+        {
+        	derived()->pre_static_array_elem_chain(in);
+        	derived()->children_static_array_elem(in);
+        	derived()->post_static_array_elem_chain(in);
+        }
+    }
+
+    void visit_static_array_key(Static_array_key* in)
+    {
+        if(in == NULL)
+        	derived()->visit_null("MIR", "Static_array_key");
+        else
+        {
+        	derived()->pre_static_array_key_chain(in);
+        	derived()->children_static_array_key(in);
+        	derived()->post_static_array_key_chain(in);
+        }
+    }
+
+    void visit_label_name(LABEL_NAME* in)
+    {
+        if(in == NULL)
+        	derived()->visit_null("MIR", "LABEL_NAME");
+        else
+        {
+        	derived()->pre_label_name_chain(in);
+        	derived()->children_label_name(in);
+        	derived()->post_label_name_chain(in);
+        }
+    }
+
+    void visit_ht_iterator(HT_ITERATOR* in)
+    {
+        if(in == NULL)
+        	derived()->visit_null("MIR", "HT_ITERATOR");
+        else
+        {
+        	derived()->pre_ht_iterator_chain(in);
+        	derived()->children_ht_iterator(in);
+        	derived()->post_ht_iterator_chain(in);
+        }
+    }
+
+    void visit_param_index(PARAM_INDEX* in)
+    {
+        if(in == NULL)
+        	derived()->visit_null("MIR", "PARAM_INDEX");
+        else
+        {
+        	derived()->pre_param_index_chain(in);
+        	derived()->children_param_index(in);
+        	derived()->post_param_index_chain(in);
+        }
+    }
+
+    void visit_php_script(PHP_script* in)
+    {
+        if(in == NULL)
+        	derived()->visit_null("MIR", "PHP_script");
+        else
+        {
+        	derived()->pre_php_script_chain(in);
+        	derived()->children_php_script(in);
+        	derived()->post_php_script_chain(in);
+        }
+    }
+
+/* Invoke the right pre-chain (manual dispatching) */
+/* Do not override unless you know what you are doing */
+public:
+    void pre_statement_chain(Statement* in)
+    {
+        switch(in->classid())
+        {
+        case Class_def::ID:
+        	derived()->pre_class_def_chain(dynamic_cast<Class_def*>(in));
+        	break;
+        case Interface_def::ID:
+        	derived()->pre_interface_def_chain(dynamic_cast<Interface_def*>(in));
+        	break;
+        case Method::ID:
+        	derived()->pre_method_chain(dynamic_cast<Method*>(in));
+        	break;
+        case Class_alias::ID:
+        	derived()->pre_class_alias_chain(dynamic_cast<Class_alias*>(in));
+        	break;
+        case Interface_alias::ID:
+        	derived()->pre_interface_alias_chain(dynamic_cast<Interface_alias*>(in));
+        	break;
+        case Method_alias::ID:
+        	derived()->pre_method_alias_chain(dynamic_cast<Method_alias*>(in));
+        	break;
+        case Return::ID:
+        	derived()->pre_return_chain(dynamic_cast<Return*>(in));
+        	break;
+        case Static_declaration::ID:
+        	derived()->pre_static_declaration_chain(dynamic_cast<Static_declaration*>(in));
+        	break;
+        case Global::ID:
+        	derived()->pre_global_chain(dynamic_cast<Global*>(in));
+        	break;
+        case Try::ID:
+        	derived()->pre_try_chain(dynamic_cast<Try*>(in));
+        	break;
+        case Throw::ID:
+        	derived()->pre_throw_chain(dynamic_cast<Throw*>(in));
+        	break;
+        case Assign_var::ID:
+        	derived()->pre_assign_var_chain(dynamic_cast<Assign_var*>(in));
+        	break;
+        case Assign_var_var::ID:
+        	derived()->pre_assign_var_var_chain(dynamic_cast<Assign_var_var*>(in));
+        	break;
+        case Assign_array::ID:
+        	derived()->pre_assign_array_chain(dynamic_cast<Assign_array*>(in));
+        	break;
+        case Assign_next::ID:
+        	derived()->pre_assign_next_chain(dynamic_cast<Assign_next*>(in));
+        	break;
+        case Assign_field::ID:
+        	derived()->pre_assign_field_chain(dynamic_cast<Assign_field*>(in));
+        	break;
+        case Eval_expr::ID:
+        	derived()->pre_eval_expr_chain(dynamic_cast<Eval_expr*>(in));
+        	break;
+        case Pre_op::ID:
+        	derived()->pre_pre_op_chain(dynamic_cast<Pre_op*>(in));
+        	break;
+        case Unset::ID:
+        	derived()->pre_unset_chain(dynamic_cast<Unset*>(in));
+        	break;
+        case Label::ID:
+        	derived()->pre_label_chain(dynamic_cast<Label*>(in));
+        	break;
+        case Goto::ID:
+        	derived()->pre_goto_chain(dynamic_cast<Goto*>(in));
+        	break;
+        case Branch::ID:
+        	derived()->pre_branch_chain(dynamic_cast<Branch*>(in));
+        	break;
+        case Foreach_next::ID:
+        	derived()->pre_foreach_next_chain(dynamic_cast<Foreach_next*>(in));
+        	break;
+        case Foreach_reset::ID:
+        	derived()->pre_foreach_reset_chain(dynamic_cast<Foreach_reset*>(in));
+        	break;
+        case Foreach_end::ID:
+        	derived()->pre_foreach_end_chain(dynamic_cast<Foreach_end*>(in));
+        	break;
+        case FOREIGN::ID:
+        	derived()->pre_foreign_chain(dynamic_cast<FOREIGN*>(in));
+        	break;
+        }
+    }
+
+    void pre_member_chain(Member* in)
+    {
+        switch(in->classid())
+        {
+        case Method::ID:
+        	derived()->pre_method_chain(dynamic_cast<Method*>(in));
+        	break;
+        case Attribute::ID:
+        	derived()->pre_attribute_chain(dynamic_cast<Attribute*>(in));
+        	break;
+        }
+    }
+
+    void pre_static_value_chain(Static_value* in)
+    {
+        switch(in->classid())
+        {
+        case INT::ID:
+        	derived()->pre_int_chain(dynamic_cast<INT*>(in));
+        	break;
+        case REAL::ID:
+        	derived()->pre_real_chain(dynamic_cast<REAL*>(in));
+        	break;
+        case STRING::ID:
+        	derived()->pre_string_chain(dynamic_cast<STRING*>(in));
+        	break;
+        case BOOL::ID:
+        	derived()->pre_bool_chain(dynamic_cast<BOOL*>(in));
+        	break;
+        case NIL::ID:
+        	derived()->pre_nil_chain(dynamic_cast<NIL*>(in));
+        	break;
+        case Static_array::ID:
+        	derived()->pre_static_array_chain(dynamic_cast<Static_array*>(in));
+        	break;
+        case Constant::ID:
+        	derived()->pre_constant_chain(dynamic_cast<Constant*>(in));
+        	break;
+        }
+    }
+
+    void pre_rvalue_chain(Rvalue* in)
+    {
+        switch(in->classid())
+        {
+        case INT::ID:
+        	derived()->pre_int_chain(dynamic_cast<INT*>(in));
+        	break;
+        case REAL::ID:
+        	derived()->pre_real_chain(dynamic_cast<REAL*>(in));
+        	break;
+        case STRING::ID:
+        	derived()->pre_string_chain(dynamic_cast<STRING*>(in));
+        	break;
+        case BOOL::ID:
+        	derived()->pre_bool_chain(dynamic_cast<BOOL*>(in));
+        	break;
+        case NIL::ID:
+        	derived()->pre_nil_chain(dynamic_cast<NIL*>(in));
+        	break;
+        case VARIABLE_NAME::ID:
+        	derived()->pre_variable_name_chain(dynamic_cast<VARIABLE_NAME*>(in));
+        	break;
+        }
+    }
+
+    void pre_variable_name_chain(Variable_name* in)
+    {
+        switch(in->classid())
+        {
+        case VARIABLE_NAME::ID:
+        	derived()->pre_variable_name_chain(dynamic_cast<VARIABLE_NAME*>(in));
+        	break;
+        case Variable_variable::ID:
+        	derived()->pre_variable_variable_chain(dynamic_cast<Variable_variable*>(in));
+        	break;
+        }
+    }
+
+    void pre_expr_chain(Expr* in)
+    {
+        switch(in->classid())
+        {
+        case Cast::ID:
+        	derived()->pre_cast_chain(dynamic_cast<Cast*>(in));
+        	break;
+        case Unary_op::ID:
+        	derived()->pre_unary_op_chain(dynamic_cast<Unary_op*>(in));
+        	break;
+        case Bin_op::ID:
+        	derived()->pre_bin_op_chain(dynamic_cast<Bin_op*>(in));
+        	break;
+        case Constant::ID:
+        	derived()->pre_constant_chain(dynamic_cast<Constant*>(in));
+        	break;
+        case Instanceof::ID:
+        	derived()->pre_instanceof_chain(dynamic_cast<Instanceof*>(in));
+        	break;
+        case Method_invocation::ID:
+        	derived()->pre_method_invocation_chain(dynamic_cast<Method_invocation*>(in));
+        	break;
+        case New::ID:
+        	derived()->pre_new_chain(dynamic_cast<New*>(in));
+        	break;
+        case INT::ID:
+        	derived()->pre_int_chain(dynamic_cast<INT*>(in));
+        	break;
+        case REAL::ID:
+        	derived()->pre_real_chain(dynamic_cast<REAL*>(in));
+        	break;
+        case STRING::ID:
+        	derived()->pre_string_chain(dynamic_cast<STRING*>(in));
+        	break;
+        case BOOL::ID:
+        	derived()->pre_bool_chain(dynamic_cast<BOOL*>(in));
+        	break;
+        case NIL::ID:
+        	derived()->pre_nil_chain(dynamic_cast<NIL*>(in));
+        	break;
+        case VARIABLE_NAME::ID:
+        	derived()->pre_variable_name_chain(dynamic_cast<VARIABLE_NAME*>(in));
+        	break;
+        case Variable_variable::ID:
+        	derived()->pre_variable_variable_chain(dynamic_cast<Variable_variable*>(in));
+        	break;
+        case Array_access::ID:
+        	derived()->pre_array_access_chain(dynamic_cast<Array_access*>(in));
+        	break;
+        case Field_access::ID:
+        	derived()->pre_field_access_chain(dynamic_cast<Field_access*>(in));
+        	break;
+        case Array_next::ID:
+        	derived()->pre_array_next_chain(dynamic_cast<Array_next*>(in));
+        	break;
+        case FOREIGN::ID:
+        	derived()->pre_foreign_chain(dynamic_cast<FOREIGN*>(in));
+        	break;
+        case Isset::ID:
+        	derived()->pre_isset_chain(dynamic_cast<Isset*>(in));
+        	break;
+        case Foreach_has_key::ID:
+        	derived()->pre_foreach_has_key_chain(dynamic_cast<Foreach_has_key*>(in));
+        	break;
+        case Foreach_get_key::ID:
+        	derived()->pre_foreach_get_key_chain(dynamic_cast<Foreach_get_key*>(in));
+        	break;
+        case Foreach_get_val::ID:
+        	derived()->pre_foreach_get_val_chain(dynamic_cast<Foreach_get_val*>(in));
+        	break;
+        case Param_is_ref::ID:
+        	derived()->pre_param_is_ref_chain(dynamic_cast<Param_is_ref*>(in));
+        	break;
+        }
+    }
+
+    void pre_target_chain(Target* in)
+    {
+        switch(in->classid())
+        {
+        case VARIABLE_NAME::ID:
+        	derived()->pre_variable_name_chain(dynamic_cast<VARIABLE_NAME*>(in));
+        	break;
+        case CLASS_NAME::ID:
+        	derived()->pre_class_name_chain(dynamic_cast<CLASS_NAME*>(in));
+        	break;
+        }
+    }
+
+    void pre_field_name_chain(Field_name* in)
+    {
+        switch(in->classid())
+        {
+        case FIELD_NAME::ID:
+        	derived()->pre_field_name_chain(dynamic_cast<FIELD_NAME*>(in));
+        	break;
+        case Variable_field::ID:
+        	derived()->pre_variable_field_chain(dynamic_cast<Variable_field*>(in));
+        	break;
+        }
+    }
+
+    void pre_class_name_chain(Class_name* in)
+    {
+        switch(in->classid())
+        {
+        case CLASS_NAME::ID:
+        	derived()->pre_class_name_chain(dynamic_cast<CLASS_NAME*>(in));
+        	break;
+        case Variable_class::ID:
+        	derived()->pre_variable_class_chain(dynamic_cast<Variable_class*>(in));
+        	break;
+        }
+    }
+
+    void pre_method_name_chain(Method_name* in)
+    {
+        switch(in->classid())
+        {
+        case METHOD_NAME::ID:
+        	derived()->pre_method_name_chain(dynamic_cast<METHOD_NAME*>(in));
+        	break;
+        case Variable_method::ID:
+        	derived()->pre_variable_method_chain(dynamic_cast<Variable_method*>(in));
+        	break;
+        }
+    }
+
+    void pre_static_array_key_chain(Static_array_key* in)
+    {
+        switch(in->classid())
+        {
+        case INT::ID:
+        	derived()->pre_int_chain(dynamic_cast<INT*>(in));
+        	break;
+        case REAL::ID:
+        	derived()->pre_real_chain(dynamic_cast<REAL*>(in));
+        	break;
+        case STRING::ID:
+        	derived()->pre_string_chain(dynamic_cast<STRING*>(in));
+        	break;
+        case BOOL::ID:
+        	derived()->pre_bool_chain(dynamic_cast<BOOL*>(in));
+        	break;
+        case NIL::ID:
+        	derived()->pre_nil_chain(dynamic_cast<NIL*>(in));
+        	break;
+        case Constant::ID:
+        	derived()->pre_constant_chain(dynamic_cast<Constant*>(in));
+        	break;
+        }
+    }
+
+/* Invoke the right post-chain (manual dispatching) */
+/* Do not override unless you know what you are doing */
+public:
+    void post_statement_chain(Statement* in)
+    {
+        switch(in->classid())
+        {
+        case Class_def::ID:
+        	derived()->post_class_def_chain(dynamic_cast<Class_def*>(in));
+        	break;
+        case Interface_def::ID:
+        	derived()->post_interface_def_chain(dynamic_cast<Interface_def*>(in));
+        	break;
+        case Method::ID:
+        	derived()->post_method_chain(dynamic_cast<Method*>(in));
+        	break;
+        case Class_alias::ID:
+        	derived()->post_class_alias_chain(dynamic_cast<Class_alias*>(in));
+        	break;
+        case Interface_alias::ID:
+        	derived()->post_interface_alias_chain(dynamic_cast<Interface_alias*>(in));
+        	break;
+        case Method_alias::ID:
+        	derived()->post_method_alias_chain(dynamic_cast<Method_alias*>(in));
+        	break;
+        case Return::ID:
+        	derived()->post_return_chain(dynamic_cast<Return*>(in));
+        	break;
+        case Static_declaration::ID:
+        	derived()->post_static_declaration_chain(dynamic_cast<Static_declaration*>(in));
+        	break;
+        case Global::ID:
+        	derived()->post_global_chain(dynamic_cast<Global*>(in));
+        	break;
+        case Try::ID:
+        	derived()->post_try_chain(dynamic_cast<Try*>(in));
+        	break;
+        case Throw::ID:
+        	derived()->post_throw_chain(dynamic_cast<Throw*>(in));
+        	break;
+        case Assign_var::ID:
+        	derived()->post_assign_var_chain(dynamic_cast<Assign_var*>(in));
+        	break;
+        case Assign_var_var::ID:
+        	derived()->post_assign_var_var_chain(dynamic_cast<Assign_var_var*>(in));
+        	break;
+        case Assign_array::ID:
+        	derived()->post_assign_array_chain(dynamic_cast<Assign_array*>(in));
+        	break;
+        case Assign_next::ID:
+        	derived()->post_assign_next_chain(dynamic_cast<Assign_next*>(in));
+        	break;
+        case Assign_field::ID:
+        	derived()->post_assign_field_chain(dynamic_cast<Assign_field*>(in));
+        	break;
+        case Eval_expr::ID:
+        	derived()->post_eval_expr_chain(dynamic_cast<Eval_expr*>(in));
+        	break;
+        case Pre_op::ID:
+        	derived()->post_pre_op_chain(dynamic_cast<Pre_op*>(in));
+        	break;
+        case Unset::ID:
+        	derived()->post_unset_chain(dynamic_cast<Unset*>(in));
+        	break;
+        case Label::ID:
+        	derived()->post_label_chain(dynamic_cast<Label*>(in));
+        	break;
+        case Goto::ID:
+        	derived()->post_goto_chain(dynamic_cast<Goto*>(in));
+        	break;
+        case Branch::ID:
+        	derived()->post_branch_chain(dynamic_cast<Branch*>(in));
+        	break;
+        case Foreach_next::ID:
+        	derived()->post_foreach_next_chain(dynamic_cast<Foreach_next*>(in));
+        	break;
+        case Foreach_reset::ID:
+        	derived()->post_foreach_reset_chain(dynamic_cast<Foreach_reset*>(in));
+        	break;
+        case Foreach_end::ID:
+        	derived()->post_foreach_end_chain(dynamic_cast<Foreach_end*>(in));
+        	break;
+        case FOREIGN::ID:
+        	derived()->post_foreign_chain(dynamic_cast<FOREIGN*>(in));
+        	break;
+        }
+    }
+
+    void post_member_chain(Member* in)
+    {
+        switch(in->classid())
+        {
+        case Method::ID:
+        	derived()->post_method_chain(dynamic_cast<Method*>(in));
+        	break;
+        case Attribute::ID:
+        	derived()->post_attribute_chain(dynamic_cast<Attribute*>(in));
+        	break;
+        }
+    }
+
+    void post_static_value_chain(Static_value* in)
+    {
+        switch(in->classid())
+        {
+        case INT::ID:
+        	derived()->post_int_chain(dynamic_cast<INT*>(in));
+        	break;
+        case REAL::ID:
+        	derived()->post_real_chain(dynamic_cast<REAL*>(in));
+        	break;
+        case STRING::ID:
+        	derived()->post_string_chain(dynamic_cast<STRING*>(in));
+        	break;
+        case BOOL::ID:
+        	derived()->post_bool_chain(dynamic_cast<BOOL*>(in));
+        	break;
+        case NIL::ID:
+        	derived()->post_nil_chain(dynamic_cast<NIL*>(in));
+        	break;
+        case Static_array::ID:
+        	derived()->post_static_array_chain(dynamic_cast<Static_array*>(in));
+        	break;
+        case Constant::ID:
+        	derived()->post_constant_chain(dynamic_cast<Constant*>(in));
+        	break;
+        }
+    }
+
+    void post_rvalue_chain(Rvalue* in)
+    {
+        switch(in->classid())
+        {
+        case INT::ID:
+        	derived()->post_int_chain(dynamic_cast<INT*>(in));
+        	break;
+        case REAL::ID:
+        	derived()->post_real_chain(dynamic_cast<REAL*>(in));
+        	break;
+        case STRING::ID:
+        	derived()->post_string_chain(dynamic_cast<STRING*>(in));
+        	break;
+        case BOOL::ID:
+        	derived()->post_bool_chain(dynamic_cast<BOOL*>(in));
+        	break;
+        case NIL::ID:
+        	derived()->post_nil_chain(dynamic_cast<NIL*>(in));
+        	break;
+        case VARIABLE_NAME::ID:
+        	derived()->post_variable_name_chain(dynamic_cast<VARIABLE_NAME*>(in));
+        	break;
+        }
+    }
+
+    void post_variable_name_chain(Variable_name* in)
+    {
+        switch(in->classid())
+        {
+        case VARIABLE_NAME::ID:
+        	derived()->post_variable_name_chain(dynamic_cast<VARIABLE_NAME*>(in));
+        	break;
+        case Variable_variable::ID:
+        	derived()->post_variable_variable_chain(dynamic_cast<Variable_variable*>(in));
+        	break;
+        }
+    }
+
+    void post_expr_chain(Expr* in)
+    {
+        switch(in->classid())
+        {
+        case Cast::ID:
+        	derived()->post_cast_chain(dynamic_cast<Cast*>(in));
+        	break;
+        case Unary_op::ID:
+        	derived()->post_unary_op_chain(dynamic_cast<Unary_op*>(in));
+        	break;
+        case Bin_op::ID:
+        	derived()->post_bin_op_chain(dynamic_cast<Bin_op*>(in));
+        	break;
+        case Constant::ID:
+        	derived()->post_constant_chain(dynamic_cast<Constant*>(in));
+        	break;
+        case Instanceof::ID:
+        	derived()->post_instanceof_chain(dynamic_cast<Instanceof*>(in));
+        	break;
+        case Method_invocation::ID:
+        	derived()->post_method_invocation_chain(dynamic_cast<Method_invocation*>(in));
+        	break;
+        case New::ID:
+        	derived()->post_new_chain(dynamic_cast<New*>(in));
+        	break;
+        case INT::ID:
+        	derived()->post_int_chain(dynamic_cast<INT*>(in));
+        	break;
+        case REAL::ID:
+        	derived()->post_real_chain(dynamic_cast<REAL*>(in));
+        	break;
+        case STRING::ID:
+        	derived()->post_string_chain(dynamic_cast<STRING*>(in));
+        	break;
+        case BOOL::ID:
+        	derived()->post_bool_chain(dynamic_cast<BOOL*>(in));
+        	break;
+        case NIL::ID:
+        	derived()->post_nil_chain(dynamic_cast<NIL*>(in));
+        	break;
+        case VARIABLE_NAME::ID:
+        	derived()->post_variable_name_chain(dynamic_cast<VARIABLE_NAME*>(in));
+        	break;
+        case Variable_variable::ID:
+        	derived()->post_variable_variable_chain(dynamic_cast<Variable_variable*>(in));
+        	break;
+        case Array_access::ID:
+        	derived()->post_array_access_chain(dynamic_cast<Array_access*>(in));
+        	break;
+        case Field_access::ID:
+        	derived()->post_field_access_chain(dynamic_cast<Field_access*>(in));
+        	break;
+        case Array_next::ID:
+        	derived()->post_array_next_chain(dynamic_cast<Array_next*>(in));
+        	break;
+        case FOREIGN::ID:
+        	derived()->post_foreign_chain(dynamic_cast<FOREIGN*>(in));
+        	break;
+        case Isset::ID:
+        	derived()->post_isset_chain(dynamic_cast<Isset*>(in));
+        	break;
+        case Foreach_has_key::ID:
+        	derived()->post_foreach_has_key_chain(dynamic_cast<Foreach_has_key*>(in));
+        	break;
+        case Foreach_get_key::ID:
+        	derived()->post_foreach_get_key_chain(dynamic_cast<Foreach_get_key*>(in));
+        	break;
+        case Foreach_get_val::ID:
+        	derived()->post_foreach_get_val_chain(dynamic_cast<Foreach_get_val*>(in));
+        	break;
+        case Param_is_ref::ID:
+        	derived()->post_param_is_ref_chain(dynamic_cast<Param_is_ref*>(in));
+        	break;
+        }
+    }
+
+    void post_target_chain(Target* in)
+    {
+        switch(in->classid())
+        {
+        case VARIABLE_NAME::ID:
+        	derived()->post_variable_name_chain(dynamic_cast<VARIABLE_NAME*>(in));
+        	break;
+        case CLASS_NAME::ID:
+        	derived()->post_class_name_chain(dynamic_cast<CLASS_NAME*>(in));
+        	break;
+        }
+    }
+
+    void post_field_name_chain(Field_name* in)
+    {
+        switch(in->classid())
+        {
+        case FIELD_NAME::ID:
+        	derived()->post_field_name_chain(dynamic_cast<FIELD_NAME*>(in));
+        	break;
+        case Variable_field::ID:
+        	derived()->post_variable_field_chain(dynamic_cast<Variable_field*>(in));
+        	break;
+        }
+    }
+
+    void post_class_name_chain(Class_name* in)
+    {
+        switch(in->classid())
+        {
+        case CLASS_NAME::ID:
+        	derived()->post_class_name_chain(dynamic_cast<CLASS_NAME*>(in));
+        	break;
+        case Variable_class::ID:
+        	derived()->post_variable_class_chain(dynamic_cast<Variable_class*>(in));
+        	break;
+        }
+    }
+
+    void post_method_name_chain(Method_name* in)
+    {
+        switch(in->classid())
+        {
+        case METHOD_NAME::ID:
+        	derived()->post_method_name_chain(dynamic_cast<METHOD_NAME*>(in));
+        	break;
+        case Variable_method::ID:
+        	derived()->post_variable_method_chain(dynamic_cast<Variable_method*>(in));
+        	break;
+        }
+    }
+
+    void post_static_array_key_chain(Static_array_key* in)
+    {
+        switch(in->classid())
+        {
+        case INT::ID:
+        	derived()->post_int_chain(dynamic_cast<INT*>(in));
+        	break;
+        case REAL::ID:
+        	derived()->post_real_chain(dynamic_cast<REAL*>(in));
+        	break;
+        case STRING::ID:
+        	derived()->post_string_chain(dynamic_cast<STRING*>(in));
+        	break;
+        case BOOL::ID:
+        	derived()->post_bool_chain(dynamic_cast<BOOL*>(in));
+        	break;
+        case NIL::ID:
+        	derived()->post_nil_chain(dynamic_cast<NIL*>(in));
+        	break;
+        case Constant::ID:
+        	derived()->post_constant_chain(dynamic_cast<Constant*>(in));
+        	break;
+        }
+    }
+
+/* Invoke the right visit-children (manual dispatching) */
+/* Do not override unless you know what you are doing */
+public:
+    void children_statement(Statement* in)
+    {
+        switch(in->classid())
+        {
+        case Class_def::ID:
+        	derived()->children_class_def(dynamic_cast<Class_def*>(in));
+        	break;
+        case Interface_def::ID:
+        	derived()->children_interface_def(dynamic_cast<Interface_def*>(in));
+        	break;
+        case Method::ID:
+        	derived()->children_method(dynamic_cast<Method*>(in));
+        	break;
+        case Class_alias::ID:
+        	derived()->children_class_alias(dynamic_cast<Class_alias*>(in));
+        	break;
+        case Interface_alias::ID:
+        	derived()->children_interface_alias(dynamic_cast<Interface_alias*>(in));
+        	break;
+        case Method_alias::ID:
+        	derived()->children_method_alias(dynamic_cast<Method_alias*>(in));
+        	break;
+        case Return::ID:
+        	derived()->children_return(dynamic_cast<Return*>(in));
+        	break;
+        case Static_declaration::ID:
+        	derived()->children_static_declaration(dynamic_cast<Static_declaration*>(in));
+        	break;
+        case Global::ID:
+        	derived()->children_global(dynamic_cast<Global*>(in));
+        	break;
+        case Try::ID:
+        	derived()->children_try(dynamic_cast<Try*>(in));
+        	break;
+        case Throw::ID:
+        	derived()->children_throw(dynamic_cast<Throw*>(in));
+        	break;
+        case Assign_var::ID:
+        	derived()->children_assign_var(dynamic_cast<Assign_var*>(in));
+        	break;
+        case Assign_var_var::ID:
+        	derived()->children_assign_var_var(dynamic_cast<Assign_var_var*>(in));
+        	break;
+        case Assign_array::ID:
+        	derived()->children_assign_array(dynamic_cast<Assign_array*>(in));
+        	break;
+        case Assign_next::ID:
+        	derived()->children_assign_next(dynamic_cast<Assign_next*>(in));
+        	break;
+        case Assign_field::ID:
+        	derived()->children_assign_field(dynamic_cast<Assign_field*>(in));
+        	break;
+        case Eval_expr::ID:
+        	derived()->children_eval_expr(dynamic_cast<Eval_expr*>(in));
+        	break;
+        case Pre_op::ID:
+        	derived()->children_pre_op(dynamic_cast<Pre_op*>(in));
+        	break;
+        case Unset::ID:
+        	derived()->children_unset(dynamic_cast<Unset*>(in));
+        	break;
+        case Label::ID:
+        	derived()->children_label(dynamic_cast<Label*>(in));
+        	break;
+        case Goto::ID:
+        	derived()->children_goto(dynamic_cast<Goto*>(in));
+        	break;
+        case Branch::ID:
+        	derived()->children_branch(dynamic_cast<Branch*>(in));
+        	break;
+        case Foreach_next::ID:
+        	derived()->children_foreach_next(dynamic_cast<Foreach_next*>(in));
+        	break;
+        case Foreach_reset::ID:
+        	derived()->children_foreach_reset(dynamic_cast<Foreach_reset*>(in));
+        	break;
+        case Foreach_end::ID:
+        	derived()->children_foreach_end(dynamic_cast<Foreach_end*>(in));
+        	break;
+        case FOREIGN::ID:
+        	derived()->children_foreign(dynamic_cast<FOREIGN*>(in));
+        	break;
+        }
+    }
+
+    void children_member(Member* in)
+    {
+        switch(in->classid())
+        {
+        case Method::ID:
+        	derived()->children_method(dynamic_cast<Method*>(in));
+        	break;
+        case Attribute::ID:
+        	derived()->children_attribute(dynamic_cast<Attribute*>(in));
+        	break;
+        }
+    }
+
+    void children_static_value(Static_value* in)
+    {
+        switch(in->classid())
+        {
+        case INT::ID:
+        	derived()->children_int(dynamic_cast<INT*>(in));
+        	break;
+        case REAL::ID:
+        	derived()->children_real(dynamic_cast<REAL*>(in));
+        	break;
+        case STRING::ID:
+        	derived()->children_string(dynamic_cast<STRING*>(in));
+        	break;
+        case BOOL::ID:
+        	derived()->children_bool(dynamic_cast<BOOL*>(in));
+        	break;
+        case NIL::ID:
+        	derived()->children_nil(dynamic_cast<NIL*>(in));
+        	break;
+        case Static_array::ID:
+        	derived()->children_static_array(dynamic_cast<Static_array*>(in));
+        	break;
+        case Constant::ID:
+        	derived()->children_constant(dynamic_cast<Constant*>(in));
+        	break;
+        }
+    }
+
+    void children_rvalue(Rvalue* in)
+    {
+        switch(in->classid())
+        {
+        case INT::ID:
+        	derived()->children_int(dynamic_cast<INT*>(in));
+        	break;
+        case REAL::ID:
+        	derived()->children_real(dynamic_cast<REAL*>(in));
+        	break;
+        case STRING::ID:
+        	derived()->children_string(dynamic_cast<STRING*>(in));
+        	break;
+        case BOOL::ID:
+        	derived()->children_bool(dynamic_cast<BOOL*>(in));
+        	break;
+        case NIL::ID:
+        	derived()->children_nil(dynamic_cast<NIL*>(in));
+        	break;
+        case VARIABLE_NAME::ID:
+        	derived()->children_variable_name(dynamic_cast<VARIABLE_NAME*>(in));
+        	break;
+        }
+    }
+
+    void children_variable_name(Variable_name* in)
+    {
+        switch(in->classid())
+        {
+        case VARIABLE_NAME::ID:
+        	derived()->children_variable_name(dynamic_cast<VARIABLE_NAME*>(in));
+        	break;
+        case Variable_variable::ID:
+        	derived()->children_variable_variable(dynamic_cast<Variable_variable*>(in));
+        	break;
+        }
+    }
+
+    void children_expr(Expr* in)
+    {
+        switch(in->classid())
+        {
+        case Cast::ID:
+        	derived()->children_cast(dynamic_cast<Cast*>(in));
+        	break;
+        case Unary_op::ID:
+        	derived()->children_unary_op(dynamic_cast<Unary_op*>(in));
+        	break;
+        case Bin_op::ID:
+        	derived()->children_bin_op(dynamic_cast<Bin_op*>(in));
+        	break;
+        case Constant::ID:
+        	derived()->children_constant(dynamic_cast<Constant*>(in));
+        	break;
+        case Instanceof::ID:
+        	derived()->children_instanceof(dynamic_cast<Instanceof*>(in));
+        	break;
+        case Method_invocation::ID:
+        	derived()->children_method_invocation(dynamic_cast<Method_invocation*>(in));
+        	break;
+        case New::ID:
+        	derived()->children_new(dynamic_cast<New*>(in));
+        	break;
+        case INT::ID:
+        	derived()->children_int(dynamic_cast<INT*>(in));
+        	break;
+        case REAL::ID:
+        	derived()->children_real(dynamic_cast<REAL*>(in));
+        	break;
+        case STRING::ID:
+        	derived()->children_string(dynamic_cast<STRING*>(in));
+        	break;
+        case BOOL::ID:
+        	derived()->children_bool(dynamic_cast<BOOL*>(in));
+        	break;
+        case NIL::ID:
+        	derived()->children_nil(dynamic_cast<NIL*>(in));
+        	break;
+        case VARIABLE_NAME::ID:
+        	derived()->children_variable_name(dynamic_cast<VARIABLE_NAME*>(in));
+        	break;
+        case Variable_variable::ID:
+        	derived()->children_variable_variable(dynamic_cast<Variable_variable*>(in));
+        	break;
+        case Array_access::ID:
+        	derived()->children_array_access(dynamic_cast<Array_access*>(in));
+        	break;
+        case Field_access::ID:
+        	derived()->children_field_access(dynamic_cast<Field_access*>(in));
+        	break;
+        case Array_next::ID:
+        	derived()->children_array_next(dynamic_cast<Array_next*>(in));
+        	break;
+        case FOREIGN::ID:
+        	derived()->children_foreign(dynamic_cast<FOREIGN*>(in));
+        	break;
+        case Isset::ID:
+        	derived()->children_isset(dynamic_cast<Isset*>(in));
+        	break;
+        case Foreach_has_key::ID:
+        	derived()->children_foreach_has_key(dynamic_cast<Foreach_has_key*>(in));
+        	break;
+        case Foreach_get_key::ID:
+        	derived()->children_foreach_get_key(dynamic_cast<Foreach_get_key*>(in));
+        	break;
+        case Foreach_get_val::ID:
+        	derived()->children_foreach_get_val(dynamic_cast<Foreach_get_val*>(in));
+        	break;
+        case Param_is_ref::ID:
+        	derived()->children_param_is_ref(dynamic_cast<Param_is_ref*>(in));
+        	break;
+        }
+    }
+
+    void children_target(Target* in)
+    {
+        switch(in->classid())
+        {
+        case VARIABLE_NAME::ID:
+        	derived()->children_variable_name(dynamic_cast<VARIABLE_NAME*>(in));
+        	break;
+        case CLASS_NAME::ID:
+        	derived()->children_class_name(dynamic_cast<CLASS_NAME*>(in));
+        	break;
+        }
+    }
+
+    void children_field_name(Field_name* in)
+    {
+        switch(in->classid())
+        {
+        case FIELD_NAME::ID:
+        	derived()->children_field_name(dynamic_cast<FIELD_NAME*>(in));
+        	break;
+        case Variable_field::ID:
+        	derived()->children_variable_field(dynamic_cast<Variable_field*>(in));
+        	break;
+        }
+    }
+
+    void children_class_name(Class_name* in)
+    {
+        switch(in->classid())
+        {
+        case CLASS_NAME::ID:
+        	derived()->children_class_name(dynamic_cast<CLASS_NAME*>(in));
+        	break;
+        case Variable_class::ID:
+        	derived()->children_variable_class(dynamic_cast<Variable_class*>(in));
+        	break;
+        }
+    }
+
+    void children_method_name(Method_name* in)
+    {
+        switch(in->classid())
+        {
+        case METHOD_NAME::ID:
+        	derived()->children_method_name(dynamic_cast<METHOD_NAME*>(in));
+        	break;
+        case Variable_method::ID:
+        	derived()->children_variable_method(dynamic_cast<Variable_method*>(in));
+        	break;
+        }
+    }
+
+    void children_static_array_key(Static_array_key* in)
+    {
+        switch(in->classid())
+        {
+        case INT::ID:
+        	derived()->children_int(dynamic_cast<INT*>(in));
+        	break;
+        case REAL::ID:
+        	derived()->children_real(dynamic_cast<REAL*>(in));
+        	break;
+        case STRING::ID:
+        	derived()->children_string(dynamic_cast<STRING*>(in));
+        	break;
+        case BOOL::ID:
+        	derived()->children_bool(dynamic_cast<BOOL*>(in));
+        	break;
+        case NIL::ID:
+        	derived()->children_nil(dynamic_cast<NIL*>(in));
+        	break;
+        case Constant::ID:
+        	derived()->children_constant(dynamic_cast<Constant*>(in));
+        	break;
+        }
+    }
+
+protected:
+    Derived* derived()
+    {
+    	return static_cast<Derived*>(this);
+    }
+};
+}
+
+
+#endif
@@ -46,12 +46,16 @@ const char *gengetopt_args_info_full_help[] = {
   "      --no-warnings             Allow warnings to be printed  (default=off)",
   "\nINPUT OPTIONS:",
   "      --read-xml=PASSNAME       Assume the input is in XML format. Start \n                                  processing after the named pass (passes are \n                                  ast|hir|mir)",
+  "      --read-bin=PASSNAME       Assume the input is in phc's binary IR format. \n                                  Start processing after the named pass (passes \n                                  are ast|hir|mir)",
   "      --no-xml-validation       Toggle XML validation  (default=on)",
   "      --include                 Parse included or required files at \n                                  compile-time  (default=off)",
   "      --include-harder          Try harder to find included files, possibly \n                                  slightly breaking some of PHP's rules  \n                                  (default=off)",
   "      --include-regexp          Use regular expressions to find include files  \n                                  (default=off)",
   "      --include-name            Try even harder to find include files, \n                                  searching the basename of the include \n                                  argument.  (default=off)",
   "      --include-searchdir=DIRECTORY\n                                Search regular expressions starting from the \n                                  search directory",
+  "      --include-jobs=JOBS       Parse up to JOBS included files at once (0 means \n                                  one per processor)  (default=`0')",
+  "      --parse-cache=DIRECTORY   Keep parsed scripts in DIRECTORY, to be reused \n                                  while their files are unchanged",
+  "      --stream                  Process the input one top-level statement at a \n                                  time, to limit the memory used by very large \n                                  scripts (not with -c or -O)  (default=off)",
   "\nCOMPILATION OPTIONS:",
   "  -C, --c-option=STRING         Pass option to the C compile (e.g., -C-g; can \n                                  be specified multiple times)",
   "      --generate-c              Generate C code  (default=off)",
@@ -69,6 +73,7 @@ const char *gengetopt_args_info_full_help[] = {
   "\nOUTPUT OPTIONS:",
   "      --dump=PASSNAME           Dump input as PHP (although potentially with \n                                  gotos and labels) after PASSNAME",
   "      --dump-xml=PASSNAME       Dump input as XML after PASSNAME",
+  "      --dump-bin=PASSNAME       Dump input in phc's binary IR format after \n                                  PASSNAME",
   "      --dump-dot=PASSNAME       Dump input as DOT after PASSNAME",
   "      --dump-parse-tree         Dump parse tree as DOT  (default=off)",
   "      --dump-tokens             Dump list of tokens from the lexer  \n                                  (default=off)",
@@ -87,12 +92,19 @@ const char *gengetopt_args_info_full_help[] = {
   "      --flow-insensitive        Turn off flow-sensitivity  (default=off)",
   "      --call-string-length=LENGTH\n                                Choose the call-string length ('0' indicates \n                                  infinite call-string)  (default=`0')",
   "      --ssi-type=FLAVOR         Select SSI flavor.  (possible values=\"ssi\", \n                                  \"essa\" default=`ssi')",
+  "      --memoize                 Cache the results of pure functions at run-time  \n                                  (default=off)",
   "\nDEBUGGING PHC:",
   "      --stats                   Print compile-time statistics  (default=off)",
+  "      --time-passes             Print the time and memory used by each pass  \n                                  (default=off)",
+  "      --time-passes-json=FILENAME\n                                Write the time and memory used by each pass to \n                                  FILENAME, as JSON",
+  "      --wpa-trace=FILENAME      Write a trace of the whole-program analysis to \n                                  FILENAME, as JSON lines",
+  "      --alloc-profile           Print the memory allocated by each type and pass  \n                                  (default=off)",
   "      --rt-stats                Print statistics about a program at run-time  \n                                  (default=off)",
   "      --cfg-dump=PASSNAME       Dump CFG after the pass named 'PASSNAME'",
   "      --debug=PASSNAME          Print debugging information for the pass named \n                                  'PASSNAME",
   "      --dont-fail               Dont fail on error (after parsing)  \n                                  (default=off)",
+  "      --check-folding           Check constant folding against the PHP \n                                  interpreter  (default=off)",
+  "      --debug-arenas            Protect arena memory after it is released, to \n                                  catch data which outlives its arena  \n                                  (default=off)",
   "      --disable=PASSNAME        Disable the pass named 'PASSNAME'",
   "      --pause                   Pause compilation at pause() statements (in phc \n                                  source, not user code)  (default=off)",
   "\nMore options are available via --full-help",
@@ -116,19 +128,19 @@ init_help_array(void)
   gengetopt_args_info_help[11] = gengetopt_args_info_full_help[11];
   gengetopt_args_info_help[12] = gengetopt_args_info_full_help[12];
   gengetopt_args_info_help[13] = gengetopt_args_info_full_help[13];
-  gengetopt_args_info_help[14] = gengetopt_args_info_full_help[15];
+  gengetopt_args_info_help[14] = gengetopt_args_info_full_help[14];
   gengetopt_args_info_help[15] = gengetopt_args_info_full_help[16];
   gengetopt_args_info_help[16] = gengetopt_args_info_full_help[17];
   gengetopt_args_info_help[17] = gengetopt_args_info_full_help[18];
   gengetopt_args_info_help[18] = gengetopt_args_info_full_help[19];
   gengetopt_args_info_help[19] = gengetopt_args_info_full_help[20];
   gengetopt_args_info_help[20] = gengetopt_args_info_full_help[21];
-  gengetopt_args_info_help[21] = gengetopt_args_info_full_help[23];
-  gengetopt_args_info_help[22] = gengetopt_args_info_full_help[24];
-  gengetopt_args_info_help[23] = gengetopt_args_info_full_help[26];
-  gengetopt_args_info_help[24] = gengetopt_args_info_full_help[27];
-  gengetopt_args_info_help[25] = gengetopt_args_info_full_help[28];
-  gengetopt_args_info_help[26] = gengetopt_args_info_full_help[29];
+  gengetopt_args_info_help[21] = gengetopt_args_info_full_help[22];
+  gengetopt_args_info_help[22] = gengetopt_args_info_full_help[23];
+  gengetopt_args_info_help[23] = gengetopt_args_info_full_help[24];
+  gengetopt_args_info_help[24] = gengetopt_args_info_full_help[25];
+  gengetopt_args_info_help[25] = gengetopt_args_info_full_help[27];
+  gengetopt_args_info_help[26] = gengetopt_args_info_full_help[28];
   gengetopt_args_info_help[27] = gengetopt_args_info_full_help[30];
   gengetopt_args_info_help[28] = gengetopt_args_info_full_help[31];
   gengetopt_args_info_help[29] = gengetopt_args_info_full_help[32];
@@ -137,17 +149,23 @@ init_help_array(void)
   gengetopt_args_info_help[32] = gengetopt_args_info_full_help[35];
   gengetopt_args_info_help[33] = gengetopt_args_info_full_help[36];
   gengetopt_args_info_help[34] = gengetopt_args_info_full_help[37];
-  gengetopt_args_info_help[35] = gengetopt_args_info_full_help[40];
-  gengetopt_args_info_help[36] = gengetopt_args_info_full_help[51];
-  gengetopt_args_info_help[37] = gengetopt_args_info_full_help[52];
-  gengetopt_args_info_help[38] = gengetopt_args_info_full_help[53];
-  gengetopt_args_info_help[39] = gengetopt_args_info_full_help[54];
-  gengetopt_args_info_help[40] = gengetopt_args_info_full_help[63];
-  gengetopt_args_info_help[41] = 0; 
+  gengetopt_args_info_help[35] = gengetopt_args_info_full_help[38];
+  gengetopt_args_info_help[36] = gengetopt_args_info_full_help[39];
+  gengetopt_args_info_help[37] = gengetopt_args_info_full_help[40];
+  gengetopt_args_info_help[38] = gengetopt_args_info_full_help[41];
+  gengetopt_args_info_help[39] = gengetopt_args_info_full_help[42];
+  gengetopt_args_info_help[40] = gengetopt_args_info_full_help[45];
+  gengetopt_args_info_help[41] = gengetopt_args_info_full_help[56];
+  gengetopt_args_info_help[42] = gengetopt_args_info_full_help[57];
+  gengetopt_args_info_help[43] = gengetopt_args_info_full_help[58];
+  gengetopt_args_info_help[44] = gengetopt_args_info_full_help[59];
+  gengetopt_args_info_help[45] = gengetopt_args_info_full_help[60];
+  gengetopt_args_info_help[46] = gengetopt_args_info_full_help[75];
+  gengetopt_args_info_help[47] = 0; 
   
 }
 
-const char *gengetopt_args_info_help[42];
+const char *gengetopt_args_info_help[48];
 
 typedef enum {ARG_NO
   , ARG_FLAG
@@ -188,12 +206,16 @@ void clear_given (struct gengetopt_args_info *args_info)
   args_info->define_given = 0 ;
   args_info->no_warnings_given = 0 ;
   args_info->read_xml_given = 0 ;
+  args_info->read_bin_given = 0 ;
   args_info->no_xml_validation_given = 0 ;
   args_info->include_given = 0 ;
   args_info->include_harder_given = 0 ;
   args_info->include_regexp_given = 0 ;
   args_info->include_name_given = 0 ;
   args_info->include_searchdir_given = 0 ;
+  args_info->include_jobs_given = 0 ;
+  args_info->parse_cache_given = 0 ;
+  args_info->stream_given = 0 ;
   args_info->c_option_given = 0 ;
   args_info->generate_c_given = 0 ;
   args_info->extension_given = 0 ;
@@ -208,6 +230,7 @@ void clear_given (struct gengetopt_args_info *args_info)
   args_info->no_hash_bang_given = 0 ;
   args_info->dump_given = 0 ;
   args_info->dump_xml_given = 0 ;
+  args_info->dump_bin_given = 0 ;
   args_info->dump_dot_given = 0 ;
   args_info->dump_parse_tree_given = 0 ;
   args_info->dump_tokens_given = 0 ;
@@ -222,11 +245,18 @@ void clear_given (struct gengetopt_args_info *args_info)
   args_info->flow_insensitive_given = 0 ;
   args_info->call_string_length_given = 0 ;
   args_info->ssi_type_given = 0 ;
+  args_info->memoize_given = 0 ;
   args_info->stats_given = 0 ;
+  args_info->time_passes_given = 0 ;
+  args_info->time_passes_json_given = 0 ;
+  args_info->wpa_trace_given = 0 ;
+  args_info->alloc_profile_given = 0 ;
   args_info->rt_stats_given = 0 ;
   args_info->cfg_dump_given = 0 ;
   args_info->debug_given = 0 ;
   args_info->dont_fail_given = 0 ;
+  args_info->check_folding_given = 0 ;
+  args_info->debug_arenas_given = 0 ;
   args_info->disable_given = 0 ;
   args_info->pause_given = 0 ;
 }
@@ -248,6 +278,8 @@ void clear_args (struct gengetopt_args_info *args_info)
   args_info->no_warnings_flag = 0;
   args_info->read_xml_arg = NULL;
   args_info->read_xml_orig = NULL;
+  args_info->read_bin_arg = NULL;
+  args_info->read_bin_orig = NULL;
   args_info->no_xml_validation_flag = 1;
   args_info->include_flag = 0;
   args_info->include_harder_flag = 0;
@@ -255,6 +287,11 @@ void clear_args (struct gengetopt_args_info *args_info)
   args_info->include_name_flag = 0;
   args_info->include_searchdir_arg = NULL;
   args_info->include_searchdir_orig = NULL;
+  args_info->include_jobs_arg = 0;
+  args_info->include_jobs_orig = NULL;
+  args_info->parse_cache_arg = NULL;
+  args_info->parse_cache_orig = NULL;
+  args_info->stream_flag = 0;
   args_info->c_option_arg = NULL;
   args_info->c_option_orig = NULL;
   args_info->generate_c_flag = 0;
@@ -278,6 +315,8 @@ void clear_args (struct gengetopt_args_info *args_info)
   args_info->dump_orig = NULL;
   args_info->dump_xml_arg = NULL;
   args_info->dump_xml_orig = NULL;
+  args_info->dump_bin_arg = NULL;
+  args_info->dump_bin_orig = NULL;
   args_info->dump_dot_arg = NULL;
   args_info->dump_dot_orig = NULL;
   args_info->dump_parse_tree_flag = 0;
@@ -295,13 +334,22 @@ void clear_args (struct gengetopt_args_info *args_info)
   args_info->call_string_length_orig = NULL;
   args_info->ssi_type_arg = ssi_type_arg_ssi;
   args_info->ssi_type_orig = NULL;
+  args_info->memoize_flag = 0;
   args_info->stats_flag = 0;
+  args_info->time_passes_flag = 0;
+  args_info->time_passes_json_arg = NULL;
+  args_info->time_passes_json_orig = NULL;
+  args_info->wpa_trace_arg = NULL;
+  args_info->wpa_trace_orig = NULL;
+  args_info->alloc_profile_flag = 0;
   args_info->rt_stats_flag = 0;
   args_info->cfg_dump_arg = NULL;
   args_info->cfg_dump_orig = NULL;
   args_info->debug_arg = NULL;
   args_info->debug_orig = NULL;
   args_info->dont_fail_flag = 0;
+  args_info->check_folding_flag = 0;
+  args_info->debug_arenas_flag = 0;
   args_info->disable_arg = NULL;
   args_info->disable_orig = NULL;
   args_info->pause_flag = 0;
@@ -331,61 +379,75 @@ void init_args_info(struct gengetopt_args_info *args_info)
   args_info->define_max = 0;
   args_info->no_warnings_help = gengetopt_args_info_full_help[11] ;
   args_info->read_xml_help = gengetopt_args_info_full_help[13] ;
-  args_info->no_xml_validation_help = gengetopt_args_info_full_help[14] ;
-  args_info->include_help = gengetopt_args_info_full_help[15] ;
-  args_info->include_harder_help = gengetopt_args_info_full_help[16] ;
-  args_info->include_regexp_help = gengetopt_args_info_full_help[17] ;
-  args_info->include_name_help = gengetopt_args_info_full_help[18] ;
-  args_info->include_searchdir_help = gengetopt_args_info_full_help[19] ;
-  args_info->c_option_help = gengetopt_args_info_full_help[21] ;
+  args_info->read_bin_help = gengetopt_args_info_full_help[14] ;
+  args_info->no_xml_validation_help = gengetopt_args_info_full_help[15] ;
+  args_info->include_help = gengetopt_args_info_full_help[16] ;
+  args_info->include_harder_help = gengetopt_args_info_full_help[17] ;
+  args_info->include_regexp_help = gengetopt_args_info_full_help[18] ;
+  args_info->include_name_help = gengetopt_args_info_full_help[19] ;
+  args_info->include_searchdir_help = gengetopt_args_info_full_help[20] ;
+  args_info->include_jobs_help = gengetopt_args_info_full_help[21] ;
+  args_info->parse_cache_help = gengetopt_args_info_full_help[22] ;
+  args_info->stream_help = gengetopt_args_info_full_help[23] ;
+  args_info->c_option_help = gengetopt_args_info_full_help[25] ;
   args_info->c_option_min = 0;
   args_info->c_option_max = 0;
-  args_info->generate_c_help = gengetopt_args_info_full_help[22] ;
-  args_info->extension_help = gengetopt_args_info_full_help[23] ;
-  args_info->web_app_help = gengetopt_args_info_full_help[24] ;
-  args_info->with_php_help = gengetopt_args_info_full_help[25] ;
-  args_info->optimize_help = gengetopt_args_info_full_help[26] ;
-  args_info->output_help = gengetopt_args_info_full_help[27] ;
-  args_info->execute_help = gengetopt_args_info_full_help[28] ;
-  args_info->next_line_curlies_help = gengetopt_args_info_full_help[30] ;
-  args_info->no_leading_tab_help = gengetopt_args_info_full_help[31] ;
-  args_info->tab_help = gengetopt_args_info_full_help[32] ;
-  args_info->no_hash_bang_help = gengetopt_args_info_full_help[33] ;
-  args_info->dump_help = gengetopt_args_info_full_help[35] ;
+  args_info->generate_c_help = gengetopt_args_info_full_help[26] ;
+  args_info->extension_help = gengetopt_args_info_full_help[27] ;
+  args_info->web_app_help = gengetopt_args_info_full_help[28] ;
+  args_info->with_php_help = gengetopt_args_info_full_help[29] ;
+  args_info->optimize_help = gengetopt_args_info_full_help[30] ;
+  args_info->output_help = gengetopt_args_info_full_help[31] ;
+  args_info->execute_help = gengetopt_args_info_full_help[32] ;
+  args_info->next_line_curlies_help = gengetopt_args_info_full_help[34] ;
+  args_info->no_leading_tab_help = gengetopt_args_info_full_help[35] ;
+  args_info->tab_help = gengetopt_args_info_full_help[36] ;
+  args_info->no_hash_bang_help = gengetopt_args_info_full_help[37] ;
+  args_info->dump_help = gengetopt_args_info_full_help[39] ;
   args_info->dump_min = 0;
   args_info->dump_max = 0;
-  args_info->dump_xml_help = gengetopt_args_info_full_help[36] ;
+  args_info->dump_xml_help = gengetopt_args_info_full_help[40] ;
+  args_info->dump_bin_help = gengetopt_args_info_full_help[41] ;
+  args_info->dump_bin_min = 0;
+  args_info->dump_bin_max = 0;
   args_info->dump_xml_min = 0;
   args_info->dump_xml_max = 0;
-  args_info->dump_dot_help = gengetopt_args_info_full_help[37] ;
+  args_info->dump_dot_help = gengetopt_args_info_full_help[42] ;
   args_info->dump_dot_min = 0;
   args_info->dump_dot_max = 0;
-  args_info->dump_parse_tree_help = gengetopt_args_info_full_help[38] ;
-  args_info->dump_tokens_help = gengetopt_args_info_full_help[39] ;
-  args_info->list_passes_help = gengetopt_args_info_full_help[40] ;
-  args_info->convert_uppered_help = gengetopt_args_info_full_help[42] ;
-  args_info->no_dot_line_numbers_help = gengetopt_args_info_full_help[44] ;
-  args_info->no_dot_nulls_help = gengetopt_args_info_full_help[45] ;
-  args_info->no_dot_empty_lists_help = gengetopt_args_info_full_help[46] ;
-  args_info->no_xml_line_numbers_help = gengetopt_args_info_full_help[48] ;
-  args_info->no_xml_base_64_help = gengetopt_args_info_full_help[49] ;
-  args_info->no_xml_attrs_help = gengetopt_args_info_full_help[50] ;
-  args_info->flow_insensitive_help = gengetopt_args_info_full_help[52] ;
-  args_info->call_string_length_help = gengetopt_args_info_full_help[53] ;
-  args_info->ssi_type_help = gengetopt_args_info_full_help[54] ;
-  args_info->stats_help = gengetopt_args_info_full_help[56] ;
-  args_info->rt_stats_help = gengetopt_args_info_full_help[57] ;
-  args_info->cfg_dump_help = gengetopt_args_info_full_help[58] ;
+  args_info->dump_parse_tree_help = gengetopt_args_info_full_help[43] ;
+  args_info->dump_tokens_help = gengetopt_args_info_full_help[44] ;
+  args_info->list_passes_help = gengetopt_args_info_full_help[45] ;
+  args_info->convert_uppered_help = gengetopt_args_info_full_help[47] ;
+  args_info->no_dot_line_numbers_help = gengetopt_args_info_full_help[49] ;
+  args_info->no_dot_nulls_help = gengetopt_args_info_full_help[50] ;
+  args_info->no_dot_empty_lists_help = gengetopt_args_info_full_help[51] ;
+  args_info->no_xml_line_numbers_help = gengetopt_args_info_full_help[53] ;
+  args_info->no_xml_base_64_help = gengetopt_args_info_full_help[54] ;
+  args_info->no_xml_attrs_help = gengetopt_args_info_full_help[55] ;
+  args_info->flow_insensitive_help = gengetopt_args_info_full_help[57] ;
+  args_info->call_string_length_help = gengetopt_args_info_full_help[58] ;
+  args_info->ssi_type_help = gengetopt_args_info_full_help[59] ;
+  args_info->memoize_help = gengetopt_args_info_full_help[60] ;
+  args_info->stats_help = gengetopt_args_info_full_help[62] ;
+  args_info->time_passes_help = gengetopt_args_info_full_help[63] ;
+  args_info->time_passes_json_help = gengetopt_args_info_full_help[64] ;
+  args_info->wpa_trace_help = gengetopt_args_info_full_help[65] ;
+  args_info->alloc_profile_help = gengetopt_args_info_full_help[66] ;
+  args_info->rt_stats_help = gengetopt_args_info_full_help[67] ;
+  args_info->cfg_dump_help = gengetopt_args_info_full_help[68] ;
   args_info->cfg_dump_min = 0;
   args_info->cfg_dump_max = 0;
-  args_info->debug_help = gengetopt_args_info_full_help[59] ;
+  args_info->debug_help = gengetopt_args_info_full_help[69] ;
   args_info->debug_min = 0;
   args_info->debug_max = 0;
-  args_info->dont_fail_help = gengetopt_args_info_full_help[60] ;
-  args_info->disable_help = gengetopt_args_info_full_help[61] ;
+  args_info->dont_fail_help = gengetopt_args_info_full_help[70] ;
+  args_info->check_folding_help = gengetopt_args_info_full_help[71] ;
+  args_info->debug_arenas_help = gengetopt_args_info_full_help[72] ;
+  args_info->disable_help = gengetopt_args_info_full_help[73] ;
   args_info->disable_min = 0;
   args_info->disable_max = 0;
-  args_info->pause_help = gengetopt_args_info_full_help[62] ;
+  args_info->pause_help = gengetopt_args_info_full_help[74] ;
   
 }
 
@@ -528,8 +590,13 @@ cmdline_parser_release (struct gengetopt_args_info *args_info)
   free_multiple_string_field (args_info->define_given, &(args_info->define_arg), &(args_info->define_orig));
   free_string_field (&(args_info->read_xml_arg));
   free_string_field (&(args_info->read_xml_orig));
+  free_string_field (&(args_info->read_bin_arg));
+  free_string_field (&(args_info->read_bin_orig));
   free_string_field (&(args_info->include_searchdir_arg));
   free_string_field (&(args_info->include_searchdir_orig));
+  free_string_field (&(args_info->include_jobs_orig));
+  free_string_field (&(args_info->parse_cache_arg));
+  free_string_field (&(args_info->parse_cache_orig));
   free_multiple_string_field (args_info->c_option_given, &(args_info->c_option_arg), &(args_info->c_option_orig));
   free_string_field (&(args_info->extension_arg));
   free_string_field (&(args_info->extension_orig));
@@ -545,9 +612,14 @@ cmdline_parser_release (struct gengetopt_args_info *args_info)
   free_string_field (&(args_info->tab_orig));
   free_multiple_string_field (args_info->dump_given, &(args_info->dump_arg), &(args_info->dump_orig));
   free_multiple_string_field (args_info->dump_xml_given, &(args_info->dump_xml_arg), &(args_info->dump_xml_orig));
+  free_multiple_string_field (args_info->dump_bin_given, &(args_info->dump_bin_arg), &(args_info->dump_bin_orig));
   free_multiple_string_field (args_info->dump_dot_given, &(args_info->dump_dot_arg), &(args_info->dump_dot_orig));
   free_string_field (&(args_info->call_string_length_orig));
   free_string_field (&(args_info->ssi_type_orig));
+  free_string_field (&(args_info->time_passes_json_arg));
+  free_string_field (&(args_info->time_passes_json_orig));
+  free_string_field (&(args_info->wpa_trace_arg));
+  free_string_field (&(args_info->wpa_trace_orig));
   free_multiple_string_field (args_info->cfg_dump_given, &(args_info->cfg_dump_arg), &(args_info->cfg_dump_orig));
   free_multiple_string_field (args_info->debug_given, &(args_info->debug_arg), &(args_info->debug_orig));
   free_multiple_string_field (args_info->disable_given, &(args_info->disable_arg), &(args_info->disable_orig));
@@ -656,6 +728,8 @@ cmdline_parser_dump(FILE *outfile, struct gengetopt_args_info *args_info)
     write_into_file(outfile, "no-warnings", 0, 0 );
   if (args_info->read_xml_given)
     write_into_file(outfile, "read-xml", args_info->read_xml_orig, 0);
+  if (args_info->read_bin_given)
+    write_into_file(outfile, "read-bin", args_info->read_bin_orig, 0);
   if (args_info->no_xml_validation_given)
     write_into_file(outfile, "no-xml-validation", 0, 0 );
   if (args_info->include_given)
@@ -668,6 +742,12 @@ cmdline_parser_dump(FILE *outfile, struct gengetopt_args_info *args_info)
     write_into_file(outfile, "include-name", 0, 0 );
   if (args_info->include_searchdir_given)
     write_into_file(outfile, "include-searchdir", args_info->include_searchdir_orig, 0);
+  if (args_info->include_jobs_given)
+    write_into_file(outfile, "include-jobs", args_info->include_jobs_orig, 0);
+  if (args_info->parse_cache_given)
+    write_into_file(outfile, "parse-cache", args_info->parse_cache_orig, 0);
+  if (args_info->stream_given)
+    write_into_file(outfile, "stream", 0, 0 );
   write_multiple_into_file(outfile, args_info->c_option_given, "c-option", args_info->c_option_orig, 0);
   if (args_info->generate_c_given)
     write_into_file(outfile, "generate-c", 0, 0 );
@@ -693,6 +773,7 @@ cmdline_parser_dump(FILE *outfile, struct gengetopt_args_info *args_info)
     write_into_file(outfile, "no-hash-bang", 0, 0 );
   write_multiple_into_file(outfile, args_info->dump_given, "dump", args_info->dump_orig, 0);
   write_multiple_into_file(outfile, args_info->dump_xml_given, "dump-xml", args_info->dump_xml_orig, 0);
+  write_multiple_into_file(outfile, args_info->dump_bin_given, "dump-bin", args_info->dump_bin_orig, 0);
   write_multiple_into_file(outfile, args_info->dump_dot_given, "dump-dot", args_info->dump_dot_orig, 0);
   if (args_info->dump_parse_tree_given)
     write_into_file(outfile, "dump-parse-tree", 0, 0 );
@@ -720,14 +801,28 @@ cmdline_parser_dump(FILE *outfile, struct gengetopt_args_info *args_info)
     write_into_file(outfile, "call-string-length", args_info->call_string_length_orig, 0);
   if (args_info->ssi_type_given)
     write_into_file(outfile, "ssi-type", args_info->ssi_type_orig, cmdline_parser_ssi_type_values);
+  if (args_info->memoize_given)
+    write_into_file(outfile, "memoize", 0, 0 );
   if (args_info->stats_given)
     write_into_file(outfile, "stats", 0, 0 );
+  if (args_info->time_passes_given)
+    write_into_file(outfile, "time-passes", 0, 0 );
+  if (args_info->time_passes_json_given)
+    write_into_file(outfile, "time-passes-json", args_info->time_passes_json_orig, 0);
+  if (args_info->wpa_trace_given)
+    write_into_file(outfile, "wpa-trace", args_info->wpa_trace_orig, 0);
+  if (args_info->alloc_profile_given)
+    write_into_file(outfile, "alloc-profile", 0, 0 );
   if (args_info->rt_stats_given)
     write_into_file(outfile, "rt-stats", 0, 0 );
   write_multiple_into_file(outfile, args_info->cfg_dump_given, "cfg-dump", args_info->cfg_dump_orig, 0);
   write_multiple_into_file(outfile, args_info->debug_given, "debug", args_info->debug_orig, 0);
   if (args_info->dont_fail_given)
     write_into_file(outfile, "dont-fail", 0, 0 );
+  if (args_info->check_folding_given)
+    write_into_file(outfile, "check-folding", 0, 0 );
+  if (args_info->debug_arenas_given)
+    write_into_file(outfile, "debug-arenas", 0, 0 );
   write_multiple_into_file(outfile, args_info->disable_given, "disable", args_info->disable_orig, 0);
   if (args_info->pause_given)
     write_into_file(outfile, "pause", 0, 0 );
@@ -999,6 +1094,9 @@ cmdline_parser_required2 (struct gengetopt_args_info *args_info, const char *pro
   if (check_multiple_option_occurrences(prog_name, args_info->dump_xml_given, args_info->dump_xml_min, args_info->dump_xml_max, "'--dump-xml'"))
      error = 1;
   
+  if (check_multiple_option_occurrences(prog_name, args_info->dump_bin_given, args_info->dump_bin_min, args_info->dump_bin_max, "'--dump-bin'"))
+     error = 1;
+  
   if (check_multiple_option_occurrences(prog_name, args_info->dump_dot_given, args_info->dump_dot_min, args_info->dump_dot_max, "'--dump-dot'"))
      error = 1;
   
@@ -1304,6 +1402,7 @@ cmdline_parser_internal (
   struct generic_list * c_option_list = NULL;
   struct generic_list * dump_list = NULL;
   struct generic_list * dump_xml_list = NULL;
+  struct generic_list * dump_bin_list = NULL;
   struct generic_list * dump_dot_list = NULL;
   struct generic_list * cfg_dump_list = NULL;
   struct generic_list * debug_list = NULL;
@@ -1350,12 +1449,16 @@ cmdline_parser_internal (
         { "define",	1, NULL, 'd' },
         { "no-warnings",	0, NULL, 0 },
         { "read-xml",	1, NULL, 0 },
+        { "read-bin",	1, NULL, 0 },
         { "no-xml-validation",	0, NULL, 0 },
         { "include",	0, NULL, 0 },
         { "include-harder",	0, NULL, 0 },
         { "include-regexp",	0, NULL, 0 },
         { "include-name",	0, NULL, 0 },
         { "include-searchdir",	1, NULL, 0 },
+        { "include-jobs",	1, NULL, 0 },
+        { "parse-cache",	1, NULL, 0 },
+        { "stream",	0, NULL, 0 },
         { "c-option",	1, NULL, 'C' },
         { "generate-c",	0, NULL, 0 },
         { "extension",	1, NULL, 0 },
@@ -1370,6 +1473,7 @@ cmdline_parser_internal (
         { "no-hash-bang",	0, NULL, 0 },
         { "dump",	1, NULL, 0 },
         { "dump-xml",	1, NULL, 0 },
+        { "dump-bin",	1, NULL, 0 },
         { "dump-dot",	1, NULL, 0 },
         { "dump-parse-tree",	0, NULL, 0 },
         { "dump-tokens",	0, NULL, 0 },
@@ -1384,11 +1488,18 @@ cmdline_parser_internal (
         { "flow-insensitive",	0, NULL, 0 },
         { "call-string-length",	1, NULL, 0 },
         { "ssi-type",	1, NULL, 0 },
+        { "memoize",	0, NULL, 0 },
         { "stats",	0, NULL, 0 },
+        { "time-passes",	0, NULL, 0 },
+        { "time-passes-json",	1, NULL, 0 },
+        { "wpa-trace",	1, NULL, 0 },
+        { "alloc-profile",	0, NULL, 0 },
         { "rt-stats",	0, NULL, 0 },
         { "cfg-dump",	1, NULL, 0 },
         { "debug",	1, NULL, 0 },
         { "dont-fail",	0, NULL, 0 },
+        { "check-folding",	0, NULL, 0 },
+        { "debug-arenas",	0, NULL, 0 },
         { "disable",	1, NULL, 0 },
         { "pause",	0, NULL, 0 },
         { 0,  0, 0, 0 }
@@ -1561,6 +1672,20 @@ cmdline_parser_internal (
                 additional_error))
               goto failure;
           
+          }
+          /* Assume the input is in phc's binary IR format. Start processing after the named pass (passes are ast|hir|mir).  */
+          else if (strcmp (long_options[option_index].name, "read-bin") == 0)
+          {
+          
+          
+            if (update_arg( (void *)&(args_info->read_bin_arg), 
+                 &(args_info->read_bin_orig), &(args_info->read_bin_given),
+                &(local_args_info.read_bin_given), optarg, 0, 0, ARG_STRING,
+                check_ambiguity, override, 0, 0,
+                "read-bin", '-',
+                additional_error))
+              goto failure;
+          
           }
           /* Toggle XML validation.  */
           else if (strcmp (long_options[option_index].name, "no-xml-validation") == 0)
@@ -1635,6 +1760,46 @@ cmdline_parser_internal (
                 additional_error))
               goto failure;
           
+          }
+          /* Parse up to JOBS included files at once (0 means one per processor).  */
+          else if (strcmp (long_options[option_index].name, "include-jobs") == 0)
+          {
+          
+          
+            if (update_arg( (void *)&(args_info->include_jobs_arg), 
+                 &(args_info->include_jobs_orig), &(args_info->include_jobs_given),
+                &(local_args_info.include_jobs_given), optarg, 0, "0", ARG_INT,
+                check_ambiguity, override, 0, 0,
+                "include-jobs", '-',
+                additional_error))
+              goto failure;
+          
+          }
+          /* Keep parsed scripts in DIRECTORY, to be reused while their files are unchanged.  */
+          else if (strcmp (long_options[option_index].name, "parse-cache") == 0)
+          {
+          
+          
+            if (update_arg( (void *)&(args_info->parse_cache_arg), 
+                 &(args_info->parse_cache_orig), &(args_info->parse_cache_given),
+                &(local_args_info.parse_cache_given), optarg, 0, 0, ARG_STRING,
+                check_ambiguity, override, 0, 0,
+                "parse-cache", '-',
+                additional_error))
+              goto failure;
+          
+          }
+          /* Process the input one top-level statement at a time, to limit the memory used by very large scripts (not with -c or -O).  */
+          else if (strcmp (long_options[option_index].name, "stream") == 0)
+          {
+          
+          
+            if (update_arg((void *)&(args_info->stream_flag), 0, &(args_info->stream_given),
+                &(local_args_info.stream_given), optarg, 0, 0, ARG_FLAG,
+                check_ambiguity, override, 1, 0, "stream", '-',
+                additional_error))
+              goto failure;
+          
           }
           /* Generate C code.  */
           else if (strcmp (long_options[option_index].name, "generate-c") == 0)
@@ -1761,6 +1926,17 @@ cmdline_parser_internal (
                 additional_error))
               goto failure;
           
+          }
+          /* Dump input in phc's binary IR format after PASSNAME.  */
+          else if (strcmp (long_options[option_index].name, "dump-bin") == 0)
+          {
+          
+            if (update_multiple_arg_temp(&dump_bin_list, 
+                &(local_args_info.dump_bin_given), optarg, 0, 0, ARG_STRING,
+                "dump-bin", '-',
+                additional_error))
+              goto failure;
+          
           }
           /* Dump input as DOT after PASSNAME.  */
           else if (strcmp (long_options[option_index].name, "dump-dot") == 0)
@@ -1932,6 +2108,18 @@ cmdline_parser_internal (
                 additional_error))
               goto failure;
           
+          }
+          /* Cache the results of pure functions at run-time.  */
+          else if (strcmp (long_options[option_index].name, "memoize") == 0)
+          {
+          
+          
+            if (update_arg((void *)&(args_info->memoize_flag), 0, &(args_info->memoize_given),
+                &(local_args_info.memoize_given), optarg, 0, 0, ARG_FLAG,
+                check_ambiguity, override, 1, 0, "memoize", '-',
+                additional_error))
+              goto failure;
+          
           }
           /* Print compile-time statistics.  */
           else if (strcmp (long_options[option_index].name, "stats") == 0)
@@ -1944,6 +2132,58 @@ cmdline_parser_internal (
                 additional_error))
               goto failure;
           
+          }
+          /* Print the time and memory used by each pass.  */
+          else if (strcmp (long_options[option_index].name, "time-passes") == 0)
+          {
+          
+          
+            if (update_arg((void *)&(args_info->time_passes_flag), 0, &(args_info->time_passes_given),
+                &(local_args_info.time_passes_given), optarg, 0, 0, ARG_FLAG,
+                check_ambiguity, override, 1, 0, "time-passes", '-',
+                additional_error))
+              goto failure;
+          
+          }
+          /* Write the time and memory used by each pass to FILENAME, as JSON.  */
+          else if (strcmp (long_options[option_index].name, "time-passes-json") == 0)
+          {
+          
+          
+            if (update_arg( (void *)&(args_info->time_passes_json_arg), 
+                 &(args_info->time_passes_json_orig), &(args_info->time_passes_json_given),
+                &(local_args_info.time_passes_json_given), optarg, 0, 0, ARG_STRING,
+                check_ambiguity, override, 0, 0,
+                "time-passes-json", '-',
+                additional_error))
+              goto failure;
+          
+          }
+          /* Write a trace of the whole-program analysis to FILENAME, as JSON lines.  */
+          else if (strcmp (long_options[option_index].name, "wpa-trace") == 0)
+          {
+          
+          
+            if (update_arg( (void *)&(args_info->wpa_trace_arg), 
+                 &(args_info->wpa_trace_orig), &(args_info->wpa_trace_given),
+                &(local_args_info.wpa_trace_given), optarg, 0, 0, ARG_STRING,
+                check_ambiguity, override, 0, 0,
+                "wpa-trace", '-',
+                additional_error))
+              goto failure;
+          
+          }
+          /* Print the memory allocated by each type and pass.  */
+          else if (strcmp (long_options[option_index].name, "alloc-profile") == 0)
+          {
+          
+          
+            if (update_arg((void *)&(args_info->alloc_profile_flag), 0, &(args_info->alloc_profile_given),
+                &(local_args_info.alloc_profile_given), optarg, 0, 0, ARG_FLAG,
+                check_ambiguity, override, 1, 0, "alloc-profile", '-',
+                additional_error))
+              goto failure;
+          
           }
           /* Print statistics about a program at run-time.  */
           else if (strcmp (long_options[option_index].name, "rt-stats") == 0)
@@ -1990,6 +2230,30 @@ cmdline_parser_internal (
                 additional_error))
               goto failure;
           
+          }
+          /* Check constant folding against the PHP interpreter.  */
+          else if (strcmp (long_options[option_index].name, "check-folding") == 0)
+          {
+          
+          
+            if (update_arg((void *)&(args_info->check_folding_flag), 0, &(args_info->check_folding_given),
+                &(local_args_info.check_folding_given), optarg, 0, 0, ARG_FLAG,
+                check_ambiguity, override, 1, 0, "check-folding", '-',
+                additional_error))
+              goto failure;
+          
+          }
+          /* Protect arena memory after it is released, to catch data which outlives its arena.  */
+          else if (strcmp (long_options[option_index].name, "debug-arenas") == 0)
+          {
+          
+          
+            if (update_arg((void *)&(args_info->debug_arenas_flag), 0, &(args_info->debug_arenas_given),
+                &(local_args_info.debug_arenas_given), optarg, 0, 0, ARG_FLAG,
+                check_ambiguity, override, 1, 0, "debug-arenas", '-',
+                additional_error))
+              goto failure;
+          
           }
           /* Disable the pass named 'PASSNAME'.  */
           else if (strcmp (long_options[option_index].name, "disable") == 0)
@@ -2051,6 +2315,10 @@ cmdline_parser_internal (
     &(args_info->dump_xml_orig), args_info->dump_xml_given,
     local_args_info.dump_xml_given, 0,
     ARG_STRING, dump_xml_list);
+  update_multiple_arg((void *)&(args_info->dump_bin_arg),
+    &(args_info->dump_bin_orig), args_info->dump_bin_given,
+    local_args_info.dump_bin_given, 0,
+    ARG_STRING, dump_bin_list);
   update_multiple_arg((void *)&(args_info->dump_dot_arg),
     &(args_info->dump_dot_orig), args_info->dump_dot_given,
     local_args_info.dump_dot_given, 0,
@@ -2080,6 +2348,8 @@ cmdline_parser_internal (
   local_args_info.dump_given = 0;
   args_info->dump_xml_given += local_args_info.dump_xml_given;
   local_args_info.dump_xml_given = 0;
+  args_info->dump_bin_given += local_args_info.dump_bin_given;
+  local_args_info.dump_bin_given = 0;
   args_info->dump_dot_given += local_args_info.dump_dot_given;
   local_args_info.dump_dot_given = 0;
   args_info->cfg_dump_given += local_args_info.cfg_dump_given;
@@ -2132,6 +2402,7 @@ failure:
   free_list (c_option_list, 1 );
   free_list (dump_list, 1 );
   free_list (dump_xml_list, 1 );
+  free_list (dump_bin_list, 1 );
   free_list (dump_dot_list, 1 );
   free_list (cfg_dump_list, 1 );
   free_list (debug_list, 1 );
@@ -74,6 +74,9 @@ struct gengetopt_args_info
   char * read_xml_arg;	/**< @brief Assume the input is in XML format. Start processing after the named pass (passes are ast|hir|mir).  */
   char * read_xml_orig;	/**< @brief Assume the input is in XML format. Start processing after the named pass (passes are ast|hir|mir) original value given at command line.  */
   const char *read_xml_help; /**< @brief Assume the input is in XML format. Start processing after the named pass (passes are ast|hir|mir) help description.  */
+  char * read_bin_arg;	/**< @brief Assume the input is in phc's binary IR format. Start processing after the named pass (passes are ast|hir|mir).  */
+  char * read_bin_orig;	/**< @brief Assume the input is in phc's binary IR format. Start processing after the named pass (passes are ast|hir|mir) original value given at command line.  */
+  const char *read_bin_help; /**< @brief Assume the input is in phc's binary IR format. Start processing after the named pass (passes are ast|hir|mir) help description.  */
   int no_xml_validation_flag;	/**< @brief Toggle XML validation (default=on).  */
   const char *no_xml_validation_help; /**< @brief Toggle XML validation help description.  */
   int include_flag;	/**< @brief Parse included or required files at compile-time (default=off).  */
@@ -87,6 +90,14 @@ struct gengetopt_args_info
   char * include_searchdir_arg;	/**< @brief Search regular expressions starting from the search directory.  */
   char * include_searchdir_orig;	/**< @brief Search regular expressions starting from the search directory original value given at command line.  */
   const char *include_searchdir_help; /**< @brief Search regular expressions starting from the search directory help description.  */
+  int include_jobs_arg;	/**< @brief Parse up to JOBS included files at once (0 means one per processor) (default='0').  */
+  char * include_jobs_orig;	/**< @brief Parse up to JOBS included files at once (0 means one per processor) original value given at command line.  */
+  const char *include_jobs_help; /**< @brief Parse up to JOBS included files at once (0 means one per processor) help description.  */
+  char * parse_cache_arg;	/**< @brief Keep parsed scripts in DIRECTORY, to be reused while their files are unchanged.  */
+  char * parse_cache_orig;	/**< @brief Keep parsed scripts in DIRECTORY, to be reused while their files are unchanged original value given at command line.  */
+  const char *parse_cache_help; /**< @brief Keep parsed scripts in DIRECTORY, to be reused while their files are unchanged help description.  */
+  int stream_flag;	/**< @brief Process the input one top-level statement at a time, to limit the memory used by very large scripts (not with -c or -O) (default=off).  */
+  const char *stream_help; /**< @brief Process the input one top-level statement at a time, to limit the memory used by very large scripts (not with -c or -O) help description.  */
   char ** c_option_arg;	/**< @brief Pass option to the C compile (e.g., -C-g; can be specified multiple times).  */
   char ** c_option_orig;	/**< @brief Pass option to the C compile (e.g., -C-g; can be specified multiple times) original value given at command line.  */
   unsigned int c_option_min; /**< @brief Pass option to the C compile (e.g., -C-g; can be specified multiple times)'s minimum occurreces */
@@ -130,6 +141,11 @@ struct gengetopt_args_info
   unsigned int dump_xml_min; /**< @brief Dump input as XML after PASSNAME's minimum occurreces */
   unsigned int dump_xml_max; /**< @brief Dump input as XML after PASSNAME's maximum occurreces */
   const char *dump_xml_help; /**< @brief Dump input as XML after PASSNAME help description.  */
+  char ** dump_bin_arg;	/**< @brief Dump input in phc's binary IR format after PASSNAME.  */
+  char ** dump_bin_orig;	/**< @brief Dump input in phc's binary IR format after PASSNAME original value given at command line.  */
+  unsigned int dump_bin_min; /**< @brief Dump input in phc's binary IR format after PASSNAME's minimum occurreces */
+  unsigned int dump_bin_max; /**< @brief Dump input in phc's binary IR format after PASSNAME's maximum occurreces */
+  const char *dump_bin_help; /**< @brief Dump input in phc's binary IR format after PASSNAME help description.  */
   char ** dump_dot_arg;	/**< @brief Dump input as DOT after PASSNAME.  */
   char ** dump_dot_orig;	/**< @brief Dump input as DOT after PASSNAME original value given at command line.  */
   unsigned int dump_dot_min; /**< @brief Dump input as DOT after PASSNAME's minimum occurreces */
@@ -163,8 +179,20 @@ struct gengetopt_args_info
   enum enum_ssi_type ssi_type_arg;	/**< @brief Select SSI flavor. (default='ssi').  */
   char * ssi_type_orig;	/**< @brief Select SSI flavor. original value given at command line.  */
   const char *ssi_type_help; /**< @brief Select SSI flavor. help description.  */
+  int memoize_flag;	/**< @brief Cache the results of pure functions at run-time (default=off).  */
+  const char *memoize_help; /**< @brief Cache the results of pure functions at run-time help description.  */
   int stats_flag;	/**< @brief Print compile-time statistics (default=off).  */
   const char *stats_help; /**< @brief Print compile-time statistics help description.  */
+  int time_passes_flag;	/**< @brief Print the time and memory used by each pass (default=off).  */
+  const char *time_passes_help; /**< @brief Print the time and memory used by each pass help description.  */
+  char * time_passes_json_arg;	/**< @brief Write the time and memory used by each pass to FILENAME, as JSON.  */
+  char * time_passes_json_orig;	/**< @brief Write the time and memory used by each pass to FILENAME, as JSON original value given at command line.  */
+  const char *time_passes_json_help; /**< @brief Write the time and memory used by each pass to FILENAME, as JSON help description.  */
+  char * wpa_trace_arg;	/**< @brief Write a trace of the whole-program analysis to FILENAME, as JSON lines.  */
+  char * wpa_trace_orig;	/**< @brief Write a trace of the whole-program analysis to FILENAME, as JSON lines original value given at command line.  */
+  const char *wpa_trace_help; /**< @brief Write a trace of the whole-program analysis to FILENAME, as JSON lines help description.  */
+  int alloc_profile_flag;	/**< @brief Print the memory allocated by each type and pass (default=off).  */
+  const char *alloc_profile_help; /**< @brief Print the memory allocated by each type and pass help description.  */
   int rt_stats_flag;	/**< @brief Print statistics about a program at run-time (default=off).  */
   const char *rt_stats_help; /**< @brief Print statistics about a program at run-time help description.  */
   char ** cfg_dump_arg;	/**< @brief Dump CFG after the pass named 'PASSNAME'.  */
@@ -179,6 +207,10 @@ struct gengetopt_args_info
   const char *debug_help; /**< @brief Print debugging information for the pass named 'PASSNAME help description.  */
   int dont_fail_flag;	/**< @brief Dont fail on error (after parsing) (default=off).  */
   const char *dont_fail_help; /**< @brief Dont fail on error (after parsing) help description.  */
+  int check_folding_flag;	/**< @brief Check constant folding against the PHP interpreter (default=off).  */
+  const char *check_folding_help; /**< @brief Check constant folding against the PHP interpreter help description.  */
+  int debug_arenas_flag;	/**< @brief Protect arena memory after it is released, to catch data which outlives its arena (default=off).  */
+  const char *debug_arenas_help; /**< @brief Protect arena memory after it is released, to catch data which outlives its arena help description.  */
   char ** disable_arg;	/**< @brief Disable the pass named 'PASSNAME'.  */
   char ** disable_orig;	/**< @brief Disable the pass named 'PASSNAME' original value given at command line.  */
   unsigned int disable_min; /**< @brief Disable the pass named 'PASSNAME''s minimum occurreces */
@@ -199,12 +231,16 @@ struct gengetopt_args_info
   unsigned int define_given ;	/**< @brief Whether define was given.  */
   unsigned int no_warnings_given ;	/**< @brief Whether no-warnings was given.  */
   unsigned int read_xml_given ;	/**< @brief Whether read-xml was given.  */
+  unsigned int read_bin_given ;	/**< @brief Whether read-bin was given.  */
   unsigned int no_xml_validation_given ;	/**< @brief Whether no-xml-validation was given.  */
   unsigned int include_given ;	/**< @brief Whether include was given.  */
   unsigned int include_harder_given ;	/**< @brief Whether include-harder was given.  */
   unsigned int include_regexp_given ;	/**< @brief Whether include-regexp was given.  */
   unsigned int include_name_given ;	/**< @brief Whether include-name was given.  */
   unsigned int include_searchdir_given ;	/**< @brief Whether include-searchdir was given.  */
+  unsigned int include_jobs_given ;	/**< @brief Whether include-jobs was given.  */
+  unsigned int parse_cache_given ;	/**< @brief Whether parse-cache was given.  */
+  unsigned int stream_given ;	/**< @brief Whether stream was given.  */
   unsigned int c_option_given ;	/**< @brief Whether c-option was given.  */
   unsigned int generate_c_given ;	/**< @brief Whether generate-c was given.  */
   unsigned int extension_given ;	/**< @brief Whether extension was given.  */
@@ -219,6 +255,7 @@ struct gengetopt_args_info
   unsigned int no_hash_bang_given ;	/**< @brief Whether no-hash-bang was given.  */
   unsigned int dump_given ;	/**< @brief Whether dump was given.  */
   unsigned int dump_xml_given ;	/**< @brief Whether dump-xml was given.  */
+  unsigned int dump_bin_given ;	/**< @brief Whether dump-bin was given.  */
   unsigned int dump_dot_given ;	/**< @brief Whether dump-dot was given.  */
   unsigned int dump_parse_tree_given ;	/**< @brief Whether dump-parse-tree was given.  */
   unsigned int dump_tokens_given ;	/**< @brief Whether dump-tokens was given.  */
@@ -233,11 +270,18 @@ struct gengetopt_args_info
   unsigned int flow_insensitive_given ;	/**< @brief Whether flow-insensitive was given.  */
   unsigned int call_string_length_given ;	/**< @brief Whether call-string-length was given.  */
   unsigned int ssi_type_given ;	/**< @brief Whether ssi-type was given.  */
+  unsigned int memoize_given ;	/**< @brief Whether memoize was given.  */
   unsigned int stats_given ;	/**< @brief Whether stats was given.  */
+  unsigned int time_passes_given ;	/**< @brief Whether time-passes was given.  */
+  unsigned int time_passes_json_given ;	/**< @brief Whether time-passes-json was given.  */
+  unsigned int wpa_trace_given ;	/**< @brief Whether wpa-trace was given.  */
+  unsigned int alloc_profile_given ;	/**< @brief Whether alloc-profile was given.  */
   unsigned int rt_stats_given ;	/**< @brief Whether rt-stats was given.  */
   unsigned int cfg_dump_given ;	/**< @brief Whether cfg-dump was given.  */
   unsigned int debug_given ;	/**< @brief Whether debug was given.  */
   unsigned int dont_fail_given ;	/**< @brief Whether dont-fail was given.  */
+  unsigned int check_folding_given ;	/**< @brief Whether check-folding was given.  */
+  unsigned int debug_arenas_given ;	/**< @brief Whether debug-arenas was given.  */
   unsigned int disable_given ;	/**< @brief Whether disable was given.  */
   unsigned int pause_given ;	/**< @brief Whether pause was given.  */
 
@@ -843,6 +843,8 @@ goto find_rule; \
 	#include "php_parser.tab.hpp"
 	#include "cmdline.h"
 	#include "parsing/PHP_context.h"
+	#include "parsing/Char_set.h"
+	#include "parsing/Source_buffer.h"
 	#include "keywords.h"
 
 	extern struct gengetopt_args_info args_info;
@@ -889,14 +891,29 @@ goto find_rule; \
 	// Defined in php_parser.ypp
 	Node* copy_state(Node* node, PHP_context* context);
 
-	#define YY_INPUT(buf,result,max_size)		\
-	{														\
-		std::istream& stream = yyextra->stream;		\
-		stream.read (buf, max_size);				\
-		result = stream.gcount ();					\
-		if (result == 0 && stream.eofbit)		\
-			result = YY_NULL;							\
-	}
+	/*
+	 * Extend a single character match to the run of characters up to the
+	 * next one in STOPS, so that the action handles the whole run at once
+	 * instead of flex matching it character by character. The whole source
+	 * is in the scanner's buffer, so yyless can move the end of the match
+	 * forward. Every set includes the newlines, so that lines are still
+	 * counted, and the characters which start any other pattern in the
+	 * state.
+	 */
+	#define SCAN_AHEAD(stops)																\
+		if(!stops.contains(*yytext))															\
+		{																							\
+			const char* end = yyextra->source->data + yyextra->source->size;	\
+			yyless(stops.find(yytext + 1, end) - yytext);							\
+		}
+
+	static const Char_set html_stops("<\r\n");
+	static const Char_set ml_comment_stops("*\r\n");
+	static const Char_set sl_comment_stops("?\r\n");
+	static const Char_set sq_string_stops("'\\\r\n");
+	static const Char_set dq_string_stops("\"\\${\r\n");
+	static const Char_set bt_string_stops("`\\${\r\n");
+	static const Char_set heredoc_stops("\\${\r\n");
 /* Define lexical states */
 
 		
@@ -914,7 +931,7 @@ goto find_rule; \
 
 
 /* Define a few tokens referenced in the grammar, below */
-#line 918 "src/generated/lex.yy.cc"
+#line 935 "src/generated/lex.yy.cc"
 
 #define INITIAL 0
 #define PHP 1
@@ -1183,12 +1200,12 @@ YY_DECL
 	register int yy_act;
     struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
 
-#line 169 "src/generated_src/php_scanner.lex"
+#line 186 "src/generated_src/php_scanner.lex"
 
 
 	/* Update source_line */
 
-#line 1192 "src/generated/lex.yy.cc"
+#line 1209 "src/generated/lex.yy.cc"
 
     yylval = yylval_param;
 
@@ -1286,7 +1303,7 @@ do_action:	/* This label is used only to access EOF actions. */
 case 1:
 /* rule 1 can match eol */
 YY_RULE_SETUP
-#line 173 "src/generated_src/php_scanner.lex"
+#line 190 "src/generated_src/php_scanner.lex"
 {
 								if(YY_START != SL_COMM && YY_START != ML_COMM)
 									yyextra->attach_to_previous = 0;
@@ -1299,183 +1316,183 @@ YY_RULE_SETUP
 /* Casts */
 case 2:
 YY_RULE_SETUP
-#line 184 "src/generated_src/php_scanner.lex"
+#line 201 "src/generated_src/php_scanner.lex"
 { RETURN_CAST (CAST_INT);  }
 	YY_BREAK
 case 3:
 YY_RULE_SETUP
-#line 185 "src/generated_src/php_scanner.lex"
+#line 202 "src/generated_src/php_scanner.lex"
 { RETURN_CAST (CAST_REAL);  }
 	YY_BREAK
 case 4:
 YY_RULE_SETUP
-#line 186 "src/generated_src/php_scanner.lex"
+#line 203 "src/generated_src/php_scanner.lex"
 { RETURN_CAST (CAST_STRING);  }
 	YY_BREAK
 case 5:
 YY_RULE_SETUP
-#line 187 "src/generated_src/php_scanner.lex"
+#line 204 "src/generated_src/php_scanner.lex"
 { RETURN_CAST (CAST_ARRAY);  }
 	YY_BREAK
 case 6:
 YY_RULE_SETUP
-#line 188 "src/generated_src/php_scanner.lex"
+#line 205 "src/generated_src/php_scanner.lex"
 { RETURN_CAST (CAST_OBJECT);  }
 	YY_BREAK
 case 7:
 YY_RULE_SETUP
-#line 189 "src/generated_src/php_scanner.lex"
+#line 206 "src/generated_src/php_scanner.lex"
 { RETURN_CAST (CAST_BOOL);  }
 	YY_BREAK
 case 8:
 YY_RULE_SETUP
-#line 190 "src/generated_src/php_scanner.lex"
+#line 207 "src/generated_src/php_scanner.lex"
 { RETURN_CAST (CAST_UNSET);  }
 	YY_BREAK
 /* Operators */
 case 9:
 YY_RULE_SETUP
-#line 194 "src/generated_src/php_scanner.lex"
+#line 211 "src/generated_src/php_scanner.lex"
 { RETURN_OP(O_EQEQ, "=="); }
 	YY_BREAK
 case 10:
 YY_RULE_SETUP
-#line 195 "src/generated_src/php_scanner.lex"
+#line 212 "src/generated_src/php_scanner.lex"
 { RETURN_OP(O_EQEQEQ, "==="); }
 	YY_BREAK
 case 11:
 YY_RULE_SETUP
-#line 196 "src/generated_src/php_scanner.lex"
+#line 213 "src/generated_src/php_scanner.lex"
 { RETURN_OP(O_NOTEQ, "!="); }
 	YY_BREAK
 case 12:
 YY_RULE_SETUP
-#line 197 "src/generated_src/php_scanner.lex"
+#line 214 "src/generated_src/php_scanner.lex"
 { RETURN_OP(O_NOTEQ, "<>"); }
 	YY_BREAK
 case 13:
 YY_RULE_SETUP
-#line 198 "src/generated_src/php_scanner.lex"
+#line 215 "src/generated_src/php_scanner.lex"
 { RETURN_OP(O_NOTEQEQ, "!=="); }
 	YY_BREAK
 case 14:
 YY_RULE_SETUP
-#line 199 "src/generated_src/php_scanner.lex"
+#line 216 "src/generated_src/php_scanner.lex"
 { RETURN_OP(O_LE, "<="); }
 	YY_BREAK
 case 15:
 YY_RULE_SETUP
-#line 200 "src/generated_src/php_scanner.lex"
+#line 217 "src/generated_src/php_scanner.lex"
 { RETURN_OP(O_GE, ">="); }
 	YY_BREAK
 case 16:
 YY_RULE_SETUP
-#line 202 "src/generated_src/php_scanner.lex"
+#line 219 "src/generated_src/php_scanner.lex"
 { RETURN(O_INC); }
 	YY_BREAK
 case 17:
 YY_RULE_SETUP
-#line 203 "src/generated_src/php_scanner.lex"
+#line 220 "src/generated_src/php_scanner.lex"
 { RETURN(O_DEC); }
 	YY_BREAK
 case 18:
 YY_RULE_SETUP
-#line 204 "src/generated_src/php_scanner.lex"
+#line 221 "src/generated_src/php_scanner.lex"
 { RETURN(O_DOUBLEARROW); }
 	YY_BREAK
 case 19:
 YY_RULE_SETUP
-#line 205 "src/generated_src/php_scanner.lex"
+#line 222 "src/generated_src/php_scanner.lex"
 { RETURN(O_SINGLEARROW); }
 	YY_BREAK
 case 20:
 YY_RULE_SETUP
-#line 207 "src/generated_src/php_scanner.lex"
+#line 224 "src/generated_src/php_scanner.lex"
 { RETURN_OP(O_SL, "<<"); }
 	YY_BREAK
 case 21:
 YY_RULE_SETUP
-#line 208 "src/generated_src/php_scanner.lex"
+#line 225 "src/generated_src/php_scanner.lex"
 { RETURN_OP(O_SR, ">>"); }
 	YY_BREAK
 case 22:
 YY_RULE_SETUP
-#line 210 "src/generated_src/php_scanner.lex"
+#line 227 "src/generated_src/php_scanner.lex"
 { RETURN(O_PLUSEQ); }
 	YY_BREAK
 case 23:
 YY_RULE_SETUP
-#line 211 "src/generated_src/php_scanner.lex"
+#line 228 "src/generated_src/php_scanner.lex"
 { RETURN(O_MINUSEQ); }
 	YY_BREAK
 case 24:
 YY_RULE_SETUP
-#line 212 "src/generated_src/php_scanner.lex"
+#line 229 "src/generated_src/php_scanner.lex"
 { RETURN(O_MULEQ); }
 	YY_BREAK
 case 25:
 YY_RULE_SETUP
-#line 213 "src/generated_src/php_scanner.lex"
+#line 230 "src/generated_src/php_scanner.lex"
 { RETURN(O_DIVEQ); }
 	YY_BREAK
 case 26:
 YY_RULE_SETUP
-#line 214 "src/generated_src/php_scanner.lex"
+#line 231 "src/generated_src/php_scanner.lex"
 { RETURN(O_CONCATEQ); }
 	YY_BREAK
 case 27:
 YY_RULE_SETUP
-#line 215 "src/generated_src/php_scanner.lex"
+#line 232 "src/generated_src/php_scanner.lex"
 { RETURN(O_MODEQ); }
 	YY_BREAK
 case 28:
 YY_RULE_SETUP
-#line 216 "src/generated_src/php_scanner.lex"
+#line 233 "src/generated_src/php_scanner.lex"
 { RETURN(O_ANDEQ); }
 	YY_BREAK
 case 29:
 YY_RULE_SETUP
-#line 217 "src/generated_src/php_scanner.lex"
+#line 234 "src/generated_src/php_scanner.lex"
 { RETURN(O_OREQ); }
 	YY_BREAK
 case 30:
 YY_RULE_SETUP
-#line 218 "src/generated_src/php_scanner.lex"
+#line 235 "src/generated_src/php_scanner.lex"
 { RETURN(O_XOREQ); }
 	YY_BREAK
 case 31:
 YY_RULE_SETUP
-#line 219 "src/generated_src/php_scanner.lex"
+#line 236 "src/generated_src/php_scanner.lex"
 { RETURN(O_SLEQ); }
 	YY_BREAK
 case 32:
 YY_RULE_SETUP
-#line 220 "src/generated_src/php_scanner.lex"
+#line 237 "src/generated_src/php_scanner.lex"
 { RETURN(O_SREQ); }
 	YY_BREAK
 case 33:
 YY_RULE_SETUP
-#line 221 "src/generated_src/php_scanner.lex"
+#line 238 "src/generated_src/php_scanner.lex"
 { RETURN(O_COLONCOLON); }
 	YY_BREAK
 case 34:
 YY_RULE_SETUP
-#line 223 "src/generated_src/php_scanner.lex"
+#line 240 "src/generated_src/php_scanner.lex"
 { RETURN_OP(O_LOGICAND, "&&"); }
 	YY_BREAK
 case 35:
 YY_RULE_SETUP
-#line 224 "src/generated_src/php_scanner.lex"
+#line 241 "src/generated_src/php_scanner.lex"
 { RETURN_OP(O_LOGICOR, "||"); }
 	YY_BREAK
 case 36:
 YY_RULE_SETUP
-#line 226 "src/generated_src/php_scanner.lex"
+#line 243 "src/generated_src/php_scanner.lex"
 { RETURN_OP(*yytext, yytext); }
 	YY_BREAK
 case 37:
 YY_RULE_SETUP
-#line 227 "src/generated_src/php_scanner.lex"
+#line 244 "src/generated_src/php_scanner.lex"
 { 
 								yyextra->attach_to_previous = true; 
 								RETURN_OP(*yytext, yytext); 
@@ -1484,16 +1501,16 @@ YY_RULE_SETUP
 /* Tokens */
 case 38:
 YY_RULE_SETUP
-#line 234 "src/generated_src/php_scanner.lex"
+#line 251 "src/generated_src/php_scanner.lex"
 {
 								// variable names do not contain $
-								yylval->string = new String(yytext+1); 
+								yylval->string = intern (yytext+1); 
 								RETURN(VARIABLE);
 							}
 	YY_BREAK
 case 39:
 YY_RULE_SETUP
-#line 239 "src/generated_src/php_scanner.lex"
+#line 256 "src/generated_src/php_scanner.lex"
 
 							{	// Can't declare local variables without scoping them
 								
@@ -1501,7 +1518,7 @@ YY_RULE_SETUP
 								// keyword so that we can reproduce it exactly the
 								// same way in the unparsers, if we so desire 
 								// (keywords are case insensitive)
-								yylval->string = new String(yytext);
+								yylval->string = intern (yytext);
 							
 								// Check if the ident is in fact a keyword
 								const struct keyword* keyword;
@@ -1589,7 +1606,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 40:
 YY_RULE_SETUP
-#line 331 "src/generated_src/php_scanner.lex"
+#line 348 "src/generated_src/php_scanner.lex"
 { 
 								INT* i = new INT(
 									0, // initialized in Token_conversion
@@ -1601,7 +1618,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 41:
 YY_RULE_SETUP
-#line 339 "src/generated_src/php_scanner.lex"
+#line 356 "src/generated_src/php_scanner.lex"
 { 
 								REAL* r = new REAL(
 									0.0, // initialized in Token_conversion
@@ -1614,7 +1631,7 @@ YY_RULE_SETUP
 case 42:
 /* rule 42 can match eol */
 YY_RULE_SETUP
-#line 347 "src/generated_src/php_scanner.lex"
+#line 364 "src/generated_src/php_scanner.lex"
 { 
 								yyextra->value_buffer = ""; 
 								yyextra->source_rep_buffer = "";
@@ -1625,7 +1642,7 @@ YY_RULE_SETUP
 /* Strings */
 case 43:
 YY_RULE_SETUP
-#line 356 "src/generated_src/php_scanner.lex"
+#line 373 "src/generated_src/php_scanner.lex"
 { 
 								yyextra->value_buffer = ""; 
 								yyextra->source_rep_buffer = "";
@@ -1634,7 +1651,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 44:
 YY_RULE_SETUP
-#line 361 "src/generated_src/php_scanner.lex"
+#line 378 "src/generated_src/php_scanner.lex"
 { 
 								// We don't know when the actual function call will
 								// be constructed, so we cannot set any attributes on
@@ -1651,7 +1668,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 45:
 YY_RULE_SETUP
-#line 374 "src/generated_src/php_scanner.lex"
+#line 391 "src/generated_src/php_scanner.lex"
 { 
 								yyextra->value_buffer = ""; 
 								yyextra->source_rep_buffer = "";
@@ -1660,7 +1677,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 46:
 YY_RULE_SETUP
-#line 379 "src/generated_src/php_scanner.lex"
+#line 396 "src/generated_src/php_scanner.lex"
 { 
 								yyextra->value_buffer = ""; 
 								yyextra->source_rep_buffer = "";
@@ -1671,7 +1688,7 @@ YY_RULE_SETUP
 case 47:
 /* rule 47 can match eol */
 YY_RULE_SETUP
-#line 387 "src/generated_src/php_scanner.lex"
+#line 404 "src/generated_src/php_scanner.lex"
 {
 								// Following a suggestion by Tim Van Holder on bison-help,
 								// we treat blank lines as comments
@@ -1680,7 +1697,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 48:
 YY_RULE_SETUP
-#line 392 "src/generated_src/php_scanner.lex"
+#line 409 "src/generated_src/php_scanner.lex"
 {
 								yyextra->value_buffer = yytext;	
 								BEGIN(ML_COMM); 
@@ -1688,7 +1705,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 49:
 YY_RULE_SETUP
-#line 396 "src/generated_src/php_scanner.lex"
+#line 413 "src/generated_src/php_scanner.lex"
 { 
 								yyextra->value_buffer = yytext;	
 								BEGIN(SL_COMM); 
@@ -1696,7 +1713,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 50:
 YY_RULE_SETUP
-#line 401 "src/generated_src/php_scanner.lex"
+#line 418 "src/generated_src/php_scanner.lex"
 { 
 								yyextra->value_buffer.append(yytext);
 								
@@ -1713,13 +1730,16 @@ YY_RULE_SETUP
 case 51:
 /* rule 51 can match eol */
 YY_RULE_SETUP
-#line 413 "src/generated_src/php_scanner.lex"
-{ yyextra->value_buffer.push_back(*yytext); }
+#line 430 "src/generated_src/php_scanner.lex"
+{
+								SCAN_AHEAD(ml_comment_stops);
+								yyextra->value_buffer.append(yytext, yyleng);
+							}
 	YY_BREAK
 case 52:
 /* rule 52 can match eol */
 YY_RULE_SETUP
-#line 415 "src/generated_src/php_scanner.lex"
+#line 435 "src/generated_src/php_scanner.lex"
 { 
 								if(yyextra->attach_to_previous)
 									yyextra->attach_comment(new String(yyextra->value_buffer));
@@ -1734,7 +1754,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 53:
 YY_RULE_SETUP
-#line 426 "src/generated_src/php_scanner.lex"
+#line 446 "src/generated_src/php_scanner.lex"
 {
 								yyextra->value_buffer = ""; 
 								yyextra->source_rep_buffer = ""; 
@@ -1743,26 +1763,29 @@ YY_RULE_SETUP
 	YY_BREAK
 case 54:
 YY_RULE_SETUP
-#line 431 "src/generated_src/php_scanner.lex"
-{ yyextra->value_buffer.push_back(*yytext); }	
+#line 451 "src/generated_src/php_scanner.lex"
+{
+								SCAN_AHEAD(sl_comment_stops);
+								yyextra->value_buffer.append(yytext, yyleng);
+							}
 	YY_BREAK
 /* Any other character */
 case 55:
 /* rule 55 can match eol */
 YY_RULE_SETUP
-#line 435 "src/generated_src/php_scanner.lex"
+#line 458 "src/generated_src/php_scanner.lex"
 /* Ignore */
 	YY_BREAK
 case 56:
 /* rule 56 can match eol */
 YY_RULE_SETUP
-#line 436 "src/generated_src/php_scanner.lex"
+#line 459 "src/generated_src/php_scanner.lex"
 { RETURN(INVALID_TOKEN); }
 	YY_BREAK
 /* Deal with singly quoted strings */
 case 57:
 YY_RULE_SETUP
-#line 440 "src/generated_src/php_scanner.lex"
+#line 463 "src/generated_src/php_scanner.lex"
 {
 							STRING* str = new STRING(
 								new String(yyextra->value_buffer),
@@ -1778,7 +1801,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 58:
 YY_RULE_SETUP
-#line 452 "src/generated_src/php_scanner.lex"
+#line 475 "src/generated_src/php_scanner.lex"
 {
 							yyextra->source_rep_buffer.push_back('\\');
 							BEGIN(SQ_ESC); 
@@ -1787,15 +1810,16 @@ YY_RULE_SETUP
 case 59:
 /* rule 59 can match eol */
 YY_RULE_SETUP
-#line 456 "src/generated_src/php_scanner.lex"
+#line 479 "src/generated_src/php_scanner.lex"
 { 
-							yyextra->value_buffer.push_back(*yytext); 
-							yyextra->source_rep_buffer.push_back(*yytext);
+							SCAN_AHEAD(sq_string_stops);
+							yyextra->value_buffer.append(yytext, yyleng);
+							yyextra->source_rep_buffer.append(yytext, yyleng);
 						}
 	YY_BREAK
 case 60:
 YY_RULE_SETUP
-#line 461 "src/generated_src/php_scanner.lex"
+#line 485 "src/generated_src/php_scanner.lex"
 { 
 							yyextra->value_buffer.push_back(*yytext); 
 							yyextra->source_rep_buffer.push_back(*yytext); 
@@ -1804,7 +1828,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 61:
 YY_RULE_SETUP
-#line 466 "src/generated_src/php_scanner.lex"
+#line 490 "src/generated_src/php_scanner.lex"
 {
 							yyextra->value_buffer.push_back(*yytext); 
 							yyextra->source_rep_buffer.push_back(*yytext); 
@@ -1814,7 +1838,7 @@ YY_RULE_SETUP
 case 62:
 /* rule 62 can match eol */
 YY_RULE_SETUP
-#line 471 "src/generated_src/php_scanner.lex"
+#line 495 "src/generated_src/php_scanner.lex"
 {
 							yyextra->value_buffer.push_back('\\');
 							yyextra->value_buffer.push_back(*yytext);
@@ -1826,7 +1850,7 @@ YY_RULE_SETUP
 /* Deal with backticked strings. */
 case 63:
 YY_RULE_SETUP
-#line 481 "src/generated_src/php_scanner.lex"
+#line 505 "src/generated_src/php_scanner.lex"
 {
 							yyextra->schedule_return_string();
 							yyextra->schedule_return(')');
@@ -1837,7 +1861,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 64:
 YY_RULE_SETUP
-#line 488 "src/generated_src/php_scanner.lex"
+#line 512 "src/generated_src/php_scanner.lex"
 { 
 							yyextra->value_buffer.push_back('`'); 
 							yyextra->source_rep_buffer.append(yytext);
@@ -1845,7 +1869,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 65:
 YY_RULE_SETUP
-#line 492 "src/generated_src/php_scanner.lex"
+#line 516 "src/generated_src/php_scanner.lex"
 {
 							yyextra->source_rep_buffer.push_back('\\');
 							yy_push_state(ESCAPE, yyscanner); 
@@ -1854,16 +1878,17 @@ YY_RULE_SETUP
 case 66:
 /* rule 66 can match eol */
 YY_RULE_SETUP
-#line 496 "src/generated_src/php_scanner.lex"
+#line 520 "src/generated_src/php_scanner.lex"
 { 
-							yyextra->value_buffer.push_back(*yytext); 
-							yyextra->source_rep_buffer.push_back(*yytext); 
+							SCAN_AHEAD(bt_string_stops);
+							yyextra->value_buffer.append(yytext, yyleng);
+							yyextra->source_rep_buffer.append(yytext, yyleng);
 						}
 	YY_BREAK
 /* Deal with in-string syntax (in DQ_STR, HD_STR, and BT_STR) */
 case 67:
 YY_RULE_SETUP
-#line 503 "src/generated_src/php_scanner.lex"
+#line 528 "src/generated_src/php_scanner.lex"
 {
 							yyextra->schedule_return_string();
 							yyextra->schedule_return_op(".", "phc.unparser.in_string_syntax.simple");
@@ -1877,7 +1902,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 68:
 YY_RULE_SETUP
-#line 513 "src/generated_src/php_scanner.lex"
+#line 538 "src/generated_src/php_scanner.lex"
 {
 							yyextra->schedule_return_string();
 							yyextra->schedule_return_op(".", "phc.unparser.in_string_syntax.delimited");
@@ -1890,7 +1915,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 69:
 YY_RULE_SETUP
-#line 522 "src/generated_src/php_scanner.lex"
+#line 547 "src/generated_src/php_scanner.lex"
 
 						{
 							long left, right;
@@ -1913,7 +1938,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 70:
 YY_RULE_SETUP
-#line 541 "src/generated_src/php_scanner.lex"
+#line 566 "src/generated_src/php_scanner.lex"
 
 						{
 							long left, right;
@@ -1936,7 +1961,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 71:
 YY_RULE_SETUP
-#line 560 "src/generated_src/php_scanner.lex"
+#line 585 "src/generated_src/php_scanner.lex"
 
 						{
 							long left, right;
@@ -1959,7 +1984,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 72:
 YY_RULE_SETUP
-#line 579 "src/generated_src/php_scanner.lex"
+#line 604 "src/generated_src/php_scanner.lex"
 
 						{
 							long arrow;
@@ -1980,7 +2005,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 73:
 YY_RULE_SETUP
-#line 597 "src/generated_src/php_scanner.lex"
+#line 622 "src/generated_src/php_scanner.lex"
 {
 							yy_push_state(COMPLEX2, yyscanner);
 							yy_push_state(COMPLEX1, yyscanner);
@@ -1999,7 +2024,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 74:
 YY_RULE_SETUP
-#line 613 "src/generated_src/php_scanner.lex"
+#line 638 "src/generated_src/php_scanner.lex"
 { 
 							yyextra->value_buffer.push_back('\n'); 
 							yyextra->source_rep_buffer.push_back('n'); 
@@ -2008,7 +2033,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 75:
 YY_RULE_SETUP
-#line 618 "src/generated_src/php_scanner.lex"
+#line 643 "src/generated_src/php_scanner.lex"
 { 
 							yyextra->value_buffer.push_back('\t'); 
 							yyextra->source_rep_buffer.push_back('t'); 
@@ -2017,7 +2042,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 76:
 YY_RULE_SETUP
-#line 623 "src/generated_src/php_scanner.lex"
+#line 648 "src/generated_src/php_scanner.lex"
 { 
 							yyextra->value_buffer.push_back('\r'); 
 							yyextra->source_rep_buffer.push_back('r'); 
@@ -2026,7 +2051,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 77:
 YY_RULE_SETUP
-#line 628 "src/generated_src/php_scanner.lex"
+#line 653 "src/generated_src/php_scanner.lex"
 { 
 							yyextra->value_buffer.push_back('\\'); 
 							yyextra->source_rep_buffer.push_back('\\'); 
@@ -2035,7 +2060,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 78:
 YY_RULE_SETUP
-#line 633 "src/generated_src/php_scanner.lex"
+#line 658 "src/generated_src/php_scanner.lex"
 { 
 							yyextra->value_buffer.push_back('$');  
 							yyextra->source_rep_buffer.push_back('$');  
@@ -2044,7 +2069,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 79:
 YY_RULE_SETUP
-#line 638 "src/generated_src/php_scanner.lex"
+#line 663 "src/generated_src/php_scanner.lex"
 
 						{
 							char c = (char) strtol(yytext + 1, 0, 16);
@@ -2056,7 +2081,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 80:
 YY_RULE_SETUP
-#line 646 "src/generated_src/php_scanner.lex"
+#line 671 "src/generated_src/php_scanner.lex"
 
 						{
 							char c = (char) strtol(yytext, 0, 8);
@@ -2069,7 +2094,7 @@ YY_RULE_SETUP
 case 81:
 /* rule 81 can match eol */
 YY_RULE_SETUP
-#line 654 "src/generated_src/php_scanner.lex"
+#line 679 "src/generated_src/php_scanner.lex"
 { 
 							yyextra->value_buffer.push_back('\\');
 							yyextra->value_buffer.push_back(*yytext);
@@ -2082,7 +2107,7 @@ YY_RULE_SETUP
 case 82:
 /* rule 82 can match eol */
 YY_RULE_SETUP
-#line 664 "src/generated_src/php_scanner.lex"
+#line 689 "src/generated_src/php_scanner.lex"
 {
 							yyless(0);
 							BEGIN(PHP);
@@ -2098,7 +2123,7 @@ YY_RULE_SETUP
 case 83:
 /* rule 83 can match eol */
 YY_RULE_SETUP
-#line 675 "src/generated_src/php_scanner.lex"
+#line 700 "src/generated_src/php_scanner.lex"
 {
 							yyless(0);
 							yy_pop_state(yyscanner);
@@ -2114,7 +2139,7 @@ YY_RULE_SETUP
 /* Deal with (doubly quoted) strings. */
 case 84:
 YY_RULE_SETUP
-#line 689 "src/generated_src/php_scanner.lex"
+#line 714 "src/generated_src/php_scanner.lex"
 {
 							STRING* str = new STRING(
 								new String(yyextra->value_buffer),
@@ -2131,7 +2156,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 85:
 YY_RULE_SETUP
-#line 703 "src/generated_src/php_scanner.lex"
+#line 728 "src/generated_src/php_scanner.lex"
 { 
 							yyextra->value_buffer.push_back('"'); 
 							yyextra->source_rep_buffer.append(yytext);
@@ -2139,7 +2164,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 86:
 YY_RULE_SETUP
-#line 707 "src/generated_src/php_scanner.lex"
+#line 732 "src/generated_src/php_scanner.lex"
 {
 							yyextra->source_rep_buffer.push_back('\\');
 							yy_push_state(ESCAPE, yyscanner); 
@@ -2148,16 +2173,17 @@ YY_RULE_SETUP
 case 87:
 /* rule 87 can match eol */
 YY_RULE_SETUP
-#line 711 "src/generated_src/php_scanner.lex"
+#line 736 "src/generated_src/php_scanner.lex"
 { 
-							yyextra->value_buffer.push_back(*yytext); 
-							yyextra->source_rep_buffer.push_back(*yytext); 
+							SCAN_AHEAD(dq_string_stops);
+							yyextra->value_buffer.append(yytext, yyleng);
+							yyextra->source_rep_buffer.append(yytext, yyleng);
 						}
 	YY_BREAK
 /* Heredoc syntax */
 case 88:
 YY_RULE_SETUP
-#line 718 "src/generated_src/php_scanner.lex"
+#line 744 "src/generated_src/php_scanner.lex"
 {
 							yyextra->heredoc_id = strdup(yytext);
 							yyextra->heredoc_id_len = yyleng;
@@ -2180,7 +2206,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 89:
 YY_RULE_SETUP
-#line 737 "src/generated_src/php_scanner.lex"
+#line 763 "src/generated_src/php_scanner.lex"
 { 
 							yyless(0); 
 							BEGIN(PHP); 
@@ -2190,18 +2216,18 @@ YY_RULE_SETUP
 case 90:
 /* rule 90 can match eol */
 YY_RULE_SETUP
-#line 743 "src/generated_src/php_scanner.lex"
+#line 769 "src/generated_src/php_scanner.lex"
 { BEGIN(HD_MAIN); }
 	YY_BREAK
 case 91:
 /* rule 91 can match eol */
 YY_RULE_SETUP
-#line 744 "src/generated_src/php_scanner.lex"
+#line 770 "src/generated_src/php_scanner.lex"
 { RETURN(INVALID_TOKEN);	}
 	YY_BREAK
 case 92:
 YY_RULE_SETUP
-#line 746 "src/generated_src/php_scanner.lex"
+#line 772 "src/generated_src/php_scanner.lex"
 {
 							yyextra->source_rep_buffer.push_back('\\');
 							yy_push_state(ESCAPE, yyscanner); 
@@ -2210,7 +2236,7 @@ YY_RULE_SETUP
 case 93:
 /* rule 93 can match eol */
 YY_RULE_SETUP
-#line 750 "src/generated_src/php_scanner.lex"
+#line 776 "src/generated_src/php_scanner.lex"
 {
 							yyextra->value_buffer.push_back(*yytext);
 							yyextra->source_rep_buffer.push_back(*yytext);
@@ -2222,26 +2248,36 @@ YY_RULE_SETUP
 case 94:
 /* rule 94 can match eol */
 YY_RULE_SETUP
-#line 757 "src/generated_src/php_scanner.lex"
-
-							yyextra->value_buffer.push_back(*yytext);
-							yyextra->source_rep_buffer.push_back(*yytext);
+#line 783 "src/generated_src/php_scanner.lex"
 
-							if(yyextra->heredoc_id_ptr && (*yyextra->heredoc_id_ptr == *yytext))
-								yyextra->heredoc_id_ptr++;
+							if(yyextra->heredoc_id_ptr == 0)
+							{
+								// Not in the middle of the heredoc's identifier
+								SCAN_AHEAD(heredoc_stops);
+								yyextra->value_buffer.append(yytext, yyleng);
+								yyextra->source_rep_buffer.append(yytext, yyleng);
+							}
 							else
-								yyextra->heredoc_id_ptr = 0;
+							{
+								yyextra->value_buffer.push_back(*yytext);
+								yyextra->source_rep_buffer.push_back(*yytext);
+
+								if(*yyextra->heredoc_id_ptr == *yytext)
+									yyextra->heredoc_id_ptr++;
+								else
+									yyextra->heredoc_id_ptr = 0;
 
-							if(yyextra->heredoc_id_ptr - yyextra->heredoc_id == yyextra->heredoc_id_len)
-							{	
-								BEGIN(HD_END);
+								if(yyextra->heredoc_id_ptr - yyextra->heredoc_id == yyextra->heredoc_id_len)
+								{	
+									BEGIN(HD_END);
+								}
 							}
 
 	YY_BREAK
 case 95:
 /* rule 95 can match eol */
 YY_RULE_SETUP
-#line 771 "src/generated_src/php_scanner.lex"
+#line 807 "src/generated_src/php_scanner.lex"
  
 							{
 								// Remove heredoc_id from the buffer 
@@ -2284,7 +2320,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 96:
 YY_RULE_SETUP
-#line 810 "src/generated_src/php_scanner.lex"
+#line 846 "src/generated_src/php_scanner.lex"
 
 							yyextra->value_buffer.push_back(*yytext);
 							yyextra->source_rep_buffer.push_back(*yytext);
@@ -2296,7 +2332,7 @@ YY_RULE_SETUP
 case 97:
 /* rule 97 can match eol */
 YY_RULE_SETUP
-#line 819 "src/generated_src/php_scanner.lex"
+#line 855 "src/generated_src/php_scanner.lex"
 {
 							yyless(0);
 
@@ -2315,7 +2351,7 @@ YY_RULE_SETUP
 case 98:
 /* rule 98 can match eol */
 YY_RULE_SETUP
-#line 835 "src/generated_src/php_scanner.lex"
+#line 871 "src/generated_src/php_scanner.lex"
 {
 							if(yyextra->source_line == 1)
 							{
@@ -2329,7 +2365,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 99:
 YY_RULE_SETUP
-#line 845 "src/generated_src/php_scanner.lex"
+#line 881 "src/generated_src/php_scanner.lex"
 {
 							// The logic that deals with returning multiple tokens
 							// needs at least two tokens to work with.
@@ -2345,7 +2381,7 @@ YY_RULE_SETUP
 case 100:
 /* rule 100 can match eol */
 YY_RULE_SETUP
-#line 856 "src/generated_src/php_scanner.lex"
+#line 892 "src/generated_src/php_scanner.lex"
 
 							BEGIN(PHP); 
 
@@ -2372,7 +2408,7 @@ case YY_STATE_EOF(SL_COMM):
 case YY_STATE_EOF(COMPLEX1):
 case YY_STATE_EOF(COMPLEX2):
 case YY_STATE_EOF(RET_MULTI):
-#line 865 "src/generated_src/php_scanner.lex"
+#line 901 "src/generated_src/php_scanner.lex"
 
 							if(yyextra->value_buffer.empty())
 							{
@@ -2390,15 +2426,18 @@ case YY_STATE_EOF(RET_MULTI):
 case 101:
 /* rule 101 can match eol */
 YY_RULE_SETUP
-#line 878 "src/generated_src/php_scanner.lex"
-{ yyextra->value_buffer.push_back(*yytext); }
+#line 914 "src/generated_src/php_scanner.lex"
+{
+							SCAN_AHEAD(html_stops);
+							yyextra->value_buffer.append(yytext, yyleng);
+						}
 	YY_BREAK
 case 102:
 YY_RULE_SETUP
-#line 880 "src/generated_src/php_scanner.lex"
+#line 919 "src/generated_src/php_scanner.lex"
 YY_FATAL_ERROR( "flex scanner jammed" );
 	YY_BREAK
-#line 2402 "src/generated/lex.yy.cc"
+#line 2441 "src/generated/lex.yy.cc"
 
 	case YY_END_OF_BUFFER:
 		{
@@ -3536,7 +3575,7 @@ void PHP_free (void * ptr , yyscan_t yyscanner)
 
 #define YYTABLES_NAME "yytables"
 
-#line 880 "src/generated_src/php_scanner.lex"
+#line 919 "src/generated_src/php_scanner.lex"
 
 
 
@@ -3545,11 +3584,13 @@ void PHP_free (void * ptr , yyscan_t yyscanner)
  * need access to the BEGIN and COMPLEX2 macros defined in lex.yy.cc
  */
 
-void PHP_context::init_scanner(FILE*)
+void PHP_context::init_scanner()
 {
 	PHP_lex_init(&scanner);
 	PHP_set_extra(this,scanner);
-	PHP_set_in(NULL,scanner);
+
+	// Scan the source in place. It ends with the two NULs flex requires.
+	PHP__scan_buffer(source->data, source->size + 2, scanner);
 }
 
 void PHP_context::destroy_scanner()
@@ -120,8 +120,8 @@
 	
 	Node* copy_state(Node* node, PHP_context* context)
 	{
-		node->attrs->set("phc.line_number", new Integer(context->source_line));
-		node->attrs->set("phc.filename", context->filename->clone());
+		node->attrs->set_line_number(context->source_line);
+		node->attrs->set_filename(context->filename);
 		if(context->starts_line)
 			node->attrs->set_true("phc.unparser.starts_line");
 
@@ -3366,7 +3366,11 @@ yyreduce:
 			if(!(yyvsp[(2) - (2)].list_ast_statement)->empty())
 				(yyvsp[(2) - (2)].list_ast_statement)->front()->attrs->erase("phc.unparser.is_wrapped");
 
-			(yyvsp[(1) - (2)].list_ast_statement)->push_back_all((yyvsp[(2) - (2)].list_ast_statement));
+			// When streaming, the statements are handed on instead of kept
+			if(context->stream_handler)
+				context->stream_statements((yyvsp[(2) - (2)].list_ast_statement));
+			else
+				(yyvsp[(1) - (2)].list_ast_statement)->push_back_all((yyvsp[(2) - (2)].list_ast_statement));
 			(yyval.list_ast_statement) = (yyvsp[(1) - (2)].list_ast_statement);
 		;}
     break;
@@ -3374,7 +3378,7 @@ yyreduce:
   case 4:
 
 /* Line 1455 of yacc.c  */
-#line 477 "src/generated_src/php_parser.ypp"
+#line 481 "src/generated_src/php_parser.ypp"
     {
 			(yyval.list_ast_statement) = new List<Statement*>;
 		;}
@@ -3383,7 +3387,7 @@ yyreduce:
   case 5:
 
 /* Line 1455 of yacc.c  */
-#line 484 "src/generated_src/php_parser.ypp"
+#line 488 "src/generated_src/php_parser.ypp"
     {
 			(yyval.list_ast_statement) = (yyvsp[(1) - (1)].list_ast_statement);
 		;}
@@ -3392,7 +3396,7 @@ yyreduce:
   case 6:
 
 /* Line 1455 of yacc.c  */
-#line 488 "src/generated_src/php_parser.ypp"
+#line 492 "src/generated_src/php_parser.ypp"
     {
 			(yyval.list_ast_statement) = wrap((yyvsp[(1) - (1)].ast_method));
 		;}
@@ -3401,7 +3405,7 @@ yyreduce:
   case 7:
 
 /* Line 1455 of yacc.c  */
-#line 492 "src/generated_src/php_parser.ypp"
+#line 496 "src/generated_src/php_parser.ypp"
     {
 			(yyval.list_ast_statement) = wrap((yyvsp[(1) - (1)].ast_statement));
 		;}
@@ -3410,7 +3414,7 @@ yyreduce:
   case 8:
 
 /* Line 1455 of yacc.c  */
-#line 496 "src/generated_src/php_parser.ypp"
+#line 500 "src/generated_src/php_parser.ypp"
     {
 			assert(0);
 		;}
@@ -3419,7 +3423,7 @@ yyreduce:
   case 9:
 
 /* Line 1455 of yacc.c  */
-#line 506 "src/generated_src/php_parser.ypp"
+#line 510 "src/generated_src/php_parser.ypp"
     {
 			(yyvsp[(1) - (2)].list_ast_statement)->push_back_all((yyvsp[(2) - (2)].list_ast_statement));
 			(yyval.list_ast_statement) = (yyvsp[(1) - (2)].list_ast_statement);
@@ -3429,7 +3433,7 @@ yyreduce:
   case 10:
 
 /* Line 1455 of yacc.c  */
-#line 511 "src/generated_src/php_parser.ypp"
+#line 515 "src/generated_src/php_parser.ypp"
     {
 			(yyval.list_ast_statement) = new List<Statement*>;
 		;}
@@ -3438,7 +3442,7 @@ yyreduce:
   case 11:
 
 /* Line 1455 of yacc.c  */
-#line 518 "src/generated_src/php_parser.ypp"
+#line 522 "src/generated_src/php_parser.ypp"
     {
 			(yyval.list_ast_statement) = (yyvsp[(1) - (1)].list_ast_statement);
 		;}
@@ -3447,7 +3451,7 @@ yyreduce:
   case 12:
 
 /* Line 1455 of yacc.c  */
-#line 522 "src/generated_src/php_parser.ypp"
+#line 526 "src/generated_src/php_parser.ypp"
     {
 			(yyval.list_ast_statement) = wrap((yyvsp[(1) - (1)].ast_method));
 		;}
@@ -3456,7 +3460,7 @@ yyreduce:
   case 13:
 
 /* Line 1455 of yacc.c  */
-#line 526 "src/generated_src/php_parser.ypp"
+#line 530 "src/generated_src/php_parser.ypp"
     {
 			(yyval.list_ast_statement) = wrap((yyvsp[(1) - (1)].ast_statement));
 		;}
@@ -3465,7 +3469,7 @@ yyreduce:
   case 14:
 
 /* Line 1455 of yacc.c  */
-#line 530 "src/generated_src/php_parser.ypp"
+#line 534 "src/generated_src/php_parser.ypp"
     {
 			assert(0);
 		;}
@@ -3474,7 +3478,7 @@ yyreduce:
   case 15:
 
 /* Line 1455 of yacc.c  */
-#line 537 "src/generated_src/php_parser.ypp"
+#line 541 "src/generated_src/php_parser.ypp"
     {
 			(yyval.list_ast_statement) = (yyvsp[(1) - (1)].list_ast_statement);
 		;}
@@ -3483,7 +3487,7 @@ yyreduce:
   case 16:
 
 /* Line 1455 of yacc.c  */
-#line 548 "src/generated_src/php_parser.ypp"
+#line 552 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_if) = NEW(If, (NULL, NULL, NULL));
 		;}
@@ -3492,7 +3496,7 @@ yyreduce:
   case 17:
 
 /* Line 1455 of yacc.c  */
-#line 555 "src/generated_src/php_parser.ypp"
+#line 559 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_if) = NEW(If, (NULL, NULL, NULL));
 		;}
@@ -3501,7 +3505,7 @@ yyreduce:
   case 18:
 
 /* Line 1455 of yacc.c  */
-#line 562 "src/generated_src/php_parser.ypp"
+#line 566 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_foreach) = NEW(Foreach, (NULL, NULL, false, NULL, NULL));
 		;}
@@ -3510,7 +3514,7 @@ yyreduce:
   case 19:
 
 /* Line 1455 of yacc.c  */
-#line 569 "src/generated_src/php_parser.ypp"
+#line 573 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_while) = NEW(While, (NULL, NULL));
 		;}
@@ -3519,7 +3523,7 @@ yyreduce:
   case 20:
 
 /* Line 1455 of yacc.c  */
-#line 576 "src/generated_src/php_parser.ypp"
+#line 580 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_do) = NEW(Do, (NULL, NULL));
 		;}
@@ -3528,7 +3532,7 @@ yyreduce:
   case 21:
 
 /* Line 1455 of yacc.c  */
-#line 583 "src/generated_src/php_parser.ypp"
+#line 587 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_for) = NEW(For, (NULL, NULL, NULL, NULL));
 		;}
@@ -3537,7 +3541,7 @@ yyreduce:
   case 22:
 
 /* Line 1455 of yacc.c  */
-#line 590 "src/generated_src/php_parser.ypp"
+#line 594 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_switch) = NEW(Switch, (NULL, NULL));
 		;}
@@ -3546,7 +3550,7 @@ yyreduce:
   case 23:
 
 /* Line 1455 of yacc.c  */
-#line 597 "src/generated_src/php_parser.ypp"
+#line 601 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_declare) = NEW(Declare, (NULL, NULL));
 		;}
@@ -3555,7 +3559,7 @@ yyreduce:
   case 24:
 
 /* Line 1455 of yacc.c  */
-#line 604 "src/generated_src/php_parser.ypp"
+#line 608 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_try) = NEW(Try, (NULL, NULL));
 		;}
@@ -3564,7 +3568,7 @@ yyreduce:
   case 25:
 
 /* Line 1455 of yacc.c  */
-#line 611 "src/generated_src/php_parser.ypp"
+#line 615 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_catch) = NEW(Catch, (NULL, NULL, NULL));
 		;}
@@ -3573,7 +3577,7 @@ yyreduce:
   case 26:
 
 /* Line 1455 of yacc.c  */
-#line 618 "src/generated_src/php_parser.ypp"
+#line 622 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_method) = NEW(Method, (NULL, NULL));
 		;}
@@ -3582,7 +3586,7 @@ yyreduce:
   case 27:
 
 /* Line 1455 of yacc.c  */
-#line 625 "src/generated_src/php_parser.ypp"
+#line 629 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_switch_case) = NEW(Switch_case, (NULL, NULL));
 		;}
@@ -3591,7 +3595,7 @@ yyreduce:
   case 28:
 
 /* Line 1455 of yacc.c  */
-#line 632 "src/generated_src/php_parser.ypp"
+#line 636 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_switch_case) = NEW(Switch_case, (NULL, NULL));
 		;}
@@ -3600,7 +3604,7 @@ yyreduce:
   case 29:
 
 /* Line 1455 of yacc.c  */
-#line 640 "src/generated_src/php_parser.ypp"
+#line 644 "src/generated_src/php_parser.ypp"
     {
 			(yyval.list_ast_statement) = (yyvsp[(1) - (1)].list_ast_statement);
 		;}
@@ -3609,7 +3613,7 @@ yyreduce:
   case 30:
 
 /* Line 1455 of yacc.c  */
-#line 644 "src/generated_src/php_parser.ypp"
+#line 648 "src/generated_src/php_parser.ypp"
     {
 			(yyvsp[(1) - (7)].ast_if)->expr = (yyvsp[(3) - (7)].ast_expr);
 			(yyvsp[(1) - (7)].ast_if)->iftrue = (yyvsp[(5) - (7)].list_ast_statement);
@@ -3647,7 +3651,7 @@ yyreduce:
   case 31:
 
 /* Line 1455 of yacc.c  */
-#line 677 "src/generated_src/php_parser.ypp"
+#line 681 "src/generated_src/php_parser.ypp"
     {
 			// Duplication of logic above for K_IF.
 			
@@ -3677,7 +3681,7 @@ yyreduce:
   case 32:
 
 /* Line 1455 of yacc.c  */
-#line 702 "src/generated_src/php_parser.ypp"
+#line 706 "src/generated_src/php_parser.ypp"
     {
 			(yyvsp[(1) - (5)].ast_while)->expr = (yyvsp[(3) - (5)].ast_expr);
 			(yyvsp[(1) - (5)].ast_while)->statements = (yyvsp[(5) - (5)].list_ast_statement);
@@ -3689,7 +3693,7 @@ yyreduce:
   case 33:
 
 /* Line 1455 of yacc.c  */
-#line 709 "src/generated_src/php_parser.ypp"
+#line 713 "src/generated_src/php_parser.ypp"
     {
 			(yyvsp[(1) - (7)].ast_do)->statements = (yyvsp[(2) - (7)].list_ast_statement);
 			(yyvsp[(1) - (7)].ast_do)->expr = (yyvsp[(5) - (7)].ast_expr);
@@ -3701,7 +3705,7 @@ yyreduce:
   case 34:
 
 /* Line 1455 of yacc.c  */
-#line 716 "src/generated_src/php_parser.ypp"
+#line 720 "src/generated_src/php_parser.ypp"
     {
 			(yyvsp[(1) - (9)].ast_for)->init = (yyvsp[(3) - (9)].ast_expr);
 			(yyvsp[(1) - (9)].ast_for)->cond = (yyvsp[(5) - (9)].ast_expr);
@@ -3715,7 +3719,7 @@ yyreduce:
   case 35:
 
 /* Line 1455 of yacc.c  */
-#line 725 "src/generated_src/php_parser.ypp"
+#line 729 "src/generated_src/php_parser.ypp"
     {
 			(yyvsp[(1) - (5)].ast_switch)->expr = (yyvsp[(3) - (5)].ast_expr);
 			(yyvsp[(1) - (5)].ast_switch)->switch_cases = (yyvsp[(5) - (5)].list_ast_switch_case);
@@ -3727,7 +3731,7 @@ yyreduce:
   case 36:
 
 /* Line 1455 of yacc.c  */
-#line 732 "src/generated_src/php_parser.ypp"
+#line 736 "src/generated_src/php_parser.ypp"
     {
 			(yyval.list_ast_statement) = wrap(NEW(Break, (NULL)));
 		;}
@@ -3736,7 +3740,7 @@ yyreduce:
   case 37:
 
 /* Line 1455 of yacc.c  */
-#line 736 "src/generated_src/php_parser.ypp"
+#line 740 "src/generated_src/php_parser.ypp"
     {
 			(yyval.list_ast_statement) = wrap(NEW(Break, ((yyvsp[(2) - (3)].ast_expr))));
 		;}
@@ -3745,7 +3749,7 @@ yyreduce:
   case 38:
 
 /* Line 1455 of yacc.c  */
-#line 740 "src/generated_src/php_parser.ypp"
+#line 744 "src/generated_src/php_parser.ypp"
     {
 			(yyval.list_ast_statement) = wrap(NEW(Continue, (NULL)));
 		;}
@@ -3754,7 +3758,7 @@ yyreduce:
   case 39:
 
 /* Line 1455 of yacc.c  */
-#line 744 "src/generated_src/php_parser.ypp"
+#line 748 "src/generated_src/php_parser.ypp"
     {
 			(yyval.list_ast_statement) = wrap(NEW(Continue, ((yyvsp[(2) - (3)].ast_expr))));
 		;}
@@ -3763,7 +3767,7 @@ yyreduce:
   case 40:
 
 /* Line 1455 of yacc.c  */
-#line 748 "src/generated_src/php_parser.ypp"
+#line 752 "src/generated_src/php_parser.ypp"
     {
 			(yyval.list_ast_statement) = wrap(NEW(Return, (NULL)));
 		;}
@@ -3772,7 +3776,7 @@ yyreduce:
   case 41:
 
 /* Line 1455 of yacc.c  */
-#line 752 "src/generated_src/php_parser.ypp"
+#line 756 "src/generated_src/php_parser.ypp"
     {
 			(yyval.list_ast_statement) = wrap(NEW(Return, ((yyvsp[(2) - (3)].ast_expr))));
 		;}
@@ -3781,7 +3785,7 @@ yyreduce:
   case 42:
 
 /* Line 1455 of yacc.c  */
-#line 756 "src/generated_src/php_parser.ypp"
+#line 760 "src/generated_src/php_parser.ypp"
     {
 			(yyval.list_ast_statement) = wrap(NEW(Return, ((yyvsp[(2) - (3)].ast_expr))));
 		;}
@@ -3790,7 +3794,7 @@ yyreduce:
   case 43:
 
 /* Line 1455 of yacc.c  */
-#line 760 "src/generated_src/php_parser.ypp"
+#line 764 "src/generated_src/php_parser.ypp"
     {
 			(yyval.list_ast_statement) = wrap(NEW(Global, ((yyvsp[(2) - (3)].list_ast_variable_name))));
 		;}
@@ -3799,7 +3803,7 @@ yyreduce:
   case 44:
 
 /* Line 1455 of yacc.c  */
-#line 764 "src/generated_src/php_parser.ypp"
+#line 768 "src/generated_src/php_parser.ypp"
     {
 			(yyval.list_ast_statement) = wrap(NEW(Static_declaration, ((yyvsp[(2) - (3)].list_ast_name_with_default))));
 		;}
@@ -3808,7 +3812,7 @@ yyreduce:
   case 45:
 
 /* Line 1455 of yacc.c  */
-#line 768 "src/generated_src/php_parser.ypp"
+#line 772 "src/generated_src/php_parser.ypp"
     {
 			Method_invocation* inv;
 			inv = NEW(Method_invocation,
@@ -3824,7 +3828,7 @@ yyreduce:
   case 46:
 
 /* Line 1455 of yacc.c  */
-#line 779 "src/generated_src/php_parser.ypp"
+#line 783 "src/generated_src/php_parser.ypp"
     {
 			STRING* scalar = NEW(STRING, ((yyvsp[(1) - (1)].string), (yyvsp[(1) - (1)].string)));
 			Expr* fn = NEW(Method_invocation, ("echo", scalar));
@@ -3839,7 +3843,7 @@ yyreduce:
   case 47:
 
 /* Line 1455 of yacc.c  */
-#line 789 "src/generated_src/php_parser.ypp"
+#line 793 "src/generated_src/php_parser.ypp"
     {
 			(yyval.list_ast_statement) = wrap(NEW(Eval_expr, ((yyvsp[(1) - (2)].ast_expr))));
 		;}
@@ -3848,7 +3852,7 @@ yyreduce:
   case 48:
 
 /* Line 1455 of yacc.c  */
-#line 793 "src/generated_src/php_parser.ypp"
+#line 797 "src/generated_src/php_parser.ypp"
     {
 			Method_invocation* fn;
 			fn = NEW(Method_invocation, ("use", (yyvsp[(2) - (3)].token_string)));
@@ -3860,7 +3864,7 @@ yyreduce:
   case 49:
 
 /* Line 1455 of yacc.c  */
-#line 800 "src/generated_src/php_parser.ypp"
+#line 804 "src/generated_src/php_parser.ypp"
     {
 			Method_invocation* fn;
 			METHOD_NAME* unset;
@@ -3873,7 +3877,7 @@ yyreduce:
   case 50:
 
 /* Line 1455 of yacc.c  */
-#line 808 "src/generated_src/php_parser.ypp"
+#line 812 "src/generated_src/php_parser.ypp"
     {
 			(yyvsp[(1) - (8)].ast_foreach)->expr = (yyvsp[(3) - (8)].ast_expr);
 			(yyvsp[(1) - (8)].ast_foreach)->statements = (yyvsp[(8) - (8)].list_ast_statement);
@@ -3903,7 +3907,7 @@ yyreduce:
   case 51:
 
 /* Line 1455 of yacc.c  */
-#line 833 "src/generated_src/php_parser.ypp"
+#line 837 "src/generated_src/php_parser.ypp"
     {
 			// Duplication of the logic in the previous rule
 			(yyvsp[(1) - (8)].ast_foreach)->expr = (yyvsp[(3) - (8)].ast_expr);
@@ -3934,7 +3938,7 @@ yyreduce:
   case 52:
 
 /* Line 1455 of yacc.c  */
-#line 859 "src/generated_src/php_parser.ypp"
+#line 863 "src/generated_src/php_parser.ypp"
     {
 			(yyvsp[(1) - (5)].ast_declare)->directives = (yyvsp[(3) - (5)].list_ast_directive);
 			(yyvsp[(1) - (5)].ast_declare)->statements = (yyvsp[(5) - (5)].list_ast_statement);
@@ -3946,7 +3950,7 @@ yyreduce:
   case 53:
 
 /* Line 1455 of yacc.c  */
-#line 866 "src/generated_src/php_parser.ypp"
+#line 870 "src/generated_src/php_parser.ypp"
     {
 			(yyval.list_ast_statement) = wrap(NEW(Nop, ()));
 		;}
@@ -3955,7 +3959,7 @@ yyreduce:
   case 54:
 
 /* Line 1455 of yacc.c  */
-#line 870 "src/generated_src/php_parser.ypp"
+#line 874 "src/generated_src/php_parser.ypp"
     {
 			VARIABLE_NAME* var = new VARIABLE_NAME((yyvsp[(6) - (9)].string));
 			
@@ -3977,7 +3981,7 @@ yyreduce:
   case 55:
 
 /* Line 1455 of yacc.c  */
-#line 887 "src/generated_src/php_parser.ypp"
+#line 891 "src/generated_src/php_parser.ypp"
     {
 			(yyval.list_ast_statement) = wrap(NEW(Throw, ((yyvsp[(2) - (3)].ast_expr))));
 		;}
@@ -3986,7 +3990,7 @@ yyreduce:
   case 56:
 
 /* Line 1455 of yacc.c  */
-#line 894 "src/generated_src/php_parser.ypp"
+#line 898 "src/generated_src/php_parser.ypp"
     {
 			(yyval.list_ast_catch) = (yyvsp[(1) - (1)].list_ast_catch);
 		;}
@@ -3995,7 +3999,7 @@ yyreduce:
   case 57:
 
 /* Line 1455 of yacc.c  */
-#line 898 "src/generated_src/php_parser.ypp"
+#line 902 "src/generated_src/php_parser.ypp"
     {
 			List<Catch*>* catches = new List<Catch*>;
 			(yyval.list_ast_catch) = catches;
@@ -4005,7 +4009,7 @@ yyreduce:
   case 58:
 
 /* Line 1455 of yacc.c  */
-#line 906 "src/generated_src/php_parser.ypp"
+#line 910 "src/generated_src/php_parser.ypp"
     {
 			List<Catch*>* catches = new List<Catch*>;
 			catches->push_back((yyvsp[(1) - (1)].ast_catch));
@@ -4017,7 +4021,7 @@ yyreduce:
   case 59:
 
 /* Line 1455 of yacc.c  */
-#line 913 "src/generated_src/php_parser.ypp"
+#line 917 "src/generated_src/php_parser.ypp"
     {
 			(yyvsp[(1) - (2)].list_ast_catch)->push_back((yyvsp[(2) - (2)].ast_catch));
 			
@@ -4028,7 +4032,7 @@ yyreduce:
   case 60:
 
 /* Line 1455 of yacc.c  */
-#line 922 "src/generated_src/php_parser.ypp"
+#line 926 "src/generated_src/php_parser.ypp"
     {
 			VARIABLE_NAME* var = new VARIABLE_NAME((yyvsp[(4) - (6)].string));
 			
@@ -4043,7 +4047,7 @@ yyreduce:
   case 61:
 
 /* Line 1455 of yacc.c  */
-#line 935 "src/generated_src/php_parser.ypp"
+#line 939 "src/generated_src/php_parser.ypp"
     {
 			List<Actual_parameter*>* vars = new List<Actual_parameter*>;
 			vars->push_back(new Actual_parameter(false, (yyvsp[(1) - (1)].ast_variable)));
@@ -4054,7 +4058,7 @@ yyreduce:
   case 62:
 
 /* Line 1455 of yacc.c  */
-#line 941 "src/generated_src/php_parser.ypp"
+#line 945 "src/generated_src/php_parser.ypp"
     {
 			(yyvsp[(1) - (3)].list_ast_actual_parameter)->push_back(new Actual_parameter(false, (yyvsp[(3) - (3)].ast_variable)));
 			(yyval.list_ast_actual_parameter) = (yyvsp[(1) - (3)].list_ast_actual_parameter);
@@ -4064,7 +4068,7 @@ yyreduce:
   case 63:
 
 /* Line 1455 of yacc.c  */
-#line 949 "src/generated_src/php_parser.ypp"
+#line 953 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_variable) = expect_variable((yyvsp[(1) - (1)].ast_expr));
 		;}
@@ -4073,7 +4077,7 @@ yyreduce:
   case 64:
 
 /* Line 1455 of yacc.c  */
-#line 956 "src/generated_src/php_parser.ypp"
+#line 960 "src/generated_src/php_parser.ypp"
     {
 			(yyval.token_string) = (yyvsp[(1) - (1)].token_string);
 		;}
@@ -4082,7 +4086,7 @@ yyreduce:
   case 65:
 
 /* Line 1455 of yacc.c  */
-#line 960 "src/generated_src/php_parser.ypp"
+#line 964 "src/generated_src/php_parser.ypp"
     {
 			(yyval.token_string) = (yyvsp[(2) - (3)].token_string);
 		;}
@@ -4091,7 +4095,7 @@ yyreduce:
   case 66:
 
 /* Line 1455 of yacc.c  */
-#line 967 "src/generated_src/php_parser.ypp"
+#line 971 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_method) = (yyvsp[(1) - (1)].ast_method);
 		;}
@@ -4100,7 +4104,7 @@ yyreduce:
   case 67:
 
 /* Line 1455 of yacc.c  */
-#line 974 "src/generated_src/php_parser.ypp"
+#line 978 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_statement) = (yyvsp[(1) - (1)].ast_statement);
 		;}
@@ -4109,7 +4113,7 @@ yyreduce:
   case 68:
 
 /* Line 1455 of yacc.c  */
-#line 981 "src/generated_src/php_parser.ypp"
+#line 985 "src/generated_src/php_parser.ypp"
     {
 			(yyval.integer) = new Integer(0);
 		;}
@@ -4118,7 +4122,7 @@ yyreduce:
   case 69:
 
 /* Line 1455 of yacc.c  */
-#line 985 "src/generated_src/php_parser.ypp"
+#line 989 "src/generated_src/php_parser.ypp"
     {
 			(yyval.integer) = new Integer(1);
 		;}
@@ -4127,14 +4131,14 @@ yyreduce:
   case 70:
 
 /* Line 1455 of yacc.c  */
-#line 991 "src/generated_src/php_parser.ypp"
+#line 995 "src/generated_src/php_parser.ypp"
     {context->current_method = dynamic_cast<String*>((yyvsp[(3) - (3)].string));;}
     break;
 
   case 71:
 
 /* Line 1455 of yacc.c  */
-#line 992 "src/generated_src/php_parser.ypp"
+#line 996 "src/generated_src/php_parser.ypp"
     {
 			METHOD_NAME* name = new METHOD_NAME((yyvsp[(3) - (8)].string));
 		
@@ -4149,21 +4153,21 @@ yyreduce:
   case 72:
 
 /* Line 1455 of yacc.c  */
-#line 1004 "src/generated_src/php_parser.ypp"
+#line 1008 "src/generated_src/php_parser.ypp"
     {context->current_class = dynamic_cast<String*>((yyvsp[(2) - (2)].string));;}
     break;
 
   case 73:
 
 /* Line 1455 of yacc.c  */
-#line 1004 "src/generated_src/php_parser.ypp"
+#line 1008 "src/generated_src/php_parser.ypp"
     {context->current_class = new String ();;}
     break;
 
   case 74:
 
 /* Line 1455 of yacc.c  */
-#line 1005 "src/generated_src/php_parser.ypp"
+#line 1009 "src/generated_src/php_parser.ypp"
     {
 			CLASS_NAME* name = NEW (CLASS_NAME, (yyvsp[(2) - (9)].string));
 
@@ -4179,7 +4183,7 @@ yyreduce:
   case 75:
 
 /* Line 1455 of yacc.c  */
-#line 1016 "src/generated_src/php_parser.ypp"
+#line 1020 "src/generated_src/php_parser.ypp"
     {
 			INTERFACE_NAME* name = new INTERFACE_NAME((yyvsp[(2) - (6)].string));
 
@@ -4194,7 +4198,7 @@ yyreduce:
   case 76:
 
 /* Line 1455 of yacc.c  */
-#line 1039 "src/generated_src/php_parser.ypp"
+#line 1043 "src/generated_src/php_parser.ypp"
     {
 			Class_mod* mod = NEW(Class_mod, (false, false));
 			(yyval.ast_class_def) = NEW(Class_def, (mod));
@@ -4204,7 +4208,7 @@ yyreduce:
   case 77:
 
 /* Line 1455 of yacc.c  */
-#line 1044 "src/generated_src/php_parser.ypp"
+#line 1048 "src/generated_src/php_parser.ypp"
     {
 			Class_mod* mod = NEW(Class_mod, (true, false));
 			(yyval.ast_class_def) = NEW(Class_def, (mod));
@@ -4214,7 +4218,7 @@ yyreduce:
   case 78:
 
 /* Line 1455 of yacc.c  */
-#line 1049 "src/generated_src/php_parser.ypp"
+#line 1053 "src/generated_src/php_parser.ypp"
     {
 			Class_mod* mod = NEW(Class_mod, (false, true));
 			(yyval.ast_class_def) = NEW(Class_def, (mod));
@@ -4224,7 +4228,7 @@ yyreduce:
   case 79:
 
 /* Line 1455 of yacc.c  */
-#line 1057 "src/generated_src/php_parser.ypp"
+#line 1061 "src/generated_src/php_parser.ypp"
     {
 			(yyval.token_class_name) = NULL;
 		;}
@@ -4233,7 +4237,7 @@ yyreduce:
   case 80:
 
 /* Line 1455 of yacc.c  */
-#line 1061 "src/generated_src/php_parser.ypp"
+#line 1065 "src/generated_src/php_parser.ypp"
     {
 			(yyval.token_class_name) = (yyvsp[(2) - (2)].token_class_name);
 		;}
@@ -4242,7 +4246,7 @@ yyreduce:
   case 81:
 
 /* Line 1455 of yacc.c  */
-#line 1068 "src/generated_src/php_parser.ypp"
+#line 1072 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_interface_def) = NEW(Interface_def, (NULL, NULL, NULL));
 		;}
@@ -4251,7 +4255,7 @@ yyreduce:
   case 82:
 
 /* Line 1455 of yacc.c  */
-#line 1075 "src/generated_src/php_parser.ypp"
+#line 1079 "src/generated_src/php_parser.ypp"
     {
 			(yyval.list_token_interface_name) = new List<INTERFACE_NAME*>;
 		;}
@@ -4260,7 +4264,7 @@ yyreduce:
   case 83:
 
 /* Line 1455 of yacc.c  */
-#line 1079 "src/generated_src/php_parser.ypp"
+#line 1083 "src/generated_src/php_parser.ypp"
     {
 			(yyval.list_token_interface_name) = (yyvsp[(2) - (2)].list_token_interface_name);
 		;}
@@ -4269,7 +4273,7 @@ yyreduce:
   case 84:
 
 /* Line 1455 of yacc.c  */
-#line 1089 "src/generated_src/php_parser.ypp"
+#line 1093 "src/generated_src/php_parser.ypp"
     {
 			(yyval.list_token_interface_name) = new List<INTERFACE_NAME*>;
 		;}
@@ -4278,7 +4282,7 @@ yyreduce:
   case 85:
 
 /* Line 1455 of yacc.c  */
-#line 1093 "src/generated_src/php_parser.ypp"
+#line 1097 "src/generated_src/php_parser.ypp"
     {
 			(yyval.list_token_interface_name) = (yyvsp[(2) - (2)].list_token_interface_name);
 		;}
@@ -4287,7 +4291,7 @@ yyreduce:
   case 86:
 
 /* Line 1455 of yacc.c  */
-#line 1100 "src/generated_src/php_parser.ypp"
+#line 1104 "src/generated_src/php_parser.ypp"
     {
 			INTERFACE_NAME* ifn = NEW(INTERFACE_NAME, ((yyvsp[(1) - (1)].token_class_name)->value));
 		
@@ -4302,7 +4306,7 @@ yyreduce:
   case 87:
 
 /* Line 1455 of yacc.c  */
-#line 1110 "src/generated_src/php_parser.ypp"
+#line 1114 "src/generated_src/php_parser.ypp"
     {
 			INTERFACE_NAME* ifn = NEW(INTERFACE_NAME, ((yyvsp[(3) - (3)].token_class_name)->value));
 			(yyvsp[(1) - (3)].list_token_interface_name)->push_back(ifn);
@@ -4314,7 +4318,7 @@ yyreduce:
   case 88:
 
 /* Line 1455 of yacc.c  */
-#line 1120 "src/generated_src/php_parser.ypp"
+#line 1124 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_variable) = NULL;
 		;}
@@ -4323,7 +4327,7 @@ yyreduce:
   case 89:
 
 /* Line 1455 of yacc.c  */
-#line 1124 "src/generated_src/php_parser.ypp"
+#line 1128 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_variable) = (yyvsp[(2) - (2)].ast_variable);
 		;}
@@ -4332,7 +4336,7 @@ yyreduce:
   case 90:
 
 /* Line 1455 of yacc.c  */
-#line 1131 "src/generated_src/php_parser.ypp"
+#line 1135 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_variable) = expect_variable((yyvsp[(1) - (1)].ast_expr));
 		;}
@@ -4341,7 +4345,7 @@ yyreduce:
   case 91:
 
 /* Line 1455 of yacc.c  */
-#line 1135 "src/generated_src/php_parser.ypp"
+#line 1139 "src/generated_src/php_parser.ypp"
     {
 			(yyvsp[(2) - (2)].ast_expr)->attrs->set_true("phc.parser.is_ref");
 			(yyval.ast_variable) = expect_variable((yyvsp[(2) - (2)].ast_expr));
@@ -4351,7 +4355,7 @@ yyreduce:
   case 92:
 
 /* Line 1455 of yacc.c  */
-#line 1143 "src/generated_src/php_parser.ypp"
+#line 1147 "src/generated_src/php_parser.ypp"
     {
 			(yyval.list_ast_statement) = (yyvsp[(1) - (1)].list_ast_statement);
 		;}
@@ -4360,7 +4364,7 @@ yyreduce:
   case 93:
 
 /* Line 1455 of yacc.c  */
-#line 1147 "src/generated_src/php_parser.ypp"
+#line 1151 "src/generated_src/php_parser.ypp"
     {
 			(yyval.list_ast_statement) = (yyvsp[(2) - (4)].list_ast_statement);
 		;}
@@ -4369,7 +4373,7 @@ yyreduce:
   case 94:
 
 /* Line 1455 of yacc.c  */
-#line 1154 "src/generated_src/php_parser.ypp"
+#line 1158 "src/generated_src/php_parser.ypp"
     {
 			(yyval.list_ast_statement) = (yyvsp[(1) - (1)].list_ast_statement);
 		;}
@@ -4378,7 +4382,7 @@ yyreduce:
   case 95:
 
 /* Line 1455 of yacc.c  */
-#line 1158 "src/generated_src/php_parser.ypp"
+#line 1162 "src/generated_src/php_parser.ypp"
     {
 			(yyval.list_ast_statement) = (yyvsp[(2) - (4)].list_ast_statement);
 		;}
@@ -4387,7 +4391,7 @@ yyreduce:
   case 96:
 
 /* Line 1455 of yacc.c  */
-#line 1165 "src/generated_src/php_parser.ypp"
+#line 1169 "src/generated_src/php_parser.ypp"
     {
 			(yyval.list_ast_statement) = (yyvsp[(1) - (1)].list_ast_statement);
 		;}
@@ -4396,7 +4400,7 @@ yyreduce:
   case 97:
 
 /* Line 1455 of yacc.c  */
-#line 1169 "src/generated_src/php_parser.ypp"
+#line 1173 "src/generated_src/php_parser.ypp"
     {
 			(yyval.list_ast_statement) = (yyvsp[(2) - (4)].list_ast_statement);
 		;}
@@ -4405,7 +4409,7 @@ yyreduce:
   case 98:
 
 /* Line 1455 of yacc.c  */
-#line 1176 "src/generated_src/php_parser.ypp"
+#line 1180 "src/generated_src/php_parser.ypp"
     {
 			DIRECTIVE_NAME* name = NEW (DIRECTIVE_NAME, ((yyvsp[(1) - (3)].string)));
 
@@ -4420,7 +4424,7 @@ yyreduce:
   case 99:
 
 /* Line 1455 of yacc.c  */
-#line 1186 "src/generated_src/php_parser.ypp"
+#line 1190 "src/generated_src/php_parser.ypp"
     {
 			DIRECTIVE_NAME* name = NEW (DIRECTIVE_NAME, ((yyvsp[(3) - (5)].string)));
 			
@@ -4433,7 +4437,7 @@ yyreduce:
   case 100:
 
 /* Line 1455 of yacc.c  */
-#line 1197 "src/generated_src/php_parser.ypp"
+#line 1201 "src/generated_src/php_parser.ypp"
     {
 			(yyval.list_ast_switch_case) = (yyvsp[(2) - (3)].list_ast_switch_case);
 		;}
@@ -4442,7 +4446,7 @@ yyreduce:
   case 101:
 
 /* Line 1455 of yacc.c  */
-#line 1201 "src/generated_src/php_parser.ypp"
+#line 1205 "src/generated_src/php_parser.ypp"
     {
 			(yyval.list_ast_switch_case) = (yyvsp[(3) - (4)].list_ast_switch_case);
 		;}
@@ -4451,7 +4455,7 @@ yyreduce:
   case 102:
 
 /* Line 1455 of yacc.c  */
-#line 1205 "src/generated_src/php_parser.ypp"
+#line 1209 "src/generated_src/php_parser.ypp"
     {
 			(yyval.list_ast_switch_case) = (yyvsp[(2) - (4)].list_ast_switch_case);
 		;}
@@ -4460,7 +4464,7 @@ yyreduce:
   case 103:
 
 /* Line 1455 of yacc.c  */
-#line 1209 "src/generated_src/php_parser.ypp"
+#line 1213 "src/generated_src/php_parser.ypp"
     {
 			(yyval.list_ast_switch_case) = (yyvsp[(3) - (5)].list_ast_switch_case);
 		;}
@@ -4469,7 +4473,7 @@ yyreduce:
   case 104:
 
 /* Line 1455 of yacc.c  */
-#line 1216 "src/generated_src/php_parser.ypp"
+#line 1220 "src/generated_src/php_parser.ypp"
     {
 			(yyval.list_ast_switch_case) = new List<Switch_case*>;
 		;}
@@ -4478,7 +4482,7 @@ yyreduce:
   case 105:
 
 /* Line 1455 of yacc.c  */
-#line 1220 "src/generated_src/php_parser.ypp"
+#line 1224 "src/generated_src/php_parser.ypp"
     {
 			(yyvsp[(2) - (5)].ast_switch_case)->statements = (yyvsp[(5) - (5)].list_ast_statement);
 			(yyvsp[(2) - (5)].ast_switch_case)->expr = (yyvsp[(3) - (5)].ast_expr);
@@ -4492,7 +4496,7 @@ yyreduce:
   case 106:
 
 /* Line 1455 of yacc.c  */
-#line 1229 "src/generated_src/php_parser.ypp"
+#line 1233 "src/generated_src/php_parser.ypp"
     {
 			(yyvsp[(2) - (4)].ast_switch_case)->statements = (yyvsp[(4) - (4)].list_ast_statement);
 			(yyvsp[(2) - (4)].ast_switch_case)->expr = NULL;
@@ -4506,7 +4510,7 @@ yyreduce:
   case 109:
 
 /* Line 1455 of yacc.c  */
-#line 1249 "src/generated_src/php_parser.ypp"
+#line 1253 "src/generated_src/php_parser.ypp"
     {
 			(yyval.list_ast_statement) = (yyvsp[(1) - (1)].list_ast_statement);
 		;}
@@ -4515,7 +4519,7 @@ yyreduce:
   case 110:
 
 /* Line 1455 of yacc.c  */
-#line 1253 "src/generated_src/php_parser.ypp"
+#line 1257 "src/generated_src/php_parser.ypp"
     {
 			(yyval.list_ast_statement) = (yyvsp[(2) - (4)].list_ast_statement);
 		;}
@@ -4524,7 +4528,7 @@ yyreduce:
   case 111:
 
 /* Line 1455 of yacc.c  */
-#line 1260 "src/generated_src/php_parser.ypp"
+#line 1264 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_if) = NULL;
 		;}
@@ -4533,7 +4537,7 @@ yyreduce:
   case 112:
 
 /* Line 1455 of yacc.c  */
-#line 1264 "src/generated_src/php_parser.ypp"
+#line 1268 "src/generated_src/php_parser.ypp"
     {
 			List<Statement*>* empty = new List<Statement*>;
 			
@@ -4568,7 +4572,7 @@ yyreduce:
   case 113:
 
 /* Line 1455 of yacc.c  */
-#line 1300 "src/generated_src/php_parser.ypp"
+#line 1304 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_if) = NULL;
 		;}
@@ -4577,7 +4581,7 @@ yyreduce:
   case 114:
 
 /* Line 1455 of yacc.c  */
-#line 1304 "src/generated_src/php_parser.ypp"
+#line 1308 "src/generated_src/php_parser.ypp"
     {
 			List<Statement*>* empty = new List<Statement*>;
 			
@@ -4608,7 +4612,7 @@ yyreduce:
   case 115:
 
 /* Line 1455 of yacc.c  */
-#line 1333 "src/generated_src/php_parser.ypp"
+#line 1337 "src/generated_src/php_parser.ypp"
     {
 			(yyval.list_ast_statement) = new List<Statement*>;
 		;}
@@ -4617,7 +4621,7 @@ yyreduce:
   case 116:
 
 /* Line 1455 of yacc.c  */
-#line 1337 "src/generated_src/php_parser.ypp"
+#line 1341 "src/generated_src/php_parser.ypp"
     {
 			(yyval.list_ast_statement) = (yyvsp[(2) - (2)].list_ast_statement);
 		;}
@@ -4626,7 +4630,7 @@ yyreduce:
   case 117:
 
 /* Line 1455 of yacc.c  */
-#line 1347 "src/generated_src/php_parser.ypp"
+#line 1351 "src/generated_src/php_parser.ypp"
     {
 			(yyval.list_ast_statement) = new List<Statement*>;
 		;}
@@ -4635,7 +4639,7 @@ yyreduce:
   case 118:
 
 /* Line 1455 of yacc.c  */
-#line 1351 "src/generated_src/php_parser.ypp"
+#line 1355 "src/generated_src/php_parser.ypp"
     {
 			(yyval.list_ast_statement) = (yyvsp[(3) - (3)].list_ast_statement);
 		;}
@@ -4644,7 +4648,7 @@ yyreduce:
   case 119:
 
 /* Line 1455 of yacc.c  */
-#line 1358 "src/generated_src/php_parser.ypp"
+#line 1362 "src/generated_src/php_parser.ypp"
     {
 			(yyval.list_ast_formal_parameter) = (yyvsp[(1) - (1)].list_ast_formal_parameter);
 		;}
@@ -4653,7 +4657,7 @@ yyreduce:
   case 120:
 
 /* Line 1455 of yacc.c  */
-#line 1362 "src/generated_src/php_parser.ypp"
+#line 1366 "src/generated_src/php_parser.ypp"
     {
 			List<Formal_parameter*>* params = new List<Formal_parameter*>;
 			(yyval.list_ast_formal_parameter) = params;
@@ -4663,7 +4667,7 @@ yyreduce:
   case 121:
 
 /* Line 1455 of yacc.c  */
-#line 1373 "src/generated_src/php_parser.ypp"
+#line 1377 "src/generated_src/php_parser.ypp"
     {
 			VARIABLE_NAME* name = new VARIABLE_NAME((yyvsp[(2) - (2)].string));
 			
@@ -4679,7 +4683,7 @@ yyreduce:
   case 122:
 
 /* Line 1455 of yacc.c  */
-#line 1384 "src/generated_src/php_parser.ypp"
+#line 1388 "src/generated_src/php_parser.ypp"
     {
 			VARIABLE_NAME* name = new VARIABLE_NAME((yyvsp[(3) - (3)].string));
 			
@@ -4695,7 +4699,7 @@ yyreduce:
   case 123:
 
 /* Line 1455 of yacc.c  */
-#line 1395 "src/generated_src/php_parser.ypp"
+#line 1399 "src/generated_src/php_parser.ypp"
     {
 			VARIABLE_NAME* name = new VARIABLE_NAME((yyvsp[(3) - (5)].string));
 			
@@ -4711,7 +4715,7 @@ yyreduce:
   case 124:
 
 /* Line 1455 of yacc.c  */
-#line 1406 "src/generated_src/php_parser.ypp"
+#line 1410 "src/generated_src/php_parser.ypp"
     {
 			VARIABLE_NAME* name = new VARIABLE_NAME((yyvsp[(2) - (4)].string));
 			
@@ -4727,7 +4731,7 @@ yyreduce:
   case 125:
 
 /* Line 1455 of yacc.c  */
-#line 1417 "src/generated_src/php_parser.ypp"
+#line 1421 "src/generated_src/php_parser.ypp"
     {
 			VARIABLE_NAME* name = new VARIABLE_NAME((yyvsp[(4) - (4)].string));
 			
@@ -4740,7 +4744,7 @@ yyreduce:
   case 126:
 
 /* Line 1455 of yacc.c  */
-#line 1425 "src/generated_src/php_parser.ypp"
+#line 1429 "src/generated_src/php_parser.ypp"
     {
 			VARIABLE_NAME* name = new VARIABLE_NAME((yyvsp[(5) - (5)].string));
 			
@@ -4753,7 +4757,7 @@ yyreduce:
   case 127:
 
 /* Line 1455 of yacc.c  */
-#line 1433 "src/generated_src/php_parser.ypp"
+#line 1437 "src/generated_src/php_parser.ypp"
     {
 			VARIABLE_NAME* name = new VARIABLE_NAME((yyvsp[(5) - (7)].string));
 			
@@ -4766,7 +4770,7 @@ yyreduce:
   case 128:
 
 /* Line 1455 of yacc.c  */
-#line 1441 "src/generated_src/php_parser.ypp"
+#line 1445 "src/generated_src/php_parser.ypp"
     {
 			VARIABLE_NAME* name = new VARIABLE_NAME((yyvsp[(4) - (6)].string));
 			
@@ -4779,7 +4783,7 @@ yyreduce:
   case 129:
 
 /* Line 1455 of yacc.c  */
-#line 1452 "src/generated_src/php_parser.ypp"
+#line 1456 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_type) = NEW(Type, (NULL));
 		;}
@@ -4788,7 +4792,7 @@ yyreduce:
   case 130:
 
 /* Line 1455 of yacc.c  */
-#line 1456 "src/generated_src/php_parser.ypp"
+#line 1460 "src/generated_src/php_parser.ypp"
     {
 			CLASS_NAME* class_name = NEW (CLASS_NAME, (yyvsp[(1) - (1)].string));
 			(yyval.ast_type) = NEW(Type, (class_name));
@@ -4798,7 +4802,7 @@ yyreduce:
   case 131:
 
 /* Line 1455 of yacc.c  */
-#line 1461 "src/generated_src/php_parser.ypp"
+#line 1465 "src/generated_src/php_parser.ypp"
     {
 			CLASS_NAME* class_name = new CLASS_NAME(new String ("array"));
 			(yyval.ast_type) = NEW(Type, (class_name));
@@ -4808,7 +4812,7 @@ yyreduce:
   case 132:
 
 /* Line 1455 of yacc.c  */
-#line 1469 "src/generated_src/php_parser.ypp"
+#line 1473 "src/generated_src/php_parser.ypp"
     {
 			(yyval.list_ast_actual_parameter) = (yyvsp[(1) - (1)].list_ast_actual_parameter);
 		;}
@@ -4817,7 +4821,7 @@ yyreduce:
   case 133:
 
 /* Line 1455 of yacc.c  */
-#line 1473 "src/generated_src/php_parser.ypp"
+#line 1477 "src/generated_src/php_parser.ypp"
     {
 			(yyval.list_ast_actual_parameter) = new List<Actual_parameter*>;
 		;}
@@ -4826,7 +4830,7 @@ yyreduce:
   case 134:
 
 /* Line 1455 of yacc.c  */
-#line 1480 "src/generated_src/php_parser.ypp"
+#line 1484 "src/generated_src/php_parser.ypp"
     {
 			List<Actual_parameter*>* list = new List<Actual_parameter*>;
 			list->push_back(NEW(Actual_parameter, (false, (yyvsp[(1) - (1)].ast_expr))));
@@ -4837,7 +4841,7 @@ yyreduce:
   case 135:
 
 /* Line 1455 of yacc.c  */
-#line 1486 "src/generated_src/php_parser.ypp"
+#line 1490 "src/generated_src/php_parser.ypp"
     {
 			List<Actual_parameter*>* list = new List<Actual_parameter*>;
 			list->push_back(NEW(Actual_parameter, (false, (yyvsp[(1) - (1)].ast_expr))));
@@ -4848,7 +4852,7 @@ yyreduce:
   case 136:
 
 /* Line 1455 of yacc.c  */
-#line 1492 "src/generated_src/php_parser.ypp"
+#line 1496 "src/generated_src/php_parser.ypp"
     {
 			List<Actual_parameter*>* list = new List<Actual_parameter*>;
 			list->push_back(NEW(Actual_parameter, (true, (yyvsp[(2) - (2)].ast_expr))));
@@ -4859,7 +4863,7 @@ yyreduce:
   case 137:
 
 /* Line 1455 of yacc.c  */
-#line 1498 "src/generated_src/php_parser.ypp"
+#line 1502 "src/generated_src/php_parser.ypp"
     {
 			(yyvsp[(1) - (3)].list_ast_actual_parameter)->push_back(NEW(Actual_parameter, (false, (yyvsp[(3) - (3)].ast_expr))));
 			(yyval.list_ast_actual_parameter) = (yyvsp[(1) - (3)].list_ast_actual_parameter);
@@ -4869,7 +4873,7 @@ yyreduce:
   case 138:
 
 /* Line 1455 of yacc.c  */
-#line 1503 "src/generated_src/php_parser.ypp"
+#line 1507 "src/generated_src/php_parser.ypp"
     {
 			(yyvsp[(1) - (3)].list_ast_actual_parameter)->push_back(NEW(Actual_parameter, (false, (yyvsp[(3) - (3)].ast_expr))));
 			(yyval.list_ast_actual_parameter) = (yyvsp[(1) - (3)].list_ast_actual_parameter);
@@ -4879,7 +4883,7 @@ yyreduce:
   case 139:
 
 /* Line 1455 of yacc.c  */
-#line 1508 "src/generated_src/php_parser.ypp"
+#line 1512 "src/generated_src/php_parser.ypp"
     {
 			(yyvsp[(1) - (4)].list_ast_actual_parameter)->push_back(NEW(Actual_parameter, (true, (yyvsp[(4) - (4)].ast_expr))));
 			(yyval.list_ast_actual_parameter) = (yyvsp[(1) - (4)].list_ast_actual_parameter);
@@ -4889,7 +4893,7 @@ yyreduce:
   case 140:
 
 /* Line 1455 of yacc.c  */
-#line 1516 "src/generated_src/php_parser.ypp"
+#line 1520 "src/generated_src/php_parser.ypp"
     {
 			(yyvsp[(1) - (3)].list_ast_variable_name)->push_back((yyvsp[(3) - (3)].ast_variable_name));
 			(yyval.list_ast_variable_name) = (yyvsp[(1) - (3)].list_ast_variable_name);
@@ -4899,7 +4903,7 @@ yyreduce:
   case 141:
 
 /* Line 1455 of yacc.c  */
-#line 1521 "src/generated_src/php_parser.ypp"
+#line 1525 "src/generated_src/php_parser.ypp"
     {
 			List<Variable_name*>* list = new List<Variable_name*>;
 			list->push_back((yyvsp[(1) - (1)].ast_variable_name));
@@ -4911,7 +4915,7 @@ yyreduce:
   case 142:
 
 /* Line 1455 of yacc.c  */
-#line 1531 "src/generated_src/php_parser.ypp"
+#line 1535 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_variable_name) = NEW(VARIABLE_NAME, ((yyvsp[(1) - (1)].string)));
 		;}
@@ -4920,7 +4924,7 @@ yyreduce:
   case 143:
 
 /* Line 1455 of yacc.c  */
-#line 1535 "src/generated_src/php_parser.ypp"
+#line 1539 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_variable_name) = NEW(Reflection, ((yyvsp[(2) - (2)].ast_expr)));
 		;}
@@ -4929,7 +4933,7 @@ yyreduce:
   case 144:
 
 /* Line 1455 of yacc.c  */
-#line 1539 "src/generated_src/php_parser.ypp"
+#line 1543 "src/generated_src/php_parser.ypp"
     {
 			(yyvsp[(3) - (4)].ast_expr)->attrs->set_true("phc.unparser.needs_user_curlies");
 			(yyval.ast_variable_name) = NEW(Reflection, ((yyvsp[(3) - (4)].ast_expr)));
@@ -4939,7 +4943,7 @@ yyreduce:
   case 145:
 
 /* Line 1455 of yacc.c  */
-#line 1547 "src/generated_src/php_parser.ypp"
+#line 1551 "src/generated_src/php_parser.ypp"
     {
 			VARIABLE_NAME* name = new VARIABLE_NAME((yyvsp[(3) - (3)].string));
 			(yyvsp[(1) - (3)].list_ast_name_with_default)->push_back(NEW(Name_with_default, (name, NULL)));
@@ -4950,7 +4954,7 @@ yyreduce:
   case 146:
 
 /* Line 1455 of yacc.c  */
-#line 1553 "src/generated_src/php_parser.ypp"
+#line 1557 "src/generated_src/php_parser.ypp"
     {
 			VARIABLE_NAME* name = new VARIABLE_NAME((yyvsp[(3) - (5)].string));
 			(yyvsp[(1) - (5)].list_ast_name_with_default)->push_back(NEW(Name_with_default, (name, (yyvsp[(5) - (5)].ast_expr))));
@@ -4961,7 +4965,7 @@ yyreduce:
   case 147:
 
 /* Line 1455 of yacc.c  */
-#line 1559 "src/generated_src/php_parser.ypp"
+#line 1563 "src/generated_src/php_parser.ypp"
     {
 			VARIABLE_NAME* name = new VARIABLE_NAME((yyvsp[(1) - (1)].string));
 			List<Name_with_default*>* list = new List<Name_with_default*>;
@@ -4973,7 +4977,7 @@ yyreduce:
   case 148:
 
 /* Line 1455 of yacc.c  */
-#line 1566 "src/generated_src/php_parser.ypp"
+#line 1570 "src/generated_src/php_parser.ypp"
     {
 			VARIABLE_NAME* name = new VARIABLE_NAME((yyvsp[(1) - (3)].string));
 			List<Name_with_default*>* list = new List<Name_with_default*>;
@@ -4985,7 +4989,7 @@ yyreduce:
   case 149:
 
 /* Line 1455 of yacc.c  */
-#line 1576 "src/generated_src/php_parser.ypp"
+#line 1580 "src/generated_src/php_parser.ypp"
     {
 			(yyvsp[(1) - (2)].list_ast_member)->push_back((yyvsp[(2) - (2)].ast_member));
 			(yyval.list_ast_member) = (yyvsp[(1) - (2)].list_ast_member);
@@ -4995,7 +4999,7 @@ yyreduce:
   case 150:
 
 /* Line 1455 of yacc.c  */
-#line 1581 "src/generated_src/php_parser.ypp"
+#line 1585 "src/generated_src/php_parser.ypp"
     {
 			(yyval.list_ast_member) = new List<Member*>;
 		;}
@@ -5004,7 +5008,7 @@ yyreduce:
   case 151:
 
 /* Line 1455 of yacc.c  */
-#line 1588 "src/generated_src/php_parser.ypp"
+#line 1592 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_member) = NEW(Attribute, ((yyvsp[(1) - (3)].ast_attr_mod), (yyvsp[(2) - (3)].list_ast_name_with_default)));
 		;}
@@ -5013,7 +5017,7 @@ yyreduce:
   case 152:
 
 /* Line 1455 of yacc.c  */
-#line 1592 "src/generated_src/php_parser.ypp"
+#line 1596 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_member) = (yyvsp[(1) - (2)].ast_attribute);
 		;}
@@ -5022,21 +5026,21 @@ yyreduce:
   case 153:
 
 /* Line 1455 of yacc.c  */
-#line 1595 "src/generated_src/php_parser.ypp"
+#line 1599 "src/generated_src/php_parser.ypp"
     {context->current_method = dynamic_cast<String*>((yyvsp[(4) - (4)].string));;}
     break;
 
   case 154:
 
 /* Line 1455 of yacc.c  */
-#line 1595 "src/generated_src/php_parser.ypp"
+#line 1599 "src/generated_src/php_parser.ypp"
     {context->current_method = new String;;}
     break;
 
   case 155:
 
 /* Line 1455 of yacc.c  */
-#line 1596 "src/generated_src/php_parser.ypp"
+#line 1600 "src/generated_src/php_parser.ypp"
     {
 			METHOD_NAME* name = new METHOD_NAME((yyvsp[(4) - (10)].string));
 		
@@ -5051,7 +5055,7 @@ yyreduce:
   case 156:
 
 /* Line 1455 of yacc.c  */
-#line 1609 "src/generated_src/php_parser.ypp"
+#line 1613 "src/generated_src/php_parser.ypp"
     {
 			// Abstract method
 			(yyval.list_ast_statement) = NULL;
@@ -5061,7 +5065,7 @@ yyreduce:
   case 157:
 
 /* Line 1455 of yacc.c  */
-#line 1614 "src/generated_src/php_parser.ypp"
+#line 1618 "src/generated_src/php_parser.ypp"
     {
 			(yyval.list_ast_statement) = (yyvsp[(1) - (1)].list_ast_statement);
 		;}
@@ -5070,7 +5074,7 @@ yyreduce:
   case 158:
 
 /* Line 1455 of yacc.c  */
-#line 1621 "src/generated_src/php_parser.ypp"
+#line 1625 "src/generated_src/php_parser.ypp"
     {
 			if((yyvsp[(1) - (1)].ast_method_mod)->is_abstract)
 			{
@@ -5084,7 +5088,7 @@ yyreduce:
   case 159:
 
 /* Line 1455 of yacc.c  */
-#line 1630 "src/generated_src/php_parser.ypp"
+#line 1634 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_attr_mod) = NEW(Attr_mod, (false, false, false, false, false));
 		;}
@@ -5093,7 +5097,7 @@ yyreduce:
   case 160:
 
 /* Line 1455 of yacc.c  */
-#line 1637 "src/generated_src/php_parser.ypp"
+#line 1641 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_method_mod) = new Method_mod();
 		;}
@@ -5102,7 +5106,7 @@ yyreduce:
   case 161:
 
 /* Line 1455 of yacc.c  */
-#line 1641 "src/generated_src/php_parser.ypp"
+#line 1645 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_method_mod) = (yyvsp[(1) - (1)].ast_method_mod);
 		;}
@@ -5111,7 +5115,7 @@ yyreduce:
   case 162:
 
 /* Line 1455 of yacc.c  */
-#line 1648 "src/generated_src/php_parser.ypp"
+#line 1652 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_method_mod) = (yyvsp[(1) - (1)].ast_method_mod);
 		;}
@@ -5120,7 +5124,7 @@ yyreduce:
   case 163:
 
 /* Line 1455 of yacc.c  */
-#line 1652 "src/generated_src/php_parser.ypp"
+#line 1656 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_method_mod) = NEW(Method_mod, ((yyvsp[(1) - (2)].ast_method_mod), (yyvsp[(2) - (2)].ast_method_mod)));
 		;}
@@ -5129,7 +5133,7 @@ yyreduce:
   case 164:
 
 /* Line 1455 of yacc.c  */
-#line 1659 "src/generated_src/php_parser.ypp"
+#line 1663 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_method_mod) = Method_mod::new_PUBLIC();
 		;}
@@ -5138,7 +5142,7 @@ yyreduce:
   case 165:
 
 /* Line 1455 of yacc.c  */
-#line 1663 "src/generated_src/php_parser.ypp"
+#line 1667 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_method_mod) = Method_mod::new_PROTECTED();
 		;}
@@ -5147,7 +5151,7 @@ yyreduce:
   case 166:
 
 /* Line 1455 of yacc.c  */
-#line 1667 "src/generated_src/php_parser.ypp"
+#line 1671 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_method_mod) = Method_mod::new_PRIVATE();
 		;}
@@ -5156,7 +5160,7 @@ yyreduce:
   case 167:
 
 /* Line 1455 of yacc.c  */
-#line 1671 "src/generated_src/php_parser.ypp"
+#line 1675 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_method_mod) = Method_mod::new_STATIC();
 		;}
@@ -5165,7 +5169,7 @@ yyreduce:
   case 168:
 
 /* Line 1455 of yacc.c  */
-#line 1675 "src/generated_src/php_parser.ypp"
+#line 1679 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_method_mod) = Method_mod::new_ABSTRACT();
 		;}
@@ -5174,7 +5178,7 @@ yyreduce:
   case 169:
 
 /* Line 1455 of yacc.c  */
-#line 1679 "src/generated_src/php_parser.ypp"
+#line 1683 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_method_mod) = Method_mod::new_FINAL();
 		;}
@@ -5183,7 +5187,7 @@ yyreduce:
   case 170:
 
 /* Line 1455 of yacc.c  */
-#line 1686 "src/generated_src/php_parser.ypp"
+#line 1690 "src/generated_src/php_parser.ypp"
     {
 			VARIABLE_NAME* name = new VARIABLE_NAME((yyvsp[(3) - (3)].string));
 			(yyvsp[(1) - (3)].list_ast_name_with_default)->push_back(NEW(Name_with_default, (name, NULL)));
@@ -5194,7 +5198,7 @@ yyreduce:
   case 171:
 
 /* Line 1455 of yacc.c  */
-#line 1692 "src/generated_src/php_parser.ypp"
+#line 1696 "src/generated_src/php_parser.ypp"
     {
 			VARIABLE_NAME* name = new VARIABLE_NAME((yyvsp[(3) - (5)].string));
 			(yyvsp[(1) - (5)].list_ast_name_with_default)->push_back(NEW(Name_with_default, (name, (yyvsp[(5) - (5)].ast_expr))));
@@ -5205,7 +5209,7 @@ yyreduce:
   case 172:
 
 /* Line 1455 of yacc.c  */
-#line 1698 "src/generated_src/php_parser.ypp"
+#line 1702 "src/generated_src/php_parser.ypp"
     {
 			VARIABLE_NAME* name = new VARIABLE_NAME((yyvsp[(1) - (1)].string));
 			List<Name_with_default*>* vars = new List<Name_with_default*>;
@@ -5217,7 +5221,7 @@ yyreduce:
   case 173:
 
 /* Line 1455 of yacc.c  */
-#line 1705 "src/generated_src/php_parser.ypp"
+#line 1709 "src/generated_src/php_parser.ypp"
     {
 			VARIABLE_NAME* name = new VARIABLE_NAME((yyvsp[(1) - (3)].string));
 			List<Name_with_default*>* vars = new List<Name_with_default*>;
@@ -5229,7 +5233,7 @@ yyreduce:
   case 174:
 
 /* Line 1455 of yacc.c  */
-#line 1715 "src/generated_src/php_parser.ypp"
+#line 1719 "src/generated_src/php_parser.ypp"
     {
 			VARIABLE_NAME* name = new VARIABLE_NAME((yyvsp[(3) - (5)].string));
 			Name_with_default* var = NEW(Name_with_default, (name, (yyvsp[(5) - (5)].ast_expr)));
@@ -5241,7 +5245,7 @@ yyreduce:
   case 175:
 
 /* Line 1455 of yacc.c  */
-#line 1722 "src/generated_src/php_parser.ypp"
+#line 1726 "src/generated_src/php_parser.ypp"
     {
 			VARIABLE_NAME* name = new VARIABLE_NAME((yyvsp[(2) - (4)].string));
 			List<Name_with_default*>* vars = new List<Name_with_default*>;
@@ -5257,7 +5261,7 @@ yyreduce:
   case 176:
 
 /* Line 1455 of yacc.c  */
-#line 1744 "src/generated_src/php_parser.ypp"
+#line 1748 "src/generated_src/php_parser.ypp"
     {
 			(yyvsp[(1) - (3)].list_ast_actual_parameter)->push_back (NEW (Actual_parameter, (false, (yyvsp[(3) - (3)].ast_expr))));
 			(yyval.list_ast_actual_parameter) = (yyvsp[(1) - (3)].list_ast_actual_parameter);
@@ -5267,7 +5271,7 @@ yyreduce:
   case 177:
 
 /* Line 1455 of yacc.c  */
-#line 1749 "src/generated_src/php_parser.ypp"
+#line 1753 "src/generated_src/php_parser.ypp"
     {
 			(yyval.list_ast_actual_parameter) = new List<Actual_parameter*>;
 			(yyval.list_ast_actual_parameter)->push_back(NEW(Actual_parameter, (false, (yyvsp[(1) - (1)].ast_expr))));
@@ -5277,7 +5281,7 @@ yyreduce:
   case 178:
 
 /* Line 1455 of yacc.c  */
-#line 1757 "src/generated_src/php_parser.ypp"
+#line 1761 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_expr) = NULL;
 		;}
@@ -5286,7 +5290,7 @@ yyreduce:
   case 179:
 
 /* Line 1455 of yacc.c  */
-#line 1761 "src/generated_src/php_parser.ypp"
+#line 1765 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_expr) = (yyvsp[(1) - (1)].ast_expr)
 		;}
@@ -5295,7 +5299,7 @@ yyreduce:
   case 180:
 
 /* Line 1455 of yacc.c  */
-#line 1771 "src/generated_src/php_parser.ypp"
+#line 1775 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_expr) = NEW(Bin_op, ((yyvsp[(1) - (3)].ast_expr), (yyvsp[(2) - (3)].token_op), (yyvsp[(3) - (3)].ast_expr)));
 			(yyval.ast_expr)->attrs->set_true("phc.unparser.no_binop_brackets");
@@ -5305,7 +5309,7 @@ yyreduce:
   case 181:
 
 /* Line 1455 of yacc.c  */
-#line 1776 "src/generated_src/php_parser.ypp"
+#line 1780 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_expr) = (yyvsp[(1) - (1)].ast_expr);
 		;}
@@ -5314,7 +5318,7 @@ yyreduce:
   case 182:
 
 /* Line 1455 of yacc.c  */
-#line 1783 "src/generated_src/php_parser.ypp"
+#line 1787 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_expr) = NEW(List_assignment, ((yyvsp[(3) - (6)].ast_nested_list_elements)->list_elements, (yyvsp[(6) - (6)].ast_expr)));
 		;}
@@ -5323,7 +5327,7 @@ yyreduce:
   case 183:
 
 /* Line 1455 of yacc.c  */
-#line 1787 "src/generated_src/php_parser.ypp"
+#line 1791 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_expr) = NEW(Assignment, (expect_variable((yyvsp[(1) - (3)].ast_expr)), false, (yyvsp[(3) - (3)].ast_expr)));
 		;}
@@ -5332,7 +5336,7 @@ yyreduce:
   case 184:
 
 /* Line 1455 of yacc.c  */
-#line 1791 "src/generated_src/php_parser.ypp"
+#line 1795 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_expr) = NEW(Assignment, (expect_variable((yyvsp[(1) - (4)].ast_expr)), true, (yyvsp[(4) - (4)].ast_expr)));
 		;}
@@ -5341,7 +5345,7 @@ yyreduce:
   case 185:
 
 /* Line 1455 of yacc.c  */
-#line 1795 "src/generated_src/php_parser.ypp"
+#line 1799 "src/generated_src/php_parser.ypp"
     {
 			(yyvsp[(6) - (6)].ast_new)->class_name = (yyvsp[(5) - (6)].ast_class_name);
 			(yyval.ast_expr) = NEW(Assignment, (expect_variable((yyvsp[(1) - (6)].ast_expr)), true, (yyvsp[(6) - (6)].ast_new)));
@@ -5351,7 +5355,7 @@ yyreduce:
   case 186:
 
 /* Line 1455 of yacc.c  */
-#line 1800 "src/generated_src/php_parser.ypp"
+#line 1804 "src/generated_src/php_parser.ypp"
     {
 			(yyvsp[(3) - (3)].ast_new)->class_name = (yyvsp[(2) - (3)].ast_class_name);
 			(yyval.ast_expr) = (yyvsp[(3) - (3)].ast_new);
@@ -5361,7 +5365,7 @@ yyreduce:
   case 187:
 
 /* Line 1455 of yacc.c  */
-#line 1805 "src/generated_src/php_parser.ypp"
+#line 1809 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_expr) = NEW(Method_invocation, ("clone", (yyvsp[(2) - (2)].ast_expr)));
 			(yyval.ast_expr)->attrs->set_true("phc.unparser.no_brackets");
@@ -5371,7 +5375,7 @@ yyreduce:
   case 188:
 
 /* Line 1455 of yacc.c  */
-#line 1810 "src/generated_src/php_parser.ypp"
+#line 1814 "src/generated_src/php_parser.ypp"
     {
 			Variable* var = expect_variable((yyvsp[(1) - (3)].ast_expr));
 			(yyval.ast_expr) = new Op_assignment(var, "+", (yyvsp[(3) - (3)].ast_expr));
@@ -5381,7 +5385,7 @@ yyreduce:
   case 189:
 
 /* Line 1455 of yacc.c  */
-#line 1815 "src/generated_src/php_parser.ypp"
+#line 1819 "src/generated_src/php_parser.ypp"
     {
 			Variable* var = expect_variable((yyvsp[(1) - (3)].ast_expr));
 			(yyval.ast_expr) = new Op_assignment(var, "-", (yyvsp[(3) - (3)].ast_expr));
@@ -5391,7 +5395,7 @@ yyreduce:
   case 190:
 
 /* Line 1455 of yacc.c  */
-#line 1820 "src/generated_src/php_parser.ypp"
+#line 1824 "src/generated_src/php_parser.ypp"
     {
 			Variable* var = expect_variable((yyvsp[(1) - (3)].ast_expr));
 			(yyval.ast_expr) = new Op_assignment(var, "*", (yyvsp[(3) - (3)].ast_expr));
@@ -5401,7 +5405,7 @@ yyreduce:
   case 191:
 
 /* Line 1455 of yacc.c  */
-#line 1825 "src/generated_src/php_parser.ypp"
+#line 1829 "src/generated_src/php_parser.ypp"
     {
 			Variable* var = expect_variable((yyvsp[(1) - (3)].ast_expr));
 			(yyval.ast_expr) = new Op_assignment(var, "/", (yyvsp[(3) - (3)].ast_expr));
@@ -5411,7 +5415,7 @@ yyreduce:
   case 192:
 
 /* Line 1455 of yacc.c  */
-#line 1830 "src/generated_src/php_parser.ypp"
+#line 1834 "src/generated_src/php_parser.ypp"
     {
 			Variable* var = expect_variable((yyvsp[(1) - (3)].ast_expr));
 			(yyval.ast_expr) = new Op_assignment(var, ".", (yyvsp[(3) - (3)].ast_expr));
@@ -5421,7 +5425,7 @@ yyreduce:
   case 193:
 
 /* Line 1455 of yacc.c  */
-#line 1835 "src/generated_src/php_parser.ypp"
+#line 1839 "src/generated_src/php_parser.ypp"
     {
 			Variable* var = expect_variable((yyvsp[(1) - (3)].ast_expr));
 			(yyval.ast_expr) = new Op_assignment(var, "%", (yyvsp[(3) - (3)].ast_expr));
@@ -5431,7 +5435,7 @@ yyreduce:
   case 194:
 
 /* Line 1455 of yacc.c  */
-#line 1840 "src/generated_src/php_parser.ypp"
+#line 1844 "src/generated_src/php_parser.ypp"
     {
 			Variable* var = expect_variable((yyvsp[(1) - (3)].ast_expr));
 			(yyval.ast_expr) = new Op_assignment(var, "&", (yyvsp[(3) - (3)].ast_expr));
@@ -5441,7 +5445,7 @@ yyreduce:
   case 195:
 
 /* Line 1455 of yacc.c  */
-#line 1845 "src/generated_src/php_parser.ypp"
+#line 1849 "src/generated_src/php_parser.ypp"
     {
 			Variable* var = expect_variable((yyvsp[(1) - (3)].ast_expr));
 			(yyval.ast_expr) = new Op_assignment(var, "|", (yyvsp[(3) - (3)].ast_expr));
@@ -5451,7 +5455,7 @@ yyreduce:
   case 196:
 
 /* Line 1455 of yacc.c  */
-#line 1850 "src/generated_src/php_parser.ypp"
+#line 1854 "src/generated_src/php_parser.ypp"
     {
 			Variable* var = expect_variable((yyvsp[(1) - (3)].ast_expr));
 			(yyval.ast_expr) = new Op_assignment(var, "^", (yyvsp[(3) - (3)].ast_expr));
@@ -5461,7 +5465,7 @@ yyreduce:
   case 197:
 
 /* Line 1455 of yacc.c  */
-#line 1855 "src/generated_src/php_parser.ypp"
+#line 1859 "src/generated_src/php_parser.ypp"
     {
 			Variable* var = expect_variable((yyvsp[(1) - (3)].ast_expr));
 			(yyval.ast_expr) = new Op_assignment(var, "<<", (yyvsp[(3) - (3)].ast_expr));
@@ -5471,7 +5475,7 @@ yyreduce:
   case 198:
 
 /* Line 1455 of yacc.c  */
-#line 1860 "src/generated_src/php_parser.ypp"
+#line 1864 "src/generated_src/php_parser.ypp"
     {
 			Variable* var = expect_variable((yyvsp[(1) - (3)].ast_expr));
 			(yyval.ast_expr) = new Op_assignment(var, ">>", (yyvsp[(3) - (3)].ast_expr));
@@ -5481,7 +5485,7 @@ yyreduce:
   case 199:
 
 /* Line 1455 of yacc.c  */
-#line 1865 "src/generated_src/php_parser.ypp"
+#line 1869 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_expr) = NEW(Post_op, (expect_variable((yyvsp[(1) - (2)].ast_expr)), "++"));
 		;}
@@ -5490,7 +5494,7 @@ yyreduce:
   case 200:
 
 /* Line 1455 of yacc.c  */
-#line 1869 "src/generated_src/php_parser.ypp"
+#line 1873 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_expr) = NEW(Pre_op, (expect_variable((yyvsp[(2) - (2)].ast_expr)), "++"));
 		;}
@@ -5499,7 +5503,7 @@ yyreduce:
   case 201:
 
 /* Line 1455 of yacc.c  */
-#line 1873 "src/generated_src/php_parser.ypp"
+#line 1877 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_expr) = NEW(Post_op, (expect_variable((yyvsp[(1) - (2)].ast_expr)), "--"));
 		;}
@@ -5508,7 +5512,7 @@ yyreduce:
   case 202:
 
 /* Line 1455 of yacc.c  */
-#line 1877 "src/generated_src/php_parser.ypp"
+#line 1881 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_expr) = NEW(Pre_op, (expect_variable((yyvsp[(2) - (2)].ast_expr)), "--"));
 		;}
@@ -5517,7 +5521,7 @@ yyreduce:
   case 203:
 
 /* Line 1455 of yacc.c  */
-#line 1881 "src/generated_src/php_parser.ypp"
+#line 1885 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_expr) = NEW(Bin_op, ((yyvsp[(1) - (3)].ast_expr), (yyvsp[(2) - (3)].token_op), (yyvsp[(3) - (3)].ast_expr)));
 			(yyval.ast_expr)->attrs->set_true("phc.unparser.no_binop_brackets");
@@ -5527,7 +5531,7 @@ yyreduce:
   case 204:
 
 /* Line 1455 of yacc.c  */
-#line 1886 "src/generated_src/php_parser.ypp"
+#line 1890 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_expr) = NEW(Bin_op, ((yyvsp[(1) - (3)].ast_expr), (yyvsp[(2) - (3)].token_op), (yyvsp[(3) - (3)].ast_expr)));
 			(yyval.ast_expr)->attrs->set_true("phc.unparser.no_binop_brackets");
@@ -5537,7 +5541,7 @@ yyreduce:
   case 205:
 
 /* Line 1455 of yacc.c  */
-#line 1891 "src/generated_src/php_parser.ypp"
+#line 1895 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_expr) = NEW(Bin_op, ((yyvsp[(1) - (3)].ast_expr), (yyvsp[(2) - (3)].token_op), (yyvsp[(3) - (3)].ast_expr)));
 			(yyval.ast_expr)->attrs->set_true("phc.unparser.no_binop_brackets");
@@ -5547,7 +5551,7 @@ yyreduce:
   case 206:
 
 /* Line 1455 of yacc.c  */
-#line 1896 "src/generated_src/php_parser.ypp"
+#line 1900 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_expr) = NEW(Bin_op, ((yyvsp[(1) - (3)].ast_expr), (yyvsp[(2) - (3)].token_op), (yyvsp[(3) - (3)].ast_expr)));
 			(yyval.ast_expr)->attrs->set_true("phc.unparser.no_binop_brackets");
@@ -5557,7 +5561,7 @@ yyreduce:
   case 207:
 
 /* Line 1455 of yacc.c  */
-#line 1901 "src/generated_src/php_parser.ypp"
+#line 1905 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_expr) = NEW(Bin_op, ((yyvsp[(1) - (3)].ast_expr), (yyvsp[(2) - (3)].token_op), (yyvsp[(3) - (3)].ast_expr)));
 			(yyval.ast_expr)->attrs->set_true("phc.unparser.no_binop_brackets");
@@ -5567,7 +5571,7 @@ yyreduce:
   case 208:
 
 /* Line 1455 of yacc.c  */
-#line 1906 "src/generated_src/php_parser.ypp"
+#line 1910 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_expr) = NEW(Bin_op, ((yyvsp[(1) - (3)].ast_expr), (yyvsp[(2) - (3)].token_op), (yyvsp[(3) - (3)].ast_expr)));
 			(yyval.ast_expr)->attrs->set_true("phc.unparser.no_binop_brackets");
@@ -5577,7 +5581,7 @@ yyreduce:
   case 209:
 
 /* Line 1455 of yacc.c  */
-#line 1911 "src/generated_src/php_parser.ypp"
+#line 1915 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_expr) = NEW(Bin_op, ((yyvsp[(1) - (3)].ast_expr), (yyvsp[(2) - (3)].token_op), (yyvsp[(3) - (3)].ast_expr)));
 			(yyval.ast_expr)->attrs->set_true("phc.unparser.no_binop_brackets");
@@ -5587,7 +5591,7 @@ yyreduce:
   case 210:
 
 /* Line 1455 of yacc.c  */
-#line 1916 "src/generated_src/php_parser.ypp"
+#line 1920 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_expr) = NEW(Bin_op, ((yyvsp[(1) - (3)].ast_expr), (yyvsp[(2) - (3)].token_op), (yyvsp[(3) - (3)].ast_expr)));
 			(yyval.ast_expr)->attrs->set_true("phc.unparser.no_binop_brackets");
@@ -5597,7 +5601,7 @@ yyreduce:
   case 211:
 
 /* Line 1455 of yacc.c  */
-#line 1921 "src/generated_src/php_parser.ypp"
+#line 1925 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_expr) = NEW(Bin_op, ((yyvsp[(1) - (3)].ast_expr), (yyvsp[(2) - (3)].token_op), (yyvsp[(3) - (3)].ast_expr)));
 			(yyval.ast_expr)->attrs->set_true("phc.unparser.no_binop_brackets");
@@ -5607,7 +5611,7 @@ yyreduce:
   case 212:
 
 /* Line 1455 of yacc.c  */
-#line 1926 "src/generated_src/php_parser.ypp"
+#line 1930 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_expr) = NEW(Bin_op, ((yyvsp[(1) - (4)].ast_expr), (yyvsp[(2) - (4)].token_op), expect_variable_or_method_invocation ((yyvsp[(3) - (4)].ast_expr))));
 			(yyval.ast_expr)->attrs->set_true("phc.unparser.no_binop_brackets");
@@ -5623,7 +5627,7 @@ yyreduce:
   case 213:
 
 /* Line 1455 of yacc.c  */
-#line 1937 "src/generated_src/php_parser.ypp"
+#line 1941 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_expr) = NEW(Bin_op, ((yyvsp[(1) - (3)].ast_expr), (yyvsp[(2) - (3)].token_op), (yyvsp[(3) - (3)].ast_expr)));
 			(yyval.ast_expr)->attrs->set_true("phc.unparser.no_binop_brackets");
@@ -5633,7 +5637,7 @@ yyreduce:
   case 214:
 
 /* Line 1455 of yacc.c  */
-#line 1942 "src/generated_src/php_parser.ypp"
+#line 1946 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_expr) = NEW(Bin_op, ((yyvsp[(1) - (3)].ast_expr), (yyvsp[(2) - (3)].token_op), (yyvsp[(3) - (3)].ast_expr)));
 			(yyval.ast_expr)->attrs->set_true("phc.unparser.no_binop_brackets");
@@ -5643,7 +5647,7 @@ yyreduce:
   case 215:
 
 /* Line 1455 of yacc.c  */
-#line 1947 "src/generated_src/php_parser.ypp"
+#line 1951 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_expr) = NEW(Bin_op, ((yyvsp[(1) - (3)].ast_expr), (yyvsp[(2) - (3)].token_op), (yyvsp[(3) - (3)].ast_expr)));
 			(yyval.ast_expr)->attrs->set_true("phc.unparser.no_binop_brackets");
@@ -5653,7 +5657,7 @@ yyreduce:
   case 216:
 
 /* Line 1455 of yacc.c  */
-#line 1952 "src/generated_src/php_parser.ypp"
+#line 1956 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_expr) = NEW(Bin_op, ((yyvsp[(1) - (3)].ast_expr), (yyvsp[(2) - (3)].token_op), (yyvsp[(3) - (3)].ast_expr)));
 			(yyval.ast_expr)->attrs->set_true("phc.unparser.no_binop_brackets");
@@ -5663,7 +5667,7 @@ yyreduce:
   case 217:
 
 /* Line 1455 of yacc.c  */
-#line 1957 "src/generated_src/php_parser.ypp"
+#line 1961 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_expr) = NEW(Bin_op, ((yyvsp[(1) - (3)].ast_expr), (yyvsp[(2) - (3)].token_op), (yyvsp[(3) - (3)].ast_expr)));
 			(yyval.ast_expr)->attrs->set_true("phc.unparser.no_binop_brackets");
@@ -5673,7 +5677,7 @@ yyreduce:
   case 218:
 
 /* Line 1455 of yacc.c  */
-#line 1962 "src/generated_src/php_parser.ypp"
+#line 1966 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_expr) = NEW(Bin_op, ((yyvsp[(1) - (3)].ast_expr), (yyvsp[(2) - (3)].token_op), (yyvsp[(3) - (3)].ast_expr)));
 			(yyval.ast_expr)->attrs->set_true("phc.unparser.no_binop_brackets");
@@ -5683,7 +5687,7 @@ yyreduce:
   case 219:
 
 /* Line 1455 of yacc.c  */
-#line 1967 "src/generated_src/php_parser.ypp"
+#line 1971 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_expr) = NEW(Bin_op, ((yyvsp[(1) - (3)].ast_expr), (yyvsp[(2) - (3)].token_op), (yyvsp[(3) - (3)].ast_expr)));
 			(yyval.ast_expr)->attrs->set_true("phc.unparser.no_binop_brackets");
@@ -5693,7 +5697,7 @@ yyreduce:
   case 220:
 
 /* Line 1455 of yacc.c  */
-#line 1972 "src/generated_src/php_parser.ypp"
+#line 1976 "src/generated_src/php_parser.ypp"
     {
 			// We ignore unary plus
 			(yyval.ast_expr) = (yyvsp[(2) - (2)].ast_expr);
@@ -5703,7 +5707,7 @@ yyreduce:
   case 221:
 
 /* Line 1455 of yacc.c  */
-#line 1977 "src/generated_src/php_parser.ypp"
+#line 1981 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_expr) = NEW(Unary_op, ((yyvsp[(1) - (2)].token_op), (yyvsp[(2) - (2)].ast_expr)));
 		;}
@@ -5712,7 +5716,7 @@ yyreduce:
   case 222:
 
 /* Line 1455 of yacc.c  */
-#line 1981 "src/generated_src/php_parser.ypp"
+#line 1985 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_expr) = NEW(Unary_op, ((yyvsp[(1) - (2)].token_op), (yyvsp[(2) - (2)].ast_expr)));
 		;}
@@ -5721,7 +5725,7 @@ yyreduce:
   case 223:
 
 /* Line 1455 of yacc.c  */
-#line 1985 "src/generated_src/php_parser.ypp"
+#line 1989 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_expr) = NEW(Unary_op, ((yyvsp[(1) - (2)].token_op), (yyvsp[(2) - (2)].ast_expr)));
 		;}
@@ -5730,7 +5734,7 @@ yyreduce:
   case 224:
 
 /* Line 1455 of yacc.c  */
-#line 1989 "src/generated_src/php_parser.ypp"
+#line 1993 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_expr) = NEW(Bin_op, ((yyvsp[(1) - (3)].ast_expr), (yyvsp[(2) - (3)].token_op), (yyvsp[(3) - (3)].ast_expr)));
 			(yyval.ast_expr)->attrs->set_true("phc.unparser.no_binop_brackets");
@@ -5740,7 +5744,7 @@ yyreduce:
   case 225:
 
 /* Line 1455 of yacc.c  */
-#line 1994 "src/generated_src/php_parser.ypp"
+#line 1998 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_expr) = NEW(Bin_op, ((yyvsp[(1) - (3)].ast_expr), (yyvsp[(2) - (3)].token_op), (yyvsp[(3) - (3)].ast_expr)));
 			(yyval.ast_expr)->attrs->set_true("phc.unparser.no_binop_brackets");
@@ -5750,7 +5754,7 @@ yyreduce:
   case 226:
 
 /* Line 1455 of yacc.c  */
-#line 1999 "src/generated_src/php_parser.ypp"
+#line 2003 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_expr) = NEW(Bin_op, ((yyvsp[(1) - (3)].ast_expr), (yyvsp[(2) - (3)].token_op), (yyvsp[(3) - (3)].ast_expr)));
 			(yyval.ast_expr)->attrs->set_true("phc.unparser.no_binop_brackets");
@@ -5760,7 +5764,7 @@ yyreduce:
   case 227:
 
 /* Line 1455 of yacc.c  */
-#line 2004 "src/generated_src/php_parser.ypp"
+#line 2008 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_expr) = NEW(Bin_op, ((yyvsp[(1) - (3)].ast_expr), (yyvsp[(2) - (3)].token_op), (yyvsp[(3) - (3)].ast_expr)));
 			(yyval.ast_expr)->attrs->set_true("phc.unparser.no_binop_brackets");
@@ -5770,7 +5774,7 @@ yyreduce:
   case 228:
 
 /* Line 1455 of yacc.c  */
-#line 2009 "src/generated_src/php_parser.ypp"
+#line 2013 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_expr) = NEW(Bin_op, ((yyvsp[(1) - (3)].ast_expr), (yyvsp[(2) - (3)].token_op), (yyvsp[(3) - (3)].ast_expr)));
 			(yyval.ast_expr)->attrs->set_true("phc.unparser.no_binop_brackets");
@@ -5780,7 +5784,7 @@ yyreduce:
   case 229:
 
 /* Line 1455 of yacc.c  */
-#line 2014 "src/generated_src/php_parser.ypp"
+#line 2018 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_expr) = NEW(Bin_op, ((yyvsp[(1) - (3)].ast_expr), (yyvsp[(2) - (3)].token_op), (yyvsp[(3) - (3)].ast_expr)));
 			(yyval.ast_expr)->attrs->set_true("phc.unparser.no_binop_brackets");
@@ -5790,7 +5794,7 @@ yyreduce:
   case 230:
 
 /* Line 1455 of yacc.c  */
-#line 2019 "src/generated_src/php_parser.ypp"
+#line 2023 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_expr) = NEW(Bin_op, ((yyvsp[(1) - (3)].ast_expr), (yyvsp[(2) - (3)].token_op), (yyvsp[(3) - (3)].ast_expr)));
 			(yyval.ast_expr)->attrs->set_true("phc.unparser.no_binop_brackets");
@@ -5800,7 +5804,7 @@ yyreduce:
   case 231:
 
 /* Line 1455 of yacc.c  */
-#line 2024 "src/generated_src/php_parser.ypp"
+#line 2028 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_expr) = NEW(Bin_op, ((yyvsp[(1) - (3)].ast_expr), (yyvsp[(2) - (3)].token_op), (yyvsp[(3) - (3)].ast_expr)));
 			(yyval.ast_expr)->attrs->set_true("phc.unparser.no_binop_brackets");
@@ -5810,7 +5814,7 @@ yyreduce:
   case 232:
 
 /* Line 1455 of yacc.c  */
-#line 2029 "src/generated_src/php_parser.ypp"
+#line 2033 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_expr) = NEW(Instanceof, ((yyvsp[(1) - (3)].ast_expr), (yyvsp[(3) - (3)].ast_class_name)));
 		;}
@@ -5819,7 +5823,7 @@ yyreduce:
   case 233:
 
 /* Line 1455 of yacc.c  */
-#line 2033 "src/generated_src/php_parser.ypp"
+#line 2037 "src/generated_src/php_parser.ypp"
     {
 			(yyvsp[(2) - (3)].ast_expr)->attrs->set_true("phc.unparser.needs_user_brackets");
 			
@@ -5830,7 +5834,7 @@ yyreduce:
   case 234:
 
 /* Line 1455 of yacc.c  */
-#line 2039 "src/generated_src/php_parser.ypp"
+#line 2043 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_expr) = NEW(Conditional_expr, ((yyvsp[(1) - (5)].ast_expr), (yyvsp[(3) - (5)].ast_expr), (yyvsp[(5) - (5)].ast_expr)));
 		;}
@@ -5839,7 +5843,7 @@ yyreduce:
   case 235:
 
 /* Line 1455 of yacc.c  */
-#line 2043 "src/generated_src/php_parser.ypp"
+#line 2047 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_expr) = (yyvsp[(1) - (1)].ast_method_invocation);
 		;}
@@ -5848,7 +5852,7 @@ yyreduce:
   case 236:
 
 /* Line 1455 of yacc.c  */
-#line 2047 "src/generated_src/php_parser.ypp"
+#line 2051 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_expr) = NEW(Cast, ("int", (yyvsp[(1) - (2)].string), (yyvsp[(2) - (2)].ast_expr)));
 		;}
@@ -5857,7 +5861,7 @@ yyreduce:
   case 237:
 
 /* Line 1455 of yacc.c  */
-#line 2051 "src/generated_src/php_parser.ypp"
+#line 2055 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_expr) = NEW(Cast, ("real", (yyvsp[(1) - (2)].string), (yyvsp[(2) - (2)].ast_expr)));
 		;}
@@ -5866,7 +5870,7 @@ yyreduce:
   case 238:
 
 /* Line 1455 of yacc.c  */
-#line 2055 "src/generated_src/php_parser.ypp"
+#line 2059 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_expr) = NEW(Cast, ("string", (yyvsp[(1) - (2)].string), (yyvsp[(2) - (2)].ast_expr)));
 		;}
@@ -5875,7 +5879,7 @@ yyreduce:
   case 239:
 
 /* Line 1455 of yacc.c  */
-#line 2059 "src/generated_src/php_parser.ypp"
+#line 2063 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_expr) = NEW(Cast, ("array", (yyvsp[(1) - (2)].string), (yyvsp[(2) - (2)].ast_expr)));
 		;}
@@ -5884,7 +5888,7 @@ yyreduce:
   case 240:
 
 /* Line 1455 of yacc.c  */
-#line 2063 "src/generated_src/php_parser.ypp"
+#line 2067 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_expr) = NEW(Cast, ("object", (yyvsp[(1) - (2)].string), (yyvsp[(2) - (2)].ast_expr)));
 		;}
@@ -5893,7 +5897,7 @@ yyreduce:
   case 241:
 
 /* Line 1455 of yacc.c  */
-#line 2067 "src/generated_src/php_parser.ypp"
+#line 2071 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_expr) = NEW(Cast, ("bool", (yyvsp[(1) - (2)].string), (yyvsp[(2) - (2)].ast_expr)));
 		;}
@@ -5902,7 +5906,7 @@ yyreduce:
   case 242:
 
 /* Line 1455 of yacc.c  */
-#line 2071 "src/generated_src/php_parser.ypp"
+#line 2075 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_expr) = NEW(Cast, ("unset", (yyvsp[(1) - (2)].string), (yyvsp[(2) - (2)].ast_expr)));
 		;}
@@ -5911,7 +5915,7 @@ yyreduce:
   case 243:
 
 /* Line 1455 of yacc.c  */
-#line 2075 "src/generated_src/php_parser.ypp"
+#line 2079 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_expr) = (yyvsp[(2) - (2)].ast_method_invocation);
 		;}
@@ -5920,7 +5924,7 @@ yyreduce:
   case 244:
 
 /* Line 1455 of yacc.c  */
-#line 2079 "src/generated_src/php_parser.ypp"
+#line 2083 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_expr) = (yyvsp[(2) - (2)].ast_method_invocation);
       delete (yyvsp[(2) - (2)].ast_method_invocation)->method_name;
@@ -5931,7 +5935,7 @@ yyreduce:
   case 245:
 
 /* Line 1455 of yacc.c  */
-#line 2085 "src/generated_src/php_parser.ypp"
+#line 2089 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_expr) = NEW(Ignore_errors, ((yyvsp[(2) - (2)].ast_expr)));
 		;}
@@ -5940,7 +5944,7 @@ yyreduce:
   case 246:
 
 /* Line 1455 of yacc.c  */
-#line 2089 "src/generated_src/php_parser.ypp"
+#line 2093 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_expr) = (yyvsp[(1) - (1)].ast_expr);
 		;}
@@ -5949,7 +5953,7 @@ yyreduce:
   case 247:
 
 /* Line 1455 of yacc.c  */
-#line 2093 "src/generated_src/php_parser.ypp"
+#line 2097 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_expr) = NEW(Array, ((yyvsp[(3) - (4)].list_ast_array_elem)));
 		;}
@@ -5958,7 +5962,7 @@ yyreduce:
   case 248:
 
 /* Line 1455 of yacc.c  */
-#line 2097 "src/generated_src/php_parser.ypp"
+#line 2101 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_expr) = NEW(Method_invocation, ("print", (yyvsp[(2) - (2)].ast_expr)));
 			(yyval.ast_expr)->attrs->set_true("phc.unparser.no_brackets");
@@ -5968,7 +5972,7 @@ yyreduce:
   case 249:
 
 /* Line 1455 of yacc.c  */
-#line 2105 "src/generated_src/php_parser.ypp"
+#line 2109 "src/generated_src/php_parser.ypp"
     {
 			METHOD_NAME* fn;
 
@@ -5987,7 +5991,7 @@ yyreduce:
   case 250:
 
 /* Line 1455 of yacc.c  */
-#line 2119 "src/generated_src/php_parser.ypp"
+#line 2123 "src/generated_src/php_parser.ypp"
     {
 			METHOD_NAME* fn = new METHOD_NAME((yyvsp[(3) - (6)].string));
 
@@ -5998,7 +6002,7 @@ yyreduce:
   case 251:
 
 /* Line 1455 of yacc.c  */
-#line 2125 "src/generated_src/php_parser.ypp"
+#line 2129 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_method_invocation) = NEW(Method_invocation, ((yyvsp[(1) - (6)].token_class_name), NEW(Reflection, ((yyvsp[(3) - (6)].ast_variable))), (yyvsp[(5) - (6)].list_ast_actual_parameter)));
 		;}
@@ -6007,7 +6011,7 @@ yyreduce:
   case 252:
 
 /* Line 1455 of yacc.c  */
-#line 2129 "src/generated_src/php_parser.ypp"
+#line 2133 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_method_invocation) = NEW(Method_invocation, (NULL, NEW(Reflection, ((yyvsp[(1) - (4)].ast_variable))), (yyvsp[(3) - (4)].list_ast_actual_parameter)));
 		;}
@@ -6016,7 +6020,7 @@ yyreduce:
   case 253:
 
 /* Line 1455 of yacc.c  */
-#line 2136 "src/generated_src/php_parser.ypp"
+#line 2140 "src/generated_src/php_parser.ypp"
     {
 			CLASS_NAME* name = NEW (CLASS_NAME, (yyvsp[(1) - (1)].string));
 			(yyval.token_class_name) = name;
@@ -6026,7 +6030,7 @@ yyreduce:
   case 254:
 
 /* Line 1455 of yacc.c  */
-#line 2144 "src/generated_src/php_parser.ypp"
+#line 2148 "src/generated_src/php_parser.ypp"
     {
 			CLASS_NAME* name = NEW (CLASS_NAME, (yyvsp[(1) - (1)].string));
 
@@ -6037,7 +6041,7 @@ yyreduce:
   case 255:
 
 /* Line 1455 of yacc.c  */
-#line 2150 "src/generated_src/php_parser.ypp"
+#line 2154 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_class_name) = NEW(Reflection, ((yyvsp[(1) - (1)].ast_variable)));
 		;}
@@ -6046,7 +6050,7 @@ yyreduce:
   case 256:
 
 /* Line 1455 of yacc.c  */
-#line 2161 "src/generated_src/php_parser.ypp"
+#line 2165 "src/generated_src/php_parser.ypp"
     {
 			(yyvsp[(3) - (4)].ast_variable)->target = (yyvsp[(1) - (4)].ast_variable);
 
@@ -6064,7 +6068,7 @@ yyreduce:
   case 257:
 
 /* Line 1455 of yacc.c  */
-#line 2174 "src/generated_src/php_parser.ypp"
+#line 2178 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_variable) = (yyvsp[(1) - (1)].ast_variable);
 		;}
@@ -6073,7 +6077,7 @@ yyreduce:
   case 258:
 
 /* Line 1455 of yacc.c  */
-#line 2181 "src/generated_src/php_parser.ypp"
+#line 2185 "src/generated_src/php_parser.ypp"
     {
 			(yyvsp[(1) - (2)].list_ast_variable)->push_back((yyvsp[(2) - (2)].ast_variable));
 			(yyval.list_ast_variable) = (yyvsp[(1) - (2)].list_ast_variable);
@@ -6083,7 +6087,7 @@ yyreduce:
   case 259:
 
 /* Line 1455 of yacc.c  */
-#line 2186 "src/generated_src/php_parser.ypp"
+#line 2190 "src/generated_src/php_parser.ypp"
     {
 			List<Variable*>* vars = new List<Variable*>;
 			(yyval.list_ast_variable) = vars;
@@ -6093,7 +6097,7 @@ yyreduce:
   case 260:
 
 /* Line 1455 of yacc.c  */
-#line 2194 "src/generated_src/php_parser.ypp"
+#line 2198 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_variable) = (yyvsp[(2) - (2)].ast_variable);
 		;}
@@ -6102,7 +6106,7 @@ yyreduce:
   case 261:
 
 /* Line 1455 of yacc.c  */
-#line 2204 "src/generated_src/php_parser.ypp"
+#line 2208 "src/generated_src/php_parser.ypp"
     {
 			Expr* expr = NEW(INT, (0L));
 			Actual_parameter* arg = NEW(Actual_parameter, (false, expr));
@@ -6119,7 +6123,7 @@ yyreduce:
   case 262:
 
 /* Line 1455 of yacc.c  */
-#line 2216 "src/generated_src/php_parser.ypp"
+#line 2220 "src/generated_src/php_parser.ypp"
     {
 			Expr* expr = NEW(INT, (0L));
 			Actual_parameter* arg = NEW(Actual_parameter, (false, expr));
@@ -6135,7 +6139,7 @@ yyreduce:
   case 263:
 
 /* Line 1455 of yacc.c  */
-#line 2227 "src/generated_src/php_parser.ypp"
+#line 2231 "src/generated_src/php_parser.ypp"
     {
 			Actual_parameter* arg = NEW(Actual_parameter, (false, (yyvsp[(2) - (3)].ast_expr)));
 			(yyval.ast_method_invocation) = NEW(Method_invocation,
@@ -6149,7 +6153,7 @@ yyreduce:
   case 264:
 
 /* Line 1455 of yacc.c  */
-#line 2243 "src/generated_src/php_parser.ypp"
+#line 2247 "src/generated_src/php_parser.ypp"
     {
 			List<Actual_parameter*>* args = new List<Actual_parameter*>;
 			
@@ -6161,7 +6165,7 @@ yyreduce:
   case 265:
 
 /* Line 1455 of yacc.c  */
-#line 2250 "src/generated_src/php_parser.ypp"
+#line 2254 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_new) = NEW(New, (NULL, (yyvsp[(2) - (3)].list_ast_actual_parameter)));
 		;}
@@ -6170,7 +6174,7 @@ yyreduce:
   case 266:
 
 /* Line 1455 of yacc.c  */
-#line 2257 "src/generated_src/php_parser.ypp"
+#line 2261 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_expr) = (yyvsp[(1) - (1)].token_int);
 		;}
@@ -6179,7 +6183,7 @@ yyreduce:
   case 267:
 
 /* Line 1455 of yacc.c  */
-#line 2261 "src/generated_src/php_parser.ypp"
+#line 2265 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_expr) = (yyvsp[(1) - (1)].token_real);
 		;}
@@ -6188,7 +6192,7 @@ yyreduce:
   case 268:
 
 /* Line 1455 of yacc.c  */
-#line 2265 "src/generated_src/php_parser.ypp"
+#line 2269 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_expr) = (yyvsp[(1) - (1)].token_string);
 		;}
@@ -6197,7 +6201,7 @@ yyreduce:
   case 269:
 
 /* Line 1455 of yacc.c  */
-#line 2269 "src/generated_src/php_parser.ypp"
+#line 2273 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_expr) = (yyvsp[(1) - (1)].token_bool);
 		;}
@@ -6206,7 +6210,7 @@ yyreduce:
   case 270:
 
 /* Line 1455 of yacc.c  */
-#line 2273 "src/generated_src/php_parser.ypp"
+#line 2277 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_expr) = (yyvsp[(1) - (1)].token_bool);
 		;}
@@ -6215,7 +6219,7 @@ yyreduce:
   case 271:
 
 /* Line 1455 of yacc.c  */
-#line 2277 "src/generated_src/php_parser.ypp"
+#line 2281 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_expr) = (yyvsp[(1) - (1)].token_null);
 		;}
@@ -6224,7 +6228,7 @@ yyreduce:
   case 272:
 
 /* Line 1455 of yacc.c  */
-#line 2281 "src/generated_src/php_parser.ypp"
+#line 2285 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_expr) = (yyvsp[(1) - (1)].token_int);
 		;}
@@ -6233,7 +6237,7 @@ yyreduce:
   case 273:
 
 /* Line 1455 of yacc.c  */
-#line 2285 "src/generated_src/php_parser.ypp"
+#line 2289 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_expr) = (yyvsp[(1) - (1)].token_string);
 		;}
@@ -6242,7 +6246,7 @@ yyreduce:
   case 274:
 
 /* Line 1455 of yacc.c  */
-#line 2289 "src/generated_src/php_parser.ypp"
+#line 2293 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_expr) = (yyvsp[(1) - (1)].token_string);
 		;}
@@ -6251,7 +6255,7 @@ yyreduce:
   case 275:
 
 /* Line 1455 of yacc.c  */
-#line 2293 "src/generated_src/php_parser.ypp"
+#line 2297 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_expr) = (yyvsp[(1) - (1)].token_string);
 		;}
@@ -6260,7 +6264,7 @@ yyreduce:
   case 276:
 
 /* Line 1455 of yacc.c  */
-#line 2297 "src/generated_src/php_parser.ypp"
+#line 2301 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_expr) = (yyvsp[(1) - (1)].token_string);
 		;}
@@ -6269,7 +6273,7 @@ yyreduce:
   case 277:
 
 /* Line 1455 of yacc.c  */
-#line 2304 "src/generated_src/php_parser.ypp"
+#line 2308 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_expr) = (yyvsp[(1) - (1)].ast_expr);
 		;}
@@ -6278,7 +6282,7 @@ yyreduce:
   case 278:
 
 /* Line 1455 of yacc.c  */
-#line 2308 "src/generated_src/php_parser.ypp"
+#line 2312 "src/generated_src/php_parser.ypp"
     {
 			CONSTANT_NAME* name = new CONSTANT_NAME((yyvsp[(1) - (1)].string));
 			(yyval.ast_expr) = NEW(Constant, (NULL, name));
@@ -6288,7 +6292,7 @@ yyreduce:
   case 279:
 
 /* Line 1455 of yacc.c  */
-#line 2313 "src/generated_src/php_parser.ypp"
+#line 2317 "src/generated_src/php_parser.ypp"
     {
 			// We simply ignore the +
 			(yyval.ast_expr) = (yyvsp[(2) - (2)].ast_expr);
@@ -6298,7 +6302,7 @@ yyreduce:
   case 280:
 
 /* Line 1455 of yacc.c  */
-#line 2318 "src/generated_src/php_parser.ypp"
+#line 2322 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_expr) = NEW(Unary_op, ((yyvsp[(2) - (2)].ast_expr), "-"));
 		;}
@@ -6307,7 +6311,7 @@ yyreduce:
   case 281:
 
 /* Line 1455 of yacc.c  */
-#line 2322 "src/generated_src/php_parser.ypp"
+#line 2326 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_expr) = NEW(Array, ((yyvsp[(3) - (4)].list_ast_array_elem)));
 		;}
@@ -6316,7 +6320,7 @@ yyreduce:
   case 282:
 
 /* Line 1455 of yacc.c  */
-#line 2326 "src/generated_src/php_parser.ypp"
+#line 2330 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_expr) = (yyvsp[(1) - (1)].ast_constant);
 		;}
@@ -6325,7 +6329,7 @@ yyreduce:
   case 283:
 
 /* Line 1455 of yacc.c  */
-#line 2333 "src/generated_src/php_parser.ypp"
+#line 2337 "src/generated_src/php_parser.ypp"
     {
 			CLASS_NAME* class_name = NEW (CLASS_NAME, (yyvsp[(1) - (3)].string));
 			CONSTANT_NAME* constant = new CONSTANT_NAME((yyvsp[(3) - (3)].string));
@@ -6337,7 +6341,7 @@ yyreduce:
   case 284:
 
 /* Line 1455 of yacc.c  */
-#line 2343 "src/generated_src/php_parser.ypp"
+#line 2347 "src/generated_src/php_parser.ypp"
     {
 			CONSTANT_NAME* name = new CONSTANT_NAME((yyvsp[(1) - (1)].string));
 
@@ -6348,7 +6352,7 @@ yyreduce:
   case 285:
 
 /* Line 1455 of yacc.c  */
-#line 2349 "src/generated_src/php_parser.ypp"
+#line 2353 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_expr) = (yyvsp[(1) - (1)].ast_constant);
 		;}
@@ -6357,7 +6361,7 @@ yyreduce:
   case 286:
 
 /* Line 1455 of yacc.c  */
-#line 2353 "src/generated_src/php_parser.ypp"
+#line 2357 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_expr) = (yyvsp[(1) - (1)].ast_expr);
 		;}
@@ -6366,7 +6370,7 @@ yyreduce:
   case 287:
 
 /* Line 1455 of yacc.c  */
-#line 2360 "src/generated_src/php_parser.ypp"
+#line 2364 "src/generated_src/php_parser.ypp"
     {
 			(yyval.list_ast_array_elem) = new List<Array_elem*>;
 		;}
@@ -6375,7 +6379,7 @@ yyreduce:
   case 288:
 
 /* Line 1455 of yacc.c  */
-#line 2364 "src/generated_src/php_parser.ypp"
+#line 2368 "src/generated_src/php_parser.ypp"
     {
 			(yyval.list_ast_array_elem) = (yyvsp[(1) - (2)].list_ast_array_elem);
 		;}
@@ -6384,7 +6388,7 @@ yyreduce:
   case 291:
 
 /* Line 1455 of yacc.c  */
-#line 2379 "src/generated_src/php_parser.ypp"
+#line 2383 "src/generated_src/php_parser.ypp"
     {
 			Array_elem* elem = NEW(Array_elem, ((yyvsp[(3) - (5)].ast_expr), false, (yyvsp[(5) - (5)].ast_expr)));
 			(yyvsp[(1) - (5)].list_ast_array_elem)->push_back(elem);
@@ -6396,7 +6400,7 @@ yyreduce:
   case 292:
 
 /* Line 1455 of yacc.c  */
-#line 2386 "src/generated_src/php_parser.ypp"
+#line 2390 "src/generated_src/php_parser.ypp"
     {
 			Array_elem* elem = NEW(Array_elem, (NULL, false, (yyvsp[(3) - (3)].ast_expr)));
 			(yyvsp[(1) - (3)].list_ast_array_elem)->push_back(elem);
@@ -6408,7 +6412,7 @@ yyreduce:
   case 293:
 
 /* Line 1455 of yacc.c  */
-#line 2393 "src/generated_src/php_parser.ypp"
+#line 2397 "src/generated_src/php_parser.ypp"
     {
 			List<Array_elem*>* list = new List<Array_elem*>;
 			Array_elem* elem = NEW(Array_elem, ((yyvsp[(1) - (3)].ast_expr), false, (yyvsp[(3) - (3)].ast_expr)));
@@ -6421,7 +6425,7 @@ yyreduce:
   case 294:
 
 /* Line 1455 of yacc.c  */
-#line 2401 "src/generated_src/php_parser.ypp"
+#line 2405 "src/generated_src/php_parser.ypp"
     {
 			List<Array_elem*>* list = new List<Array_elem*>;
 			Array_elem* elem = NEW(Array_elem, (NULL, false, (yyvsp[(1) - (1)].ast_expr)));
@@ -6434,7 +6438,7 @@ yyreduce:
   case 295:
 
 /* Line 1455 of yacc.c  */
-#line 2412 "src/generated_src/php_parser.ypp"
+#line 2416 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_expr) = (yyvsp[(1) - (1)].ast_expr);
 		;}
@@ -6443,7 +6447,7 @@ yyreduce:
   case 296:
 
 /* Line 1455 of yacc.c  */
-#line 2416 "src/generated_src/php_parser.ypp"
+#line 2420 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_expr) = (yyvsp[(1) - (1)].ast_expr);
 		;}
@@ -6452,7 +6456,7 @@ yyreduce:
   case 297:
 
 /* Line 1455 of yacc.c  */
-#line 2423 "src/generated_src/php_parser.ypp"
+#line 2427 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_expr) = (yyvsp[(1) - (1)].ast_expr);
 		;}
@@ -6461,7 +6465,7 @@ yyreduce:
   case 298:
 
 /* Line 1455 of yacc.c  */
-#line 2430 "src/generated_src/php_parser.ypp"
+#line 2434 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_expr) = (yyvsp[(1) - (1)].ast_expr);
 		;}
@@ -6470,7 +6474,7 @@ yyreduce:
   case 299:
 
 /* Line 1455 of yacc.c  */
-#line 2437 "src/generated_src/php_parser.ypp"
+#line 2441 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_expr) = (yyvsp[(1) - (1)].ast_expr);
 		;}
@@ -6479,7 +6483,7 @@ yyreduce:
   case 300:
 
 /* Line 1455 of yacc.c  */
-#line 2461 "src/generated_src/php_parser.ypp"
+#line 2465 "src/generated_src/php_parser.ypp"
     {
 			List<Expr*>::iterator i;
 			for(i = (yyvsp[(2) - (2)].list_ast_expr)->begin(); i != (yyvsp[(2) - (2)].list_ast_expr)->end(); i++)
@@ -6516,7 +6520,7 @@ yyreduce:
   case 301:
 
 /* Line 1455 of yacc.c  */
-#line 2493 "src/generated_src/php_parser.ypp"
+#line 2497 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_expr) = (yyvsp[(1) - (1)].ast_expr);
 		;}
@@ -6525,7 +6529,7 @@ yyreduce:
   case 302:
 
 /* Line 1455 of yacc.c  */
-#line 2504 "src/generated_src/php_parser.ypp"
+#line 2508 "src/generated_src/php_parser.ypp"
     {
 			(yyvsp[(1) - (2)].list_ast_expr)->push_back((yyvsp[(2) - (2)].ast_expr));
 			
@@ -6536,7 +6540,7 @@ yyreduce:
   case 303:
 
 /* Line 1455 of yacc.c  */
-#line 2510 "src/generated_src/php_parser.ypp"
+#line 2514 "src/generated_src/php_parser.ypp"
     {
 			List<Expr*>* props = new List<Expr*>;
 			props->push_back((yyvsp[(1) - (1)].ast_expr));
@@ -6548,7 +6552,7 @@ yyreduce:
   case 304:
 
 /* Line 1455 of yacc.c  */
-#line 2539 "src/generated_src/php_parser.ypp"
+#line 2543 "src/generated_src/php_parser.ypp"
     {
 			if((yyvsp[(3) - (3)].list_ast_actual_parameter))
 			{
@@ -6588,7 +6592,7 @@ yyreduce:
   case 305:
 
 /* Line 1455 of yacc.c  */
-#line 2577 "src/generated_src/php_parser.ypp"
+#line 2581 "src/generated_src/php_parser.ypp"
     {
 			(yyval.list_ast_actual_parameter) = (yyvsp[(2) - (3)].list_ast_actual_parameter);
 		;}
@@ -6597,7 +6601,7 @@ yyreduce:
   case 306:
 
 /* Line 1455 of yacc.c  */
-#line 2581 "src/generated_src/php_parser.ypp"
+#line 2585 "src/generated_src/php_parser.ypp"
     {
 			(yyval.list_ast_actual_parameter) = NULL;
 		;}
@@ -6606,7 +6610,7 @@ yyreduce:
   case 307:
 
 /* Line 1455 of yacc.c  */
-#line 2588 "src/generated_src/php_parser.ypp"
+#line 2592 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_variable) = (yyvsp[(1) - (1)].ast_variable);
 		;}
@@ -6615,7 +6619,7 @@ yyreduce:
   case 308:
 
 /* Line 1455 of yacc.c  */
-#line 2592 "src/generated_src/php_parser.ypp"
+#line 2596 "src/generated_src/php_parser.ypp"
     {
 			for(long i = 0; i < (yyvsp[(1) - (2)].integer)->value(); i++)
 			{
@@ -6629,7 +6633,7 @@ yyreduce:
   case 309:
 
 /* Line 1455 of yacc.c  */
-#line 2604 "src/generated_src/php_parser.ypp"
+#line 2608 "src/generated_src/php_parser.ypp"
     {
 			(yyvsp[(3) - (3)].ast_variable)->target = (yyvsp[(1) - (3)].token_class_name);
 			(yyval.ast_variable) = (yyvsp[(3) - (3)].ast_variable);
@@ -6639,7 +6643,7 @@ yyreduce:
   case 310:
 
 /* Line 1455 of yacc.c  */
-#line 2612 "src/generated_src/php_parser.ypp"
+#line 2616 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_expr) = (yyvsp[(1) - (1)].ast_variable);
 		;}
@@ -6648,7 +6652,7 @@ yyreduce:
   case 311:
 
 /* Line 1455 of yacc.c  */
-#line 2616 "src/generated_src/php_parser.ypp"
+#line 2620 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_expr) = (yyvsp[(1) - (1)].ast_method_invocation);
 		;}
@@ -6657,7 +6661,7 @@ yyreduce:
   case 312:
 
 /* Line 1455 of yacc.c  */
-#line 2623 "src/generated_src/php_parser.ypp"
+#line 2627 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_variable) = (yyvsp[(1) - (1)].ast_variable);
 		;}
@@ -6666,7 +6670,7 @@ yyreduce:
   case 313:
 
 /* Line 1455 of yacc.c  */
-#line 2627 "src/generated_src/php_parser.ypp"
+#line 2631 "src/generated_src/php_parser.ypp"
     {
 			for(long i = 0; i < (yyvsp[(1) - (2)].integer)->value(); i++)
 			{
@@ -6680,7 +6684,7 @@ yyreduce:
   case 314:
 
 /* Line 1455 of yacc.c  */
-#line 2636 "src/generated_src/php_parser.ypp"
+#line 2640 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_variable) = (yyvsp[(1) - (1)].ast_variable);
 		;}
@@ -6689,7 +6693,7 @@ yyreduce:
   case 315:
 
 /* Line 1455 of yacc.c  */
-#line 2643 "src/generated_src/php_parser.ypp"
+#line 2647 "src/generated_src/php_parser.ypp"
     {
 			(yyvsp[(1) - (4)].ast_variable)->array_indices->push_back((yyvsp[(3) - (4)].ast_expr));
 			(yyval.ast_variable) = (yyvsp[(1) - (4)].ast_variable);
@@ -6699,7 +6703,7 @@ yyreduce:
   case 316:
 
 /* Line 1455 of yacc.c  */
-#line 2648 "src/generated_src/php_parser.ypp"
+#line 2652 "src/generated_src/php_parser.ypp"
     {
 			if((yyvsp[(3) - (4)].ast_expr) != NULL)
 				(yyvsp[(3) - (4)].ast_expr)->attrs->set_true("phc.unparser.index_curlies");
@@ -6712,7 +6716,7 @@ yyreduce:
   case 317:
 
 /* Line 1455 of yacc.c  */
-#line 2656 "src/generated_src/php_parser.ypp"
+#line 2660 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_variable) = NEW(Variable, ((yyvsp[(1) - (1)].ast_variable_name)));
 		;}
@@ -6721,7 +6725,7 @@ yyreduce:
   case 318:
 
 /* Line 1455 of yacc.c  */
-#line 2663 "src/generated_src/php_parser.ypp"
+#line 2667 "src/generated_src/php_parser.ypp"
     {
 			VARIABLE_NAME* var = new VARIABLE_NAME((yyvsp[(1) - (1)].string));
 			(yyval.ast_variable_name) = var;
@@ -6731,7 +6735,7 @@ yyreduce:
   case 319:
 
 /* Line 1455 of yacc.c  */
-#line 2668 "src/generated_src/php_parser.ypp"
+#line 2672 "src/generated_src/php_parser.ypp"
     {
 			(yyvsp[(3) - (4)].ast_expr)->attrs->set_true("phc.unparser.needs_user_curlies");
 			(yyval.ast_variable_name) = NEW(Reflection, ((yyvsp[(3) - (4)].ast_expr)));
@@ -6741,7 +6745,7 @@ yyreduce:
   case 320:
 
 /* Line 1455 of yacc.c  */
-#line 2676 "src/generated_src/php_parser.ypp"
+#line 2680 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_expr) = NULL;
 		;}
@@ -6750,7 +6754,7 @@ yyreduce:
   case 321:
 
 /* Line 1455 of yacc.c  */
-#line 2680 "src/generated_src/php_parser.ypp"
+#line 2684 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_expr) = (yyvsp[(1) - (1)].ast_expr);
 		;}
@@ -6759,7 +6763,7 @@ yyreduce:
   case 322:
 
 /* Line 1455 of yacc.c  */
-#line 2687 "src/generated_src/php_parser.ypp"
+#line 2691 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_variable) = (yyvsp[(1) - (1)].ast_variable);
 		;}
@@ -6768,7 +6772,7 @@ yyreduce:
   case 323:
 
 /* Line 1455 of yacc.c  */
-#line 2691 "src/generated_src/php_parser.ypp"
+#line 2695 "src/generated_src/php_parser.ypp"
     {
 			// This is a "normal" variable (which includes a $), i.e. $x->$y
 			// So, we need to add a level of indirection
@@ -6779,7 +6783,7 @@ yyreduce:
   case 324:
 
 /* Line 1455 of yacc.c  */
-#line 2703 "src/generated_src/php_parser.ypp"
+#line 2707 "src/generated_src/php_parser.ypp"
     {
 			(yyvsp[(1) - (4)].ast_variable)->array_indices->push_back((yyvsp[(3) - (4)].ast_expr));
 			(yyval.ast_variable) = (yyvsp[(1) - (4)].ast_variable);
@@ -6789,7 +6793,7 @@ yyreduce:
   case 325:
 
 /* Line 1455 of yacc.c  */
-#line 2708 "src/generated_src/php_parser.ypp"
+#line 2712 "src/generated_src/php_parser.ypp"
     {
 			if((yyvsp[(3) - (4)].ast_expr) != NULL)
 				(yyvsp[(3) - (4)].ast_expr)->attrs->set_true("phc.unparser.index_curlies");
@@ -6802,7 +6806,7 @@ yyreduce:
   case 326:
 
 /* Line 1455 of yacc.c  */
-#line 2716 "src/generated_src/php_parser.ypp"
+#line 2720 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_variable) = NEW(Variable, ((yyvsp[(1) - (1)].ast_variable_name)));
 		;}
@@ -6811,7 +6815,7 @@ yyreduce:
   case 327:
 
 /* Line 1455 of yacc.c  */
-#line 2726 "src/generated_src/php_parser.ypp"
+#line 2730 "src/generated_src/php_parser.ypp"
     {
 			VARIABLE_NAME* var = new VARIABLE_NAME((yyvsp[(1) - (1)].string));
 			(yyval.ast_variable_name) = var;
@@ -6821,7 +6825,7 @@ yyreduce:
   case 328:
 
 /* Line 1455 of yacc.c  */
-#line 2731 "src/generated_src/php_parser.ypp"
+#line 2735 "src/generated_src/php_parser.ypp"
     {
 			(yyvsp[(2) - (3)].ast_expr)->attrs->set_true("phc.unparser.needs_user_curlies");
 			(yyval.ast_variable_name) = NEW(Reflection, ((yyvsp[(2) - (3)].ast_expr)));
@@ -6831,7 +6835,7 @@ yyreduce:
   case 329:
 
 /* Line 1455 of yacc.c  */
-#line 2742 "src/generated_src/php_parser.ypp"
+#line 2746 "src/generated_src/php_parser.ypp"
     {
 			(yyval.integer) = new Integer(1);
 		;}
@@ -6840,7 +6844,7 @@ yyreduce:
   case 330:
 
 /* Line 1455 of yacc.c  */
-#line 2746 "src/generated_src/php_parser.ypp"
+#line 2750 "src/generated_src/php_parser.ypp"
     {
 			(*(yyvsp[(1) - (2)].integer))++;
 			(yyval.integer) = (yyvsp[(1) - (2)].integer);
@@ -6850,7 +6854,7 @@ yyreduce:
   case 331:
 
 /* Line 1455 of yacc.c  */
-#line 2754 "src/generated_src/php_parser.ypp"
+#line 2758 "src/generated_src/php_parser.ypp"
     {
 			(yyvsp[(1) - (3)].ast_nested_list_elements)->list_elements->push_back((yyvsp[(3) - (3)].ast_list_element));
 			
@@ -6861,7 +6865,7 @@ yyreduce:
   case 332:
 
 /* Line 1455 of yacc.c  */
-#line 2760 "src/generated_src/php_parser.ypp"
+#line 2764 "src/generated_src/php_parser.ypp"
     {
 			List<List_element*>* elements = new List<List_element*>;
 			elements->push_back((yyvsp[(1) - (1)].ast_list_element));
@@ -6873,7 +6877,7 @@ yyreduce:
   case 333:
 
 /* Line 1455 of yacc.c  */
-#line 2773 "src/generated_src/php_parser.ypp"
+#line 2777 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_list_element) = expect_variable((yyvsp[(1) - (1)].ast_expr));
 		;}
@@ -6882,7 +6886,7 @@ yyreduce:
   case 334:
 
 /* Line 1455 of yacc.c  */
-#line 2777 "src/generated_src/php_parser.ypp"
+#line 2781 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_list_element) = (yyvsp[(3) - (4)].ast_nested_list_elements);
 		;}
@@ -6891,7 +6895,7 @@ yyreduce:
   case 335:
 
 /* Line 1455 of yacc.c  */
-#line 2781 "src/generated_src/php_parser.ypp"
+#line 2785 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_list_element) = NULL;
 		;}
@@ -6900,7 +6904,7 @@ yyreduce:
   case 336:
 
 /* Line 1455 of yacc.c  */
-#line 2788 "src/generated_src/php_parser.ypp"
+#line 2792 "src/generated_src/php_parser.ypp"
     {
 			(yyval.list_ast_array_elem) = new List<Array_elem*>;
 		;}
@@ -6909,7 +6913,7 @@ yyreduce:
   case 337:
 
 /* Line 1455 of yacc.c  */
-#line 2792 "src/generated_src/php_parser.ypp"
+#line 2796 "src/generated_src/php_parser.ypp"
     {
 			(yyval.list_ast_array_elem) = (yyvsp[(1) - (2)].list_ast_array_elem);
 		;}
@@ -6918,7 +6922,7 @@ yyreduce:
   case 338:
 
 /* Line 1455 of yacc.c  */
-#line 2802 "src/generated_src/php_parser.ypp"
+#line 2806 "src/generated_src/php_parser.ypp"
     {
 			Array_elem* elem = NEW(Array_elem, ((yyvsp[(3) - (5)].ast_expr), false, (yyvsp[(5) - (5)].ast_expr)));
 			(yyvsp[(1) - (5)].list_ast_array_elem)->push_back(elem);
@@ -6930,7 +6934,7 @@ yyreduce:
   case 339:
 
 /* Line 1455 of yacc.c  */
-#line 2809 "src/generated_src/php_parser.ypp"
+#line 2813 "src/generated_src/php_parser.ypp"
     {
 			Array_elem* elem = NEW(Array_elem, (NULL, false, (yyvsp[(3) - (3)].ast_expr)));
 			(yyvsp[(1) - (3)].list_ast_array_elem)->push_back(elem);
@@ -6942,7 +6946,7 @@ yyreduce:
   case 340:
 
 /* Line 1455 of yacc.c  */
-#line 2816 "src/generated_src/php_parser.ypp"
+#line 2820 "src/generated_src/php_parser.ypp"
     {
 			List<Array_elem*>* list = new List<Array_elem*>;
 			Array_elem* elem = NEW(Array_elem, ((yyvsp[(1) - (3)].ast_expr), false, (yyvsp[(3) - (3)].ast_expr)));
@@ -6955,7 +6959,7 @@ yyreduce:
   case 341:
 
 /* Line 1455 of yacc.c  */
-#line 2824 "src/generated_src/php_parser.ypp"
+#line 2828 "src/generated_src/php_parser.ypp"
     {
 			List<Array_elem*>* list = new List<Array_elem*>;
 			Array_elem* elem = NEW(Array_elem, (NULL, false, (yyvsp[(1) - (1)].ast_expr)));
@@ -6968,7 +6972,7 @@ yyreduce:
   case 342:
 
 /* Line 1455 of yacc.c  */
-#line 2832 "src/generated_src/php_parser.ypp"
+#line 2836 "src/generated_src/php_parser.ypp"
     {
 			Array_elem* elem = 
 				NEW(Array_elem, ((yyvsp[(3) - (6)].ast_expr), true, (yyvsp[(6) - (6)].ast_expr)));
@@ -6981,7 +6985,7 @@ yyreduce:
   case 343:
 
 /* Line 1455 of yacc.c  */
-#line 2840 "src/generated_src/php_parser.ypp"
+#line 2844 "src/generated_src/php_parser.ypp"
     {
 			Array_elem* elem = 
 				NEW(Array_elem, (NULL, true, (yyvsp[(4) - (4)].ast_expr)));
@@ -6994,7 +6998,7 @@ yyreduce:
   case 344:
 
 /* Line 1455 of yacc.c  */
-#line 2848 "src/generated_src/php_parser.ypp"
+#line 2852 "src/generated_src/php_parser.ypp"
     {
 			List<Array_elem*>* list = new List<Array_elem*>;
 			Array_elem* elem = 
@@ -7008,7 +7012,7 @@ yyreduce:
   case 345:
 
 /* Line 1455 of yacc.c  */
-#line 2857 "src/generated_src/php_parser.ypp"
+#line 2861 "src/generated_src/php_parser.ypp"
     {
 			List<Array_elem*>* list = new List<Array_elem*>;
 			Array_elem* elem = 
@@ -7022,7 +7026,7 @@ yyreduce:
   case 346:
 
 /* Line 1455 of yacc.c  */
-#line 2869 "src/generated_src/php_parser.ypp"
+#line 2873 "src/generated_src/php_parser.ypp"
     {
 			METHOD_NAME* fn = NEW(METHOD_NAME, (new String("isset")));
 			(yyval.ast_method_invocation) = NEW(Method_invocation, (NULL, fn, (yyvsp[(3) - (4)].list_ast_actual_parameter)));
@@ -7032,7 +7036,7 @@ yyreduce:
   case 347:
 
 /* Line 1455 of yacc.c  */
-#line 2874 "src/generated_src/php_parser.ypp"
+#line 2878 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_method_invocation) = NEW(Method_invocation, ("empty", (yyvsp[(3) - (4)].ast_expr)));
 		;}
@@ -7041,7 +7045,7 @@ yyreduce:
   case 348:
 
 /* Line 1455 of yacc.c  */
-#line 2878 "src/generated_src/php_parser.ypp"
+#line 2882 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_method_invocation) = NEW(Method_invocation, ("include", (yyvsp[(2) - (2)].ast_expr)));
 			(yyval.ast_method_invocation)->attrs->set_true("phc.unparser.no_brackets");
@@ -7051,7 +7055,7 @@ yyreduce:
   case 349:
 
 /* Line 1455 of yacc.c  */
-#line 2883 "src/generated_src/php_parser.ypp"
+#line 2887 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_method_invocation) = NEW(Method_invocation, ("include_once", (yyvsp[(2) - (2)].ast_expr)));
 			(yyval.ast_method_invocation)->attrs->set_true("phc.unparser.no_brackets");
@@ -7061,7 +7065,7 @@ yyreduce:
   case 350:
 
 /* Line 1455 of yacc.c  */
-#line 2888 "src/generated_src/php_parser.ypp"
+#line 2892 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_method_invocation) = NEW(Method_invocation, ("eval", (yyvsp[(3) - (4)].ast_expr)));
 		;}
@@ -7070,7 +7074,7 @@ yyreduce:
   case 351:
 
 /* Line 1455 of yacc.c  */
-#line 2892 "src/generated_src/php_parser.ypp"
+#line 2896 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_method_invocation) = NEW(Method_invocation, ("require", (yyvsp[(2) - (2)].ast_expr)));
 			(yyval.ast_method_invocation)->attrs->set_true("phc.unparser.no_brackets");
@@ -7080,7 +7084,7 @@ yyreduce:
   case 352:
 
 /* Line 1455 of yacc.c  */
-#line 2897 "src/generated_src/php_parser.ypp"
+#line 2901 "src/generated_src/php_parser.ypp"
     {
 			(yyval.ast_method_invocation) = NEW(Method_invocation, ("require_once", (yyvsp[(2) - (2)].ast_expr)));
 			(yyval.ast_method_invocation)->attrs->set_true("phc.unparser.no_brackets");
@@ -7090,7 +7094,7 @@ yyreduce:
   case 353:
 
 /* Line 1455 of yacc.c  */
-#line 2905 "src/generated_src/php_parser.ypp"
+#line 2909 "src/generated_src/php_parser.ypp"
     {
 			List<Actual_parameter*>* params = new List<Actual_parameter*>;
 			
@@ -7102,7 +7106,7 @@ yyreduce:
   case 354:
 
 /* Line 1455 of yacc.c  */
-#line 2912 "src/generated_src/php_parser.ypp"
+#line 2916 "src/generated_src/php_parser.ypp"
     {
 			(yyvsp[(1) - (3)].list_ast_actual_parameter)->push_back(NEW(Actual_parameter, (false, (yyvsp[(3) - (3)].ast_expr))));
 			(yyval.list_ast_actual_parameter) = (yyvsp[(1) - (3)].list_ast_actual_parameter);
@@ -7112,7 +7116,7 @@ yyreduce:
   case 355:
 
 /* Line 1455 of yacc.c  */
-#line 2920 "src/generated_src/php_parser.ypp"
+#line 2924 "src/generated_src/php_parser.ypp"
     {
 			CONSTANT_NAME* constant = new CONSTANT_NAME((yyvsp[(3) - (3)].string));
 
@@ -7123,7 +7127,7 @@ yyreduce:
   case 356:
 
 /* Line 1455 of yacc.c  */
-#line 2933 "src/generated_src/php_parser.ypp"
+#line 2937 "src/generated_src/php_parser.ypp"
     {
 			// If there are any remaining comments, add them as a NOP
 			if(!context->last_comments.empty())
@@ -7139,7 +7143,7 @@ yyreduce:
 
 
 /* Line 1455 of yacc.c  */
-#line 7143 "src/generated/php_parser.tab.cpp"
+#line 7147 "src/generated/php_parser.tab.cpp"
       default: break;
     }
   YY_SYMBOL_PRINT ("-> $$ =", yyr1[yyn], &yyval, &yyloc);
@@ -0,0 +1,437 @@
+/*
+ * phc -- the open source PHP compiler
+ * See doc/license/README.license for licensing information
+ *
+ * Attribute garbage-collected allocations to their type and to the pass
+ * which made them, for --alloc-profile.
+ */
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <cxxabi.h>
+#include <iomanip>
+#include <map>
+#include <vector>
+
+#include "Alloc_profile.h"
+#include "lib/Object.h"
+#include "lib/error.h"
+#include "process_ir/Foreach.h"
+
+#ifndef DISABLE_GC
+#include "gc/gc.h"
+#endif
+
+using namespace std;
+
+bool alloc_profile_enabled = false;
+
+/*
+ * The profile's own data must not be allocated through the hooks it
+ * implements, so it uses the STL directly, with the system allocator. None of
+ * it points to GC objects, except the queue, which is static and so is
+ * scanned by the collector.
+ */
+
+struct Counts
+{
+	long count;
+	long bytes;
+
+	Counts ()
+	: count (0)
+	, bytes (0)
+	{
+	}
+
+	void add (long bytes)
+	{
+		this->count++;
+		this->bytes += bytes;
+	}
+};
+
+struct Scope
+{
+	string phase;
+	string name;
+	Counts allocated;
+	long peak_in_use;
+	long peak_heap;
+};
+
+// In the order they were first entered.
+static vector<Scope> scopes;
+static map<string, int> scope_index;
+static vector<int> running;
+
+static Counts outside_scopes;
+static long peak_in_use = 0;
+static long peak_heap = 0;
+
+static map<const type_info*, Counts> objects_by_type;
+static map<const type_info*, Counts> storage_by_type;
+
+// Objects whose type has not been looked up, and the scope which allocated
+// them. When the queue is full, the most recent objects are left in it, as
+// they may still be being constructed.
+#define QUEUE_SIZE 4096
+#define QUEUE_KEEP 256
+static GC_obj* queue[QUEUE_SIZE];
+static int queue_scopes[QUEUE_SIZE];
+static int queue_length = 0;
+
+// Sample the heap after this many allocations.
+#define SAMPLE_INTERVAL 4096
+static int since_sample = 0;
+
+static Counts&
+current_scope ()
+{
+	if (running.size () == 0)
+		return outside_scopes;
+
+	return scopes[running.back ()].allocated;
+}
+
+#ifndef DISABLE_GC
+
+static void
+sample_heap ()
+{
+	since_sample = 0;
+
+	long heap = GC_get_heap_size ();
+	long in_use = heap - GC_get_free_bytes ();
+
+	peak_in_use = max (peak_in_use, in_use);
+	peak_heap = max (peak_heap, heap);
+
+	foreach (int index, running)
+	{
+		scopes[index].peak_in_use = max (scopes[index].peak_in_use, in_use);
+		scopes[index].peak_heap = max (scopes[index].peak_heap, heap);
+	}
+}
+
+static void
+count_allocation ()
+{
+	if (++since_sample == SAMPLE_INTERVAL)
+		sample_heap ();
+}
+
+// Look up the types of all but the last KEEP queued objects.
+static void
+flush_queue (int keep)
+{
+	int count = queue_length - keep;
+	if (count <= 0)
+		return;
+
+	for (int i = 0; i < count; i++)
+	{
+		GC_obj* obj = queue[i];
+		void* base = GC_base (obj);
+
+		// Members of other objects are part of the other object's allocation.
+		if (base != dynamic_cast<void*> (obj))
+			continue;
+
+		long bytes = GC_size (base);
+		objects_by_type[&typeid (*obj)].add (bytes);
+
+		if (queue_scopes[i] == -1)
+			outside_scopes.add (bytes);
+		else
+			scopes[queue_scopes[i]].allocated.add (bytes);
+	}
+
+	queue_length -= count;
+	memmove (queue, queue + count, queue_length * sizeof (GC_obj*));
+	memmove (queue_scopes, queue_scopes + count, queue_length * sizeof (int));
+
+	// Don't keep anything alive that we're finished with.
+	memset (queue + queue_length, 0, count * sizeof (GC_obj*));
+}
+
+void
+alloc_profile_object (GC_obj* obj)
+{
+	// Ignore objects on the stack and in static storage.
+	if (GC_base (obj) == NULL)
+		return;
+
+	if (queue_length == QUEUE_SIZE)
+		flush_queue (QUEUE_KEEP);
+
+	queue[queue_length] = obj;
+	queue_scopes[queue_length] = running.size () ? running.back () : -1;
+	queue_length++;
+
+	count_allocation ();
+}
+
+void
+alloc_profile_forget (GC_obj* obj)
+{
+	if (GC_base (obj) == NULL)
+		return;
+
+	// Deleted objects, and objects whose constructor threw, must not be
+	// looked up later.
+	for (int i = queue_length - 1; i >= 0; i--)
+	{
+		if (queue[i] == obj)
+		{
+			queue_length--;
+			memmove (queue + i, queue + i + 1, (queue_length - i) * sizeof (GC_obj*));
+			memmove (queue_scopes + i, queue_scopes + i + 1, (queue_length - i) * sizeof (int));
+			queue[queue_length] = NULL;
+			return;
+		}
+	}
+}
+
+void
+alloc_profile_storage (const type_info& type, size_t bytes)
+{
+	storage_by_type[&type].add (bytes);
+	current_scope ().add (bytes);
+
+	count_allocation ();
+}
+
+#else
+
+static void sample_heap () {}
+static void flush_queue (int keep) {}
+void alloc_profile_object (GC_obj* obj) {}
+void alloc_profile_forget (GC_obj* obj) {}
+void alloc_profile_storage (const type_info& type, size_t bytes) {}
+
+#endif
+
+void
+Alloc_profile::enable ()
+{
+#ifndef DISABLE_GC
+	alloc_profile_enabled = true;
+	sample_heap ();
+#else
+	phc_warning ("Allocation profiling requires the garbage collector");
+#endif
+}
+
+void
+Alloc_profile::enter (string phase, string name)
+{
+	string key = phase + "/" + name;
+	if (scope_index.find (key) == scope_index.end ())
+	{
+		Scope scope;
+		scope.phase = phase;
+		scope.name = name;
+		scope.peak_in_use = 0;
+		scope.peak_heap = 0;
+
+		scope_index[key] = scopes.size ();
+		scopes.push_back (scope);
+	}
+
+	running.push_back (scope_index[key]);
+	sample_heap ();
+}
+
+void
+Alloc_profile::leave ()
+{
+	assert (running.size ());
+
+	sample_heap ();
+	running.pop_back ();
+}
+
+/*
+ * Reporting
+ */
+
+static string
+type_name (const type_info* type)
+{
+	int status;
+	char* demangled = abi::__cxa_demangle (type->name (), NULL, NULL, &status);
+	if (status != 0)
+		return type->name ();
+
+	string result = demangled;
+	free (demangled);
+	return result;
+}
+
+static string
+kind (string name, bool storage)
+{
+	if (storage)
+		return "storage";
+
+	if (name.compare (0, 5, "AST::") == 0
+		|| name.compare (0, 5, "HIR::") == 0
+		|| name.compare (0, 5, "MIR::") == 0)
+		return name.substr (0, 3);
+
+	if (name == "String")
+		return "string";
+
+	// Nearly all our templates are containers.
+	if (name.find ('<') != string::npos)
+		return "container";
+
+	return "other";
+}
+
+static string
+truncate (string name, unsigned int length)
+{
+	if (name.size () <= length)
+		return name;
+
+	return name.substr (0, length - 3) + "...";
+}
+
+static bool
+more_bytes (const pair<string, Counts>& a, const pair<string, Counts>& b)
+{
+	return a.second.bytes > b.second.bytes;
+}
+
+static void
+print_counts (ostream& os, const Counts& counts)
+{
+	os
+	<< setw (12) << counts.count
+	<< setw (12) << counts.bytes / 1024;
+}
+
+void
+Alloc_profile::print (ostream& os)
+{
+	flush_queue (0);
+	sample_heap ();
+
+	// Merge the types by name (a type can have more than one type_info if it
+	// is used in a plugin), and by kind.
+	map<string, Counts> by_type;
+	map<string, Counts> by_kind;
+	Counts total;
+
+	for (int storage = 0; storage < 2; storage++)
+	{
+		map<const type_info*, Counts>& counts = storage ? storage_by_type : objects_by_type;
+		for (map<const type_info*, Counts>::iterator i = counts.begin (); i != counts.end (); i++)
+		{
+			string name = type_name (i->first);
+			string k = kind (name, storage);
+
+			Counts& entry = by_type [k + " " + name];
+			entry.count += i->second.count;
+			entry.bytes += i->second.bytes;
+
+			by_kind[k].count += i->second.count;
+			by_kind[k].bytes += i->second.bytes;
+
+			total.count += i->second.count;
+			total.bytes += i->second.bytes;
+		}
+	}
+
+	vector<pair<string, Counts> > sorted (by_type.begin (), by_type.end ());
+	sort (sorted.begin (), sorted.end (), more_bytes);
+
+	os << "Allocations by type:" << endl;
+	os
+	<< left << setw (10) << "Kind"
+	<< setw (70) << "Type"
+	<< right << setw (12) << "Count"
+	<< setw (12) << "Bytes (KB)"
+	<< endl;
+
+	for (unsigned int i = 0; i < sorted.size () && i < 40; i++)
+	{
+		string key = sorted[i].first;
+		size_t space = key.find (' ');
+
+		os
+		<< left << setw (10) << key.substr (0, space)
+		<< setw (70) << truncate (key.substr (space + 1), 68)
+		<< right;
+		print_counts (os, sorted[i].second);
+		os << endl;
+	}
+
+	os << endl << "Allocations by kind:" << endl;
+	for (map<string, Counts>::iterator i = by_kind.begin (); i != by_kind.end (); i++)
+	{
+		os << left << setw (80) << i->first << right;
+		print_counts (os, i->second);
+		os << endl;
+	}
+	os << left << setw (80) << "total" << right;
+	print_counts (os, total);
+	os << endl;
+
+	os << endl << "Allocations by pass:" << endl;
+	os
+	<< left << setw (10) << "Phase"
+	<< setw (30) << "Pass"
+	<< right << setw (12) << "Count"
+	<< setw (12) << "Bytes (KB)"
+	<< setw (16) << "Peak used (KB)"
+	<< setw (16) << "Peak heap (KB)"
+	<< endl;
+
+	map<string, Scope> phases;
+	vector<string> phase_order;
+	foreach (Scope& scope, scopes)
+	{
+		os
+		<< left << setw (10) << scope.phase
+		<< setw (30) << truncate (scope.name, 28)
+		<< right;
+		print_counts (os, scope.allocated);
+		os
+		<< setw (16) << scope.peak_in_use / 1024
+		<< setw (16) << scope.peak_heap / 1024
+		<< endl;
+
+		if (phases.find (scope.phase) == phases.end ())
+		{
+			phases[scope.phase] = scope;
+			phase_order.push_back (scope.phase);
+		}
+
+		Scope& phase = phases[scope.phase];
+		phase.peak_in_use = max (phase.peak_in_use, scope.peak_in_use);
+		phase.peak_heap = max (phase.peak_heap, scope.peak_heap);
+	}
+
+	os << left << setw (40) << "(outside any pass)" << right;
+	print_counts (os, outside_scopes);
+	os << endl;
+
+	os << endl << "Peak heap by phase (used includes uncollected garbage):" << endl;
+	foreach (string name, phase_order)
+	{
+		os
+		<< left << setw (64) << name
+		<< right << setw (16) << phases[name].peak_in_use / 1024
+		<< setw (16) << phases[name].peak_heap / 1024
+		<< endl;
+	}
+	os
+	<< left << setw (64) << "overall"
+	<< right << setw (16) << peak_in_use / 1024
+	<< setw (16) << peak_heap / 1024
+	<< endl;
+}
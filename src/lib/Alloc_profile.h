@@ -0,0 +1,39 @@
+/*
+ * phc -- the open source PHP compiler
+ * See doc/license/README.license for licensing information
+ *
+ * Attribute garbage-collected allocations to their type and to the pass
+ * which made them, for --alloc-profile.
+ *
+ * Objects are recorded by the GC_obj constructor, and container storage by
+ * phc_allocator (see lib/Object.h). An object's type is not known until its
+ * constructor has finished, so objects are queued, and their types looked up
+ * in batches. The queue keeps its objects alive until then. Objects which are
+ * members of other objects are counted as part of the enclosing allocation.
+ *
+ * The heap in use (which includes garbage that has not yet been collected) is
+ * sampled regularly, and at the start and end of each scope, to find the peak
+ * of each pass and phase.
+ *
+ * Scopes are the entries of the Pass_timer, which calls enter and leave.
+ */
+
+#ifndef PHC_ALLOC_PROFILE_H
+#define PHC_ALLOC_PROFILE_H
+
+#include <iostream>
+#include <string>
+
+class Alloc_profile
+{
+public:
+	static void enable ();
+
+	// Attribute allocations to PHASE/NAME until the matching leave ().
+	static void enter (std::string phase, std::string name);
+	static void leave ();
+
+	static void print (std::ostream& os);
+};
+
+#endif // PHC_ALLOC_PROFILE_H
@@ -0,0 +1,139 @@
+/*
+ * phc -- the open source PHP compiler
+ * See doc/license/README.license for licensing information
+ *
+ * Region allocation for short-lived analysis data.
+ */
+
+#include <sys/mman.h>
+#include <cstdlib>
+
+#include "Arena.h"
+#include "error.h"
+
+// Chunks are allocated in multiples of this.
+#define ARENA_CHUNK_SIZE (64 * 1024)
+
+// Enough for any type we store.
+#define ARENA_ALIGNMENT (2 * sizeof (void*))
+
+bool Arena::debug = false;
+Arena* Arena::innermost = NULL;
+
+static size_t
+round_up (size_t size, size_t multiple)
+{
+	return (size + multiple - 1) / multiple * multiple;
+}
+
+Arena::Arena (Arena* outer)
+: outer (outer)
+, chunks (NULL)
+, next (NULL)
+, limit (NULL)
+{
+}
+
+Arena*
+Arena::current ()
+{
+	return innermost;
+}
+
+void
+Arena::add_chunk (size_t min_size)
+{
+	size_t size = round_up (min_size + round_up (sizeof (Chunk), ARENA_ALIGNMENT), ARENA_CHUNK_SIZE);
+
+	// Use mmap, which the collector doesn't scan, and which we can protect in
+	// debug mode.
+	void* memory = mmap (NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if (memory == MAP_FAILED)
+		phc_internal_error ("Could not allocate arena memory");
+
+	Chunk* chunk = static_cast<Chunk*> (memory);
+	chunk->next = chunks;
+	chunk->size = size;
+	chunks = chunk;
+
+	next = static_cast<char*> (memory) + round_up (sizeof (Chunk), ARENA_ALIGNMENT);
+	limit = static_cast<char*> (memory) + size;
+}
+
+void*
+Arena::allocate (size_t size)
+{
+	size = round_up (size, ARENA_ALIGNMENT);
+
+	if (next == NULL || size > (size_t)(limit - next))
+		add_chunk (size);
+
+	void* result = next;
+	next += size;
+	return result;
+}
+
+void
+Arena::release ()
+{
+	while (chunks)
+	{
+		Chunk* chunk = chunks;
+		chunks = chunk->next;
+
+		if (debug)
+		{
+			// Keep the address range, so it can't be reused by a later
+			// allocation, and any access to it faults.
+			if (mprotect (chunk, chunk->size, PROT_NONE) != 0)
+				phc_internal_error ("Could not protect arena memory");
+		}
+		else
+			munmap (chunk, chunk->size);
+	}
+
+	next = NULL;
+	limit = NULL;
+}
+
+bool
+Arena::contains (const void* p) const
+{
+	for (Chunk* chunk = chunks; chunk != NULL; chunk = chunk->next)
+	{
+		const char* start = reinterpret_cast<const char*> (chunk);
+		if (p >= start && p < start + chunk->size)
+			return true;
+	}
+
+	return false;
+}
+
+Arena_scope::Arena_scope ()
+{
+	arena = new Arena (Arena::innermost);
+	Arena::innermost = arena;
+}
+
+Arena_scope::~Arena_scope ()
+{
+	// Scopes must nest
+	assert (Arena::innermost == arena);
+
+	Arena::innermost = arena->outer;
+	arena->release ();
+}
+
+void*
+arena_allocate (size_t size)
+{
+	Arena* arena = Arena::current ();
+	if (arena)
+		return arena->allocate (size);
+
+#ifndef DISABLE_GC
+	return GC_MALLOC (size);
+#else
+	return malloc (size);
+#endif
+}
@@ -0,0 +1,149 @@
+/*
+ * phc -- the open source PHP compiler
+ * See doc/license/README.license for licensing information
+ *
+ * Region allocation for short-lived analysis data.
+ *
+ * An Arena hands out memory from large chunks, which are released all at
+ * once, and which the garbage collector neither scans nor collects. This
+ * avoids the collector marking large transient data structures, such as
+ * per-function worklists, over and over.
+ *
+ * Arenas are used through Arena_scope, which makes a new arena current for
+ * its lifetime, and arena_allocator, which allocates from the current arena
+ * (or from the GC heap if there is none). Since the arena is not scanned:
+ *
+ *	1. Data in an arena must not outlive its Arena_scope.
+ *	2. Data in an arena must only point to memory in the same arena, or to GC
+ *		objects which are kept alive by something else (for example, Edges and
+ *		Basic_blocks, which the CFG keeps alive).
+ *
+ * With --debug-arenas, released chunks are protected rather than returned to
+ * the system, so that using data after its arena has been released crashes
+ * straight away.
+ */
+
+#ifndef PHC_ARENA_H
+#define PHC_ARENA_H
+
+#include <cstddef>
+#include <new>
+
+#include "lib/Map.h"
+#include "lib/Set.h"
+
+class Arena : virtual public GC_obj
+{
+public:
+	Arena (Arena* outer);
+
+	void* allocate (size_t size);
+
+	// Free everything in the arena.
+	void release ();
+
+	bool contains (const void* p) const;
+
+	// The innermost arena, or NULL.
+	static Arena* current ();
+
+	// Protect released chunks instead of freeing them.
+	static bool debug;
+
+private:
+	friend class Arena_scope;
+
+	struct Chunk
+	{
+		Chunk* next;
+		size_t size;
+	};
+
+	Arena* outer;
+	Chunk* chunks;
+	char* next;
+	char* limit;
+
+	void add_chunk (size_t min_size);
+
+	static Arena* innermost;
+};
+
+// Make a new arena current until the end of the scope.
+class Arena_scope : virtual public GC_obj
+{
+public:
+	Arena_scope ();
+	~Arena_scope ();
+
+private:
+	Arena* arena;
+
+	// Scopes live on the stack
+	Arena_scope (const Arena_scope&);
+	void operator= (const Arena_scope&);
+};
+
+// Allocate from the current arena, or the GC heap outside any arena.
+void* arena_allocate (size_t size);
+
+// An STL allocator using arena_allocate. Memory is reclaimed when the arena is
+// released (or by the GC), so deallocate does nothing.
+template <class T>
+class arena_allocator
+{
+public:
+	typedef size_t size_type;
+	typedef ptrdiff_t difference_type;
+	typedef T* pointer;
+	typedef const T* const_pointer;
+	typedef T& reference;
+	typedef const T& const_reference;
+	typedef T value_type;
+
+	template <class U> struct rebind { typedef arena_allocator<U> other; };
+
+	arena_allocator () {}
+	arena_allocator (const arena_allocator&) {}
+	template <class U> arena_allocator (const arena_allocator<U>&) {}
+
+	pointer address (reference x) const { return &x; }
+	const_pointer address (const_reference x) const { return &x; }
+
+	pointer allocate (size_type n, const void* = 0)
+	{
+		return static_cast<pointer> (arena_allocate (n * sizeof (T)));
+	}
+
+	void deallocate (pointer, size_type) {}
+
+	size_type max_size () const { return size_t (-1) / sizeof (T); }
+
+	void construct (pointer p, const T& value) { new (p) T (value); }
+	void destroy (pointer p) { p->~T (); }
+};
+
+template <class T1, class T2>
+bool operator== (const arena_allocator<T1>&, const arena_allocator<T2>&)
+{
+	return true;
+}
+
+template <class T1, class T2>
+bool operator!= (const arena_allocator<T1>&, const arena_allocator<T2>&)
+{
+	return false;
+}
+
+// Maps and sets whose contents are allocated with arena_allocator.
+template <typename _Key, typename _Tp>
+class Arena_map : public Map<_Key, _Tp, std::tr1::hash<_Key>, std::equal_to<_Key>, arena_allocator<std::pair<const _Key, _Tp> > >
+{
+};
+
+template <typename _Tp>
+class Arena_set : public Set<_Tp, std::tr1::hash<_Tp>, std::equal_to<_Tp>, arena_allocator<_Tp> >
+{
+};
+
+#endif // PHC_ARENA_H
@@ -2,7 +2,7 @@
  * phc -- the open source PHP compiler
  * See doc/license/README.license for licensing information
  *
- * Specialized version of std::map
+ * Attributes of IR nodes.
  */
 
 #include "AttrMap.h"
@@ -10,15 +10,383 @@
 #include "Boolean.h"
 #include "Integer.h"
 
-AttrMap::AttrMap() 
-: Map<string, Object*>() 
+/*
+ * Interned keys. Keys used for booleans are also given a flag, up to the
+ * number of bits in AttrMap::present_flags. Booleans whose keys arrive after
+ * that are stored as ordinary entries.
+ */
+#define MAX_FLAGS ((int) (sizeof (unsigned long long) * 8))
+
+static Map<string, Attr_key>* key_ids = NULL;
+static Vector<string>* key_names = NULL;
+static Vector<int>* key_flags = NULL;
+static Vector<Attr_key>* flag_keys = NULL;
+static int num_flags = 0;
+
+static Attr_key LINE_NUMBER_KEY;
+static Attr_key FILENAME_KEY;
+
+// Shared filenames, and shared booleans (Booleans cannot be changed).
+static Map<string, String*>* filenames = NULL;
+static Boolean* shared_true = NULL;
+static Boolean* shared_false = NULL;
+
+static Attr_key intern (string name, bool create);
+
+static void
+init_registry ()
+{
+	if (key_ids)
+		return;
+
+	key_ids = new Map<string, Attr_key>;
+	key_names = new Vector<string>;
+	key_flags = new Vector<int>;
+	flag_keys = new Vector<Attr_key>;
+	filenames = new Map<string, String*>;
+	shared_true = new Boolean (true);
+	shared_false = new Boolean (false);
+
+	LINE_NUMBER_KEY = intern ("phc.line_number", true);
+	FILENAME_KEY = intern ("phc.filename", true);
+}
+
+// Return the key for NAME. If it isnt interned and CREATE is false, return -1.
+static Attr_key
+intern (string name, bool create)
+{
+	init_registry ();
+
+	Map<string, Attr_key>::const_iterator i = key_ids->find (name);
+	if (i != key_ids->end ())
+		return i->second;
+
+	if (!create)
+		return -1;
+
+	Attr_key result = key_names->size ();
+	key_names->push_back (name);
+	key_flags->push_back (-1);
+	(*key_ids)[name] = result;
+	return result;
+}
+
+// Return the flag for KEY, or -1 if it has none (and CREATE is false, or
+// there are no flags left).
+static int
+flag_for (Attr_key key, bool create)
+{
+	int flag = (*key_flags)[key];
+	if (flag == -1 && create && num_flags < MAX_FLAGS
+		&& key != LINE_NUMBER_KEY && key != FILENAME_KEY)
+	{
+		flag = num_flags++;
+		(*key_flags)[key] = flag;
+		flag_keys->push_back (key);
+	}
+	return flag;
+}
+
+#define BIT(FLAG) (1ULL << (FLAG))
+
+Attr_key
+AttrMap::key (string name)
+{
+	return intern (name, true);
+}
+
+string
+AttrMap::key_name (Attr_key key)
+{
+	init_registry ();
+	return (*key_names)[key];
+}
+
+AttrMap::AttrMap()
+: present_flags (0)
+, true_flags (0)
+, line_number (-1)
+, filename (NULL)
+, num_inline_entries (0)
+, more_entries (NULL)
+, snapshot (NULL)
 {
 }
 
-AttrMap::~AttrMap() 
+AttrMap::~AttrMap()
 {
 }
 
+/*
+ * Entries
+ */
+
+AttrMap::Entry*
+AttrMap::find (Attr_key key) const
+{
+	for (int i = 0; i < num_inline_entries; i++)
+		if (inline_entries[i].key == key)
+			return const_cast<Entry*> (&inline_entries[i]);
+
+	if (more_entries)
+	{
+		for (unsigned int i = 0; i < more_entries->size (); i++)
+			if ((*more_entries)[i].key == key)
+				return &(*more_entries)[i];
+	}
+
+	return NULL;
+}
+
+void
+AttrMap::add (Attr_key key, Object* value)
+{
+	Entry entry;
+	entry.key = key;
+	entry.value = value;
+
+	if (num_inline_entries < INLINE_ENTRIES)
+	{
+		inline_entries[num_inline_entries++] = entry;
+		return;
+	}
+
+	if (more_entries == NULL)
+		more_entries = new Vector<Entry>;
+
+	more_entries->push_back (entry);
+}
+
+void
+AttrMap::remove (Attr_key key)
+{
+	for (int i = 0; i < num_inline_entries; i++)
+	{
+		if (inline_entries[i].key == key)
+		{
+			// Fill the gap from the end
+			if (more_entries && more_entries->size ())
+			{
+				inline_entries[i] = more_entries->back ();
+				more_entries->pop_back ();
+			}
+			else
+			{
+				num_inline_entries--;
+				inline_entries[i] = inline_entries[num_inline_entries];
+				inline_entries[num_inline_entries].value = NULL;
+			}
+			return;
+		}
+	}
+
+	if (more_entries)
+	{
+		for (unsigned int i = 0; i < more_entries->size (); i++)
+		{
+			if ((*more_entries)[i].key == key)
+			{
+				(*more_entries)[i] = more_entries->back ();
+				more_entries->pop_back ();
+				return;
+			}
+		}
+	}
+}
+
+// Returns false if KEY cannot be stored as a flag.
+bool
+AttrMap::set_flag (Attr_key key, bool value)
+{
+	int flag = flag_for (key, true);
+	if (flag == -1)
+		return false;
+
+	present_flags |= BIT (flag);
+	if (value)
+		true_flags |= BIT (flag);
+	else
+		true_flags &= ~BIT (flag);
+
+	return true;
+}
+
+/*
+ * Map interface
+ */
+
+bool
+AttrMap::has (string name) const
+{
+	Attr_key key = intern (name, false);
+	if (key == -1)
+		return false;
+
+	if (key == LINE_NUMBER_KEY)
+		return line_number != -1;
+
+	if (key == FILENAME_KEY)
+		return filename != NULL;
+
+	int flag = flag_for (key, false);
+	if (flag != -1 && (present_flags & BIT (flag)))
+		return true;
+
+	return find (key) != NULL;
+}
+
+Object*
+AttrMap::get (string name) const
+{
+	Attr_key key = intern (name, false);
+	if (key == -1)
+		return NULL;
+
+	if (key == LINE_NUMBER_KEY)
+		return line_number == -1 ? NULL : new Integer (line_number);
+
+	if (key == FILENAME_KEY)
+		return filename;
+
+	int flag = flag_for (key, false);
+	if (flag != -1 && (present_flags & BIT (flag)))
+		return (true_flags & BIT (flag)) ? shared_true : shared_false;
+
+	Entry* entry = find (key);
+	if (entry)
+		return entry->value;
+
+	return NULL;
+}
+
+void
+AttrMap::set (string name, Object* value)
+{
+	Attr_key key = intern (name, true);
+	snapshot = NULL;
+
+	if (key == LINE_NUMBER_KEY)
+	{
+		Integer* i = dynamic_cast<Integer*> (value);
+		set_line_number (i ? i->value () : -1);
+		return;
+	}
+
+	if (key == FILENAME_KEY)
+	{
+		set_filename (dynamic_cast<String*> (value));
+		return;
+	}
+
+	// The same key may be used with different types
+	int flag = flag_for (key, false);
+	if (flag != -1)
+		present_flags &= ~BIT (flag);
+
+	if (Boolean* b = dynamic_cast<Boolean*> (value))
+	{
+		if (set_flag (key, b->value ()))
+		{
+			remove (key);
+			return;
+		}
+	}
+
+	Entry* entry = find (key);
+	if (entry)
+		entry->value = value;
+	else
+		add (key, value);
+}
+
+void
+AttrMap::erase (string name)
+{
+	Attr_key key = intern (name, false);
+	if (key == -1)
+		return;
+
+	snapshot = NULL;
+
+	if (key == LINE_NUMBER_KEY)
+		line_number = -1;
+	else if (key == FILENAME_KEY)
+		filename = NULL;
+	else
+	{
+		int flag = flag_for (key, false);
+		if (flag != -1)
+			present_flags &= ~BIT (flag);
+
+		remove (key);
+	}
+}
+
+size_t
+AttrMap::size () const
+{
+	size_t result = num_inline_entries;
+	if (more_entries)
+		result += more_entries->size ();
+
+	for (unsigned long long flags = present_flags; flags; flags &= flags - 1)
+		result++;
+
+	if (line_number != -1)
+		result++;
+
+	if (filename)
+		result++;
+
+	return result;
+}
+
+AttrMap::const_iterator
+AttrMap::begin () const
+{
+	if (snapshot == NULL)
+	{
+		init_registry ();
+		snapshot = new List<value_type>;
+
+		for (int flag = 0; flag < num_flags; flag++)
+		{
+			if (present_flags & BIT (flag))
+				snapshot->push_back (value_type (
+					key_name ((*flag_keys)[flag]),
+					(true_flags & BIT (flag)) ? shared_true : shared_false));
+		}
+
+		if (line_number != -1)
+			snapshot->push_back (value_type ("phc.line_number", new Integer (line_number)));
+
+		if (filename)
+			snapshot->push_back (value_type ("phc.filename", filename));
+
+		for (int i = 0; i < num_inline_entries; i++)
+			snapshot->push_back (value_type (key_name (inline_entries[i].key), inline_entries[i].value));
+
+		if (more_entries)
+			foreach (Entry entry, *more_entries)
+				snapshot->push_back (value_type (key_name (entry.key), entry.value));
+	}
+
+	return snapshot->begin ();
+}
+
+AttrMap::const_iterator
+AttrMap::end () const
+{
+	if (snapshot == NULL)
+		begin ();
+
+	return snapshot->end ();
+}
+
+/*
+ * Typed access
+ */
+
 Boolean* AttrMap::get_boolean(string key)
 {
 	return dyc<Boolean> (get (key));
@@ -36,36 +404,94 @@ String* AttrMap::get_string(string key)
 
 void AttrMap::set_true(string key)
 {
-	set(key, new Boolean(true));
+	init_registry ();
+	set(key, shared_true);
 }
 
 void AttrMap::set_false(string key)
 {
-	set(key, new Boolean(false));
+	init_registry ();
+	set(key, shared_false);
+}
+
+bool AttrMap::is_true(string name)
+{
+	Attr_key key = intern (name, false);
+	if (key == -1)
+		return false;
+
+	return is_true (key);
 }
 
-bool AttrMap::is_true(string key)
+bool AttrMap::is_true(Attr_key key)
 {
-	if(!has(key)) return false;
-	Boolean* ret = dyc<Boolean>((*this)[key]);
-	return ret->value();
+	int flag = flag_for (key, false);
+	if (flag != -1)
+		return (present_flags & true_flags & BIT (flag)) != 0;
+
+	// A boolean which didnt get a flag, or a key which isnt a boolean.
+	Entry* entry = find (key);
+	if (entry == NULL)
+		return false;
+
+	return dyc<Boolean> (entry->value)->value ();
+}
+
+int
+AttrMap::get_line_number ()
+{
+	return line_number;
+}
+
+void
+AttrMap::set_line_number (int line_number)
+{
+	snapshot = NULL;
+	this->line_number = line_number;
+}
+
+String*
+AttrMap::get_filename ()
+{
+	return filename;
+}
+
+void
+AttrMap::set_filename (String* filename)
+{
+	init_registry ();
+	snapshot = NULL;
+
+	if (filename == NULL)
+	{
+		this->filename = NULL;
+		return;
+	}
+
+	String* shared = filenames->get (*filename);
+	if (shared == NULL)
+	{
+		shared = filename->clone ();
+		(*filenames)[*filename] = shared;
+	}
+
+	this->filename = shared;
 }
 
 void AttrMap::erase_with_prefix (string key_prefix)
 {
-	AttrMap::iterator i;
-	// erasing using an iterator may invalidate the iterator
-	for(i = begin(); i != end(); )
+	List<string> doomed;
+
+	string key;
+	Object* value;
+	foreach (boost::tie (key, value), *this)
 	{
-		if ((*i).first.find (key_prefix, 0) != string::npos)
-		{
-			string key = (*i).first;
-			i++; // advance the iterator before deleting
-			erase (key);
-		}
-		else
-			i++;
+		if (key.find (key_prefix, 0) != string::npos)
+			doomed.push_back (key);
 	}
+
+	foreach (string key, doomed)
+		erase (key);
 }
 
 AttrMap*
@@ -79,11 +505,36 @@ AttrMap::clone()
 void
 AttrMap::clone_all_from(AttrMap* other)
 {
-	std::string str;
-	Object* obj;
-	foreach (boost::tie (str, obj), *other)
+	snapshot = NULL;
+
+	// Flags, locations and filenames can be shared.
+	unsigned long long mask = other->present_flags;
+	present_flags |= mask;
+	true_flags = (true_flags & ~mask) | (other->true_flags & mask);
+
+	for (int flag = 0; flag < num_flags; flag++)
+		if (mask & BIT (flag))
+			remove ((*flag_keys)[flag]);
+
+	if (other->line_number != -1)
+		line_number = other->line_number;
+
+	if (other->filename)
+		filename = other->filename;
+
+	for (int i = 0; i < other->num_inline_entries; i++)
 	{
-		assert (obj != NULL);
-		set(str, obj->clone());
+		Entry entry = other->inline_entries[i];
+		assert (entry.value != NULL);
+		set (key_name (entry.key), entry.value->clone ());
+	}
+
+	if (other->more_entries)
+	{
+		foreach (Entry entry, *other->more_entries)
+		{
+			assert (entry.value != NULL);
+			set (key_name (entry.key), entry.value->clone ());
+		}
 	}
 }
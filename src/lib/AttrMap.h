@@ -1,8 +1,17 @@
 /*
  * phc -- the open source PHP compiler
  * See doc/license/README.license for licensing information
- * 
- * Specialized version of Map 
+ *
+ * Attributes of IR nodes.
+ *
+ * Every node has an AttrMap, so they are kept small. Keys are interned, and
+ * stored as small integers. Boolean attributes are bits in a bitset, the line
+ * number is stored inline, and filenames are shared between all the nodes
+ * from the same file. Other attributes are kept in a small array, which
+ * spills to a vector when it has more than a few entries.
+ *
+ * The interface is still that of a Map<std::string, Object*>. Booleans,
+ * line numbers and filenames are converted to and from objects as needed.
  */
 
 #ifndef PHC_ATTR_MAP_H
@@ -10,6 +19,7 @@
 
 #include "lib/Object.h"
 #include "lib/Map.h"
+#include "lib/Vector.h"
 #include "process_ir/IR.h"
 #include <string>
 
@@ -17,12 +27,35 @@ class String;
 class Integer;
 class Boolean;
 
-class AttrMap : public Map<std::string, Object*>
+typedef int Attr_key;
+
+class AttrMap : virtual public GC_obj
 {
 public:
 	AttrMap();
 	virtual ~AttrMap();
 
+// Interned keys
+public:
+	static Attr_key key (std::string name);
+	static std::string key_name (Attr_key key);
+
+// Map interface
+public:
+	typedef std::pair<std::string, Object*> value_type;
+	typedef List<value_type>::const_iterator const_iterator;
+	typedef const_iterator iterator;
+
+	bool has (std::string key) const;
+	Object* get (std::string key) const;
+	void set (std::string key, Object* value);
+	void erase (std::string key);
+	size_t size () const;
+
+	// Iterators are invalidated by changes to the map.
+	const_iterator begin () const;
+	const_iterator end () const;
+
 // Retrieve attributes of various types
 public:
 	Boolean* get_boolean(std::string key);
@@ -45,12 +78,20 @@ public:
 	{
 		set (key, rewrap_list <IR::Node> (list));
 	};
-	
+
 // Special support for bools
 public:
 	void set_true(std::string key);
 	void set_false(std::string key);
 	bool is_true(std::string key); // is_true returns false is not has(key)
+	bool is_true(Attr_key key);
+
+// Source locations, without boxing
+public:
+	int get_line_number (); // -1 if unknown
+	void set_line_number (int line_number);
+	String* get_filename (); // NULL if unknown
+	void set_filename (String* filename);
 
 public:
 	void erase_with_prefix (std::string key_prefix);
@@ -58,6 +99,34 @@ public:
 public:
 	AttrMap* clone();
 	void clone_all_from(AttrMap* other);
+
+private:
+	struct Entry
+	{
+		Attr_key key;
+		Object* value;
+	};
+
+	// Booleans, indexed by the key's flag (see Attr_registry).
+	unsigned long long present_flags;
+	unsigned long long true_flags;
+
+	int line_number;
+	String* filename;
+
+	// Everything else
+	static const int INLINE_ENTRIES = 3;
+	Entry inline_entries[INLINE_ENTRIES];
+	int num_inline_entries;
+	Vector<Entry>* more_entries;
+
+	// Built on demand for iteration
+	mutable List<value_type>* snapshot;
+
+	Entry* find (Attr_key key) const;
+	void remove (Attr_key key);
+	void add (Attr_key key, Object* value);
+	bool set_flag (Attr_key key, bool value);
 };
 
 #endif // PHC_ATTR_MAP_H
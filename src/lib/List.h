@@ -101,7 +101,8 @@ struct equals_algorithm_selector<true, true, true>
 	template<typename T> 
 	static bool equals (T object1, T object2)
 	{ 
-		return object1->equals (object2); 
+		// Shared objects are trivially equal
+		return object1 == object2 || object1->equals (object2); 
 	} 
 };
 
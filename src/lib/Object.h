@@ -11,6 +11,8 @@
 
 #include "config.h"
 #include <assert.h>
+#include <cstddef>
+#include <typeinfo>
 
 #ifndef NULL
 #define NULL 0L
@@ -52,11 +54,59 @@
  * TODO: what does libgccpp do for us? It doesnt fix the bugs by magic...
  */
 
+class GC_obj;
+
+/*
+ * Allocation profiling (--alloc-profile): see lib/Alloc_profile.h. These are
+ * called for every object and container allocation, so only the flag is
+ * checked inline.
+ */
+extern bool alloc_profile_enabled;
+void alloc_profile_object (GC_obj* obj);
+void alloc_profile_forget (GC_obj* obj);
+void alloc_profile_storage (const std::type_info& type, size_t bytes);
+
 // Avoid proliferation of USE_GC by defining the allocator here.
 #ifndef DISABLE_GC
 #include "gc/gc_cpp.h"
 #include "gc/gc_allocator.h"
-#define phc_allocator gc_allocator
+
+// A gc_allocator which records the storage it allocates when profiling.
+template <class T>
+class profiled_gc_allocator : public gc_allocator<T>
+{
+public:
+	typedef typename gc_allocator<T>::pointer pointer;
+	typedef typename gc_allocator<T>::size_type size_type;
+
+	template <class U> struct rebind { typedef profiled_gc_allocator<U> other; };
+
+	profiled_gc_allocator () {}
+	profiled_gc_allocator (const profiled_gc_allocator&) {}
+	template <class U> profiled_gc_allocator (const profiled_gc_allocator<U>&) {}
+
+	pointer allocate (size_type n, const void* hint = 0)
+	{
+		if (alloc_profile_enabled)
+			alloc_profile_storage (typeid (T), n * sizeof (T));
+
+		return gc_allocator<T>::allocate (n, hint);
+	}
+};
+
+template <class T1, class T2>
+bool operator== (const profiled_gc_allocator<T1>&, const profiled_gc_allocator<T2>&)
+{
+	return true;
+}
+
+template <class T1, class T2>
+bool operator!= (const profiled_gc_allocator<T1>&, const profiled_gc_allocator<T2>&)
+{
+	return false;
+}
+
+#define phc_allocator profiled_gc_allocator
 #else
 #define phc_allocator std::allocator
 #endif
@@ -70,7 +120,23 @@ class GC_obj
 {
 // Make Obj a virtual base (required for RTTI and dynamic casts)
 public:
-	virtual ~GC_obj() {}
+	GC_obj ()
+	{
+		if (alloc_profile_enabled)
+			alloc_profile_object (this);
+	}
+
+	GC_obj (const GC_obj&)
+	{
+		if (alloc_profile_enabled)
+			alloc_profile_object (this);
+	}
+
+	virtual ~GC_obj()
+	{
+		if (alloc_profile_enabled)
+			alloc_profile_forget (this);
+	}
 };
 
 class Object : public GC_obj
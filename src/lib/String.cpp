@@ -9,6 +9,7 @@
 
 #include "String.h" 
 #include "AttrMap.h"
+#include "Map.h"
 
 using std::string;
 
@@ -45,6 +46,11 @@ String* String::clone()
 	return new String(*this);
 }
 
+bool String::is_interned () const
+{
+	return false;
+}
+
 
 // This is a common idiom discussed all over the web. The 'correct'
 // way to do it supports locales, which is not our aim. We simply
@@ -70,3 +76,47 @@ String* s (const string& str)
 {
 	return new String (str);
 }
+
+/*
+ * Symbols
+ */
+
+Symbol::Symbol (const string& name)
+: String (name)
+, has_hash (false)
+, hash (0)
+{
+}
+
+bool Symbol::is_interned () const
+{
+	return true;
+}
+
+Symbol* Symbol::intern (const string& name)
+{
+	static Map<string, Symbol*>* symbols = new Map<string, Symbol*>;
+
+	Symbol*& result = (*symbols)[name];
+	if (result == NULL)
+		result = new Symbol (name);
+
+	return result;
+}
+
+String* intern (const string& name)
+{
+	return Symbol::intern (name);
+}
+
+unsigned long long stable_hash (const char* data, size_t size)
+{
+	unsigned long long hash = 14695981039346656037ULL;
+	for (size_t i = 0; i < size; i++)
+	{
+		hash ^= (unsigned char) data[i];
+		hash *= 1099511628211ULL;
+	}
+
+	return hash;
+}
@@ -42,11 +42,66 @@ public:
 	bool ci_compare (const string& s);
 	String* to_lower() const;
 	String* clone();
+
+	// True for Symbols (see below)
+	virtual bool is_interned () const;
 };
 
 // 'new String' must be the most typed function in phc
 String* s (const string& s);
 
+/*
+ * Identifiers (variable, method, class and field names, etc) are interned: the
+ * scanner, the IR's convenience constructors and fresh () all return the one
+ * Symbol for each distinct name. Two interned names are therefore equal iff
+ * they are the same object, and per-name data, such as the name's Zend hash,
+ * can be cached on the Symbol.
+ *
+ * Symbols are shared by every node which uses the name, so they must never be
+ * changed in place (nor their attrs used). To rename something, give it a new
+ * String.
+ */
+class Symbol : public String
+{
+public:
+	static Symbol* intern (const string& name);
+
+	bool is_interned () const;
+
+public:
+	// Set by PHP::get_hash
+	bool has_hash;
+	unsigned long hash;
+
+private:
+	Symbol (const string& name);
+};
+
+String* intern (const string& name);
+
+// Interned strings are compared by address. Other Strings (for example, names
+// which have been cloned) fall back to comparing characters.
+inline bool operator== (const String& a, const String& b)
+{
+	if (&a == &b)
+		return true;
+
+	if (a.is_interned () && b.is_interned ())
+		return false;
+
+	return static_cast<const string&> (a) == static_cast<const string&> (b);
+}
+
+inline bool operator!= (const String& a, const String& b)
+{
+	return not (a == b);
+}
+
 SET_CLONABLE(String)
 
+// A 64-bit FNV-1a hash of DATA. Unlike the hashes of Symbols (see
+// PHP::get_hash) or of STL strings, it is the same for every build and run
+// of phc, so it can be kept in files.
+unsigned long long stable_hash (const char* data, size_t size);
+
 #endif // PHC_STRING_H
@@ -0,0 +1,96 @@
+/*
+ * phc -- the open source PHP compiler
+ * See doc/license/README.license for licensing information
+ *
+ * Compile the code generator's macros when phc is built, so that phc does not
+ * parse them every time it generates C.
+ *
+ * Usage: micg_compile FILE... > MICG_templates.cpp
+ *
+ * Each FILE is named as Generate_C reads it (relative to runtime/, eg
+ * templates/templates_new.c). Its macros are parsed and checked, so that
+ * mistakes in them stop the build, and written out as C++ source, which holds
+ * them in phc's binary format and registers them as MICG_precompiled.
+ */
+
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+
+#include "codegen/MICG_gen.h"
+#include "generated/cmdline.h"
+#include "parsing/MICG_parser.h"
+#include "pass_manager/Pass_manager.h"
+#include "process_ir/Bin_unparser.h"
+#include "process_ir/General.h"
+
+using namespace std;
+
+// Used throughout phc
+struct gengetopt_args_info args_info;
+Pass_manager* pm;
+
+// From codegen/Generate_C.cpp
+string read_file (String* filename);
+
+// Write DATA as the contents of a string literal, split over several lines.
+static void
+write_literal (ostream& out, const string& data)
+{
+	out << hex << setfill ('0');
+
+	for (size_t i = 0; i < data.size (); i++)
+	{
+		if (i % 16 == 0)
+			out << (i ? "\"\n" : "") << "\t\"";
+
+		out << "\\x" << setw (2) << (unsigned int) (unsigned char) data[i];
+	}
+
+	out << "\"\n" << dec;
+}
+
+int main (int argc, char** argv)
+{
+	if (argc < 2)
+	{
+		cerr << "Usage: micg_compile FILE..." << endl;
+		return -1;
+	}
+
+	cout
+	<< "// Generated by micg_compile. Do not edit.\n"
+	<< "\n"
+	<< "#include \"codegen/MICG_gen.h\"\n";
+
+	for (int i = 1; i < argc; i++)
+	{
+		String* filename = s(argv[i]);
+		string source = read_file (filename);
+
+		// Check them as add_macro_def would.
+		MICG_gen* micg = new MICG_gen;
+		MICG::Macro_list* macros = (new MICG_parser)->parse (source, *filename);
+		foreach (MICG::Macro* m, *macros)
+			micg->add_macro (m);
+
+		stringstream data;
+		Bin_unparser_state* state = new Bin_unparser_state;
+		bin_unparse (new MICG::All (macros), state);
+		state->finish (data);
+
+		cout
+		<< "\n"
+		<< "// " << *filename << "\n"
+		<< "static const char data_" << i << "[] =\n";
+		write_literal (cout, data.str ());
+		cout << "\t;\n";
+
+		cout
+		<< "static MICG_precompiled precompiled_" << i << " (\"" << *filename << "\", "
+		<< stable_hash (source.data (), source.size ()) << "ULL, "
+		<< "data_" << i << ", sizeof (data_" << i << ") - 1);\n";
+	}
+
+	return 0;
+}
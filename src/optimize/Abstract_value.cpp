@@ -24,25 +24,35 @@ using namespace std;
 Abstract_value::Abstract_value (const Literal* lit)
 : lit (lit)
 , types (Type_info::get_type (lit))
+, range (NULL)
 {
 }
 
 Abstract_value::Abstract_value (const Types* types)
 : lit (NULL)
 , types (types)
+, range (NULL)
 {
 }
 
-Abstract_value::Abstract_value (const Literal* lit, const Types* types)
+Abstract_value::Abstract_value (const Types* types, const Range_cell* range)
+: lit (NULL)
+, types (types)
+, range (range)
+{
+}
+
+Abstract_value::Abstract_value (const Literal* lit, const Types* types, const Range_cell* range)
 : lit (lit)
 , types (types)
+, range (range)
 {
 }
 
 Abstract_value*
 Abstract_value::unknown ()
 {
-	return new Abstract_value (NULL, NULL);
+	return new Abstract_value (NULL, NULL, NULL);
 }
 
 Abstract_value*
@@ -58,7 +68,13 @@ Abstract_value::clone () const
 	if (newtypes)
 		newtypes = newtypes->clone ();
 
-	return new Abstract_value (newlit, newtypes);
+	return new Abstract_value (newlit, newtypes, range);
+}
+
+Abstract_value*
+Abstract_value::with_range (const Range_cell* range) const
+{
+	return new Abstract_value (lit, types, range);
 }
 
 
@@ -21,6 +21,8 @@
 
 namespace MIR { class Literal; }
 
+class Range_cell;
+
 typedef Set<string> Types;
 
 class Abstract_value : virtual public GC_obj
@@ -29,9 +31,15 @@ public:
 	const MIR::Literal* const lit;
 	const Types* const types;
 
+	// The range of an integer value, from VRP. This isn't part of the lattice
+	// value (see equals ()), but it is carried with the value so that it is
+	// propagated on copies.
+	const Range_cell* const range;
+
 public:
 	Abstract_value (const MIR::Literal* lit);
 	Abstract_value (const Types* types);
+	Abstract_value (const Types* types, const Range_cell* range);
 
 	// An unknown type is awful.
 	static Abstract_value* unknown ();
@@ -44,10 +52,13 @@ public:
 	bool equals (const Abstract_value* absval) const;
 	Abstract_value* clone () const;
 
+	// Return a copy with RANGE attached.
+	Abstract_value* with_range (const Range_cell* range) const;
+
 	void dump (std::ostream& os = cdebug) const;
 
 private:
-	Abstract_value (const MIR::Literal*, const Types* types);
+	Abstract_value (const MIR::Literal*, const Types* types, const Range_cell* range = NULL);
 };
 
 namespace Type_info
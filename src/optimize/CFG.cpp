@@ -20,6 +20,7 @@
 #include "lib/Vector.h"
 
 #include "CFG.h"
+#include "MIR_static_visitor.h"
 #include "Def_use_web.h"
 
 #include "ssa/Dominance.h"
@@ -646,7 +647,7 @@ public:
 	}
 };
 
-class Label_counter : public Visitor, virtual public GC_obj
+class Label_counter : public Static_visitor<Label_counter>, virtual public GC_obj
 {
 	Map<string, int>* counts;
 public:
@@ -689,7 +690,8 @@ CFG::get_linear_statements ()
 
 	/* Remove labels that are only used once. */
 	Map<string, int> label_counts;
-	(new Label_counter (&label_counts))->visit_statement_list (results);
+	Label_counter counter (&label_counts);
+	counter.visit_statement_list (results);
 
 	i = results->begin ();
 	while (i != results->end ())
@@ -0,0 +1,397 @@
+/*
+ * phc -- the open source PHP compiler
+ * See doc/license/README.license for licensing information
+ *
+ * Merge compiler-generated temporaries whose live ranges do not overlap.
+ *
+ * Shredding creates a fresh temporary for every subexpression, and each
+ * temporary which survives optimization becomes a zval* local in the
+ * generated C, which is declared, initialized and destroyed in every call.
+ * Most of them are only live for a statement or two.
+ *
+ * Just before code generation, we build a CFG for each method, and compute
+ * the liveness of its temporaries:
+ *
+ *		live_in (B) = use (B) U (live_out (B) - def (B))
+ *		live_out (B) = U live_in (S), for each successor S of B
+ *
+ *	A temporary interferes with every other temporary which is live after a
+ *	statement which assigns to it. Temporaries which do not interfere are
+ *	given the same name, greedily, in the order they appear. Copies between
+ *	two temporaries which are merged disappear.
+ *
+ *	Only temporaries which live outside the symbol table are merged (which is
+ *	all of them, since fresh () marks them st_entry_not_required), so
+ *	variable-variables, eval and extract () cannot see them. We do not merge
+ *	a temporary if:
+ *		- it might become a reference, or be bound to one (assigning to it
+ *		would then write through the reference): if it is in a reference
+ *		assignment, if it is passed to a parameter which is, or might be, by
+ *		reference, or if it is returned from a function which returns by
+ *		reference,
+ *		- it appears in a global or static declaration, or a try block (the
+ *		CFG treats the try statement as a single statement),
+ *		- it might be read before it is assigned, since it would then read
+ *		another temporary's value, rather than NULL.
+ */
+
+#include "Coalesce_temporaries.h"
+#include "Basic_block.h"
+#include "CFG.h"
+#include "Method_info.h"
+#include "Oracle.h"
+#include "pass_manager/Pass_manager.h"
+#include "process_ir/General.h"
+#include "process_ir/stats.h"
+#include "MIR_static_visitor.h"
+
+using namespace MIR;
+using namespace std;
+
+/*
+ * Find the variables in a statement, the one it assigns to, and those it
+ * might bind by reference.
+ */
+class Temp_occurrences : public Static_visitor<Temp_occurrences>
+{
+public:
+	using Static_visitor<Temp_occurrences>::pre_variable_name;
+
+	List<VARIABLE_NAME*> vars;
+	VARIABLE_NAME* def;
+	Set<string> refs;
+	bool binds_refs;
+
+public:
+	Temp_occurrences ()
+	: def (NULL)
+	, binds_refs (false)
+	{
+	}
+
+	void pre_variable_name (VARIABLE_NAME* in)
+	{
+		vars.push_back (in);
+	}
+
+	void pre_assign_var (Assign_var* in)
+	{
+		if (in->is_ref)
+			binds_refs = true;
+		else
+			def = in->lhs;
+	}
+
+	void pre_assign_var_var (Assign_var_var* in)
+	{
+		binds_refs |= in->is_ref;
+	}
+
+	void pre_assign_array (Assign_array* in)
+	{
+		binds_refs |= in->is_ref;
+	}
+
+	void pre_assign_next (Assign_next* in)
+	{
+		binds_refs |= in->is_ref;
+	}
+
+	void pre_assign_field (Assign_field* in)
+	{
+		binds_refs |= in->is_ref;
+	}
+
+	void pre_global (Global* in)
+	{
+		binds_refs = true;
+	}
+
+	void pre_static_declaration (Static_declaration* in)
+	{
+		binds_refs = true;
+	}
+
+	void pre_try (Try* in)
+	{
+		binds_refs = true;
+	}
+
+	void pre_method_invocation (Method_invocation* in)
+	{
+		METHOD_NAME* method_name = dynamic_cast<METHOD_NAME*> (in->method_name);
+		Method_info* info = NULL;
+		if (in->target == NULL && method_name)
+			info = Oracle::get_method_info (method_name->value);
+
+		int i = 0;
+		foreach (Actual_parameter* ap, *in->actual_parameters)
+		{
+			if (ap->is_ref || info == NULL || info->param_by_ref (i))
+				add_ref (ap->rvalue);
+			i++;
+		}
+	}
+
+	void pre_new (New* in)
+	{
+		// We dont know which constructor is called.
+		foreach (Actual_parameter* ap, *in->actual_parameters)
+			add_ref (ap->rvalue);
+	}
+
+	void add_ref (Rvalue* in)
+	{
+		if (VARIABLE_NAME* var = dynamic_cast<VARIABLE_NAME*> (in))
+			refs.insert (*var->value);
+	}
+};
+
+static bool
+is_temporary (VARIABLE_NAME* var)
+{
+	return var->attrs->is_true ("phc.codegen.compiler_generated")
+		&& var->attrs->is_true ("phc.codegen.st_entry_not_required");
+}
+
+Coalesce_temporaries::Coalesce_temporaries ()
+: cfg (NULL)
+{
+	name = new String ("ctemps");
+	description = new String ("Coalesce temporaries with disjoint live ranges");
+}
+
+bool
+Coalesce_temporaries::pass_is_enabled (Pass_manager* pm)
+{
+	return pm->args_info->optimize_arg != string ("0");
+}
+
+void
+Coalesce_temporaries::run (IR::PHP_script* in, Pass_manager* pm)
+{
+	int count = 0;
+	foreach (Statement* s, *dyc<PHP_script> (in)->statements)
+	{
+		if (Method* method = dynamic_cast<Method*> (s))
+			count += coalesce (method);
+
+		else if (Class_def* class_def = dynamic_cast<Class_def*> (s))
+		{
+			foreach (Member* member, *class_def->members)
+			{
+				if (Method* method = dynamic_cast<Method*> (member))
+					count += coalesce (method);
+			}
+		}
+	}
+
+	if (count == 0)
+		pm->changed_nothing ();
+}
+
+int
+Coalesce_temporaries::coalesce (Method* method)
+{
+	if (method->statements == NULL)
+		return 0;
+
+	occurrences.clear ();
+	excluded.clear ();
+	defs.clear ();
+	uses.clear ();
+	live_ins.clear ();
+	live_outs.clear ();
+	interferes.clear ();
+
+	cfg = new CFG (NULL, method);
+
+	if (!collect (method))
+		return 0;
+
+	compute_liveness ();
+
+	// Temporaries which might be read before they are assigned.
+	foreach (string name, live_ins[cfg->get_entry_bb ()->ID])
+		excluded.insert (name);
+
+	build_interference ();
+
+	int count = rename (method);
+	DEBUG ("Removed " << count << " temporaries from "
+			<< *method->signature->method_name->value);
+
+	return count;
+}
+
+// Returns false if METHOD contains statements we cannot analyse.
+bool
+Coalesce_temporaries::collect (Method* method)
+{
+	foreach (Basic_block* bb, *cfg->get_all_bbs ())
+	{
+		Temp_occurrences occ;
+
+		if (Statement_block* sb = dynamic_cast<Statement_block*> (bb))
+		{
+			if (isa<FOREIGN> (sb->statement))
+				return false;
+
+			occ.visit_statement (sb->statement);
+
+			if (isa<Return> (sb->statement) && method->signature->return_by_ref)
+				occ.binds_refs = true;
+		}
+		else if (Branch_block* branch = dynamic_cast<Branch_block*> (bb))
+			occ.vars.push_back (branch->branch->variable_name);
+		else
+			continue;
+
+		foreach (VARIABLE_NAME* var, occ.vars)
+		{
+			string name = *var->value;
+
+			if (!is_temporary (var) || occ.binds_refs || occ.refs.has (name))
+				excluded.insert (name);
+
+			if (!is_temporary (var))
+				continue;
+
+			occurrences[name].push_back (var);
+
+			if (var == occ.def)
+				defs[bb->ID] = name;
+			else
+				uses[bb->ID].insert (name);
+		}
+	}
+
+	return true;
+}
+
+void
+Coalesce_temporaries::compute_liveness ()
+{
+	BB_list* bbs = cfg->get_all_bbs_bottom_up ();
+
+	bool changed = true;
+	while (changed)
+	{
+		changed = false;
+
+		foreach (Basic_block* bb, *bbs)
+		{
+			Set<string> out;
+			foreach (Basic_block* succ, *bb->get_successors ())
+				out.insert (live_ins[succ->ID].begin (), live_ins[succ->ID].end ());
+
+			Set<string> in = uses[bb->ID];
+			foreach (string name, out)
+			{
+				if (!defs.has (bb->ID) || defs[bb->ID] != name)
+					in.insert (name);
+			}
+
+			if (!in.equals (&live_ins[bb->ID]))
+				changed = true;
+
+			live_outs[bb->ID] = out;
+			live_ins[bb->ID] = in;
+		}
+	}
+}
+
+void
+Coalesce_temporaries::build_interference ()
+{
+	string def;
+	long id;
+	foreach (boost::tie (id, def), defs)
+	{
+		foreach (string name, live_outs[id])
+		{
+			if (name != def)
+			{
+				interferes[def].insert (name);
+				interferes[name].insert (def);
+			}
+		}
+	}
+}
+
+// Returns the number of temporaries which were renamed.
+int
+Coalesce_temporaries::rename (Method* method)
+{
+	// Give each temporary the name of the first representative it does not
+	// interfere with. CONFLICTS are the temporaries which interfere with any
+	// of a representative's members.
+	List<string> representatives;
+	Map<string, Set<string> > conflicts;
+	Map<string, string> renames;
+
+	// Go in the order of the method's statements, so that the results are
+	// the same each time.
+	foreach (Basic_block* bb, *cfg->get_all_bbs ())
+	{
+		Set<string> names = uses[bb->ID];
+		if (defs.has (bb->ID))
+			names.insert (defs[bb->ID]);
+
+		foreach (string name, names)
+		{
+			if (excluded.has (name) || renames.has (name))
+				continue;
+
+			string rep = name;
+			foreach (string candidate, representatives)
+			{
+				if (!conflicts[candidate].has (name))
+				{
+					rep = candidate;
+					break;
+				}
+			}
+
+			if (rep == name)
+				representatives.push_back (name);
+
+			renames[name] = rep;
+			Set<string>& interference = interferes[name];
+			conflicts[rep].insert (interference.begin (), interference.end ());
+		}
+	}
+
+	int count = 0;
+	string name, rep;
+	foreach (boost::tie (name, rep), renames)
+	{
+		if (name == rep)
+			continue;
+
+		// Representatives keep their names, so their names can be shared.
+		String* value = occurrences[rep].front ()->value;
+		foreach (VARIABLE_NAME* var, occurrences[name])
+			var->value = value;
+
+		count++;
+		CTS ("num_temporaries_coalesced");
+	}
+
+	// Remove copies from one merged temporary to another.
+	Statement_list::iterator i = method->statements->begin ();
+	while (i != method->statements->end ())
+	{
+		Assign_var* assign = dynamic_cast<Assign_var*> (*i);
+		VARIABLE_NAME* rhs = assign ? dynamic_cast<VARIABLE_NAME*> (assign->rhs) : NULL;
+
+		if (rhs && !assign->is_ref
+			&& renames.has (*assign->lhs->value)
+			&& *assign->lhs->value == *rhs->value)
+			method->statements->erase (i++);
+		else
+			i++;
+	}
+
+	return count;
+}
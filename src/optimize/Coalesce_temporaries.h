@@ -0,0 +1,54 @@
+/*
+ * phc -- the open source PHP compiler
+ * See doc/license/README.license for licensing information
+ *
+ * Merge compiler-generated temporaries whose live ranges do not overlap.
+ */
+
+#ifndef PHC_COALESCE_TEMPORARIES
+#define PHC_COALESCE_TEMPORARIES
+
+#include "lib/Map.h"
+#include "lib/Set.h"
+#include "pass_manager/Pass.h"
+#include "MIR.h"
+
+class CFG;
+
+class Coalesce_temporaries : public Pass
+{
+public:
+	Coalesce_temporaries ();
+
+	void run (IR::PHP_script* in, Pass_manager* pm);
+	bool pass_is_enabled (Pass_manager* pm);
+
+	// Returns the number of temporaries which were removed from METHOD.
+	int coalesce (MIR::Method* method);
+
+private:
+	CFG* cfg;
+
+	// Every occurrence of each temporary.
+	Map<string, List<MIR::VARIABLE_NAME*> > occurrences;
+
+	// Names which cannot be merged with any other.
+	Set<string> excluded;
+
+	// The temporary each block assigns to, and the temporaries it reads, by
+	// BB ID.
+	Map<long, string> defs;
+	Map<long, Set<string> > uses;
+
+	Map<long, Set<string> > live_ins;
+	Map<long, Set<string> > live_outs;
+
+	Map<string, Set<string> > interferes;
+
+	bool collect (MIR::Method* method);
+	void compute_liveness ();
+	void build_interference ();
+	int rename (MIR::Method* method);
+};
+
+#endif // PHC_COALESCE_TEMPORARIES
@@ -9,6 +9,7 @@ using namespace MIR;
 using namespace boost;
 
 DCE::DCE ()
+: bb_marks (NULL)
 {
 }
 
@@ -193,11 +194,11 @@ DCE::mark_pass ()
 void
 DCE::mark_entire_block (Basic_block* bb, string why)
 {
-	if (bb_marks[bb->ID])
+	if ((*bb_marks)[bb->ID])
 		return;
 
 	DEBUG ("marking " << bb->ID << " " << why);
-	bb_marks [bb->ID] = true;
+	(*bb_marks) [bb->ID] = true;
 
 	// Note there are no may-defs here. They're already divided into defs or
 	// uses. Also, "entire block" doesnt include Phis.
@@ -294,7 +295,7 @@ DCE::mark_def (SSA_use* use)
 void
 DCE::unmark_block (Basic_block* bb)
 {
-	bb_marks [bb->ID] = false;
+	(*bb_marks) [bb->ID] = false;
 }
 
 // Check if the block is marked (ignoring the phi nodes)
@@ -304,7 +305,7 @@ DCE::is_marked (Basic_block* bb)
 	if (isa<Entry_block> (bb) || isa<Exit_block> (bb) || isa<Empty_block> (bb))
 		return true;
 
-	return bb_marks [bb->ID];
+	return (*bb_marks) [bb->ID];
 }
 
 /*	SweepPass ():
@@ -369,7 +370,7 @@ DCE::run (CFG* cfg)
 {
 	DEBUG ("START DCE");
 	marks.clear ();
-	bb_marks.clear ();
+	bb_marks = new Arena_map<long, bool>;
 
 	worklist = new SSA_def_list;
 	this->cfg = cfg;
@@ -9,6 +9,7 @@
 #define PHC_DEAD_CODE_ELIMINATION
 
 #include "lib/Map.h"
+#include "lib/Arena.h"
 
 #include "CFG_visitor.h"
 #include "Edge.h"
@@ -28,8 +29,8 @@ private:
 	// Is the SSA_def marked?
 	SSA_op_map<bool> marks;
 
-	// Is the BB marked?
-	Map<long, bool> bb_marks;
+	// Is the BB marked? Allocated in the pass's arena.
+	Arena_map<long, bool>* bb_marks;
 
 	bool is_marked (Basic_block*);
 
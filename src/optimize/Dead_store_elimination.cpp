@@ -0,0 +1,495 @@
+/*
+ * phc -- the open source PHP compiler
+ * See doc/license/README.license for licensing information
+ *
+ * Dead-store elimination for array and field assignments.
+ *
+ * DCE works on the SSA form, which only names scalars. A store into an
+ * array or object field defines an index node of the points-to graph, and
+ * such stores are only removed if the whole statement is unused.
+ *
+ * Here, we compute liveness of index nodes, using the defs and uses which
+ * Def_use recorded during the whole-program analysis:
+ *
+ *		live_in (B) = gen (B) U (live_out (B) - kill (B))
+ *		live_out (B) = U live_in (S), for each successor S of B
+ *
+ *	where kill (B) are the must-defs of B, and gen (B) are:
+ *		- B's uses,
+ *		- every field reachable from a variable which B reads as a whole
+ *		(passing $a to a function reads all of $a's elements, but Def_use
+ *		only records the use of $a),
+ *		- every escaping name, if B might run user code (a call, or an
+ *		object with magic methods), since that code might read them.
+ *
+ *	A store is dead if none of its defs or may-defs are live after it.
+ *
+ *	The exit block uses every name defined out of the method's scope (see
+ *	Def_use::finish_block). Arrays are values, so if an array's storage node
+ *	is only reachable from the method's local variables when it returns,
+ *	then its elements cannot be observed after the method returns, and the
+ *	exit block does not use them. We do not do this for objects, as their
+ *	destructors might read them, or for __MAIN__, whose variables are
+ *	globals.
+ */
+
+#include "Dead_store_elimination.h"
+#include "Def_use_web.h"
+#include "Oracle.h"
+#include "process_ir/General.h"
+#include "MIR_static_visitor.h"
+
+#include "wpa/Aliasing.h"
+#include "wpa/Def_use.h"
+#include "wpa/Points_to.h"
+#include "wpa/Value_analysis.h"
+#include "wpa/Whole_program.h"
+
+using namespace MIR;
+using namespace std;
+
+/*
+ * Find the variables a statement reads in their entirety, as opposed to
+ * those it only indexes into. This runs on every statement, so it is dispatched
+ * statically.
+ */
+class Collect_variables : public Static_visitor<Collect_variables>
+{
+public:
+	using Static_visitor<Collect_variables>::pre_variable_name;
+
+	Map<string, int> counts;
+	Map<string, int> base_counts;
+	List<VARIABLE_NAME*> vars;
+	bool has_call;
+
+public:
+	Collect_variables ()
+	: has_call (false)
+	{
+	}
+
+	void base (VARIABLE_NAME* in)
+	{
+		base_counts[*in->value]++;
+	}
+
+	void base (Node* in)
+	{
+		if (VARIABLE_NAME* var = dynamic_cast<VARIABLE_NAME*> (in))
+			base (var);
+	}
+
+	void pre_variable_name (VARIABLE_NAME* in)
+	{
+		counts[*in->value]++;
+		vars.push_back (in);
+	}
+
+	void pre_assign_array (Assign_array* in) { base (in->lhs); }
+	void pre_assign_next (Assign_next* in) { base (in->lhs); }
+	void pre_assign_field (Assign_field* in) { base (in->target); }
+	void pre_array_access (Array_access* in) { base (in->variable_name); }
+	void pre_field_access (Field_access* in) { base (in->target); }
+
+	void pre_isset (Isset* in)
+	{
+		if (in->array_indices->size ())
+			base (in->variable_name);
+	}
+
+	void pre_unset (Unset* in)
+	{
+		if (in->array_indices->size ())
+			base (in->variable_name);
+	}
+
+	void pre_method_invocation (Method_invocation*) { has_call = true; }
+	void pre_new (New*) { has_call = true; }
+
+	bool is_read_whole (VARIABLE_NAME* in)
+	{
+		return counts[*in->value] > base_counts[*in->value];
+	}
+};
+
+// Remove the star from the name of an index node's value.
+static string
+get_storage_name (const Index_node* index)
+{
+	if (index->is_starred ())
+		return index->storage.substr (2);
+
+	return index->storage;
+}
+
+static string
+get_name (const Index_node* index)
+{
+	return get_storage_name (index) + "::" + index->index;
+}
+
+
+DSE::DSE ()
+{
+}
+
+// Can a variable of these types run user code when accessed, assigned or
+// overwritten?
+static bool
+may_run_user_code (const Types* types)
+{
+	if (types == NULL)
+		return true;
+
+	static const char* magic_methods[] = {
+		"__get", "__set", "__isset", "__unset", "__tostring", "__destruct",
+		"offsetget", "offsetset", "offsetexists", "offsetunset"
+	};
+
+	foreach (string type, *Type_info::get_object_types (types))
+	{
+		Class_info* info = Oracle::get_class_info (s(type));
+		if (info == NULL)
+			return true;
+
+		foreach (const char* magic, magic_methods)
+		{
+			if (info->get_method_info (s(magic)))
+				return true;
+		}
+	}
+
+	return false;
+}
+
+bool
+DSE::has_side_effects (Statement_block* sb)
+{
+	if (isa<Throw> (sb->statement))
+		return true;
+
+	Collect_variables cv;
+	cv.visit_statement (sb->statement);
+
+	if (cv.has_call)
+		return true;
+
+	Context* cx = Context::non_contextual (sb);
+	foreach (VARIABLE_NAME* var, cv.vars)
+	{
+		if (may_run_user_code (wp->get_abstract_value (cx, R_IN, var)->types))
+			return true;
+	}
+
+	return false;
+}
+
+bool
+DSE::is_candidate (Statement_block* sb)
+{
+	Context* cx = Context::non_contextual (sb);
+
+	if (Assign_array* aa = dynamic_cast<Assign_array*> (sb->statement))
+	{
+		if (aa->is_ref)
+			return false;
+
+		// Strings and ArrayAccess objects can also be indexed.
+		const Types* types = wp->get_abstract_value (cx, R_IN, aa->lhs)->types;
+		return types
+			&& types->size () == 1
+			&& types->has ("array");
+	}
+
+	if (Assign_field* af = dynamic_cast<Assign_field*> (sb->statement))
+	{
+		if (af->is_ref
+			|| !isa<VARIABLE_NAME> (af->target)
+			|| !isa<FIELD_NAME> (af->field_name))
+			return false;
+
+		// Check for __set.
+		const Types* types = wp->get_abstract_value (
+				cx, R_IN, dyc<VARIABLE_NAME> (af->target))->types;
+
+		return types
+			&& Type_info::get_object_types (types)->size () == types->size ()
+			&& !may_run_user_code (types);
+	}
+
+	return false;
+}
+
+bool
+DSE::is_local_array (Context* cx, string storage, Set<string>* visiting)
+{
+	if (local_arrays.has (storage))
+		return local_arrays[storage];
+
+	// Cycles are treated as escaping.
+	if (visiting->has (storage))
+		return false;
+
+	visiting->insert (storage);
+
+	bool result = true;
+	Storage_node* st = new Storage_node (storage);
+
+	if (!wp->aliasing->has_storage_node (cx, R_IN, st))
+		result = false;
+	else
+	{
+		const Types* types = wp->values->get_types (cx, R_IN, st);
+		if (types == NULL || types->size () != 1 || !types->has ("array"))
+			result = false;
+	}
+
+	if (result)
+	{
+		foreach (const Index_node* in, *wp->aliasing->get_incoming (cx, R_IN, st))
+		{
+			// References might be to variables in another scope.
+			if (wp->aliasing->get_references (cx, R_IN, in, PTG_ALL)->size ())
+				result = false;
+
+			// A local variable.
+			else if (in->storage == cx->symtable_name ())
+			{
+				if (in->index == RETNAME)
+					result = false;
+			}
+
+			// An element of a local array.
+			else if (!is_local_array (cx, in->storage, visiting))
+				result = false;
+
+			if (!result)
+				break;
+		}
+	}
+
+	visiting->erase (storage);
+	local_arrays[storage] = result;
+	return result;
+}
+
+void
+DSE::compute_escaping ()
+{
+	Basic_block* exit = cfg->get_exit_bb ();
+	Context* cx = Context::non_contextual (exit);
+	bool is_main = *cfg->method_info->name == "__MAIN__";
+
+	foreach (const Index_node* use, *du->get_uses (exit))
+	{
+		if (!is_main
+			&& wp->aliasing->has_analysis_result (cx, R_IN)
+			&& is_local_array (cx, get_storage_name (use), new Set<string>))
+		{
+			DEBUG ("Exit does not use " << get_name (use));
+			continue;
+		}
+
+		escaping.insert (get_name (use));
+	}
+}
+
+// Add NAME, and if it is an unknown index, all the fields of its storage
+// node.
+static void
+add_use (Whole_program* wp, Context* cx, Set<string>* gen, const Index_node* index)
+{
+	gen->insert (get_name (index));
+
+	if (index->index != UNKNOWN)
+		return;
+
+	Storage_node* st = new Storage_node (get_storage_name (index));
+	if (!wp->aliasing->has_storage_node (cx, R_IN, st))
+		return;
+
+	foreach (const Index_node* field, *wp->aliasing->get_fields (cx, R_IN, st))
+		gen->insert (get_name (field));
+}
+
+// Add every field reachable from INDEX.
+static void
+add_deep_use (Whole_program* wp, Context* cx, Set<string>* gen, const Index_node* index, Set<string>* seen)
+{
+	if (seen->has (index->str ()))
+		return;
+
+	seen->insert (index->str ());
+	gen->insert (get_name (index));
+
+	if (!wp->aliasing->has_field (cx, R_IN, index))
+		return;
+
+	foreach (const Storage_node* st, *wp->aliasing->get_points_to (cx, R_IN, index))
+	{
+		foreach (const Index_node* field, *wp->aliasing->get_fields (cx, R_IN, st))
+			add_deep_use (wp, cx, gen, field, seen);
+	}
+}
+
+Set<string>*
+DSE::get_gen (Basic_block* bb)
+{
+	Set<string>* gen = new Set<string>;
+
+	if (isa<Exit_block> (bb))
+	{
+		gen->insert (escaping.begin (), escaping.end ());
+		return gen;
+	}
+
+	Context* cx = Context::non_contextual (bb);
+
+	foreach (const Index_node* use, *du->get_uses (bb))
+		add_use (wp, cx, gen, use);
+
+	Statement_block* sb = dynamic_cast<Statement_block*> (bb);
+	if (sb == NULL)
+		return gen;
+
+	Collect_variables cv;
+	cv.visit_statement (sb->statement);
+
+	Set<string>* seen = new Set<string>;
+	foreach (VARIABLE_NAME* var, cv.vars)
+	{
+		if (cv.is_read_whole (var))
+			add_deep_use (wp, cx, gen, VN (cx->symtable_name (), var), seen);
+	}
+
+	if (has_side_effects (sb))
+		gen->insert (escaping.begin (), escaping.end ());
+
+	return gen;
+}
+
+Set<string>*
+DSE::get_kill (Basic_block* bb)
+{
+	Set<string>* kill = new Set<string>;
+
+	if (isa<Exit_block> (bb))
+		return kill;
+
+	foreach (const Index_node* def, *du->get_defs (bb))
+	{
+		if (def->index != UNKNOWN)
+			kill->insert (get_name (def));
+	}
+
+	return kill;
+}
+
+void
+DSE::compute_liveness ()
+{
+	Map<long, Set<string>*> gens;
+	Map<long, Set<string>*> kills;
+
+	BB_list* bbs = cfg->get_all_bbs_bottom_up ();
+	foreach (Basic_block* bb, *bbs)
+	{
+		gens[bb->ID] = get_gen (bb);
+		kills[bb->ID] = get_kill (bb);
+	}
+
+	bool changed = true;
+	while (changed)
+	{
+		changed = false;
+
+		foreach (Basic_block* bb, *bbs)
+		{
+			Set<string> out;
+			foreach (Basic_block* succ, *bb->get_successors ())
+				out.insert (live_ins[succ->ID].begin (), live_ins[succ->ID].end ());
+
+			Set<string> in = *gens[bb->ID];
+			foreach (string name, out)
+			{
+				if (!kills[bb->ID]->has (name))
+					in.insert (name);
+			}
+
+			if (!in.equals (&live_ins[bb->ID]))
+				changed = true;
+
+			live_outs[bb->ID] = out;
+			live_ins[bb->ID] = in;
+		}
+	}
+}
+
+void
+DSE::run (CFG* cfg)
+{
+	this->cfg = cfg;
+	this->du = cfg->duw->get_def_use ();
+	this->wp = du->wp;
+
+	live_ins.clear ();
+	live_outs.clear ();
+	escaping.clear ();
+	local_arrays.clear ();
+
+	// Blocks added since the analysis ran have no results.
+	foreach (Basic_block* bb, *cfg->get_all_bbs ())
+	{
+		if (!du->has_analysis_result (Context::non_contextual (bb), R_OUT))
+			return;
+	}
+
+	compute_escaping ();
+	compute_liveness ();
+
+	foreach (Basic_block* bb, *cfg->get_all_bbs ())
+	{
+		Statement_block* sb = dynamic_cast<Statement_block*> (bb);
+		if (sb == NULL || !is_candidate (sb))
+			continue;
+
+		Set<string>& live = live_outs[bb->ID];
+
+		cIndex_node_list* defs = du->get_defs (bb);
+		defs->push_back_all (du->get_may_defs (bb));
+
+		if (defs->size () == 0)
+			continue;
+
+		bool dead = true;
+		foreach (const Index_node* def, *defs)
+		{
+			string name = get_name (def);
+			string prefix = get_storage_name (def) + "::";
+
+			// Any live element of the same storage node keeps a store to an
+			// unknown index alive.
+			foreach (string live_name, live)
+			{
+				if (live_name == name
+					|| (def->index == UNKNOWN && live_name.find (prefix) == 0)
+					|| live_name == prefix + UNKNOWN)
+				{
+					dead = false;
+					break;
+				}
+			}
+
+			if (!dead)
+				break;
+		}
+
+		if (dead)
+		{
+			DEBUG ("BB " << bb->ID << " is a dead store");
+			cfg->remove_bb (bb);
+			CTS ("num_dead_stores_removed");
+		}
+	}
+}
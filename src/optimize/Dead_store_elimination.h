@@ -0,0 +1,53 @@
+/*
+ * phc -- the open source PHP compiler
+ * See doc/license/README.license for licensing information
+ *
+ * Dead-store elimination for array and field assignments.
+ */
+
+#ifndef PHC_DEAD_STORE_ELIMINATION
+#define PHC_DEAD_STORE_ELIMINATION
+
+#include "lib/Map.h"
+#include "lib/Set.h"
+
+#include "CFG_visitor.h"
+
+class Whole_program;
+class Def_use;
+class Context;
+
+class DSE : public CFG_visitor
+{
+public:
+	DSE ();
+	void run (CFG* cfg);
+
+private:
+	CFG* cfg;
+	Whole_program* wp;
+	Def_use* du;
+
+	// Live index nodes, by BB ID.
+	Map<long, Set<string> > live_ins;
+	Map<long, Set<string> > live_outs;
+
+	// The names the exit block uses, which might be observed after the
+	// method returns.
+	Set<string> escaping;
+
+	// Storage nodes which are known to be unreachable after the method
+	// returns.
+	Map<string, bool> local_arrays;
+
+	bool is_candidate (Statement_block* sb);
+	bool has_side_effects (Statement_block* sb);
+	bool is_local_array (Context* cx, string storage, Set<string>* visiting);
+
+	void compute_escaping ();
+	Set<string>* get_gen (Basic_block* bb);
+	Set<string>* get_kill (Basic_block* bb);
+	void compute_liveness ();
+};
+
+#endif // PHC_DEAD_STORE_ELIMINATION
@@ -2,46 +2,497 @@
  * phc -- the open source PHP compiler
  * See doc/license/README.license for licensing information
  *
- * Very simple inlining. Probably just removing calls to empty functions.
-  */
+ * Inline calls to small user functions.
+ *
+ * The callee's CFG is copied into the caller, in place of the call. The
+ * callee's variables are renamed to fresh names, so they cannot clash with
+ * the caller's variables (the pass is run out of SSA form, so we dont need to
+ * worry about versions). Parameters are bound with assignments (by reference
+ * for reference parameters), returns become assignments to a fresh variable,
+ * and the callee's variables are unset after the inlined body, which
+ * frees them at the same point as the callee's return would have.
+ *
+ * The cost model is simple: small functions are inlined, with a larger limit
+ * for calls in loops (which we expect to be executed more often), and for
+ * functions with only a single caller (which we expect to be removed once
+ * inlined). Recursive functions are never inlined, and the size of each
+ * caller can only grow by so much.
+ *
+ * Only functions are inlined, not methods, since we dont know the target of
+ * method calls here.
+ */
 
 #include "Inlining.h"
 #include "Oracle.h"
 #include "process_ir/General.h"
+#include "embed/embed.h"
 
 using namespace MIR;
 
+// A call costs about as much as this many statements: binding the
+// parameters, and pushing and popping the stack frame.
+static const int CALL_COST = 5;
+
+// The largest callee we inline, in statements.
+static const int SIZE_LIMIT = 20;
+
+// For calls in loops.
+static const int LOOP_FACTOR = 4;
+
+// For callees with only a single caller.
+static const int SINGLE_CALLER_FACTOR = 3;
+
+// The most statements we add to a single caller in one pass.
+static const int GROWTH_LIMIT = 200;
+
+
+/*
+ * Can a function be inlined without changing its semantics? Anything which
+ * accesses the function's symbol table or stack frame by name cannot.
+ */
+class Inline_safety_check : public Visitor
+{
+public:
+	bool safe;
+	Set<string> scope_functions;
+
+public:
+	Inline_safety_check ()
+	: safe (true)
+	{
+		scope_functions.insert ("compact");
+		scope_functions.insert ("extract");
+		scope_functions.insert ("get_defined_vars");
+		scope_functions.insert ("func_get_args");
+		scope_functions.insert ("func_get_arg");
+		scope_functions.insert ("func_num_args");
+		scope_functions.insert ("parse_str");
+		scope_functions.insert ("eval");
+		scope_functions.insert ("include");
+		scope_functions.insert ("include_once");
+		scope_functions.insert ("require");
+		scope_functions.insert ("require_once");
+		scope_functions.insert ("debug_backtrace");
+		scope_functions.insert ("debug_print_backtrace");
+	}
+
+	void pre_global (Global*) { safe = false; }
+	void pre_static_declaration (Static_declaration*) { safe = false; }
+	void pre_try (Try*) { safe = false; }
+	void pre_assign_var_var (Assign_var_var*) { safe = false; }
+	void pre_variable_variable (Variable_variable*) { safe = false; }
+	void pre_variable_method (Variable_method*) { safe = false; }
+
+	void pre_method_invocation (Method_invocation* in)
+	{
+		METHOD_NAME* name = dynamic_cast<METHOD_NAME*> (in->method_name);
+		if (name && scope_functions.has (*name->value->to_lower ()))
+			safe = false;
+	}
+};
+
+/*
+ * Rename the callee's variables to fresh names. Superglobals are the same in
+ * every scope, so they keep their names.
+ */
+class Rename_locals : public Visitor
+{
+public:
+	Map<string, String*> names;
+	Map<string, String*> iters;
+	Set<string> superglobals;
+
+public:
+	Rename_locals ()
+	{
+		foreach (VARIABLE_NAME* sg, *PHP::get_superglobals ())
+			superglobals.insert (*sg->value);
+	}
+
+	VARIABLE_NAME* rename (VARIABLE_NAME* in)
+	{
+		VARIABLE_NAME* result = in->clone ();
+		pre_variable_name (result);
+		return result;
+	}
+
+	void pre_variable_name (VARIABLE_NAME* in)
+	{
+		if (superglobals.has (*in->value))
+			return;
+
+		if (!names.has (*in->value))
+			names[*in->value] = fresh (*in->value + "_inl");
+
+		in->value = names[*in->value];
+	}
+
+	void pre_ht_iterator (HT_ITERATOR* in)
+	{
+		if (!iters.has (*in->value))
+			iters[*in->value] = fresh_iter ()->value;
+
+		in->value = iters[*in->value];
+	}
+};
+
+
+// The number of statements in the CFG, as a measure of code size.
+static int
+get_size (CFG* cfg)
+{
+	int size = 0;
+	foreach (Basic_block* bb, *cfg->get_all_bbs ())
+	{
+		if (isa<Statement_block> (bb) || isa<Branch_block> (bb))
+			size++;
+	}
+
+	return size;
+}
+
+// Is there a path from BB back to itself?
+static bool
+is_in_loop (Basic_block* bb)
+{
+	BB_list* worklist = bb->get_successors ();
+	Set<Basic_block*> seen;
+
+	while (worklist->size ())
+	{
+		Basic_block* next = worklist->front ();
+		worklist->pop_front ();
+
+		if (next == bb)
+			return true;
+
+		if (seen.has (next))
+			continue;
+
+		seen.insert (next);
+		worklist->push_back_all (next->get_successors ());
+	}
+
+	return false;
+}
+
+static bool
+has_exit_block (CFG* cfg)
+{
+	foreach (Basic_block* bb, *cfg->get_all_bbs ())
+	{
+		if (isa<Exit_block> (bb))
+			return true;
+	}
+
+	return false;
+}
+
+
+Inlining::Inlining ()
+: budget (0)
+{
+}
+
 void
-Inlining::transform_eval_expr (Statement_block* bb, Eval_expr* in, BB_list* out)
+Inlining::run (CFG* cfg)
 {
-	// remove it later
-	out->push_back (bb);
+	budget = GROWTH_LIMIT;
+	Visit_once::run (cfg);
+}
 
-	Method_invocation* mi = dynamic_cast<Method_invocation*> (in->expr);
-	if (  mi == NULL
-		|| mi->target
-		|| isa<Variable_method> (mi->method_name))
-		return;
+User_method_info*
+Inlining::get_inlinable_callee (Statement_block* bb, Method_invocation* mi)
+{
+	if (mi->target || isa<Variable_method> (mi->method_name))
+		return NULL;
 
-	// Simplest thing possible: remove calls to empty functions
 	User_method_info* info = Oracle::get_user_method_info (
 		dyc<METHOD_NAME> (mi->method_name)->value);
 
+	if (info == NULL
+		|| info->get_class_info () != NULL
+		|| info->return_by_ref ()
+		|| info->get_recursive ()
+		|| info->get_cfg () == bb->cfg)
+		return NULL;
+
+	CFG* callee = info->get_cfg ();
+	if (!has_exit_block (callee))
+		return NULL;
+
+
+	// Check the parameters can be bound.
+	Formal_parameter_list* params = info->get_method ()->signature->formal_parameters;
+	for (int i = 0; i < info->formal_param_count (); i++)
+	{
+		// Type hints are checked by the call.
+		if (params->at (i)->type->class_name)
+			return NULL;
+
+		if ((unsigned int) i < mi->actual_parameters->size ())
+		{
+			Actual_parameter* ap = mi->actual_parameters->at (i);
+			if ((ap->is_ref || info->param_by_ref (i))
+				&& !isa<VARIABLE_NAME> (ap->rvalue))
+				return NULL;
+		}
+		else
+		{
+			// Missing parameters give a warning.
+			Static_value* def = info->default_param (i);
+			if (def == NULL || !(isa<Literal> (def) || isa<Constant> (def)))
+				return NULL;
+		}
+	}
+
+
+	// Check the callee's body.
+	Inline_safety_check* check = new Inline_safety_check;
+	foreach (Basic_block* callee_bb, *callee->get_all_bbs ())
+	{
+		if (Statement_block* sb = dynamic_cast<Statement_block*> (callee_bb))
+			sb->statement->visit (check);
+	}
+
+	if (!check->safe)
+		return NULL;
+
+
+	// Cost model
+	int size = get_size (callee);
+	if (size > budget)
+		return NULL;
+
+	if (size <= CALL_COST)
+		return info;
+
+	int limit = SIZE_LIMIT;
+
+	if (is_in_loop (bb))
+		limit *= LOOP_FACTOR;
+
+	if (info->get_caller_count () == 1)
+		limit *= SINGLE_CALLER_FACTOR;
+
+	if (size > limit)
+		return NULL;
+
+	return info;
+}
+
+void
+Inlining::transform_eval_expr (Statement_block* bb, Eval_expr* in, BB_list* out)
+{
+	Method_invocation* mi = dynamic_cast<Method_invocation*> (in->expr);
+	if (mi == NULL)
+	{
+		out->push_back (bb);
+		return;
+	}
+
+	User_method_info* info = get_inlinable_callee (bb, mi);
 	if (info == NULL)
+	{
+		out->push_back (bb);
 		return;
+	}
+
+	inline_call (bb, NULL, mi, info);
 
-	// TODO: technically, we have ignored the problem that a function call can
-	// initialize a parameter which is called by ref. We've also ignored that
-	// elsewhere, which really needs to be fixed.
-	// TODO: shoudln't this be killed by DCE
-	// TODO: use a User_method_info property
+	// Leaving OUT empty removes the call.
+}
+
+void
+Inlining::transform_assign_var (Statement_block* bb, Assign_var* in, BB_list* out)
+{
+	Method_invocation* mi = dynamic_cast<Method_invocation*> (in->rhs);
+	if (mi == NULL || in->is_ref)
+	{
+		out->push_back (bb);
+		return;
+	}
 
-	// Empty CFGs have 2 statements only
-	if (info->get_cfg ()->get_all_bbs()->size() != 2)
+	User_method_info* info = get_inlinable_callee (bb, mi);
+	if (info == NULL)
+	{
+		out->push_back (bb);
 		return;
+	}
+
+	inline_call (bb, in->lhs, mi, info);
+}
+
+void
+Inlining::inline_call (Statement_block* bb, VARIABLE_NAME* lhs, Method_invocation* mi, User_method_info* info)
+{
+	DEBUG ("BB " << bb->ID << ": inlining call to " << *info->name);
+	CTS ("num_inlined_calls");
+
+	CFG* cfg = bb->cfg;
+	CFG* callee = info->get_cfg ();
+	budget -= get_size (callee);
+
+	Rename_locals* renamer = new Rename_locals;
+	VARIABLE_NAME* retval = fresh_var_name ("TLI");
+
+
+	// Bind the parameters.
+	BB_list* prologue = new BB_list;
+	prologue->push_back (new Empty_block (cfg));
+
+	for (int i = 0; i < info->formal_param_count (); i++)
+	{
+		VARIABLE_NAME* param = renamer->rename (info->param_name (i));
+
+		Assign_var* binding;
+		if ((unsigned int) i < mi->actual_parameters->size ())
+		{
+			Actual_parameter* ap = mi->actual_parameters->at (i);
+			binding = new Assign_var (
+				param,
+				ap->is_ref || info->param_by_ref (i),
+				ap->rvalue->clone ());
+		}
+		else
+		{
+			binding = new Assign_var (
+				param,
+				false,
+				dyc<Expr> (info->default_param (i)->clone ()));
+		}
+
+		prologue->push_back (new Statement_block (cfg, binding));
+	}
+
+	// The function returns NULL if it falls off the end.
+	if (lhs)
+		prologue->push_back (new Statement_block (cfg,
+			new Assign_var (retval->clone (), false, new NIL)));
+
+
+	// Copy the callee's blocks.
+	Map<Basic_block*, Basic_block*> copies;
+	foreach (Basic_block* callee_bb, *callee->get_all_bbs ())
+	{
+		Basic_block* copy;
+
+		if (isa<Entry_block> (callee_bb))
+			copy = prologue->back ();
+
+		else if (isa<Exit_block> (callee_bb))
+			copy = new Empty_block (cfg);
+
+		else if (Branch_block* br = dynamic_cast<Branch_block*> (callee_bb))
+		{
+			Branch* branch = br->branch->clone ();
+			branch->visit (renamer);
+			copy = new Branch_block (cfg, branch);
+		}
+
+		else if (Statement_block* sb = dynamic_cast<Statement_block*> (callee_bb))
+		{
+			if (Return* ret = dynamic_cast<Return*> (sb->statement))
+			{
+				if (lhs)
+				{
+					Rvalue* rvalue = ret->rvalue->clone ();
+					rvalue->visit (renamer);
+					copy = new Statement_block (cfg,
+						new Assign_var (retval->clone (), false, rvalue));
+				}
+				else
+					copy = new Empty_block (cfg);
+			}
+			else
+			{
+				Statement* statement = sb->statement->clone ();
+				statement->visit (renamer);
+				copy = new Statement_block (cfg, statement);
+			}
+		}
+
+		else
+		{
+			assert (isa<Empty_block> (callee_bb));
+			copy = new Empty_block (cfg);
+		}
+
+		copies[callee_bb] = copy;
+	}
+
+
+	// Return the value, and free the callee's variables.
+	BB_list* epilogue = new BB_list;
+	epilogue->push_back (copies[callee->get_exit_bb ()]);
+
+	if (lhs)
+	{
+		epilogue->push_back (new Statement_block (cfg,
+			new Assign_var (lhs->clone (), false, retval->clone ())));
+		epilogue->push_back (new Statement_block (cfg,
+			new Unset (NULL, retval->clone (), new Rvalue_list)));
+	}
+
+	string name;
+	String* new_name;
+	foreach (tie (name, new_name), renamer->names)
+	{
+		epilogue->push_back (new Statement_block (cfg,
+			new Unset (NULL, new VARIABLE_NAME (new_name), new Rvalue_list)));
+	}
+
+
+	// Add the new blocks. The copy of the entry block is already in the
+	// prologue, and the copy of the exit block is in the epilogue.
+	foreach (Basic_block* new_bb, *prologue)
+		cfg->add_bb (new_bb);
+
+	foreach (Basic_block* new_bb, *epilogue)
+		cfg->add_bb (new_bb);
+
+	Basic_block* callee_bb;
+	Basic_block* copy;
+	foreach (tie (callee_bb, copy), copies)
+	{
+		if (!isa<Entry_block> (callee_bb) && !isa<Exit_block> (callee_bb))
+			cfg->add_bb (copy);
+	}
+
+
+	// Add the edges.
+	Basic_block* succ = bb->get_successor ();
+	cfg->remove_edge (bb->get_successor_edge ());
+
+	Basic_block* prev = bb;
+	foreach (Basic_block* new_bb, *prologue)
+	{
+		cfg->add_edge (prev, new_bb);
+		prev = new_bb;
+	}
 
-	DEBUG ("BB " << bb->ID << ": removing call to " << *info->name);
+	foreach (tie (callee_bb, copy), copies)
+	{
+		if (Branch_block* br = dynamic_cast<Branch_block*> (callee_bb))
+		{
+			cfg->add_branch (
+				dyc<Branch_block> (copy),
+				copies[br->get_true_successor ()],
+				copies[br->get_false_successor ()]);
+		}
+		else
+		{
+			foreach (Basic_block* target, *callee_bb->get_successors ())
+				cfg->add_edge (copy, copies[target]);
+		}
+	}
 
-	// Remove it
-	out->clear ();
+	prev = NULL;
+	foreach (Basic_block* new_bb, *epilogue)
+	{
+		if (prev)
+			cfg->add_edge (prev, new_bb);
+		prev = new_bb;
+	}
+	cfg->add_edge (prev, succ);
 }
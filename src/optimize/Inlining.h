@@ -2,7 +2,8 @@
  * phc -- the open source PHP compiler
  * See doc/license/README.license for licensing information
  *
- * Very simple inlining. Probably just removing calls to empty functions.
+ * Inline calls to small user functions, by copying the callee's CFG into the
+ * caller.
  */
 
 #ifndef PHC_INLINING
@@ -10,10 +11,29 @@
 
 #include "Visit_once.h"
 
+class User_method_info;
+
 class Inlining : public Visit_once
 {
 public:
+	Inlining ();
+
+	void run (CFG* cfg);
+
 	void transform_eval_expr (Statement_block* in, MIR::Eval_expr*, BB_list* out);
+	void transform_assign_var (Statement_block* in, MIR::Assign_var*, BB_list* out);
+
+private:
+	// Return the callee if the call at BB can be inlined, and the cost model
+	// says it should be.
+	User_method_info* get_inlinable_callee (Statement_block* bb, MIR::Method_invocation* mi);
+
+	// Replace the call at BB with a copy of INFO's CFG. The return value is
+	// assigned to LHS, if it is not NULL.
+	void inline_call (Statement_block* bb, MIR::VARIABLE_NAME* lhs, MIR::Method_invocation* mi, User_method_info* info);
+
+	// The number of statements the current method may grow by.
+	int budget;
 };
 
 #endif // PHC_INLINING
@@ -5,6 +5,8 @@
  * Try to model functions as accurately as possible.
  */
 
+#include <limits.h>
+
 #include "Method_info.h"
 #include "Class_info.h"
 #include "Basic_block.h"
@@ -30,6 +32,8 @@ User_method_info::User_method_info (Method* method)
 , method (method)
 , signature (method->signature->clone())
 , side_effecting (true)
+, recursive (true)
+, caller_count (INT_MAX)
 {
 }
 
@@ -39,6 +43,8 @@ User_method_info::User_method_info (User_class_info* class_info, Method* method)
 , method (method)
 , signature (method->signature->clone())
 , side_effecting (true)
+, recursive (true)
+, caller_count (INT_MAX)
 {
 	if (!signature->method_mod->is_static)
 	{
@@ -121,6 +127,30 @@ User_method_info::get_side_effecting ()
 	return side_effecting;
 }
 
+void
+User_method_info::set_recursive (bool recursive)
+{
+	this->recursive = recursive;
+}
+
+bool
+User_method_info::get_recursive ()
+{
+	return recursive;
+}
+
+void
+User_method_info::set_caller_count (int caller_count)
+{
+	this->caller_count = caller_count;
+}
+
+int
+User_method_info::get_caller_count ()
+{
+	return caller_count;
+}
+
 String*
 UNNAMED (int param_index)
 {
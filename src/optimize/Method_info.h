@@ -120,6 +120,8 @@ private:
 	MIR::Method* method;
 	MIR::Signature* signature;
 	bool side_effecting;
+	bool recursive;
+	int caller_count;
 
 
 public:
@@ -137,6 +139,13 @@ public:
 	bool get_side_effecting ();
 	void set_side_effecting (bool);
 
+	// From the callgraph, for inlining. Until they are summarized, methods
+	// are assumed to be recursive, with many callers.
+	bool get_recursive ();
+	void set_recursive (bool);
+	int get_caller_count ();
+	void set_caller_count (int);
+
 	MIR::Method* get_method ();
 	virtual Class_info* get_class_info ();
 	virtual CFG* get_cfg ();
@@ -73,6 +73,21 @@ Aliasing::dump_everything (string comment) const
 		dump (cx, R_OUT, comment);
 }
 
+// The number of nodes and edges in the graph
+long
+Aliasing::get_result_size (Context* cx) const
+{
+	if (!outs.has (cx))
+		return 0;
+
+	Points_to* ptg = outs.at (cx);
+	return ptg->get_nodes ()->size ()
+		+ ptg->get_field_edges ()->size ()
+		+ ptg->get_points_to_edges ()->size ()
+		+ ptg->get_possible_reference_edges ()->size ()
+		+ ptg->get_definite_reference_edges ()->size ();
+}
+
 void
 Aliasing::init (Context* outer)
 {
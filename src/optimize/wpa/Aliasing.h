@@ -85,6 +85,7 @@ public:
 	bool equals (WPA* other);
 	void dump (Context* cx, Result_state state, string comment) const;
 	void dump_everything (string comment) const;
+	long get_result_size (Context* cx) const;
 
 	void merge_contexts ();
 
@@ -76,6 +76,55 @@ Callgraph::bottom_up ()
 	return result;
 }
 
+bool
+Callgraph::is_recursive (Method_info* info)
+{
+	Method_info_list* worklist = new Method_info_list;
+	worklist->push_back (info);
+
+	Set<Method_info*> seen;
+
+	while (worklist->size ())
+	{
+		Method_info* caller = worklist->front ();
+		worklist->pop_front ();
+
+		// Dont use [], which would add an entry.
+		if (!call_edges.has (caller))
+			continue;
+
+		foreach (Method_info* callee, call_edges[caller])
+		{
+			if (callee == info)
+				return true;
+
+			if (seen.has (callee))
+				continue;
+
+			seen.insert (callee);
+			worklist->push_back (callee);
+		}
+	}
+
+	return false;
+}
+
+int
+Callgraph::get_caller_count (Method_info* info)
+{
+	int count = 0;
+
+	Method_info* caller;
+	Set<Method_info*> callees;
+	foreach (tie (caller, callees), call_edges)
+	{
+		if (callees.has (info))
+			count++;
+	}
+
+	return count;
+}
+
 bool
 Callgraph::equals (WPA* wpa)
 {
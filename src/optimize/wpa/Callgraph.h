@@ -27,6 +27,12 @@ public:
 	Method_info_list* get_called_methods ();
 	Method_info_list* bottom_up ();
 
+	// Can INFO call itself, directly or indirectly?
+	bool is_recursive (Method_info* info);
+
+	// The number of methods which call INFO.
+	int get_caller_count (Method_info* info);
+
 	bool equals (WPA* other);
 	void dump (Context* cx, Result_state state, string comment) const;
 	void dump_everything (string comment) const;
@@ -8,6 +8,7 @@
 
 #include "Aliasing.h"
 #include "Points_to.h"
+#include "VRP.h"
 #include "Whole_program.h"
 
 #include "Optimization_annotator.h"
@@ -61,6 +62,7 @@ Optimization_annotator::visit_assign_next (Statement_block* bb, MIR::Assign_next
 void
 Optimization_annotator::visit_assign_var (Statement_block* bb, MIR::Assign_var* in)
 {
+	visit_expr (bb, in->rhs);
 }
 
 void
@@ -116,6 +118,12 @@ Optimization_annotator::visit_method_alias (Statement_block* bb, MIR::Method_ali
 void
 Optimization_annotator::visit_pre_op (Statement_block* bb, MIR::Pre_op* in)
 {
+	// See visit_bin_op.
+	if (wp->vrp->is_long_pre_op (Context::non_contextual (bb), in))
+	{
+		CTS ("num_long_pre_ops");
+		in->op->attrs->set_true ("phc.optimize.no_overflow");
+	}
 }
 
 void
@@ -157,6 +165,13 @@ Optimization_annotator::visit_array_next (Statement_block* bb, MIR::Array_next*
 void
 Optimization_annotator::visit_bin_op (Statement_block* bb, MIR::Bin_op* in)
 {
+	// The operands are longs, and the result cannot overflow into a double,
+	// so the code generator can use native arithmetic.
+	if (wp->vrp->is_long_bin_op (Context::non_contextual (bb), in))
+	{
+		CTS ("num_long_bin_ops");
+		in->op->attrs->set_true ("phc.optimize.no_overflow");
+	}
 }
 
 void
@@ -125,6 +125,12 @@ Optimization_transformer::rhs_is_pure (Statement_block* bb, MIR::Expr* in)
 		foreach (Actual_parameter* param, *mi->actual_parameters)
 			if (get_literal (bb, param->rvalue) == NULL)
 				return false;
+
+		// A pure user function defines its own locals, which appear in the
+		// defs. It cant define anything else, so the result is all that
+		// matters.
+		if (Oracle::get_user_method_info (name->value))
+			return true;
 	}
 
 	// If the only definition is the LHS, nothing else has happened
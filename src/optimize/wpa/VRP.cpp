@@ -11,11 +11,722 @@
  *
  * We need this to help determine when integers overflow into doubles.
  *
+ * We only track values which are certainly integers. The lattice is TOP
+ * (nothing known yet), a range [min, max], and BOTTOM (might not be an
+ * integer). Ranges are carried with Abstract_values (see
+ * Whole_program::get_abstract_value), so that copies propagate them.
+ *
+ * Loops need two tricks to converge to something useful:
+ *
+ *	- Ranges are narrowed on the edges out of a branch, using the comparison
+ *	which computed the branch's condition. In
+ *
+ *			for ($i = 0; $i < 10; $i++)
+ *
+ *	$i is [0, 9] in the body, so $i++ cannot overflow.
+ *
+ *	- Ranges which grow when a join block is revisited are widened (a join
+ *	is the only place a cycle can be re-entered, so this is sufficient for
+ *	termination). Bounds are widened to the next threshold, or else to the
+ *	limits of a long. The thresholds come from the basic induction variables
+ *	of the CFG, and the loop exit tests they are compared against. For the
+ *	loop above, $i's threshold is 10, so after the loop $i is [10, 10].
+ *
+ *	Induction variable recognition is just a heuristic for the thresholds -
+ *	if it is wrong, the range will grow past the threshold, and be widened
+ *	again.
  */
 
+#include <algorithm>
+#include <limits.h>
+#include <stdlib.h>
+
+#include "Points_to.h"
+#include "Whole_program.h"
 #include "VRP.h"
+#include "process_ir/IR.h"
+
+using namespace std;
+using namespace boost;
+using namespace MIR;
+
+/*
+ * Overflow-checked arithmetic. These return true if the operation would
+ * overflow, and otherwise store the result in RESULT.
+ */
+
+static bool
+add_overflows (long left, long right, long* result)
+{
+	if ((right > 0 && left > LONG_MAX - right)
+		|| (right < 0 && left < LONG_MIN - right))
+		return true;
+
+	*result = left + right;
+	return false;
+}
+
+static bool
+sub_overflows (long left, long right, long* result)
+{
+	if ((right < 0 && left > LONG_MAX + right)
+		|| (right > 0 && left < LONG_MIN + right))
+		return true;
+
+	*result = left - right;
+	return false;
+}
+
+static bool
+mul_overflows (long left, long right, long* result)
+{
+	if (left > 0)
+	{
+		if (right > 0 ? left > LONG_MAX / right : right < LONG_MIN / left)
+			return true;
+	}
+	else
+	{
+		if (right > 0 ? left < LONG_MIN / right : (left != 0 && right < LONG_MAX / left))
+			return true;
+	}
+
+	*result = left * right;
+	return false;
+}
+
 
 VRP::VRP (Whole_program* wp)
-: WPA (wp)
+: WPA_lattice<const Alias_name*, const Range_cell> (wp)
+{
+}
+
+const Alias_name*
+VRP::context_merge_key (const Alias_name* name) const
+{
+	return name->convert_context_name ();
+}
+
+
+/*
+ * WPA interface
+ */
+
+void
+VRP::set_storage (Context* cx, const Storage_node* storage, const Types* types)
+{
+	Lattice_type& lat = working[cx];
+
+	lat[storage] = lat[storage]->meet (Range_cell::BOTTOM);
+}
+
+void
+VRP::set_scalar (Context* cx, const Value_node* storage, const Abstract_value* val)
+{
+	Lattice_type& lat = working[cx];
+
+	lat[storage] = lat[storage]->meet (Range_cell::from_abstract_value (val));
+}
+
+void
+VRP::pull_possible_null (Context* cx, const Index_node* index)
+{
+	Lattice_type& lat = ins[cx];
+
+	lat[index] = Range_cell::BOTTOM;
+	lat[SCLVAL (index)] = Range_cell::BOTTOM;
+}
+
+void
+VRP::kill_value (Context* cx, const Index_node* lhs, bool also_kill_refs)
+{
+	Lattice_type& lat = working[cx];
+	lat.erase (lhs);
+	lat.erase (SCLVAL (lhs));
+}
+
+void
+VRP::remove_fake_node (Context* cx, const Index_node* fake)
+{
+	this->kill_value (cx, fake, false /* dont care */);
+}
+
+void
+VRP::assign_value (Context* cx, const Index_node* lhs, const Storage_node* storage)
+{
+	Lattice_type& lat = working[cx];
+
+	lat[lhs] = lat[lhs]->meet (lat[storage]);
+}
+
+void
+VRP::pull_init (Context* cx)
+{
+	// Keep the previous result, for widening.
+	if (ins.has (cx))
+		old_ins[cx] = ins[cx];
+
+	WPA_lattice<const Alias_name*, const Range_cell>::pull_init (cx);
+}
+
+void
+VRP::pull_first_pred (Context* cx, Context* pred)
+{
+	ins[cx].merge (refine_branch (cx, pred));
+}
+
+void
+VRP::pull_pred (Context* cx, Context* pred)
+{
+	ins[cx].merge (refine_branch (cx, pred));
+}
+
+void
+VRP::pull_finish (Context* cx)
+{
+	Basic_block* bb = cx->get_bb ();
+
+	if (old_ins.has (cx) && bb->get_predecessors ()->size () > 1)
+	{
+		// Get the thresholds by alias name.
+		string ns = cx->symtable_name ();
+		Map<string, List<long>*> by_name;
+
+		string var;
+		List<long>* list;
+		foreach (tie (var, list), *get_thresholds (bb->cfg))
+		{
+			Index_node* index = IN (ns, var);
+			by_name[index->str ()] = list;
+			by_name[SCLVAL (index)->str ()] = list;
+		}
+
+		// Widen anything which has grown since the last visit.
+		Lattice_type& old = old_ins[cx];
+		Lattice_type widened;
+
+		const Alias_name* name;
+		const Range_cell* cell;
+		foreach (tie (name, cell), ins[cx])
+		{
+			if (old.has (name))
+			{
+				string key = name->str ();
+				cell = old[name]->widen (cell, by_name.has (key) ? by_name[key] : NULL);
+			}
+
+			widened[name] = cell;
+		}
+
+		ins[cx] = widened;
+	}
+
+	WPA_lattice<const Alias_name*, const Range_cell>::pull_finish (cx);
+}
+
+void
+VRP::merge_contexts ()
 {
+	old_ins.clear ();
+
+	WPA_lattice<const Alias_name*, const Range_cell>::merge_contexts ();
+}
+
+
+/*
+ * Narrowing on branch edges
+ */
+
+// Narrow NAME to [MIN, MAX], if it is known to be an integer.
+static void
+narrow (Lattice_map<const Alias_name*, const Range_cell>& lat, const Alias_name* name, long min, long max)
+{
+	if (lat.has (name))
+		lat[name] = lat[name]->intersect (min, max);
+}
+
+Lattice_map<const Alias_name*, const Range_cell>*
+VRP::refine_branch (Context* cx, Context* pred)
+{
+	Lattice_type* result = &outs[pred];
+
+	Branch_block* branch = dynamic_cast<Branch_block*> (pred->get_bb ());
+	if (branch == NULL)
+		return result;
+
+	bool true_edge = branch->get_true_successor () == cx->get_bb ();
+	bool false_edge = branch->get_false_successor () == cx->get_bb ();
+	if (true_edge == false_edge)
+		return result;
+
+	// The condition must be computed in the statement immediately before the
+	// branch, or its operands might have changed in between.
+	BB_list* preds = branch->get_predecessors ();
+	if (preds->size () != 1)
+		return result;
+
+	Statement_block* sb = dynamic_cast<Statement_block*> (preds->front ());
+	if (sb == NULL)
+		return result;
+
+	Assign_var* assign = dynamic_cast<Assign_var*> (sb->statement);
+	if (assign == NULL || !assign->lhs->equals (branch->branch->variable_name))
+		return result;
+
+	Bin_op* bin_op = dynamic_cast<Bin_op*> (assign->rhs);
+	if (bin_op == NULL)
+		return result;
+
+	// Normalize to LEFT < RIGHT or LEFT <= RIGHT.
+	string op = *bin_op->op->value;
+	Rvalue* left = bin_op->left;
+	Rvalue* right = bin_op->right;
+	if (op == ">" || op == ">=")
+	{
+		swap (left, right);
+		op = (op == ">") ? "<" : "<=";
+	}
+
+	if (op != "<" && op != "<=")
+		return result;
+
+	// The comparison is only numeric if both sides are integers.
+	const Abstract_value* lval = wp->get_abstract_value (pred, R_OUT, left);
+	const Abstract_value* rval = wp->get_abstract_value (pred, R_OUT, right);
+	const Range_cell* lrange = Range_cell::from_abstract_value (lval);
+	const Range_cell* rrange = Range_cell::from_abstract_value (rval);
+	if (!lrange->is_int () || !rrange->is_int ())
+		return result;
+
+	// The strict part of the comparison. The bounds are clamped, in case the
+	// edge is not executable.
+	long strict = (op == "<") ? 1 : 0;
+
+	long lmax, lmin, rmin, rmax;
+	if (true_edge)
+	{
+		// LEFT <= RIGHT - STRICT
+		if (sub_overflows (rrange->max, strict, &lmax)
+			|| add_overflows (lrange->min, strict, &rmin))
+			return result;
+
+		lmin = LONG_MIN;
+		rmax = LONG_MAX;
+	}
+	else
+	{
+		// LEFT >= RIGHT + (1 - STRICT)
+		if (add_overflows (rrange->min, 1 - strict, &lmin)
+			|| sub_overflows (lrange->max, 1 - strict, &rmax))
+			return result;
+
+		lmax = LONG_MAX;
+		rmin = LONG_MIN;
+	}
+
+	result = new Lattice_type (outs[pred]);
+	string ns = pred->symtable_name ();
+
+	if (VARIABLE_NAME* var = dynamic_cast<VARIABLE_NAME*> (left))
+	{
+		narrow (*result, VN (ns, var), lmin, lmax);
+		narrow (*result, SCLVAL (VN (ns, var)), lmin, lmax);
+	}
+
+	if (VARIABLE_NAME* var = dynamic_cast<VARIABLE_NAME*> (right))
+	{
+		narrow (*result, VN (ns, var), rmin, rmax);
+		narrow (*result, SCLVAL (VN (ns, var)), rmin, rmax);
+	}
+
+	return result;
+}
+
+
+/*
+ * Induction variables
+ */
+
+// Match $v + c, c + $v or $v - c. Return the name of $v in VAR and c in
+// STEP.
+static bool
+match_increment (Expr* in, string* var, long* step)
+{
+	Bin_op* bin_op = dynamic_cast<Bin_op*> (in);
+	if (bin_op == NULL)
+		return false;
+
+	string op = *bin_op->op->value;
+	Rvalue* left = bin_op->left;
+	Rvalue* right = bin_op->right;
+
+	if (op == "+" && isa<INT> (left))
+		swap (left, right);
+
+	if ((op != "+" && op != "-")
+		|| !isa<VARIABLE_NAME> (left)
+		|| !isa<INT> (right))
+		return false;
+
+	*var = *dyc<VARIABLE_NAME> (left)->value;
+	*step = dyc<INT> (right)->value;
+
+	if (op == "-")
+	{
+		if (*step == LONG_MIN)
+			return false;
+
+		*step = -*step;
+	}
+
+	return true;
+}
+
+static void
+add_step (Map<string, long>& steps, Set<string>& non_ivs, string var, long step)
+{
+	if (step == 0 || (steps.has (var) && (steps[var] > 0) != (step > 0)))
+	{
+		non_ivs.insert (var);
+		return;
+	}
+
+	// Keep the largest step, which gives the most conservative threshold.
+	if (!steps.has (var) || labs (step) > labs (steps[var]))
+		steps[var] = step;
+}
+
+Map<string, List<long>*>*
+VRP::get_thresholds (CFG* cfg)
+{
+	if (thresholds.has (cfg))
+		return thresholds[cfg];
+
+	// Temporaries holding an increment, for $T = $i + 1; $i = $T;
+	Map<string, Expr*> temps;
+	Map<string, int> def_counts;
+
+	foreach (Basic_block* bb, *cfg->get_all_bbs ())
+	{
+		Statement_block* sb = dynamic_cast<Statement_block*> (bb);
+		if (sb == NULL)
+			continue;
+
+		if (Assign_var* assign = dynamic_cast<Assign_var*> (sb->statement))
+		{
+			string lhs = *assign->lhs->value;
+			def_counts[lhs]++;
+			temps[lhs] = assign->rhs;
+		}
+	}
+
+	// Find the basic induction variables: variables whose only definitions
+	// are integer literals, or increments by a constant step.
+	Map<string, long> steps;
+	Set<string> non_ivs;
+	List<Bin_op*> comparisons;
+
+	foreach (Basic_block* bb, *cfg->get_all_bbs ())
+	{
+		Statement_block* sb = dynamic_cast<Statement_block*> (bb);
+		if (sb == NULL)
+			continue;
+
+		if (Pre_op* pre_op = dynamic_cast<Pre_op*> (sb->statement))
+		{
+			add_step (steps, non_ivs, *pre_op->variable_name->value,
+						 *pre_op->op->value == "++" ? 1 : -1);
+		}
+		else if (Assign_var* assign = dynamic_cast<Assign_var*> (sb->statement))
+		{
+			string lhs = *assign->lhs->value;
+			Expr* rhs = assign->rhs;
+
+			// Look through the temporary.
+			if (VARIABLE_NAME* temp = dynamic_cast<VARIABLE_NAME*> (rhs))
+			{
+				if (def_counts[*temp->value] == 1)
+					rhs = temps[*temp->value];
+			}
+
+			string var;
+			long step;
+			if (assign->is_ref)
+				non_ivs.insert (lhs);
+			else if (isa<INT> (rhs))
+				; // initialization
+			else if (match_increment (rhs, &var, &step) && var == lhs)
+				add_step (steps, non_ivs, lhs, step);
+			else
+				non_ivs.insert (lhs);
+
+			if (isa<Bin_op> (assign->rhs))
+				comparisons.push_back (dyc<Bin_op> (assign->rhs));
+		}
+	}
+
+	// The thresholds are the last values the induction variable can take
+	// before it fails its loop test.
+	Map<string, List<long>*>* result = new Map<string, List<long>*>;
+	foreach (Bin_op* bin_op, comparisons)
+	{
+		string op = *bin_op->op->value;
+		Rvalue* left = bin_op->left;
+		Rvalue* right = bin_op->right;
+
+		// Normalize to $v OP K.
+		if (isa<INT> (left))
+		{
+			swap (left, right);
+			if (op == "<") op = ">";
+			else if (op == "<=") op = ">=";
+			else if (op == ">") op = "<";
+			else if (op == ">=") op = "<=";
+		}
+
+		if (!isa<VARIABLE_NAME> (left) || !isa<INT> (right))
+			continue;
+
+		string var = *dyc<VARIABLE_NAME> (left)->value;
+		long bound = dyc<INT> (right)->value;
+		if (!steps.has (var) || non_ivs.has (var))
+			continue;
+
+		long step = steps[var];
+		long threshold;
+		bool overflows;
+		if (step > 0 && op == "<")
+			overflows = bound == LONG_MIN || add_overflows (bound - 1, step, &threshold);
+		else if (step > 0 && op == "<=")
+			overflows = add_overflows (bound, step, &threshold);
+		else if (step < 0 && op == ">")
+			overflows = bound == LONG_MAX || add_overflows (bound + 1, step, &threshold);
+		else if (step < 0 && op == ">=")
+			overflows = add_overflows (bound, step, &threshold);
+		else
+			continue;
+
+		if (overflows)
+			continue;
+
+		DEBUG ("Induction variable $" << var << " has step " << step
+				<< " and threshold " << threshold);
+
+		if (!result->has (var))
+			(*result)[var] = new List<long>;
+
+		(*result)[var]->push_back (threshold);
+	}
+
+	thresholds[cfg] = result;
+	return result;
+}
+
+
+/*
+ * Ranges
+ */
+
+const Range_cell*
+VRP::get_range (Context* cx, Result_state state, const Alias_name* name) const
+{
+	return lattices[state][cx][name];
+}
+
+const Range_cell*
+VRP::get_bin_op_range (const Abstract_value* left, string op, const Abstract_value* right)
+{
+	const Range_cell* l = Range_cell::from_abstract_value (left);
+	const Range_cell* r = Range_cell::from_abstract_value (right);
+
+	if (!l->is_int () || !r->is_int ())
+		return NULL;
+
+	long min, max;
+	if (op == "+")
+	{
+		if (add_overflows (l->min, r->min, &min)
+			|| add_overflows (l->max, r->max, &max))
+			return NULL;
+	}
+	else if (op == "-")
+	{
+		if (sub_overflows (l->min, r->max, &min)
+			|| sub_overflows (l->max, r->min, &max))
+			return NULL;
+	}
+	else if (op == "*")
+	{
+		long products[4];
+		if (mul_overflows (l->min, r->min, &products[0])
+			|| mul_overflows (l->min, r->max, &products[1])
+			|| mul_overflows (l->max, r->min, &products[2])
+			|| mul_overflows (l->max, r->max, &products[3]))
+			return NULL;
+
+		min = *std::min_element (products, products + 4);
+		max = *std::max_element (products, products + 4);
+	}
+	else
+		return NULL;
+
+	return new Range_cell (min, max);
+}
+
+const Range_cell*
+VRP::get_pre_op_range (const Abstract_value* operand, string op)
+{
+	INT* one = new INT (1);
+	return get_bin_op_range (operand, op == "++" ? "+" : "-", new Abstract_value (one));
+}
+
+bool
+VRP::is_long_bin_op (Context* cx, Bin_op* in)
+{
+	if (!has_analysis_result (cx, R_IN))
+		return false;
+
+	const Abstract_value* left = wp->get_abstract_value (cx, R_IN, in->left);
+	const Abstract_value* right = wp->get_abstract_value (cx, R_IN, in->right);
+
+	return get_bin_op_range (left, *in->op->value, right) != NULL;
+}
+
+bool
+VRP::is_long_pre_op (Context* cx, Pre_op* in)
+{
+	if (!has_analysis_result (cx, R_IN))
+		return false;
+
+	const Abstract_value* operand = wp->get_abstract_value (cx, R_IN, in->variable_name);
+
+	return get_pre_op_range (operand, *in->op->value) != NULL;
+}
+
+
+
+/*
+ * Lattice_cell interface
+ */
+
+const Range_cell* Range_cell::TOP = new Range_cell;
+const Range_cell* Range_cell::BOTTOM = new Range_cell;
+
+Range_cell::Range_cell ()
+: min (LONG_MAX)
+, max (LONG_MIN)
+{
+}
+
+Range_cell::Range_cell (long min, long max)
+: min (min)
+, max (max)
+{
+	assert (min <= max);
+}
+
+void
+Range_cell::dump (std::ostream& os) const
+{
+	if (this == TOP)
+		os << "(T)";
+	else if (this == BOTTOM)
+		os << "(B)";
+	else
+		os << "[" << min << ", " << max << "]";
+}
+
+bool
+Range_cell::is_int () const
+{
+	return this != TOP && this != BOTTOM;
+}
+
+bool
+Range_cell::equals (const Range_cell* other) const
+{
+	if (!this->is_int () || !other->is_int ())
+		return this == other;
+
+	return this->min == other->min && this->max == other->max;
+}
+
+const Range_cell*
+Range_cell::meet (const Range_cell* other) const
+{
+	if (this == TOP)
+		return other;
+
+	if (other == TOP)
+		return this;
+
+	if (this == BOTTOM || other == BOTTOM)
+		return BOTTOM;
+
+	return new Range_cell (
+		std::min (this->min, other->min),
+		std::max (this->max, other->max));
+}
+
+const Range_cell*
+Range_cell::widen (const Range_cell* other, const List<long>* thresholds) const
+{
+	if (!this->is_int () || !other->is_int ())
+		return this->meet (other);
+
+	long min = this->min;
+	if (other->min < min)
+	{
+		min = LONG_MIN;
+		if (thresholds)
+			foreach (long t, *thresholds)
+				if (t <= other->min && t > min)
+					min = t;
+	}
+
+	long max = this->max;
+	if (other->max > max)
+	{
+		max = LONG_MAX;
+		if (thresholds)
+			foreach (long t, *thresholds)
+				if (t >= other->max && t < max)
+					max = t;
+	}
+
+	return new Range_cell (min, max);
+}
+
+const Range_cell*
+Range_cell::intersect (long min, long max) const
+{
+	if (!this->is_int ())
+		return this;
+
+	min = std::max (this->min, min);
+	max = std::min (this->max, max);
+
+	// The path is not executable, but we dont model that here.
+	if (min > max)
+		return this;
+
+	return new Range_cell (min, max);
+}
+
+const Range_cell*
+Range_cell::get_default ()
+{
+	return TOP;
+}
+
+const Range_cell*
+Range_cell::from_abstract_value (const Abstract_value* absval)
+{
+	if (const INT* lit = dynamic_cast<const INT*> (absval->lit))
+		return new Range_cell (lit->value, lit->value);
+
+	if (absval->range)
+		return absval->range;
+
+	return BOTTOM;
 }
@@ -17,13 +17,107 @@
 #ifndef PHC_VRP
 #define PHC_VRP
 
-#include "WPA.h"
+#include "WPA_lattice.h"
 
-class VRP : public WPA
+class Range_cell;
+
+class VRP : public WPA_lattice <const Alias_name*, const Range_cell>
 {
 public:
 	VRP (Whole_program* wp);
-	void dump ();
+
+	/*
+	 * WPA lattice interface
+	 */
+	const Alias_name* context_merge_key (const Alias_name*) const;
+
+	/*
+	 * WPA interface
+	 */
+	void set_storage (Context* cx, const Storage_node* storage, const Types* types);
+	void set_scalar (Context* cx, const Value_node* storage, const Abstract_value* val);
+	void pull_possible_null (Context* cx, const Index_node* node);
+
+	void kill_value (Context* cx, const Index_node*, bool);
+	void assign_value (Context* cx, const Index_node*, const Storage_node*);
+	void remove_fake_node (Context* cx, const Index_node* fake);
+
+	// Narrow the ranges of variables compared in the predecessor branch, and
+	// widen ranges which grow on each visit to a loop.
+	void pull_init (Context* cx);
+	void pull_first_pred (Context* cx, Context* pred);
+	void pull_pred (Context* cx, Context* pred);
+	void pull_finish (Context* cx);
+
+	void merge_contexts ();
+
+	/*
+	 * Ranges
+	 */
+	const Range_cell* get_range (Context* cx, Result_state state, const Alias_name* name) const;
+
+	// Return the range of the result if it is certain to be a long, or NULL
+	// if the operation might overflow into a double.
+	static const Range_cell* get_bin_op_range (const Abstract_value* left, string op, const Abstract_value* right);
+	static const Range_cell* get_pre_op_range (const Abstract_value* operand, string op);
+
+	// Can the operation be performed using native long arithmetic?
+	bool is_long_bin_op (Context* cx, MIR::Bin_op* in);
+	bool is_long_pre_op (Context* cx, MIR::Pre_op* in);
+
+private:
+	Lattice_type* refine_branch (Context* cx, Context* pred);
+	Map<string, List<long>*>* get_thresholds (CFG* cfg);
+
+	// Ins from the previous visit of each block, for widening.
+	CX_lattices<const Alias_name*, const Range_cell> old_ins;
+
+	// Widening thresholds, from the induction variables of each CFG.
+	Map<CFG*, Map<string, List<long>*>*> thresholds;
+};
+
+
+/*
+ * The range of values an integer might take. Anything which might not be an
+ * integer is BOTTOM.
+ */
+class Range_cell : virtual public GC_obj
+{
+public:
+	const long min;
+	const long max;
+
+	Range_cell (long min, long max);
+
+public:
+	void dump (std::ostream& os = cdebug) const;
+	bool equals (const Range_cell* other) const;
+	const Range_cell* meet (const Range_cell* other) const;
+
+	// Widen THIS, the result from a previous visit, to include OTHER. Bounds
+	// which grow are extended to the next threshold, or to the limits of a
+	// long.
+	const Range_cell* widen (const Range_cell* other, const List<long>* thresholds) const;
+
+	// Intersect with [MIN, MAX]. If they do not overlap, the path is not
+	// executable, but we dont model that here.
+	const Range_cell* intersect (long min, long max) const;
+
+	bool is_int () const;
+
+	static const Range_cell* get_default ();
+	static const Range_cell* from_abstract_value (const Abstract_value* absval);
+	static const Range_cell* TOP;
+	static const Range_cell* BOTTOM;
+
+private:
+	Range_cell ();
 };
 
+SET_COMPARABLE (Range_cell);
+typedef Lattice_map<const Alias_name*, const Range_cell> __range_lattice_type;
+typedef CX_lattices<const Alias_name*, const Range_cell> __range_cx_lattice_type;
+SET_COMPARABLE (__range_lattice_type);
+SET_COMPARABLE (__range_cx_lattice_type);
+
 #endif // PHC_VRP
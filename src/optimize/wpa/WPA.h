@@ -211,6 +211,10 @@ public:
 
 	virtual void dump_everything (string comment) const= 0;
 
+	// The size of the results for CX, for --wpa-trace, or -1 if the analysis
+	// has no measure of its size.
+	virtual long get_result_size (Context* cx) const { return -1; }
+
 private:
 	/* Some helper functions for merges */
 };
@@ -167,6 +167,14 @@ public:
 		outs.dump_everything ("OUT");
 	}
 
+	long get_result_size (Context* cx) const
+	{
+		if (!outs.has (cx))
+			return 0;
+
+		return outs.at (cx).size ();
+	}
+
 	void merge_contexts ()
 	{
 		working.clear ();
@@ -0,0 +1,120 @@
+/*
+ * phc -- the open source PHP compiler
+ * See doc/license/README.license for licensing information
+ *
+ * Trace the cost and convergence of the whole-program analysis.
+ */
+
+#include <sys/time.h>
+
+#include "WPA_trace.h"
+#include "lib/error.h"
+#include "lib/escape.h"
+#include "process_ir/General.h"
+
+using namespace std;
+
+WPA_trace::WPA_trace (const char* filename)
+: iteration (0)
+, iteration_start (0)
+{
+	out = new ofstream (filename);
+	if (!*out)
+		phc_error ("Cannot open %s for writing", filename);
+}
+
+double
+WPA_trace::now ()
+{
+	struct timeval tv;
+	gettimeofday (&tv, NULL);
+	return tv.tv_sec + tv.tv_usec / 1e6;
+}
+
+string
+WPA_trace::quote (string in)
+{
+	return "\"" + *escape_C_dq (s(in)) + "\"";
+}
+
+void
+WPA_trace::start_iteration (int iteration)
+{
+	this->iteration = iteration;
+	iteration_start = now ();
+}
+
+void
+WPA_trace::end_iteration (bool converged, List<string>* unconverged)
+{
+	*out
+	<< "{\"event\": \"iteration\""
+	<< ", \"iteration\": " << iteration
+	<< ", \"time\": " << now () - iteration_start
+	<< ", \"converged\": " << (converged ? "true" : "false")
+	<< ", \"unconverged\": [";
+
+	bool first = true;
+	foreach (string name, *unconverged)
+	{
+		*out << (first ? "" : ", ") << quote (name);
+		first = false;
+	}
+
+	*out << "]}" << endl;
+}
+
+void
+WPA_trace::failed (string reason)
+{
+	*out
+	<< "{\"event\": \"failed\""
+	<< ", \"iteration\": " << iteration
+	<< ", \"reason\": " << quote (reason)
+	<< "}" << endl;
+}
+
+void
+WPA_trace::start_function ()
+{
+	function_starts.push_back (now ());
+	callee_times.push_back (0);
+}
+
+void
+WPA_trace::end_function (string function, string context,
+		int blocks, int worklist_max,
+		long ptg_nodes, long ptg_edges,
+		Map<string, long>* lattice_sizes)
+{
+	double time = now () - function_starts.back ();
+	double self_time = time - callee_times.back ();
+	function_starts.pop_back ();
+	callee_times.pop_back ();
+
+	if (callee_times.size ())
+		callee_times.back () += time;
+
+	*out
+	<< "{\"event\": \"function\""
+	<< ", \"iteration\": " << iteration
+	<< ", \"function\": " << quote (function)
+	<< ", \"context\": " << quote (context)
+	<< ", \"blocks\": " << blocks
+	<< ", \"worklist_max\": " << worklist_max
+	<< ", \"time\": " << time
+	<< ", \"self_time\": " << self_time
+	<< ", \"points_to\": {\"nodes\": " << ptg_nodes << ", \"edges\": " << ptg_edges << "}"
+	<< ", \"lattices\": {";
+
+	bool first = true;
+	string name;
+	long size;
+	foreach (boost::tie (name, size), *lattice_sizes)
+	{
+		*out << (first ? "" : ", ") << quote (name) << ": " << size;
+		first = false;
+	}
+
+	*out << "}}" << endl;
+}
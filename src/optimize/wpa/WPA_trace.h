@@ -0,0 +1,71 @@
+/*
+ * phc -- the open source PHP compiler
+ * See doc/license/README.license for licensing information
+ *
+ * Trace the cost and convergence of the whole-program analysis, for
+ * --wpa-trace.
+ *
+ * The trace is written as it goes, one JSON object per line, so that it is
+ * still useful if the analysis fails or crashes. There are three kinds of
+ * record:
+ *
+ *		{"event": "function", "iteration": 1, "function": "f", "context": ...,
+ *		 "blocks": 12, "worklist_max": 3, "time": 0.01, "self_time": 0.005,
+ *		 "points_to": {"nodes": 40, "edges": 52},
+ *		 "lattices": {"constants": 10, ...}}
+ *
+ *			for each function analysed, in each context. "blocks" is the number
+ *			of blocks evaluated, "time" includes the callees' analysis, and the
+ *			sizes are those of the results at the function's exit.
+ *
+ *		{"event": "iteration", "iteration": 1, "time": 0.5,
+ *		 "converged": false, "unconverged": ["aliasing", ...]}
+ *
+ *			at the end of each outer iteration. "unconverged" lists the analyses
+ *			whose results differ from the last iteration.
+ *
+ *		{"event": "failed", "iteration": 10, "reason": "Does not converge"}
+ *
+ * misc/wpa_trace_summary.php summarises a trace.
+ */
+
+#ifndef PHC_WPA_TRACE
+#define PHC_WPA_TRACE
+
+#include <fstream>
+#include <string>
+
+#include "lib/List.h"
+#include "lib/Map.h"
+
+class WPA_trace : virtual public GC_obj
+{
+public:
+	WPA_trace (const char* filename);
+
+	void start_iteration (int iteration);
+	void end_iteration (bool converged, List<std::string>* unconverged);
+	void failed (std::string reason);
+
+	// Calls can be nested, for the analysis of callees.
+	void start_function ();
+	void end_function (std::string function, std::string context,
+			int blocks, int worklist_max,
+			long ptg_nodes, long ptg_edges,
+			Map<std::string, long>* lattice_sizes);
+
+private:
+	std::ofstream* out;
+	int iteration;
+	double iteration_start;
+
+	// Start times, and the time spent in callees, of the functions being
+	// analysed.
+	List<double> function_starts;
+	List<double> callee_times;
+
+	static double now ();
+	static std::string quote (std::string in);
+};
+
+#endif // PHC_WPA_TRACE
@@ -66,6 +66,7 @@
 
 #include "process_ir/General.h"
 #include "pass_manager/Pass_manager.h"
+#include "pass_manager/Pass_timer.h"
 
 #include "optimize/Abstract_value.h"
 #include "optimize/Edge.h"
@@ -88,9 +89,11 @@
 #include "Optimization_annotator.h"
 #include "Optimization_transformer.h"
 #include "Stat_collector.h"
+#include "WPA_trace.h"
 #include "Points_to.h"
 
 #include "lib/error.h"
+#include "embed/embed.h"
 #include <iostream>
 
 #define ANON ""
@@ -105,6 +108,10 @@ Whole_program::Whole_program (Pass_manager* pm)
 	annotator = new Optimization_annotator (this);
 	transformer = new Optimization_transformer (this);
 	stat_coll = new Stat_collector (this);
+
+	trace = NULL;
+	if (pm->args_info->wpa_trace_given)
+		trace = new WPA_trace (pm->args_info->wpa_trace_arg);
 }
 
 void
@@ -121,6 +128,14 @@ Whole_program::run (MIR::PHP_script* in)
 	{
 		iteration_num = w;
 
+		stringstream iteration_name;
+		iteration_name << "iteration " << (w+1);
+		Pass_timer_scope iteration_timing (pm->timer, "wpa", iteration_name.str ());
+
+		if (trace)
+			trace->start_iteration (w+1);
+
+		Pass_timer_scope analysis_timing (pm->timer, "wpa", "analysis");
 		initialize (outer_cx);
 
 		// Perform the whole-program analysis
@@ -138,6 +153,7 @@ Whole_program::run (MIR::PHP_script* in)
 		merge_contexts ();
 
 		dump (new Context, R_OUT, "after context merge");
+		analysis_timing.stop ();
 
 
 		// Optimize based on analysis results
@@ -172,11 +188,22 @@ Whole_program::run (MIR::PHP_script* in)
 
 		// Check if we can stop iterating the Whole-program solution.
 		DEBUG ((w+1) << "th Whole-program pass");
-		if (analyses_have_converged ())
+		List<string>* unconverged = trace ? new List<string> : NULL;
+		bool converged = analyses_have_converged (unconverged);
+
+		if (trace)
+			trace->end_iteration (converged, unconverged);
+
+		if (converged)
 			break;
 
 		if (w == 9)
+		{
+			if (trace)
+				trace->failed ("Does not converge");
+
 			phc_optimization_exception ("Does not converge"); // on the examples I'm running, this shouldnt happen.
+		}
 	}
 
 	// All the analysis and iteration is done
@@ -203,24 +230,39 @@ Whole_program::run (MIR::PHP_script* in)
 
 
 bool
-Whole_program::analyses_have_converged ()
+Whole_program::analyses_have_converged (List<string>* unconverged)
 {
 	if (old_analyses.size () == 0)
+	{
+		if (unconverged)
+		{
+			foreach_wpa (this)
+				unconverged->push_back (wpa->name);
+		}
+
 		return false;
+	}
 	
+	bool result = true;
 	List<WPA*>::const_iterator i = old_analyses.begin();
 	foreach_wpa (this)
 	{
 		if (!wpa->equals (*i))
 		{
 			DEBUG (wpa->name << " has not converged");
-			return false;
+			result = false;
+
+			// Keep going to find all the analyses which have not converged.
+			if (unconverged == NULL)
+				return false;
+
+			unconverged->push_back (wpa->name);
 		}
 
 		i++;
 	}
 
-	return true;
+	return result;
 }
 
 void
@@ -237,8 +279,8 @@ Whole_program::initialize (Context* outer_cx)
 	constants = new Constant_state (this);
 	def_use = new Def_use (this);
 	values = new Value_analysis (this);
+	vrp = new VRP (this);
 //	include_analysis = new Include_analysis (this);
-//	vrp = new VRP (this);
 
 	register_analysis ("debug-wpa", new Debug_WPA (this));
 	register_analysis ("aliasing", aliasing);
@@ -246,8 +288,8 @@ Whole_program::initialize (Context* outer_cx)
 	register_analysis ("constants", constants);
 	register_analysis ("def-use", def_use);
 	register_analysis ("values", values);
+	register_analysis ("vrp", vrp);
 //	register_analysis ("Include_analysis", include_analysis);
-//	register_analysis ("VRP", vrp);
 
 
 	/*
@@ -273,10 +315,17 @@ Whole_program::analyse_function (User_method_info* info, Context* caller_cx, MIR
 	// This is very similar to run() from Sparse_conditional_visitor, except
 	// that it isnt sparse.
 
+	if (trace)
+		trace->start_function ();
+
+	int blocks = 0;
+	int worklist_max = 0;
+
 	if (debugging_enabled)
 		cfg->dump_graphviz (s("Function entry"));
 
 	// 1. Initialize:
+	Arena_scope arena;
 	Worklist wl;
 	wl.add (cfg->get_entry_edge ());
 
@@ -292,6 +341,8 @@ Whole_program::analyse_function (User_method_info* info, Context* caller_cx, MIR
 	// 2. Stop when CFG-worklist is empty
 	while (not wl.empty())
 	{
+		worklist_max = max (worklist_max, (int) wl.size ());
+
 		Edge* e = wl.next ();
 		DEBUG (wl.size() << " edges in the worklist");
 
@@ -314,6 +365,7 @@ Whole_program::analyse_function (User_method_info* info, Context* caller_cx, MIR
 		// Analyse the block, storing per-basic-block results.
 		// This does not update the block's structure.
 		bool changed = analyse_block (target_cx);
+		blocks++;
 
 		// Add next	block(s) if the result has changed, or if this the first
 		// time the edge could be executed.
@@ -347,12 +399,41 @@ Whole_program::analyse_function (User_method_info* info, Context* caller_cx, MIR
 		skip_after_die = false;
 	}
 
+	if (trace)
+		trace_function (info, caller_cx, blocks, worklist_max);
+
 	backward_bind (
 		info,
 		Context::contextual (caller_cx, cfg->get_exit_bb ()),
 		lhs);
 }
 
+void
+Whole_program::trace_function (User_method_info* info, Context* caller_cx, int blocks, int worklist_max)
+{
+	Context* exit_cx = Context::contextual (caller_cx, info->get_cfg ()->get_exit_bb ());
+
+	Map<string, long> sizes;
+	foreach_wpa (this)
+	{
+		long size = wpa->get_result_size (exit_cx);
+		if (size != -1)
+			sizes[wpa->name] = size;
+	}
+
+	long nodes = 0;
+	long edges = 0;
+	if (aliasing->outs.has (exit_cx))
+	{
+		Points_to* ptg = aliasing->outs.at (exit_cx);
+		nodes = ptg->get_nodes ()->size ();
+		edges = aliasing->get_result_size (exit_cx) - nodes;
+	}
+
+	trace->end_function (*info->name, caller_cx->name (),
+		blocks, worklist_max, nodes, edges, &sizes);
+}
+
 Edge_list*
 Whole_program::get_successors (Context* cx)
 {
@@ -629,7 +710,7 @@ Whole_program::invoke_method (Context* caller_cx, VARIABLE_NAME* lhs, VARIABLE_N
 	// Make $this explicit, if necessary.
 	if (target && not isa<CLASS_NAME> (target))
 	{
-		params = params->clone ();
+		params = IR::share_list (params);
 		params->push_front (new Actual_parameter (false, target));
 	}
 
@@ -640,8 +721,11 @@ Whole_program::invoke_method (Context* caller_cx, VARIABLE_NAME* lhs, VARIABLE_N
 
 	foreach (Method_info* receiver, *receivers)
 	{
+		// The analysis only reads the parameters, and is finished with them
+		// before they are transformed, so they can be shared.
+		Actual_parameter_list* passed_params = IR::share_list (params);
+
 		// HACK: handle parent::__construct, which is allowed be called without a $this.
-		Actual_parameter_list* passed_params = params->clone ();
 		if (target == NULL && *receiver->name == "__construct")
 			passed_params->push_front (new Actual_parameter (false, new VARIABLE_NAME (s("this"))));
 
@@ -1748,20 +1832,31 @@ Whole_program::apply_results (User_method_info* info)
 			bool saved = debugging_enabled;
 			pm->maybe_enable_debug (s("transformer"));
 
-			Statement* old = sb->statement->clone ();
+			// The transformer changes statements in place, so the only way to
+			// tell if it changed one is to compare it to a clone. Only pay for
+			// that if someone will look at the answer.
+			bool record = debugging_enabled || pm->args_info->stats_given;
+
+			Statement* old = NULL;
+			if (record)
+				old = sb->statement->clone ();
+
 			transformer->visit_block (bb);
 
 			debugging_enabled = saved;
 
-			if (sb->statement->equals (old))
-				DEBUG ("No changes in BB: " << bb->ID);
-			else
+			if (record)
 			{
-				stringstream ss;
-				ss << sb->ID;
-				DEBUG ("BB " << bb->ID << " changed");
-				add_to_stringset_stat ("statements_optimised", ss.str ());
-			}	
+				if (sb->statement->equals (old))
+					DEBUG ("No changes in BB: " << bb->ID);
+				else
+				{
+					stringstream ss;
+					ss << sb->ID;
+					DEBUG ("BB " << bb->ID << " changed");
+					add_to_stringset_stat ("statements_optimised", ss.str ());
+				}	
+			}
 		}
 		else if (isa<Branch_block> (bb))
 		{
@@ -1787,6 +1882,10 @@ Whole_program::annotate_results (User_method_info* info)
 	// single annotator applying the results.
 	foreach (Basic_block* bb, *info->get_cfg ()->get_all_bbs ())
 		annotator->visit_block (bb);
+
+	// Pure functions can be memoized at run-time
+	if (not info->get_side_effecting ())
+		info->get_method ()->signature->attrs->set_true ("phc.optimize.pure");
 }
 
 void
@@ -1835,12 +1934,106 @@ Whole_program::strip (MIR::PHP_script* in)
 	in->transform_children (new Method_pruner ());
 }
 
+/*
+ * A function is pure if its result depends only on its parameters, and it
+ * has no effect other than returning its result. Pure functions can be
+ * evaluated at compile-time when their arguments are known, removed when
+ * their results are unused, and memoized at run-time.
+ */
+class Purity_check : public Visitor
+{
+public:
+	bool pure;
+	String* method_name;
+	Set<string> superglobals;
+
+public:
+	Purity_check (String* method_name)
+	: pure (true)
+	, method_name (method_name)
+	{
+		foreach (VARIABLE_NAME* sg, *PHP::get_superglobals ())
+			superglobals.insert (*sg->value);
+	}
+
+	// Global and static state
+	void pre_global (Global*) { pure = false; }
+	void pre_static_declaration (Static_declaration*) { pure = false; }
+	void pre_variable_name (VARIABLE_NAME* in)
+	{
+		if (superglobals.has (*in->value))
+			pure = false;
+	}
+
+	// Names we cant see
+	void pre_assign_var_var (Assign_var_var*) { pure = false; }
+	void pre_variable_variable (Variable_variable*) { pure = false; }
+	void pre_variable_method (Variable_method*) { pure = false; }
+
+	// Objects
+	void pre_new (New*) { pure = false; }
+	void pre_field_access (Field_access*) { pure = false; }
+	void pre_assign_field (Assign_field*) { pure = false; }
+	void pre_unset (Unset* in) { if (in->target) pure = false; }
+	void pre_isset (Isset* in) { if (in->target) pure = false; }
+
+	// Exceptions
+	void pre_throw (Throw*) { pure = false; }
+	void pre_try (Try*) { pure = false; }
+
+	void pre_method_invocation (Method_invocation* in)
+	{
+		METHOD_NAME* name = dynamic_cast<METHOD_NAME*> (in->method_name);
+		if (in->target || name == NULL)
+		{
+			pure = false;
+			return;
+		}
+
+		// Direct recursion doesnt make us impure. Mutual recursion is
+		// handled conservatively, since the callee has not been summarized
+		// yet.
+		if (*name->value->to_lower () == *method_name->to_lower ())
+			return;
+
+		if (!Oracle::is_pure_function (name))
+			pure = false;
+	}
+};
+
+bool
+Whole_program::is_pure (User_method_info* info)
+{
+	// Methods might use $this
+	if (info->get_class_info ())
+		return false;
+
+	if (info->return_by_ref ())
+		return false;
+
+	for (int i = 0; i < info->formal_param_count (); i++)
+		if (info->param_by_ref (i))
+			return false;
+
+	Purity_check* check = new Purity_check (info->name);
+	foreach (Basic_block* bb, *info->get_cfg ()->get_all_bbs ())
+	{
+		if (Statement_block* sb = dynamic_cast<Statement_block*> (bb))
+			sb->statement->visit (check);
+	}
+
+	return check->pure;
+}
+
 void
 Whole_program::generate_summary (User_method_info* info)
 {
-	// Simplest possible inlining info - the function does nothing.
-	if (info->get_cfg ()->get_all_bbs ()->size() == 2)
-		info->set_side_effecting (true);
+	// Calls to pure functions can be evaluated, removed and memoized.
+	info->set_side_effecting (not is_pure (info));
+
+	// For the inliner's cost model.
+	info->set_recursive (callgraph->is_recursive (info));
+	info->set_caller_count (callgraph->get_caller_count (info));
 }
 
 void
@@ -3256,7 +3449,17 @@ Whole_program::get_string_value (Context* cx, Result_state state, const Index_no
 const Abstract_value*
 Whole_program::get_abstract_value (Context* cx, Result_state state, const Alias_name* name)
 {
-	return values->get_value (cx, state, name)->value;
+	const Abstract_value* absval = values->get_value (cx, state, name)->value;
+
+	// Attach the range of integers, so that it is propagated on copies.
+	const Range_cell* range = vrp->get_range (cx, state, name);
+	if (range->is_int ()
+		&& absval->types
+		&& absval->types->size () == 1
+		&& absval->types->has ("int"))
+		return absval->with_range (range);
+
+	return absval;
 }
 
 /*
@@ -3720,6 +3923,14 @@ Whole_program::visit_pre_op (Statement_block* bb, Pre_op* in)
 		return;
 	}
 
+	// Maybe we know the range?
+	const Range_cell* range = VRP::get_pre_op_range (get_abstract_value (block_cx (), R_WORKING, n), *in->op->value);
+	if (range)
+	{
+		assign_path_scalar (block_cx (), path, new Abstract_value (new Types ("int"), range));
+		return;
+	}
+
 	// Maybe we know the type?
 	const Types* types = values->get_types (block_cx (), R_WORKING, n);
 	assign_path_typed (block_cx (), path, types);
@@ -3898,6 +4109,15 @@ Whole_program::visit_bin_op (Statement_block* bb, MIR::Bin_op* in)
 		record_use (block_cx (), VN (ns, dyc<VARIABLE_NAME> (in->right)));
 
 
+	// Integer arithmetic which stays within the range of a long cannot
+	// overflow into a double.
+	const Range_cell* range = VRP::get_bin_op_range (left, *in->op->value, right);
+	if (range)
+	{
+		assign_path_scalar (block_cx (), saved_plhs (), new Abstract_value (new Types ("int"), range));
+		return;
+	}
+
 	Types* types = values->get_bin_op_types (block_cx (), left, right, *in->op->value);
 	assign_path_typed (block_cx (), saved_plhs (), types);
 }
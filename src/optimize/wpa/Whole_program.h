@@ -61,6 +61,7 @@ class Stat_collector;
 class Pass_manager;
 class Path;
 class WPA;
+class WPA_trace;
 class Absval_cell;
 
 /*
@@ -87,6 +88,9 @@ public:
 	Optimization_annotator* annotator;
 	Stat_collector* stat_coll;
 
+	// NULL unless --wpa-trace is given.
+	WPA_trace* trace;
+
 	// Analyses should be able to reach in here to get other analyses'
 	// results.
 	Aliasing* aliasing;
@@ -94,6 +98,7 @@ public:
 	Constant_state* constants;
 	Def_use* def_use;
 	Value_analysis* values;
+	VRP* vrp;
 
 	// name of __MAIN__ scope
 	string main_scope;
@@ -158,7 +163,9 @@ public:
 	void run (CFG* cfg){phc_unreachable ();}
 
 	void initialize (Context* cx);
-	bool analyses_have_converged ();
+	// If UNCONVERGED is given, the names of the analyses which have not
+	// converged are added to it.
+	bool analyses_have_converged (List<string>* unconverged = NULL);
 
 	/* 
 	 * Creating and using analyses.
@@ -180,6 +187,7 @@ public:
 										MIR::New* in);
 
 	void generate_summary (User_method_info* info);
+	bool is_pure (User_method_info* info);
 
 	void merge_contexts ();
 
@@ -204,6 +212,9 @@ public:
 								  MIR::Actual_parameter_list*,
 								  MIR::VARIABLE_NAME* lhs);
 
+	void trace_function (User_method_info* info, Context* caller_cx,
+								int blocks, int worklist_max);
+
 	void analyse_summary (Summary_method_info* info,
 								 Context* caller_cx,
 							    MIR::Actual_parameter_list*,
@@ -7,6 +7,7 @@
 
 
 #include "process_ir/General.h"
+#include "lib/Arena.h"
 
 // TODO: put into lib
 #include <queue>
@@ -30,9 +31,10 @@ public:
 	// after those members.
 	std::priority_queue<Edge*, std::deque<Edge*>, Less_post_dominator> queue;
 
-	// Don't add edges to existing BBs, so keep track.
-	Set<Basic_block*> bbs;
-	Map<Edge*, bool> executable_flags;
+	// Don't add edges to existing BBs, so keep track. The CFG keeps the
+	// edges and blocks alive, so these can live in the caller's arena.
+	Arena_set<Basic_block*> bbs;
+	Arena_map<Edge*, bool> executable_flags;
 
 public:
 	Worklist ();
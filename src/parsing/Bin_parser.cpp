@@ -0,0 +1,483 @@
+/*
+ * phc -- the open source PHP compiler
+ * See doc/license/README.license for licensing information
+ *
+ * Parser for the IR in phc's binary format
+ */
+
+#include <cstdlib>
+#include <cstring>
+
+#include "lib/AttrMap.h"
+#include "lib/Boolean.h"
+#include "lib/error.h"
+#include "lib/Integer.h"
+#include "lib/List.h"
+#include "lib/Vector.h"
+#include "parsing/Source_buffer.h"
+#include "process_ir/Bin_unparser.h"
+#include "AST.h"
+#include "HIR.h"
+#include "MIR.h"
+#include "MICG.h"
+#include "AST_factory.h"
+#include "HIR_factory.h"
+#include "MIR_factory.h"
+#include "MICG_factory.h"
+
+#include "Bin_parser.h"
+
+using namespace std;
+
+// As in the XML parser, the factories create the nodes, and the tokens (which
+// the factories don't handle) are created here.
+class Bin_node_builder : public virtual GC_obj
+{
+public:
+	virtual bool is_token (const string& name) = 0;
+	virtual Object* create_token (const string& name, List<Object*>* args) = 0;
+	virtual Object* create_node (const string& name, List<Object*>* args) = 0;
+	virtual ~Bin_node_builder () {}
+};
+
+template<
+	class Factory,
+	class STRING,
+	class CAST,
+	class INT,
+	class REAL,
+	class BOOL,
+	class NIL,
+	class FOREIGN
+>
+class T_bin_node_builder : public Bin_node_builder
+{
+public:
+	typedef T_bin_node_builder<Factory, STRING, CAST, INT, REAL, BOOL, NIL, FOREIGN> parent;
+
+	bool is_token (const string& name)
+	{
+		return name == "STRING"
+				|| name == "CAST"
+				|| name == "INT"
+				|| name == "REAL"
+				|| name == "BOOL"
+				|| name == "NIL";
+	}
+
+	Object* create_token (const string& name, List<Object*>* args)
+	{
+		if (name == "NIL")
+			return new NIL ();
+
+		if (args->size () != 1)
+			phc_error (ERR_BIN_PARSE, "a token has no value");
+
+		Object* value = args->front ();
+
+		if (name == "STRING")
+			return new STRING (dyc<String> (value));
+
+		else if (name == "CAST")
+			return new CAST (dyc<String> (value));
+
+		else if (name == "INT")
+			return new INT (dyc<Integer> (value)->value ());
+
+		else if (name == "REAL")
+			return new REAL (strtod (dyc<String> (value)->c_str (), NULL));
+
+		else if (name == "BOOL")
+			return new BOOL (dyc<Boolean> (value)->value ());
+
+		phc_unreachable ();
+	}
+
+	Object* create_node (const string& name, List<Object*>* args)
+	{
+		// FOREIGN's value is a node from another IR.
+		if (name == "FOREIGN")
+		{
+			if (args->size () != 1)
+				phc_error (ERR_BIN_PARSE, "a FOREIGN node has no value");
+
+			return new FOREIGN (dyc<IR::Node> (args->front ()));
+		}
+
+		// Names are interned, as the scanner interns them (see lib/String.h).
+		if (name.size () > 5
+			&& name.compare (name.size () - 5, 5, "_NAME") == 0
+			&& args->size () == 1
+			&& isa<String> (args->front ()))
+		{
+			args->front () = intern (*dyc<String> (args->front ()));
+		}
+
+		return Factory::create (name.c_str (), args);
+	}
+};
+
+class AST_bin_node_builder : public T_bin_node_builder
+<
+	AST::Node_factory,
+	AST::STRING,
+	AST::CAST,
+	AST::INT,
+	AST::REAL,
+	AST::BOOL,
+	AST::NIL,
+	AST::FOREIGN
+>
+{
+};
+
+class HIR_bin_node_builder : public T_bin_node_builder
+<
+	HIR::Node_factory,
+	HIR::STRING,
+	HIR::CAST,
+	HIR::INT,
+	HIR::REAL,
+	HIR::BOOL,
+	HIR::NIL,
+	HIR::FOREIGN
+>
+{
+};
+
+class MIR_bin_node_builder : public T_bin_node_builder
+<
+	MIR::Node_factory,
+	MIR::STRING,
+	MIR::CAST,
+	MIR::INT,
+	MIR::REAL,
+	MIR::BOOL,
+	MIR::NIL,
+	MIR::FOREIGN
+>
+{
+	bool is_token (const string& name)
+	{
+		return name == "PARAM_INDEX" || parent::is_token (name);
+	}
+
+	Object* create_token (const string& name, List<Object*>* args)
+	{
+		if (name == "PARAM_INDEX" && args->size () == 1)
+			return new MIR::PARAM_INDEX (dyc<Integer> (args->front ())->value ());
+
+		return parent::create_token (name, args);
+	}
+};
+
+// MICG's tokens are all created by its factory.
+class MICG_bin_node_builder : public Bin_node_builder
+{
+public:
+	bool is_token (const string& name)
+	{
+		return false;
+	}
+
+	Object* create_token (const string& name, List<Object*>* args)
+	{
+		phc_unreachable ();
+	}
+
+	Object* create_node (const string& name, List<Object*>* args)
+	{
+		return MICG::Node_factory::create (name.c_str (), args);
+	}
+};
+
+// A node type, from the string table
+struct Bin_type : public virtual GC_obj
+{
+	Bin_node_builder* builder;
+	string name;
+	bool is_list;
+};
+
+// Reads the file in place. Strings are copied out of it, so it can be
+// unmapped afterwards.
+class Bin_reader : public virtual GC_obj
+{
+private:
+	const char* pos;
+	const char* end;
+
+	Vector<const char*> string_data;
+	Vector<unsigned long> string_sizes;
+	Vector<Bin_type*> types;
+	Vector<Vector<String*>*> attr_sets;
+
+	Bin_node_builder* ast_builder;
+	Bin_node_builder* hir_builder;
+	Bin_node_builder* mir_builder;
+	Bin_node_builder* micg_builder;
+
+public:
+	Bin_reader (const char* data, size_t size)
+	: pos (data)
+	, end (data + size)
+	{
+		ast_builder = new AST_bin_node_builder;
+		hir_builder = new HIR_bin_node_builder;
+		mir_builder = new MIR_bin_node_builder;
+		micg_builder = new MICG_bin_node_builder;
+	}
+
+	IR::Node* read ()
+	{
+		if (end - pos < BIN_MAGIC_LENGTH
+			|| memcmp (pos, BIN_MAGIC, BIN_MAGIC_LENGTH) != 0)
+			phc_error (ERR_BIN_PARSE, "the input is not in phc's binary format");
+		pos += BIN_MAGIC_LENGTH;
+
+		if (read_varint () != BIN_VERSION)
+			phc_error (ERR_BIN_PARSE, "the input is from a different version of phc");
+
+		unsigned long num_strings = read_varint ();
+		for (unsigned long i = 0; i < num_strings; i++)
+		{
+			unsigned long size = read_varint ();
+			if ((unsigned long) (end - pos) < size)
+				truncated ();
+
+			string_data.push_back (pos);
+			string_sizes.push_back (size);
+			pos += size;
+		}
+
+		// Types are looked up as they are used.
+		types.resize (num_strings, NULL);
+
+		unsigned long num_attr_sets = read_varint ();
+		for (unsigned long i = 0; i < num_attr_sets; i++)
+		{
+			Vector<String*>* keys = new Vector<String*>;
+			unsigned long num_keys = read_varint ();
+			for (unsigned long k = 0; k < num_keys; k++)
+				keys->push_back (read_string ());
+
+			attr_sets.push_back (keys);
+		}
+
+		IR::Node* result = dynamic_cast<IR::Node*> (read_object ());
+		if (result == NULL)
+			phc_error (ERR_BIN_PARSE, "the input does not hold a node");
+
+		return result;
+	}
+
+	IR::PHP_script* read_script ()
+	{
+		IR::PHP_script* result = dynamic_cast<IR::PHP_script*> (read ());
+		if (result == NULL)
+			phc_error (ERR_BIN_PARSE, "the input does not hold a script");
+
+		return result;
+	}
+
+private:
+	void truncated ()
+	{
+		phc_error (ERR_BIN_PARSE, "the input is truncated");
+	}
+
+	unsigned long read_varint ()
+	{
+		unsigned long result = 0;
+		for (int shift = 0; ; shift += 7)
+		{
+			if (pos == end)
+				truncated ();
+
+			unsigned char byte = *pos++;
+			result |= (unsigned long) (byte & 0x7F) << shift;
+
+			if (!(byte & 0x80))
+				return result;
+		}
+	}
+
+	long read_signed ()
+	{
+		unsigned long value = read_varint ();
+		return (long) (value >> 1) ^ -(long) (value & 1);
+	}
+
+	unsigned long read_index (unsigned long limit)
+	{
+		unsigned long index = read_varint ();
+		if (index >= limit)
+			phc_error (ERR_BIN_PARSE, "an index is out of range");
+
+		return index;
+	}
+
+	String* read_string ()
+	{
+		unsigned long index = read_index (string_data.size ());
+		return new String (string_data[index], string_sizes[index]);
+	}
+
+	Bin_type* get_type (unsigned long index)
+	{
+		if (index >= types.size ())
+			phc_error (ERR_BIN_PARSE, "an index is out of range");
+
+		if (types[index] == NULL)
+		{
+			string name (string_data[index], string_sizes[index]);
+			Bin_type* type = new Bin_type;
+
+			size_t sep = name.find ("::");
+			string ns = name.substr (0, sep);
+			if (ns == "AST")
+				type->builder = ast_builder;
+			else if (ns == "HIR")
+				type->builder = hir_builder;
+			else if (ns == "MIR")
+				type->builder = mir_builder;
+			else if (ns == "MICG")
+				type->builder = micg_builder;
+			else
+				phc_error (ERR_BIN_PARSE, ("unknown node type " + name).c_str ());
+
+			type->name = name.substr (sep + 2);
+			type->is_list = type->name.size () > 5
+				&& type->name.compare (type->name.size () - 5, 5, "_list") == 0;
+
+			types[index] = type;
+		}
+
+		return types[index];
+	}
+
+	AttrMap* read_attrs ()
+	{
+		AttrMap* attrs = new AttrMap;
+
+		Vector<String*>* keys = attr_sets[read_index (attr_sets.size ())];
+		foreach (String* key, *keys)
+			attrs->set (*key, read_object ());
+
+		return attrs;
+	}
+
+	// Read objects until BIN_END.
+	List<Object*>* read_children ()
+	{
+		List<Object*>* children = new List<Object*>;
+
+		while (true)
+		{
+			if (pos == end)
+				truncated ();
+
+			if (*pos == BIN_END)
+			{
+				pos++;
+				return children;
+			}
+
+			children->push_back (read_object ());
+		}
+	}
+
+	Object* read_node (Bin_type* type)
+	{
+		if (type->is_list)
+			return type->builder->create_node (type->name, read_children ());
+
+		AttrMap* attrs = read_attrs ();
+		List<Object*>* children = read_children ();
+
+		Object* result;
+		if (type->builder->is_token (type->name))
+			result = type->builder->create_token (type->name, children);
+		else
+			result = type->builder->create_node (type->name, children);
+
+		if (result == NULL)
+			phc_error (ERR_BIN_PARSE, ("unknown node type " + type->name).c_str ());
+
+		dyc<IR::Node> (result)->attrs = attrs;
+		return result;
+	}
+
+	Object* read_object ()
+	{
+		unsigned long tag = read_varint ();
+		switch (tag)
+		{
+			case BIN_END:
+				phc_error (ERR_BIN_PARSE, "a node or list ends unexpectedly");
+
+			case BIN_NULL:
+				return NULL;
+
+			case BIN_FALSE:
+				return new Boolean (false);
+
+			case BIN_TRUE:
+				return new Boolean (true);
+
+			case BIN_INTEGER:
+				return new Integer (read_signed ());
+
+			case BIN_STRING:
+				return read_string ();
+
+			case BIN_STRING_LIST:
+			{
+				List<String*>* list = new List<String*>;
+				unsigned long size = read_varint ();
+				for (unsigned long i = 0; i < size; i++)
+					list->push_back (read_string ());
+
+				return list;
+			}
+
+			case BIN_NODE_LIST:
+			{
+				IR::Node_list* list = new IR::Node_list;
+				unsigned long size = read_varint ();
+				for (unsigned long i = 0; i < size; i++)
+					list->push_back (dynamic_cast<IR::Node*> (read_object ()));
+
+				return list;
+			}
+
+			default:
+				return read_node (get_type (tag - BIN_FIRST_TYPE));
+		}
+	}
+};
+
+IR::PHP_script*
+Bin_parser::parse_bin_file (String* filename)
+{
+	Source_buffer* source = Source_buffer::open (filename);
+	if (source == NULL)
+		return NULL;
+
+	IR::PHP_script* result = parse_bin_buffer (source->data, source->size);
+	source->close ();
+
+	return result;
+}
+
+IR::PHP_script*
+Bin_parser::parse_bin_buffer (const char* data, size_t size)
+{
+	return (new Bin_reader (data, size))->read_script ();
+}
+
+IR::Node*
+Bin_parser::parse_bin_node (const char* data, size_t size)
+{
+	return (new Bin_reader (data, size))->read ();
+}
@@ -0,0 +1,29 @@
+/*
+ * phc -- the open source PHP compiler
+ * See doc/license/README.license for licensing information
+ *
+ * Parser for the IR in phc's binary format (see process_ir/Bin_unparser.h)
+ */
+
+#ifndef PHC_BIN_PARSER_H
+#define PHC_BIN_PARSER_H
+
+#include "lib/String.h"
+#include "process_ir/IR.h"
+
+#define ERR_BIN_PARSE "Could not read the binary IR (%s)"
+
+class Bin_parser : public virtual GC_obj
+{
+public:
+	// The file is mapped into memory and read in place. FILENAME may be "-",
+	// for stdin. Returns NULL if it cannot be read.
+	IR::PHP_script* parse_bin_file (String* filename);
+
+	IR::PHP_script* parse_bin_buffer (const char* data, size_t size);
+
+	// Read a node of any kind, such as the code generator's macros.
+	IR::Node* parse_bin_node (const char* data, size_t size);
+};
+
+#endif // PHC_BIN_PARSER_H
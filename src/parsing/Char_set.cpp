@@ -0,0 +1,76 @@
+/*
+ * phc -- the open source PHP compiler
+ * See doc/license/README.license for licensing information
+ *
+ * A small set of characters, which can be searched for quickly.
+ */
+
+#include <cassert>
+#include <cstring>
+
+#if defined (__AVX2__) || defined (__SSE2__)
+#include <immintrin.h>
+#endif
+
+#include "Char_set.h"
+
+Char_set::Char_set (const char* chars)
+{
+	count = strlen (chars);
+	assert (count > 0 && count <= MAX_CHARS);
+
+	memcpy (this->chars, chars, count);
+	memset (member, 0, sizeof (member));
+	for (int i = 0; i < count; i++)
+		member[(unsigned char) chars[i]] = true;
+}
+
+const char*
+Char_set::find (const char* begin, const char* end) const
+{
+	const char* p = begin;
+
+#ifdef __AVX2__
+	__m256i wide[MAX_CHARS];
+	for (int i = 0; i < count; i++)
+		wide[i] = _mm256_set1_epi8 (chars[i]);
+
+	for (; end - p >= 32; p += 32)
+	{
+		__m256i block = _mm256_loadu_si256 ((const __m256i*) p);
+		__m256i found = _mm256_cmpeq_epi8 (block, wide[0]);
+		for (int i = 1; i < count; i++)
+			found = _mm256_or_si256 (found, _mm256_cmpeq_epi8 (block, wide[i]));
+
+		unsigned int mask = _mm256_movemask_epi8 (found);
+		if (mask)
+			return p + __builtin_ctz (mask);
+	}
+#endif
+
+#ifdef __SSE2__
+	__m128i narrow[MAX_CHARS];
+	for (int i = 0; i < count; i++)
+		narrow[i] = _mm_set1_epi8 (chars[i]);
+
+	for (; end - p >= 16; p += 16)
+	{
+		__m128i block = _mm_loadu_si128 ((const __m128i*) p);
+		__m128i found = _mm_cmpeq_epi8 (block, narrow[0]);
+		for (int i = 1; i < count; i++)
+			found = _mm_or_si128 (found, _mm_cmpeq_epi8 (block, narrow[i]));
+
+		unsigned int mask = _mm_movemask_epi8 (found);
+		if (mask)
+			return p + __builtin_ctz (mask);
+	}
+#endif
+
+	for (; p < end; p++)
+	{
+		if (contains (*p))
+			return p;
+	}
+
+	return end;
+}
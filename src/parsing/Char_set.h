@@ -0,0 +1,39 @@
+/*
+ * phc -- the open source PHP compiler
+ * See doc/license/README.license for licensing information
+ *
+ * A small set of characters, which can be searched for quickly.
+ *
+ * The scanner uses these to skip over inline HTML, comments and string
+ * bodies up to the next character it needs to look at, rather than matching
+ * them one character at a time. The search compares 32 bytes at a time with
+ * AVX2, or 16 with SSE2, depending on what the compiler is targeting, and
+ * falls back to a table lookup otherwise.
+ */
+
+#ifndef PHC_CHAR_SET
+#define PHC_CHAR_SET
+
+class Char_set
+{
+public:
+	// CHARS must have no more than MAX_CHARS characters.
+	Char_set (const char* chars);
+
+	// Return the first character in [BEGIN, END) which is in the set, or END.
+	const char* find (const char* begin, const char* end) const;
+
+	bool contains (char c) const
+	{
+		return member[(unsigned char) c];
+	}
+
+private:
+	static const int MAX_CHARS = 8;
+
+	char chars[MAX_CHARS];
+	int count;
+	bool member[256];
+};
+
+#endif // PHC_CHAR_SET
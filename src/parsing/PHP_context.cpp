@@ -6,13 +6,15 @@
  */
 
 #include "PHP_context.h"
+#include "parse.h"
 
-PHP_context::PHP_context(std::istream& input, String* filename)
-: stream (input)
+PHP_context::PHP_context(Source_buffer* source, String* filename)
+: source (source)
 {	
-	init_scanner(NULL);
+	init_scanner();
 
 	php_script = NULL;
+	stream_handler = NULL;
 	current_method = new String("");
 	current_class = new String("");
 
@@ -66,6 +68,21 @@ PHP_context::dump_parse_tree ()
 	return result;
 }
 
+void
+PHP_context::stream_statements (List<AST::Statement*>* statements)
+{
+	AST::PHP_script* part = new AST::PHP_script (statements);
+
+	// The hash-bang is scanned before the first statement is parsed
+	if (hash_bang != NULL)
+	{
+		part->attrs->set ("phc.unparser.hash_bang", hash_bang);
+		hash_bang = NULL;
+	}
+
+	stream_handler->handle (part, false);
+}
+
 PHP_context::~PHP_context()
 {
 	destroy_scanner();
@@ -13,16 +13,20 @@
 #include "lib/List.h"
 #include "php_parser.tab.hpp"
 
+class Source_buffer;
+class Stream_handler;
+
 class PHP_context : public virtual GC_obj
 {
 /*
  * Constructor and destructor
  */
 public:
-	PHP_context (std::istream& input, String* filename);
+	// The scanner reads SOURCE in place.
+	PHP_context (Source_buffer* source, String* filename);
 	virtual ~PHP_context();
 
-	std::istream& stream;
+	Source_buffer* source;
 
 /*
  * Public interface
@@ -45,6 +49,12 @@ public:
 	String* current_class;
 	String* filename;
 
+	// If set, top-level statements are passed to the handler as they are
+	// parsed, and php_script holds only what follows the last one (see
+	// parse_stream).
+	Stream_handler* stream_handler;
+	void stream_statements (List<AST::Statement*>* statements);
+
 /*
  * State used by the lexical analyser
  */
@@ -101,7 +111,7 @@ public:
 
 // Initialise and destroy the scanner (bodies defined in php_scanner.lex)
 public:
-	void init_scanner(FILE* input);
+	void init_scanner();
 	void destroy_scanner();
 };
 
@@ -0,0 +1,195 @@
+/*
+ * phc -- the open source PHP compiler
+ * See doc/license/README.license for licensing information
+ *
+ * A cache of parsed scripts
+ */
+
+#include "config.h"
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+#include "cmdline.h"
+#include "lib/error.h"
+#include "lib/Map.h"
+#include "parsing/Bin_parser.h"
+#include "parsing/parse.h"
+#include "parsing/Source_buffer.h"
+#include "process_ir/Bin_unparser.h"
+
+#include "Parse_cache.h"
+
+extern struct gengetopt_args_info args_info;
+
+using namespace AST;
+using namespace std;
+
+class Cache_entry : virtual public GC_obj
+{
+public:
+	time_t mtime;
+	off_t size;
+	unsigned long long hash;
+
+	// Never given out, only clones of it
+	PHP_script* php_script;
+};
+
+static Map<string, Cache_entry*>* entries = NULL;
+
+static bool
+hash_file (String* filename, unsigned long long* hash)
+{
+	Source_buffer* source = Source_buffer::open (filename);
+	if (source == NULL)
+		return false;
+
+	*hash = stable_hash (source->data, source->size);
+	source->close ();
+
+	return true;
+}
+
+/*
+ * The file in the --parse-cache directory for FILENAME, when the hash of its
+ * contents is HASH. The script depends on the filename as well as the
+ * contents, since the filename is in its attributes. The versions of phc and
+ * of the binary format are part of the name, so that other versions of phc
+ * never read it.
+ */
+static string
+disk_path (String* filename, unsigned long long hash)
+{
+	stringstream key;
+	key << PACKAGE_VERSION << '\0' << BIN_VERSION << '\0' << *filename;
+
+	stringstream path;
+	path << args_info.parse_cache_arg << "/" << hex << setfill ('0')
+		<< setw (16) << stable_hash (key.str ().data (), key.str ().size ())
+		<< "-" << setw (16) << hash << ".bin";
+
+	return path.str ();
+}
+
+static void
+store (String* filename, struct stat* buf, unsigned long long hash, PHP_script* php_script)
+{
+	if (entries == NULL)
+		entries = new Map<string, Cache_entry*>;
+
+	Cache_entry* entry = new Cache_entry;
+	entry->mtime = buf->st_mtime;
+	entry->size = buf->st_size;
+	entry->hash = hash;
+	entry->php_script = php_script;
+
+	(*entries)[*filename] = entry;
+}
+
+PHP_script*
+parse_cache_find (String* filename)
+{
+	struct stat buf;
+	if (*filename == "-" || stat (filename->c_str (), &buf) != 0)
+		return NULL;
+
+	Cache_entry* entry = NULL;
+	if (entries && entries->has (*filename))
+		entry = (*entries)[*filename];
+
+	// A file which has not been touched need not be read.
+	if (entry
+		&& entry->mtime == buf.st_mtime
+		&& entry->size == buf.st_size)
+		return entry->php_script->clone ();
+
+	unsigned long long hash;
+	if (!hash_file (filename, &hash))
+		return NULL;
+
+	if (entry && entry->hash == hash)
+	{
+		entry->mtime = buf.st_mtime;
+		entry->size = buf.st_size;
+		return entry->php_script->clone ();
+	}
+
+	if (!args_info.parse_cache_given)
+		return NULL;
+
+	String* path = new String (disk_path (filename, hash));
+	if (access (path->c_str (), R_OK) != 0)
+		return NULL;
+
+	IR::PHP_script* ir = (new Bin_parser)->parse_bin_file (path);
+	if (ir == NULL)
+		return NULL;
+
+	PHP_script* php_script = dyc<PHP_script> (ir);
+	store (filename, &buf, hash, php_script);
+
+	return php_script->clone ();
+}
+
+static void
+write_to_disk (String* filename, unsigned long long hash, PHP_script* php_script)
+{
+	if (mkdir (args_info.parse_cache_arg, 0777) != 0 && errno != EEXIST)
+	{
+		phc_warning ("Could not create the parse cache directory %s", args_info.parse_cache_arg);
+		return;
+	}
+
+	// Write to a file of our own, then move it into place, so that another
+	// run of phc never sees half a file.
+	string path = disk_path (filename, hash);
+	stringstream temp;
+	temp << path << "." << getpid ();
+
+	ofstream out (temp.str ().c_str (), ios::out | ios::binary);
+	bin_unparse (php_script, out);
+	out.close ();
+
+	if (!out || rename (temp.str ().c_str (), path.c_str ()) != 0)
+	{
+		unlink (temp.str ().c_str ());
+		phc_warning ("Could not write %s to the parse cache", filename->c_str ());
+	}
+}
+
+void
+parse_cache_add (String* filename, PHP_script* php_script)
+{
+	struct stat buf;
+	if (*filename == "-" || stat (filename->c_str (), &buf) != 0)
+		return;
+
+	unsigned long long hash;
+	if (!hash_file (filename, &hash))
+		return;
+
+	store (filename, &buf, hash, php_script->clone ());
+
+	if (args_info.parse_cache_given)
+		write_to_disk (filename, hash, php_script);
+}
+
+PHP_script*
+parse_cached (String* filename)
+{
+	PHP_script* php_script = parse_cache_find (filename);
+	if (php_script)
+		return php_script;
+
+	php_script = parse (filename, NULL);
+	if (php_script)
+		parse_cache_add (filename, php_script);
+
+	return php_script;
+}
@@ -0,0 +1,40 @@
+/*
+ * phc -- the open source PHP compiler
+ * See doc/license/README.license for licensing information
+ *
+ * A cache of parsed scripts, so that a file which is included many times is
+ * parsed only once.
+ *
+ * Scripts are kept (after the standard transforms which parse() runs) for the
+ * rest of the run, by filename. An entry is used if the file's modification
+ * time and size are unchanged, or if the hash of its contents is. With
+ * --parse-cache=DIRECTORY, scripts are also written to DIRECTORY in phc's
+ * binary format (see process_ir/Bin_unparser.h), for later runs of phc. Those
+ * are named for the filename and the hash of the contents, so they need not
+ * be cleaned up when the files change.
+ *
+ * The passes change the scripts they are given, so the cache keeps its own
+ * copy, and returns a clone each time.
+ */
+
+#ifndef PHC_PARSE_CACHE
+#define PHC_PARSE_CACHE
+
+#include "AST.h"
+
+/*
+ * Parse FILENAME (which has already been found with search_file) as parse()
+ * does, or take it from the cache. Returns NULL if it cannot be parsed.
+ */
+AST::PHP_script* parse_cached (String* filename);
+
+/* Returns a clone of the cached script for FILENAME, or NULL. */
+AST::PHP_script* parse_cache_find (String* filename);
+
+/*
+ * Cache PHP_SCRIPT, which has just been parsed from FILENAME. The caller may
+ * carry on using it.
+ */
+void parse_cache_add (String* filename, AST::PHP_script* php_script);
+
+#endif // PHC_PARSE_CACHE
@@ -0,0 +1,128 @@
+/*
+ * phc -- the open source PHP compiler
+ * See doc/license/README.license for licensing information
+ *
+ * Source code for the scanner, which scans it in place.
+ */
+
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
+#include <iostream>
+#include <iterator>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "Source_buffer.h"
+
+using namespace std;
+
+Source_buffer::Source_buffer ()
+: data (NULL)
+, size (0)
+, mapped_size (0)
+{
+}
+
+Source_buffer::Source_buffer (String* source)
+: data (NULL)
+, size (0)
+, mapped_size (0)
+{
+	copy (source->data (), source->size ());
+}
+
+Source_buffer::Source_buffer (istream& input)
+: data (NULL)
+, size (0)
+, mapped_size (0)
+{
+	string source ((istreambuf_iterator<char> (input)), istreambuf_iterator<char> ());
+	copy (source.data (), source.size ());
+}
+
+void
+Source_buffer::copy (const char* source, size_t size)
+{
+	this->data = static_cast<char*> (malloc (size + 2));
+	this->size = size;
+
+	memcpy (data, source, size);
+	data[size] = '\0';
+	data[size + 1] = '\0';
+}
+
+// Map SIZE bytes of FD, followed by two NULs, or return NULL.
+static char*
+map_file (int fd, size_t size, size_t& mapped_size)
+{
+	size_t page = sysconf (_SC_PAGESIZE);
+	size_t length = (size + 2 + page - 1) / page * page;
+
+	// Reserve zeroed memory for the file and the NULs, and map the file over
+	// the start of it. The rest of the file's last page is zeroed too.
+	void* memory = mmap (NULL, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if (memory == MAP_FAILED)
+		return NULL;
+
+	if (mmap (memory, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_FIXED, fd, 0) == MAP_FAILED)
+	{
+		munmap (memory, length);
+		return NULL;
+	}
+
+	mapped_size = length;
+	return static_cast<char*> (memory);
+}
+
+Source_buffer*
+Source_buffer::open (String* filename)
+{
+	if (*filename == "-")
+		return new Source_buffer (cin);
+
+	int fd = ::open (filename->c_str (), O_RDONLY);
+	if (fd == -1)
+		return NULL;
+
+	Source_buffer* result = new Source_buffer;
+
+	struct stat st;
+	if (fstat (fd, &st) == 0 && S_ISREG (st.st_mode) && st.st_size > 0)
+	{
+		result->data = map_file (fd, st.st_size, result->mapped_size);
+		result->size = st.st_size;
+	}
+
+	// Empty files can't be mapped, and pipes and the like have no size.
+	if (result->data == NULL)
+	{
+		string source;
+		char buffer[4096];
+		ssize_t count;
+		while ((count = read (fd, buffer, sizeof (buffer))) > 0)
+			source.append (buffer, count);
+
+		if (count == -1)
+			result = NULL;
+		else
+			result->copy (source.data (), source.size ());
+	}
+
+	::close (fd);
+	return result;
+}
+
+void
+Source_buffer::close ()
+{
+	if (mapped_size)
+		munmap (data, mapped_size);
+	else
+		free (data);
+
+	data = NULL;
+	size = 0;
+	mapped_size = 0;
+}
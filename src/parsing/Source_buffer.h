@@ -0,0 +1,47 @@
+/*
+ * phc -- the open source PHP compiler
+ * See doc/license/README.license for licensing information
+ *
+ * Source code for the scanner, which scans it in place.
+ *
+ * Files are mapped into memory, rather than read through a stream. Other
+ * sources are copied into the buffer once. Flex requires two NUL bytes after
+ * the source, and writes to the buffer as it scans (putting back what it
+ * overwrote), so the mapping is private.
+ */
+
+#ifndef PHC_SOURCE_BUFFER
+#define PHC_SOURCE_BUFFER
+
+#include <cstddef>
+#include <istream>
+
+#include "lib/String.h"
+
+class Source_buffer : virtual public GC_obj
+{
+public:
+	// Returns NULL if FILENAME cannot be read. "-" is standard input.
+	static Source_buffer* open (String* filename);
+
+	Source_buffer (String* source);
+	Source_buffer (std::istream& input);
+
+	// The source, followed by two NULs.
+	char* data;
+	size_t size;
+
+	// Release the buffer. The scanner must not use it afterwards (the
+	// semantic values it creates are copies).
+	void close ();
+
+private:
+	Source_buffer ();
+
+	void copy (const char* source, size_t size);
+
+	// If mapped, the length of the mapping, otherwise 0.
+	size_t mapped_size;
+};
+
+#endif // PHC_SOURCE_BUFFER
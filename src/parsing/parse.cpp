@@ -5,21 +5,27 @@
  * Parser wrapper. 
  */
 
-#include <fstream>
-#include <istream>
 #include "config.h"
 #include <sys/types.h>
 #include <sys/stat.h>
+#include <sys/wait.h>
+#include <poll.h>
 #include <unistd.h>
+#include <cerrno>
+#include <cstdio>
+#include <sstream>
 #include <dirent.h> // for search dirs.
 #include <libgen.h> // for basename.
 #include <boost/regex.hpp> // for regular expression.
 #include "parse.h"
 #include "cmdline.h"
 #include "php_parser.tab.hpp"
+#include "parsing/Bin_parser.h"
 #include "parsing/PHP_context.h"
+#include "parsing/Source_buffer.h"
 #include "process_ast/Remove_parser_temporaries.h"
 #include "process_ast/Token_conversion.h"
+#include "process_ir/Bin_unparser.h"
 
 extern struct gengetopt_args_info args_info;
 
@@ -40,17 +46,17 @@ PHP_script* parse_code (String* code, String* filename, int line_number)
 
 	assert (code);
 
-	stringstream ss;
-	ss << *code;
+	Source_buffer* source = new Source_buffer (code);
 
 	PHP_script* php_script = NULL;
 
 	// Compile
-	PHP_context* context = new PHP_context(ss, filename);
+	PHP_context* context = new PHP_context(source, filename);
 	context->source_line = line_number;
 
 	bool success = context->parse ();
 	assert (success);
+	source->close ();
 
 	php_script = context->php_script;
 	php_script->attrs->set ("phc.filename", filename);
@@ -72,17 +78,12 @@ PHP_script* parse(String* filename, String_list* dirs)
 	if(full_path == NULL)
 		return NULL;
 
-	ifstream file_input;
-	istream& input = (*full_path == "-") ? cin : file_input;
-
-	if(*full_path != "-")
-	{
-		file_input.open (full_path->c_str(), ifstream::in);
-		if (not file_input.is_open ()) return NULL;
-	}
+	Source_buffer* source = Source_buffer::open (full_path);
+	if (source == NULL)
+		return NULL;
 
 	// Compile
-	PHP_context* context = new PHP_context (input, full_path);
+	PHP_context* context = new PHP_context (source, full_path);
 
 	if (args_info.dump_tokens_flag)
 	{
@@ -102,12 +103,284 @@ PHP_script* parse(String* filename, String_list* dirs)
 		}
 	}
 
-	if (file_input.is_open ()) file_input.close ();
+	source->close ();
 
 	return php_script;
 }
 
 
+/* Prepare each part of the script as parse() prepares the whole script. */
+class Prepare_part : public Stream_handler
+{
+	String* filename;
+	Stream_handler* handler;
+
+public:
+	Prepare_part (String* filename, Stream_handler* handler)
+	: filename (filename)
+	, handler (handler)
+	{
+	}
+
+	void handle (PHP_script* part, bool last)
+	{
+		part->attrs->set ("phc.filename", filename);
+		run_standard_transforms (part);
+		part->assert_valid ();
+
+		handler->handle (part, last);
+	}
+};
+
+bool parse_stream (String* filename, String_list* dirs, Stream_handler* handler)
+{
+	assert (filename);
+	assert (handler);
+
+	String* full_path = search_file (filename, dirs);
+	if (full_path == NULL)
+		return false;
+
+	Source_buffer* source = Source_buffer::open (full_path);
+	if (source == NULL)
+		return false;
+
+	PHP_context* context = new PHP_context (source, full_path);
+	context->stream_handler = new Prepare_part (filename, handler);
+
+	if (context->parse ())
+		context->stream_handler->handle (context->php_script, true);
+
+	source->close ();
+
+	return true;
+}
+
+/*
+ * parse_all runs each parser in a child process, rather than on a thread:
+ * the garbage collector, the interned Symbols and the attribute registry are
+ * not thread-safe, and a child can use all of them freely.
+ */
+class Parse_job : virtual public GC_obj
+{
+public:
+	String* full_path;
+	pid_t pid;
+
+	// Pipes from the child's output (the script) and its stderr. They are -1
+	// once they have been closed.
+	int out_fd;
+	int err_fd;
+
+	string out;
+	string err;
+};
+
+static void
+write_all (int fd, const string& data)
+{
+	const char* pos = data.data ();
+	size_t left = data.size ();
+
+	while (left > 0)
+	{
+		ssize_t written = write (fd, pos, left);
+		if (written == -1 && errno == EINTR)
+			continue;
+
+		if (written <= 0)
+			_exit (1);
+
+		pos += written;
+		left -= written;
+	}
+}
+
+// Runs in the child. Use _exit, rather than exit, so that nothing the parent
+// set up is torn down twice.
+static void
+run_parse_job (String* full_path, int out_fd, int err_fd)
+{
+	dup2 (err_fd, STDERR_FILENO);
+
+	PHP_script* php_script = parse (full_path, new String_list);
+	if (php_script == NULL)
+		_exit (1);
+
+	stringstream ss;
+	bin_unparse (php_script, ss);
+	write_all (out_fd, ss.str ());
+
+	fflush (stderr);
+	_exit (0);
+}
+
+// Returns NULL if the child cannot be started, in which case the file is
+// left for the caller to parse.
+static Parse_job*
+start_parse_job (String* full_path)
+{
+	int out_pipe[2];
+	int err_pipe[2];
+
+	if (pipe (out_pipe) == -1)
+		return NULL;
+
+	if (pipe (err_pipe) == -1)
+	{
+		close (out_pipe[0]);
+		close (out_pipe[1]);
+		return NULL;
+	}
+
+	pid_t pid = fork ();
+	if (pid == 0)
+	{
+		close (out_pipe[0]);
+		close (err_pipe[0]);
+		run_parse_job (full_path, out_pipe[1], err_pipe[1]);
+	}
+
+	// The write ends must be closed here, or the parent would never see the
+	// end of the output (and later children would hold them open too).
+	close (out_pipe[1]);
+	close (err_pipe[1]);
+
+	if (pid == -1)
+	{
+		close (out_pipe[0]);
+		close (err_pipe[0]);
+		return NULL;
+	}
+
+	Parse_job* job = new Parse_job;
+	job->full_path = full_path;
+	job->pid = pid;
+	job->out_fd = out_pipe[0];
+	job->err_fd = err_pipe[0];
+	return job;
+}
+
+// Read what is available from FD into BUFFER, and close FD at the end of the
+// input.
+static void
+read_some (int& fd, string& buffer)
+{
+	char data[65536];
+	ssize_t size = read (fd, data, sizeof (data));
+
+	if (size == -1 && errno == EINTR)
+		return;
+
+	if (size <= 0)
+	{
+		close (fd);
+		fd = -1;
+		return;
+	}
+
+	buffer.append (data, size);
+}
+
+static void
+finish_parse_job (Parse_job* job, Map<string, Parse_result*>* results)
+{
+	int status;
+	while (waitpid (job->pid, &status, 0) == -1)
+		if (errno != EINTR)
+			return;
+
+	if (!WIFEXITED (status) || WEXITSTATUS (status) != 0)
+		return;
+
+	Parse_result* result = new Parse_result;
+	result->php_script = dyc<PHP_script> (
+		(new Bin_parser)->parse_bin_buffer (job->out.data (), job->out.size ()));
+	result->messages = new String (job->err);
+
+	(*results)[*job->full_path] = result;
+}
+
+Map<string, Parse_result*>*
+parse_all (String_list* full_paths, int jobs)
+{
+	assert (jobs > 0);
+
+	Map<string, Parse_result*>* results = new Map<string, Parse_result*>;
+
+	// The children get copies of anything which is buffered, and must not
+	// write it out again.
+	cout.flush ();
+	cerr.flush ();
+	fflush (NULL);
+
+	String_list::const_iterator next = full_paths->begin ();
+	List<Parse_job*> running;
+
+	while (next != full_paths->end () || !running.empty ())
+	{
+		while (next != full_paths->end () && (int) running.size () < jobs)
+		{
+			Parse_job* job = start_parse_job (*next++);
+			if (job)
+				running.push_back (job);
+		}
+
+		if (running.empty ())
+			continue;
+
+		// Wait for any of the children to write something.
+		Vector<pollfd> fds;
+		foreach (Parse_job* job, running)
+		{
+			int job_fds[] = { job->out_fd, job->err_fd };
+			foreach (int fd, job_fds)
+			{
+				if (fd == -1)
+					continue;
+
+				pollfd pfd;
+				pfd.fd = fd;
+				pfd.events = POLLIN;
+				pfd.revents = 0;
+				fds.push_back (pfd);
+			}
+		}
+
+		if (poll (&fds[0], fds.size (), -1) == -1 && errno != EINTR)
+			phc_error ("Could not wait for the parsers of included files");
+
+		foreach (pollfd& pfd, fds)
+		{
+			if (pfd.revents == 0)
+				continue;
+
+			foreach (Parse_job* job, running)
+			{
+				if (pfd.fd == job->out_fd)
+					read_some (job->out_fd, job->out);
+				else if (pfd.fd == job->err_fd)
+					read_some (job->err_fd, job->err);
+			}
+		}
+
+		// A child is finished when it has closed both pipes.
+		List<Parse_job*>::iterator i = running.begin ();
+		while (i != running.end ())
+		{
+			if ((*i)->out_fd == -1 && (*i)->err_fd == -1)
+			{
+				finish_parse_job (*i, results);
+				i = running.erase (i);
+			}
+			else
+				i++;
+		}
+	}
+
+	return results;
+}
+
 void
 dump_parse_tree (String* filename, String_list* dirs)
 {
@@ -118,21 +391,15 @@ dump_parse_tree (String* filename, String_list* dirs)
 	if(full_path == NULL)
 		phc_error ("Search path not found");
 
-	ifstream file_input;
-	istream& input = (*full_path == "-") ? cin : file_input;
-
-	if(*full_path != "-")
-	{
-		file_input.open (full_path->c_str(), ifstream::in);
-		if (not file_input.is_open ())
-			phc_error ("Couldnt open file");
-	}
+	Source_buffer* source = Source_buffer::open (full_path);
+	if (source == NULL)
+		phc_error ("Couldnt open file");
 
-	PHP_context* context = new PHP_context (input, full_path);
+	PHP_context* context = new PHP_context (source, full_path);
 
 	context->dump_parse_tree ();
 
-	if (file_input.is_open ()) file_input.close ();
+	source->close ();
 }
 
 bool is_directory(String *dir) {
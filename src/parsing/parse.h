@@ -13,6 +13,7 @@
 #define PHC_PARSE
 
 #include "AST.h"
+#include "lib/Map.h"
 
 /*
  * Parse the specified file. Searches for the file in the current working
@@ -34,6 +35,47 @@ AST::PHP_script* parse (String* filename, String_list* dirs);
  */ 
 String* search_file (String* filename, String_list* dirs);
 
+/*
+ * Receives a script from parse_stream, one part at a time. Each part is a
+ * script of its own. LAST is true for the final part, which holds any comments
+ * after the last statement, and may be empty.
+ */
+class Stream_handler : virtual public GC_obj
+{
+public:
+	virtual void handle (AST::PHP_script* part, bool last) = 0;
+	virtual ~Stream_handler () {}
+};
+
+/*
+ * Parse the specified file as parse() does, but pass each top-level statement
+ * to HANDLER as soon as it has been parsed, rather than building the whole
+ * script, so that large scripts need not be held in memory at once (for
+ * --stream). Returns false if the file cannot be found.
+ */
+bool parse_stream (String* filename, String_list* dirs, Stream_handler* handler);
+
+/*
+ * A script parsed by parse_all, and anything its parser wrote to stderr (such
+ * as warnings). The messages should be written out when the script is used,
+ * so that they appear where they would if the file had been parsed then.
+ */
+class Parse_result : virtual public GC_obj
+{
+public:
+	AST::PHP_script* php_script;
+	String* messages;
+};
+
+/*
+ * Parse each of FULL_PATHS (which have already been found with search_file)
+ * as parse() does, with up to JOBS parsers running at once. Each is run in a
+ * child process, which sends the script back in phc's binary format (see
+ * process_ir/Bin_unparser.h). Files which cannot be parsed are left out of the
+ * result, so that the caller can parse them itself, and report the errors.
+ */
+Map<std::string, Parse_result*>* parse_all (String_list* full_paths, int jobs);
+
 /* Parse CODE, assuming that it comes from FILENAME:LINE_NUMBER */
 AST::PHP_script* parse_code (String* code, String* filename, int line_number);
 
@@ -12,6 +12,7 @@
 #define PHC_FAKE_PASS_H
 
 #include "pass_manager/Pass.h"
+#include "pass_manager/Pass_manager.h"
 
 class Fake_pass : public Pass
 {
@@ -22,7 +23,10 @@ class Fake_pass : public Pass
 		this->description = description;
 	}
 
-	void run (IR::PHP_script*, Pass_manager*) {}
+	void run (IR::PHP_script*, Pass_manager* pm)
+	{
+		pm->changed_nothing ();
+	}
 };
 
 
@@ -0,0 +1,122 @@
+/*
+ * phc -- the open source PHP compiler
+ * See doc/license/README.license for licensing information
+ *
+ * Run a chain of AST transforms in a single traversal. At each node, the
+ * pre-transforms are applied in order, each to the result of the previous
+ * one, then the children are transformed, then the post-transforms are
+ * applied in order.
+ *
+ * This gives the same result as running the transforms one after the other,
+ * so long as:
+ *		- no transform overrides children_* or transform_* methods,
+ *		- no transform relies on the traversal having finished before the
+ *		  next one starts, and
+ *		- the nodes created by one transform are left alone by the
+ *		  pre-transforms of the transforms before it.
+ * Transforms which only rewrite nodes locally on the way down, like the
+ * simple desugaring passes, meet these conditions.
+ */
+
+#ifndef PHC_FUSED_TRANSFORM_H
+#define PHC_FUSED_TRANSFORM_H
+
+#include "AST_transform.h"
+
+// Chain a transform returning a single node
+#define FUSE_NODE(PREPOST, TYPE, NAME)									\
+	TYPE* PREPOST##_##NAME (TYPE* in)												\
+	{																							\
+		TYPE* result = in;																\
+		foreach (AST::Transform* t, *transforms)									\
+		{																						\
+			if (result == NULL)															\
+				break;																		\
+																								\
+			result = t->PREPOST##_##NAME (result);		\
+		}																						\
+		return result;																		\
+	}
+
+// Chain a transform which replaces a node with a list of nodes
+#define FUSE_LIST(PREPOST, TYPE, LIST, NAME)										\
+	void PREPOST##_##NAME (TYPE* in, LIST* out)									\
+	{																							\
+		LIST* current = new LIST (in);												\
+		foreach (AST::Transform* t, *transforms)									\
+		{																						\
+			LIST* next = new LIST;														\
+			foreach (TYPE* node, *current)											\
+				t->PREPOST##_##NAME (node, next);									\
+																								\
+			current = next;																\
+		}																						\
+		out->push_back_all (current);													\
+	}
+
+#define FUSE_NODE_BOTH(TYPE, NAME)														\
+	FUSE_NODE (pre, TYPE, NAME)												\
+	FUSE_NODE (post, TYPE, NAME)
+
+#define FUSE_LIST_BOTH(TYPE, NAME)														\
+	FUSE_LIST (pre, TYPE, TYPE##_list, NAME)										\
+	FUSE_LIST (post, TYPE, TYPE##_list, NAME)
+
+class Fused_transform : public AST::Transform, virtual public GC_obj
+{
+	List<AST::Transform*>* transforms;
+
+public:
+	Fused_transform (List<AST::Transform*>* transforms)
+	: transforms (transforms)
+	{
+	}
+
+	/*
+	 * Node types with more than one subclass are dispatched by the *_statement,
+	 * *_expr, etc, methods. Let each transform do its own dispatching.
+	 */
+	FUSE_LIST_BOTH (AST::Statement, statement)
+	FUSE_LIST_BOTH (AST::Member, member)
+	FUSE_LIST_BOTH (AST::List_element, list_element)
+	FUSE_NODE_BOTH (AST::Expr, expr)
+	FUSE_NODE_BOTH (AST::Variable_name, variable_name)
+	FUSE_NODE_BOTH (AST::Class_name, class_name)
+	FUSE_NODE_BOTH (AST::Target, target)
+	FUSE_NODE_BOTH (AST::Method_name, method_name)
+
+	/*
+	 * The rest are called directly.
+	 */
+	FUSE_NODE_BOTH (AST::PHP_script, php_script)
+	FUSE_NODE_BOTH (AST::Class_mod, class_mod)
+	FUSE_NODE_BOTH (AST::Signature, signature)
+	FUSE_NODE_BOTH (AST::Method_mod, method_mod)
+	FUSE_NODE_BOTH (AST::Type, type)
+	FUSE_NODE_BOTH (AST::Attr_mod, attr_mod)
+	FUSE_NODE_BOTH (AST::Name_with_default, name_with_default)
+
+	FUSE_LIST_BOTH (AST::Formal_parameter, formal_parameter)
+	FUSE_LIST_BOTH (AST::Switch_case, switch_case)
+	FUSE_LIST_BOTH (AST::Directive, directive)
+	FUSE_LIST_BOTH (AST::Catch, catch)
+	FUSE_LIST_BOTH (AST::Array_elem, array_elem)
+	FUSE_LIST_BOTH (AST::Actual_parameter, actual_parameter)
+
+	// Tokens
+	FUSE_NODE_BOTH (AST::CLASS_NAME, class_name)
+	FUSE_NODE_BOTH (AST::INTERFACE_NAME, interface_name)
+	FUSE_NODE_BOTH (AST::METHOD_NAME, method_name)
+	FUSE_NODE_BOTH (AST::VARIABLE_NAME, variable_name)
+	FUSE_NODE_BOTH (AST::DIRECTIVE_NAME, directive_name)
+	FUSE_NODE_BOTH (AST::OP, op)
+	FUSE_NODE_BOTH (AST::CAST, cast)
+	FUSE_NODE_BOTH (AST::CONSTANT_NAME, constant_name)
+};
+
+#undef FUSE_NODE
+#undef FUSE_LIST
+#undef FUSE_NODE_BOTH
+#undef FUSE_LIST_BOTH
+
+#endif // PHC_FUSED_TRANSFORM_H
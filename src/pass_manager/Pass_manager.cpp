@@ -14,8 +14,11 @@
 #include "Plugin_pass.h"
 #include "Visitor_pass.h"
 #include "Transform_pass.h"
+#include "Fused_transform.h"
 #include "Optimization_pass.h"
+#include "Pass_timer.h"
 
+#include "process_ir/Bin_unparser.h"
 #include "process_ir/XML_unparser.h"
 #include "process_ast/AST_unparser.h"
 #include "process_hir/HIR_unparser.h"
@@ -35,6 +38,7 @@
 #include "optimize/wpa/Whole_program.h"
 
 #include "lib/error.h"
+#include "lib/Arena.h"
 #include <iostream>
 
 using namespace std;
@@ -56,6 +60,25 @@ Pass_manager::Pass_manager (gengetopt_args_info* args_info)
 	queues->push_back (opt_queue);
 	queues->push_back (ipa_queue);
 	queues->push_back (codegen_queue);
+
+	ast_fusions = new List<List<String*>*>;
+	changed_subtrees = NULL;
+	timer = NULL;
+	stream_state = NULL;
+}
+
+void Pass_manager::changed_subtree (IR::Node* subtree)
+{
+	if (changed_subtrees == NULL)
+		changed_subtrees = new List<IR::Node*>;
+
+	changed_subtrees->push_back (subtree);
+}
+
+void Pass_manager::changed_nothing ()
+{
+	if (changed_subtrees == NULL)
+		changed_subtrees = new List<IR::Node*>;
 }
 
 // AST
@@ -76,6 +99,12 @@ void Pass_manager::add_ast_pass (Pass* pass)
 	add_pass (pass, ast_queue);
 }
 
+void Pass_manager::fuse_ast_transforms (List<String*>* names)
+{
+	assert (names->size () > 1);
+	ast_fusions->push_back (names);
+}
+
 void Pass_manager::add_after_each_ast_pass (Pass* pass)
 {
 	add_after_each_pass (pass, ast_queue);
@@ -383,6 +412,41 @@ Pass_manager::maybe_enable_debug (String* pass_name)
 	}
 }
 
+// Does the user want to see the IR, or debug output, for this pass?
+bool
+Pass_manager::is_observed (String* pass_name)
+{
+	for (unsigned int i = 0; i < args_info->debug_given; i++)
+		if (*pass_name == args_info->debug_arg [i])
+			return true;
+
+	for (unsigned int i = 0; i < args_info->dump_given; i++)
+		if (*pass_name == args_info->dump_arg [i])
+			return true;
+
+	for (unsigned int i = 0; i < args_info->dump_dot_given; i++)
+		if (*pass_name == args_info->dump_dot_arg [i])
+			return true;
+
+	for (unsigned int i = 0; i < args_info->dump_xml_given; i++)
+		if (*pass_name == args_info->dump_xml_arg [i])
+			return true;
+
+	for (unsigned int i = 0; i < args_info->dump_bin_given; i++)
+		if (*pass_name == args_info->dump_bin_arg [i])
+			return true;
+
+	return false;
+}
+
+Unparser_state* Pass_manager::get_unparser_state ()
+{
+	if (stream_state)
+		return stream_state;
+
+	return new Unparser_state (cout, false);
+}
+
 void Pass_manager::dump (IR::PHP_script* in, String* passname)
 {
 	for (unsigned int i = 0; i < args_info->dump_given; i++)
@@ -391,7 +455,7 @@ void Pass_manager::dump (IR::PHP_script* in, String* passname)
 		{
 			if (in->is_AST ())
 			{
-				AST_unparser ().unparse (in->as_AST ());
+				AST_unparser (get_unparser_state ()).unparse (in->as_AST ());
 			}
 			else if (in->is_HIR ())
 			{
@@ -409,14 +473,14 @@ void Pass_manager::dump (IR::PHP_script* in, String* passname)
 					//phc_error ("Uppered dump is not supported during HIR pass: %s", name->c_str ());
 				}
 
-				HIR_unparser ().unparse (in->as_HIR ());
+				HIR_unparser (get_unparser_state ()).unparse (in->as_HIR ());
 			}
 			else if (in->is_MIR ())
 			{
 				if (args_info->convert_uppered_flag)
-					MIR_unparser().unparse_uppered (in->as_MIR ());
+					MIR_unparser (get_unparser_state ()).unparse_uppered (in->as_MIR ());
 				else
-					MIR_unparser ().unparse (in->as_MIR ());
+					MIR_unparser (get_unparser_state ()).unparse (in->as_MIR ());
 			}
 			else
 				phc_unreachable ();
@@ -440,6 +504,14 @@ void Pass_manager::dump (IR::PHP_script* in, String* passname)
 		}
 	}
 
+	for (unsigned int i = 0; i < args_info->dump_bin_given; i++)
+	{
+		if (*passname == args_info->dump_bin_arg [i])
+		{
+			bin_unparse (in, std::cout);
+		}
+	}
+
 
 	// TODO: add arguments to --stats to allow stats to be dumped once per passname, all at once at the end, or once per specified passname
 	if (args_info->stats_given)
@@ -467,6 +539,13 @@ void Pass_manager::run (IR::PHP_script* in, bool main)
 // small snippets, and to true for the main program.
 void Pass_manager::run_pass (Pass* pass, IR::PHP_script* in, bool main)
 {
+	// Passes can run other passes on new snippets of IR
+	List<IR::Node*>* outer_changed_subtrees = changed_subtrees;
+	changed_subtrees = NULL;
+
+	// Passes run on snippets are counted in the pass which runs them.
+	Pass_timer_scope timing (main ? timer : NULL, get_phase (pass), *pass->name);
+
 	try
 	{
 		assert (pass->name);
@@ -477,17 +556,98 @@ void Pass_manager::run_pass (Pass* pass, IR::PHP_script* in, bool main)
 		if (main)
 			maybe_enable_debug (pass->name);
 
+		// A disabled pass cant change anything. Passes can disable themselves
+		// while running, so ask first.
+		if (not pass->is_enabled (this))
+			changed_nothing ();
+
 		pass->run_pass (in, this, main);
+		timing.stop (in);
+
 		if (main)
 			this->dump (in, pass->name);
 
 		if (check)
-			::check (in, false);
+		{
+			if (changed_subtrees == NULL)
+				::check (in, false);
+			else
+			{
+				foreach (IR::Node* subtree, *changed_subtrees)
+					::check (subtree, false);
+			}
+		}
 	}
 	catch (String* e)
 	{
 		// TODO: Handle this	
 	}
+
+	changed_subtrees = outer_changed_subtrees;
+}
+
+/* If the passes starting at I were registered with fuse_ast_transforms, run
+ * them in a single traversal, and return the number of passes run. Return 0
+ * if they must be run one at a time: if the group has been broken up (say by
+ * a plugin, or a pass added after each pass), if we must stop partway
+ * through the group, or if the IR is wanted between the passes. */
+int Pass_manager::run_fused_ast_transforms (Pass_queue::const_iterator i, String* to, IR::PHP_script* in, bool main)
+{
+	foreach (List<String*>* group, *ast_fusions)
+	{
+		if (*group->front () != *(*i)->name)
+			continue;
+
+		List<AST::Transform*>* transforms = new List<AST::Transform*>;
+		Pass* last = NULL;
+		foreach (String* name, *group)
+		{
+			if (i == ast_queue->end () || *(*i)->name != *name)
+				return 0;
+
+			Transform_pass* pass = dynamic_cast<Transform_pass*> (*i);
+			if (pass == NULL || pass->get_ast_transform () == NULL)
+				return 0;
+
+			if (main && is_observed (name))
+				return 0;
+
+			if (to != NULL && *to == *name && name != group->back ())
+				return 0;
+
+			if (pass->is_enabled (this))
+				transforms->push_back (pass->get_ast_transform ());
+
+			last = *i;
+			i++;
+		}
+
+		if (args_info->verbose_flag && main)
+			foreach (String* name, *group)
+				cout << "Running pass: " << *name << " (fused)" << endl;
+
+		if (main)
+			maybe_enable_debug (last->name);
+
+		stringstream group_name;
+		foreach (String* name, *group)
+			group_name << (name == group->front () ? "" : "+") << *name;
+
+		Pass_timer_scope timing (main ? timer : NULL, "ast", group_name.str ());
+		if (transforms->size ())
+			in->transform_children (new Fused_transform (transforms));
+		timing.stop (in);
+
+		if (main)
+			this->dump (in, last->name);
+
+		if (check)
+			::check (in, false);
+
+		return group->size ();
+	}
+
+	return 0;
 }
 
 /* Run all passes between FROM and TO, inclusive. */
@@ -512,15 +672,29 @@ IR::PHP_script* Pass_manager::run_from_until (String* from, String* to, IR::PHP_
 
 	bool exec = false;
 	// AST
-	foreach (Pass* p, *ast_queue)
+	for (Pass_queue::const_iterator i = ast_queue->begin ();
+			i != ast_queue->end ();
+			i++)
 	{
+		Pass* p = *i;
+
 		// check for starting pass
 		if (!exec && 
 				((from == NULL) || *(p->name) == *from))
 			exec = true;
 
 		if (exec)
-			run_pass (p, in, main);
+		{
+			int fused = run_fused_ast_transforms (i, to, in, main);
+			if (fused == 0)
+				run_pass (p, in, main);
+			else
+			{
+				// Skip to the last pass in the group
+				advance (i, fused - 1);
+				p = *i;
+			}
+		}
 
 		// check for last pass
 		if (exec && (to != NULL) && *(p->name) == *to)
@@ -539,8 +713,15 @@ IR::PHP_script* Pass_manager::run_from_until (String* from, String* to, IR::PHP_
 
 	// HIR
 	if (exec)
+	{
 		in = in->fold_lower ();
 
+		// Passes only check what they change, so check everything between
+		// IRs.
+		if (check)
+			::check (in, false);
+	}
+
 	foreach (Pass* p, *hir_queue)
 	{
 		// check for starting pass
@@ -565,8 +746,15 @@ IR::PHP_script* Pass_manager::run_from_until (String* from, String* to, IR::PHP_
 
 	// MIR
 	if (exec)
+	{
 		in = in->fold_lower ();
 
+		// Passes only check what they change, so check everything between
+		// IRs.
+		if (check)
+			::check (in, false);
+	}
+
 	foreach (Pass* p, *mir_queue)
 	{
 		// check for starting pass
@@ -604,6 +792,19 @@ IR::PHP_script* Pass_manager::run_from_until (String* from, String* to, IR::PHP_
 	return in;
 }
 
+// The queue PASS is in, for --time-passes
+string Pass_manager::get_phase (Pass* pass)
+{
+	if (ast_queue->has (pass)) return "ast";
+	if (hir_queue->has (pass)) return "hir";
+	if (mir_queue->has (pass)) return "mir";
+	if (wpa_queue->has (pass)) return "wpa";
+	if (opt_queue->has (pass)) return "optimize";
+	if (ipa_queue->has (pass)) return "ipa";
+	if (codegen_queue->has (pass)) return "codegen";
+	return "plugin";
+}
+
 void Pass_manager::post_process ()
 {
 	foreach (Pass_queue* q, *queues)
@@ -667,15 +868,19 @@ void Pass_manager::optimize (MIR::PHP_script* in)
 
 		// Initialize the optimization oracle (also builds CFGs)
 		maybe_enable_debug (s("cfg"));
+		Pass_timer_scope cfg_timing (timer, "optimize", "cfg");
 		Oracle::initialize (in);
+		cfg_timing.stop ();
 
 		// TODO: check if WPA is enabled
 
 
 		// WPA calls all other passes
 		maybe_enable_debug (s("wpa"));
+		Pass_timer_scope timing (timer, "wpa", "wpa");
 		Whole_program* wpa = new Whole_program (this);
 		wpa->run (in);
+		timing.stop (in);
 	}
 	catch (String* e)
 	{
@@ -721,12 +926,17 @@ Pass_manager::run_optimization_pass (Pass* pass, Whole_program* wp, CFG* cfg)
 	if (args_info->verbose_flag)
 		cout << "Running pass: " << *pass->name << endl;
 
+	// Includes the conversion into and out of SSA form
+	Pass_timer_scope timing (timer, get_phase (pass), *pass->name);
+
 	// TODO: re-enable this.
 	// If an optimization pass sees something it cant handle, it throws an
 	// exception, and we skip optimizing the function.
 
 	maybe_enable_debug (s("build-ssa-ssi"));
 
+	Pass_timer_scope build_timing (timer, "optimize", "build-ssa-ssi");
+
 	HSSA *hssa = NULL;
 	if (opt->require_ssa || opt->require_ssi)
 	{
@@ -751,11 +961,15 @@ Pass_manager::run_optimization_pass (Pass* pass, Whole_program* wp, CFG* cfg)
 		cfg_dump (cfg, pass->name, s("Non-SSA"));
 	}
 
+	build_timing.stop ();
+
 	// Run optimization
 	maybe_enable_debug (pass->name);
 
 	try
 	{
+		// Data which only lives as long as the pass
+		Arena_scope arena;
 		opt->run (cfg, this);
 	}
 	catch (String* e)
@@ -770,6 +984,7 @@ Pass_manager::run_optimization_pass (Pass* pass, Whole_program* wp, CFG* cfg)
 	if (opt->require_ssa || opt->require_ssi)
 	{
 		maybe_enable_debug (s("drop-ssa-ssi"));
+		Pass_timer_scope drop_timing (timer, "optimize", "drop-ssa-ssi");
 		hssa->convert_out_of_hssa_form ();
 		cfg->clean ();
 		cfg_dump (cfg, pass->name, s("Out of SSA/SSI (cleaned)"));
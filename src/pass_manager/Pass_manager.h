@@ -18,13 +18,15 @@ class CFG_visitor;
 class Optimization_pass;
 class Whole_program;
 class Pass;
+class Pass_timer;
 class String;
+class Unparser_state;
 
 typedef List<Pass*> Pass_queue;
 namespace AST { class Visitor; class Transform; }
 namespace HIR { class Visitor; class Transform; }
 namespace MIR { class Visitor; class Transform; class Method; }
-namespace IR { class PHP_script; }
+namespace IR { class PHP_script; class Node; }
 
 class Pass_manager : virtual public GC_obj
 {
@@ -36,6 +38,23 @@ public:
 	gengetopt_args_info* args_info;
 	bool check; // check IR after each pass
 
+	// Passes which know which parts of the IR they changed report them, so
+	// that only those parts are checked after the pass. If a pass reports
+	// nothing, the whole IR is checked.
+	void changed_subtree (IR::Node* subtree);
+	void changed_nothing ();
+
+	// Times each pass if --time-passes is given, otherwise NULL.
+	Pass_timer* timer;
+
+	// If --stream is given, the parts of the script are printed with the same
+	// unparser state, so that they join up. Otherwise NULL.
+	Unparser_state* stream_state;
+
+	// The state to print the program with, for --dump, --pretty-print and
+	// --obfuscate.
+	Unparser_state* get_unparser_state ();
+
 	Pass_manager (gengetopt_args_info* args_info);
 
 	// Remove passes
@@ -53,6 +72,10 @@ public:
 	void add_ast_transform (AST::Transform* transform, String* name, String* description);
 	void add_after_each_ast_pass (Pass* pass);
 
+	// Run the named AST transforms in a single traversal, if they are adjacent
+	// in the queue. See Fused_transform.h for which transforms can be fused.
+	void fuse_ast_transforms (List<String*>* names);
+
 	// Add HIR passes
 	void add_hir_pass (Pass* pass);
 	void add_hir_visitor (HIR::Visitor* visitor, String* name, String* description);
@@ -100,12 +123,15 @@ public:
 
 	void run (IR::PHP_script* in, bool main = false);
 	void run_pass (Pass* pass, IR::PHP_script* in, bool main = false);
+	int run_fused_ast_transforms (Pass_queue::const_iterator i, String* to, IR::PHP_script* in, bool main);
 	void post_process ();
 
 
 	void list_passes ();
+	std::string get_phase (Pass* pass);
 	void dump (IR::PHP_script* in, String* passname);
 	void maybe_enable_debug (String* passname);
+	bool is_observed (String* passname);
 
 	// HACK: debugging for optimization passes.
 	void cfg_dump (CFG* cfg, String* passname, String* comment);
@@ -119,6 +145,10 @@ protected:
 	Pass_queue* ipa_queue;
 	Pass_queue* codegen_queue;
 	List<Pass_queue*>* queues;
+	List<List<String*>*>* ast_fusions;
+
+	// Subtrees changed by the current pass, or NULL if unknown
+	List<IR::Node*>* changed_subtrees;
 };
 
 #endif // PHC_PASS_MANAGER_H
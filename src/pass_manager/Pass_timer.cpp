@@ -0,0 +1,317 @@
+/*
+ * phc -- the open source PHP compiler
+ * See doc/license/README.license for licensing information
+ *
+ * Measure the time and memory used by each pass, for --time-passes.
+ */
+
+#include <iomanip>
+#include <sys/time.h>
+#include <sys/resource.h>
+
+#include "Pass_timer.h"
+#include "lib/Alloc_profile.h"
+#include "lib/escape.h"
+#include "process_ir/General.h"
+
+#ifndef DISABLE_GC
+#include "gc/gc.h"
+#endif
+
+#include "AST_visitor.h"
+#include "HIR_visitor.h"
+#include "MIR_visitor.h"
+
+using namespace std;
+
+/*
+ * Count the nodes in an IR
+ */
+
+template <class Visitor, class Node>
+class Node_counter : public Visitor
+{
+public:
+	long count;
+
+	Node_counter ()
+	: count (0)
+	{
+	}
+
+	void pre_node (Node* in)
+	{
+		count++;
+	}
+};
+
+static long
+count_nodes (IR::PHP_script* in)
+{
+	if (in->is_AST ())
+	{
+		Node_counter<AST::Visitor, AST::Node> counter;
+		in->as_AST ()->visit (&counter);
+		return counter.count;
+	}
+	else if (in->is_HIR ())
+	{
+		Node_counter<HIR::Visitor, HIR::Node> counter;
+		in->as_HIR ()->visit (&counter);
+		return counter.count;
+	}
+	else
+	{
+		Node_counter<MIR::Visitor, MIR::Node> counter;
+		in->as_MIR ()->visit (&counter);
+		return counter.count;
+	}
+}
+
+/*
+ * Timing
+ */
+
+static double
+seconds (struct timeval& tv)
+{
+	return tv.tv_sec + tv.tv_usec / 1e6;
+}
+
+Pass_timer::Sample
+Pass_timer::now ()
+{
+	Sample result;
+
+	struct timeval tv;
+	gettimeofday (&tv, NULL);
+	result.wall = seconds (tv);
+
+	struct rusage self, children;
+	getrusage (RUSAGE_SELF, &self);
+	getrusage (RUSAGE_CHILDREN, &children);
+	result.cpu = seconds (self.ru_utime) + seconds (self.ru_stime)
+				  + seconds (children.ru_utime) + seconds (children.ru_stime);
+
+#ifndef DISABLE_GC
+	result.heap = GC_get_heap_size ();
+	result.collections = GC_gc_no;
+#else
+	result.heap = 0;
+	result.collections = 0;
+#endif
+
+	return result;
+}
+
+Pass_timer::Pass_timer ()
+{
+	begin = now ();
+}
+
+void
+Pass_timer::start (string phase, string name)
+{
+	string key = phase + "/" + name;
+	Entry* entry = entries_by_name[key];
+	if (entry == NULL)
+	{
+		entry = new Entry;
+		entry->phase = phase;
+		entry->name = name;
+		entry->depth = running.size ();
+		entry->runs = 0;
+		entry->wall = 0;
+		entry->cpu = 0;
+		entry->heap_growth = 0;
+		entry->collections = 0;
+		entry->nodes = -1;
+
+		entries.push_back (entry);
+		entries_by_name[key] = entry;
+	}
+
+	Running r;
+	r.entry = entry;
+	r.start = now ();
+	running.push_back (r);
+
+	if (alloc_profile_enabled)
+		Alloc_profile::enter (phase, name);
+}
+
+void
+Pass_timer::stop (IR::PHP_script* in)
+{
+	assert (running.size ());
+
+	Sample end = now ();
+	Running r = running.back ();
+	running.pop_back ();
+
+	if (alloc_profile_enabled)
+		Alloc_profile::leave ();
+
+	Entry* entry = r.entry;
+	entry->runs++;
+	entry->wall += end.wall - r.start.wall;
+	entry->cpu += end.cpu - r.start.cpu;
+	entry->heap_growth += end.heap - r.start.heap;
+	entry->collections += end.collections - r.start.collections;
+
+	if (in)
+	{
+		// Dont count the time to count the nodes against the enclosing
+		// entries either.
+		double wall = now ().wall;
+		entry->nodes = count_nodes (in);
+		wall = now ().wall - wall;
+
+		foreach (Running& outer, running)
+			outer.start.wall += wall;
+	}
+}
+
+/*
+ * Reports
+ */
+
+double
+Pass_timer::get_cpu (string phase, string name)
+{
+	double result = 0;
+	foreach (Entry* entry, entries)
+	{
+		if (entry->phase != phase)
+			continue;
+
+		if (name == "" ? entry->depth == 0 : entry->name == name)
+			result += entry->cpu;
+	}
+
+	return result;
+}
+
+void
+Pass_timer::print_table (ostream& os)
+{
+	Sample end = now ();
+
+	os
+	<< left << setw (10) << "Phase"
+	<< setw (30) << "Pass"
+	<< right << setw (6) << "Runs"
+	<< setw (11) << "Wall (s)"
+	<< setw (11) << "CPU (s)"
+	<< setw (12) << "Heap (KB)"
+	<< setw (6) << "GCs"
+	<< setw (10) << "Nodes"
+	<< endl;
+
+	os << fixed << setprecision (3);
+
+	foreach (Entry* entry, entries)
+	{
+		os
+		<< left << setw (10) << entry->phase
+		<< setw (30) << (string (entry->depth * 2, ' ') + entry->name)
+		<< right << setw (6) << entry->runs
+		<< setw (11) << entry->wall
+		<< setw (11) << entry->cpu
+		<< setw (12) << entry->heap_growth / 1024
+		<< setw (6) << entry->collections;
+
+		if (entry->nodes == -1)
+			os << setw (10) << "-";
+		else
+			os << setw (10) << entry->nodes;
+
+		os << endl;
+	}
+
+	os
+	<< left << setw (10) << "total"
+	<< setw (30) << ""
+	<< right << setw (6) << ""
+	<< setw (11) << end.wall - begin.wall
+	<< setw (11) << end.cpu - begin.cpu
+	<< setw (12) << (end.heap - begin.heap) / 1024
+	<< setw (6) << end.collections - begin.collections
+	<< setw (10) << ""
+	<< endl;
+
+	os.unsetf (ios_base::floatfield);
+	os << setprecision (6);
+}
+
+void
+Pass_timer::print_json (ostream& os)
+{
+	Sample end = now ();
+
+	os << "{\n";
+	os << "  \"passes\": [\n";
+
+	bool first = true;
+	foreach (Entry* entry, entries)
+	{
+		if (!first)
+			os << ",\n";
+		first = false;
+
+		os
+		<< "    {"
+		<< "\"phase\": \"" << *escape_C_dq (s(entry->phase)) << "\", "
+		<< "\"name\": \"" << *escape_C_dq (s(entry->name)) << "\", "
+		<< "\"depth\": " << entry->depth << ", "
+		<< "\"runs\": " << entry->runs << ", "
+		<< "\"wall\": " << entry->wall << ", "
+		<< "\"cpu\": " << entry->cpu << ", "
+		<< "\"heap_growth\": " << entry->heap_growth << ", "
+		<< "\"collections\": " << entry->collections << ", "
+		<< "\"nodes\": ";
+
+		if (entry->nodes == -1)
+			os << "null";
+		else
+			os << entry->nodes;
+
+		os << "}";
+	}
+
+	os << "\n  ],\n";
+	os
+	<< "  \"total\": {"
+	<< "\"wall\": " << end.wall - begin.wall << ", "
+	<< "\"cpu\": " << end.cpu - begin.cpu << ", "
+	<< "\"heap_growth\": " << end.heap - begin.heap << ", "
+	<< "\"heap_size\": " << end.heap << ", "
+	<< "\"collections\": " << end.collections - begin.collections
+	<< "}\n";
+	os << "}\n";
+}
+
+/*
+ * Scopes
+ */
+
+Pass_timer_scope::Pass_timer_scope (Pass_timer* timer, string phase, string name)
+: timer (timer)
+{
+	if (timer)
+		timer->start (phase, name);
+}
+
+Pass_timer_scope::~Pass_timer_scope ()
+{
+	stop ();
+}
+
+void
+Pass_timer_scope::stop (IR::PHP_script* in)
+{
+	if (timer)
+		timer->stop (in);
+
+	timer = NULL;
+}
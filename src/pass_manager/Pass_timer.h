@@ -0,0 +1,101 @@
+/*
+ * phc -- the open source PHP compiler
+ * See doc/license/README.license for licensing information
+ *
+ * Measure the time and memory used by each pass, for --time-passes.
+ *
+ * Each entry is identified by a phase (the pass queue, or "wpa" for the
+ * whole-program iterations) and a name. Entries can be started more than once
+ * (optimization passes run once per method, and in each WPA iteration), and
+ * the results are summed. Entries can be nested, and include the time of the
+ * entries inside them: each WPA iteration includes the optimization passes it
+ * runs, for example.
+ *
+ * The entries are also the scopes of the allocation profile (see
+ * lib/Alloc_profile.h).
+ */
+
+#ifndef PHC_PASS_TIMER_H
+#define PHC_PASS_TIMER_H
+
+#include <iostream>
+#include <string>
+
+#include "lib/List.h"
+#include "lib/Map.h"
+
+namespace IR { class PHP_script; }
+
+class Pass_timer : virtual public GC_obj
+{
+public:
+	Pass_timer ();
+
+	void start (std::string phase, std::string name);
+
+	// Stop the innermost entry. If IN is given, count its nodes (after the
+	// entry is stopped, so that it does not affect the timings).
+	void stop (IR::PHP_script* in = NULL);
+
+	// Print the entries, in the order they were first started.
+	void print_table (std::ostream& os);
+	void print_json (std::ostream& os);
+
+	// The CPU time of the entry PHASE/NAME, or of the outermost entries in
+	// PHASE if NAME is empty.
+	double get_cpu (std::string phase, std::string name = "");
+
+private:
+	struct Sample
+	{
+		double wall;
+		double cpu; // includes child processes, such as gcc
+		long heap;
+		unsigned long collections;
+	};
+
+	static Sample now ();
+
+	struct Entry
+	{
+		std::string phase;
+		std::string name;
+		int depth;
+		int runs;
+		double wall;
+		double cpu;
+		long heap_growth;
+		unsigned long collections;
+		long nodes; // after the last run, or -1 if unknown
+	};
+
+	struct Running
+	{
+		Entry* entry;
+		Sample start;
+	};
+
+	Sample begin;
+	List<Entry*> entries;
+	Map<std::string, Entry*> entries_by_name;
+	List<Running> running;
+};
+
+// Time a scope, if TIMER is not NULL.
+class Pass_timer_scope
+{
+public:
+	Pass_timer_scope (Pass_timer* timer, std::string phase, std::string name);
+	~Pass_timer_scope ();
+
+	void stop (IR::PHP_script* in = NULL);
+
+private:
+	Pass_timer* timer;
+
+	// Scopes live on the stack
+	Pass_timer_scope (const Pass_timer_scope&);
+	void operator= (const Pass_timer_scope&);
+};
+
+#endif // PHC_PASS_TIMER_H
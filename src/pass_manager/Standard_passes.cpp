@@ -0,0 +1,135 @@
+/*
+ * phc -- the open source PHP compiler
+ * See doc/license/README.license for licensing information
+ *
+ * The passes which make up phc.
+ */
+
+#include "Standard_passes.h"
+#include "ast_to_hir/AST_shredder.h"
+#include "ast_to_hir/Desugar.h"
+#include "ast_to_hir/Early_lower_control_flow.h"
+#include "ast_to_hir/Echo_split.h"
+#include "ast_to_hir/List_shredder.h"
+#include "ast_to_hir/Lower_expr_flow.h"
+#include "ast_to_hir/Pre_post_op_shredder.h"
+#include "ast_to_hir/Remove_solo_exprs.h"
+#include "ast_to_hir/Split_multiple_arguments.h"
+#include "ast_to_hir/Split_unset_isset.h"
+#include "ast_to_hir/Strip_comments.h"
+#include "ast_to_hir/Switch_bin_op.h"
+#include "codegen/Clarify.h"
+#include "codegen/Compile_C.h"
+#include "codegen/Generate_C_annotations.h"
+#include "codegen/Generate_C_pass.h"
+#include "codegen/Lift_functions_and_classes.h"
+#include "hir_to_mir/Lower_control_flow.h"
+#include "hir_to_mir/Lower_dynamic_definitions.h"
+#include "hir_to_mir/Lower_method_invocations.h"
+#include "optimize/hacks/Copy_propagation.h"
+#include "optimize/hacks/Dead_temp_cleanup.h"
+#include "optimize/Coalesce_temporaries.h"
+#include "optimize/Dead_code_elimination.h"
+#include "optimize/Dead_store_elimination.h"
+#include "optimize/If_simplification.h"
+#include "optimize/Inlining.h"
+#include "optimize/Mark_initialized.h"
+#include "optimize/Misc_annotations.h"
+#include "optimize/Prune_symbol_table.h"
+#include "optimize/Remove_loop_booleans.h"
+#include "pass_manager/Fake_pass.h"
+#include "pass_manager/Pass_manager.h"
+#include "process_ast/Constant_folding.h"
+#include "process_ast/Invalid_check.h"
+#include "process_ast/Note_top_level_declarations.h"
+#include "process_ast/Pretty_print.h"
+#include "process_ast/Process_includes.h"
+#include "process_ast/Remove_concat_null.h"
+#include "process_ast/Strip_unparser_attributes.h"
+#include "process_mir/Obfuscate.h"
+
+using namespace std;
+
+void
+add_standard_passes (Pass_manager* pm, stringstream& c_code)
+{
+	// process_ast passes
+	pm->add_ast_pass (new Invalid_check ());
+	pm->add_ast_pass (new Fake_pass (s("ast"), s("Abstract Syntax Tree - a representation of the PHP program, as written")));
+	pm->add_ast_pass (new Process_includes (false, s("incl1"), pm, s("incl1")));
+	pm->add_ast_pass (new Pretty_print ());
+
+	// Begin lowering to hir
+	pm->add_ast_visitor (new Strip_comments (), s("decomment"), s("Remove comments"));
+	pm->add_ast_visitor (new Strip_unparser_attributes (), s("sua"), s("Remove the attributes used to pretty-print source code"));
+	pm->add_ast_visitor (new Note_top_level_declarations (), s("ntld"), s("Make a note of top-level-declarations before the information is lost"));
+
+	// Small optimization on the AST
+	pm->add_ast_transform (new Constant_folding(), s("const-fold"), s("Fold constant expressions"));
+	pm->add_ast_transform (new Remove_concat_null (), s("rcn"), s("Remove concatenations with \"\"")); // TODO: this is wrong - it really should be converted to a cast to string.
+
+
+
+	// Make simple statements simpler
+	pm->add_ast_transform (new Desugar (), s("desug"), s("Canonicalize simple constructs"));
+	pm->add_ast_transform (new Split_multiple_arguments (), s("sma"), s("Split multiple arguments for globals, attributes and static declarations"));
+	pm->add_ast_transform (new Split_unset_isset (), s("sui"), s("Split unset() and isset() into multiple calls with one argument each"));
+	pm->add_ast_transform (new Echo_split (), s("ecs"), s("Split echo() into multiple calls with one argument each"));
+
+	pm->add_ast_transform (new Early_lower_control_flow (), s("elcf"), s("Early Lower Control Flow - lower for, while, do and switch statements")); // AST
+	pm->add_ast_transform (new Lower_expr_flow (), s("lef"), s("Lower Expression Flow - Lower ||, && and ?: expressions"));
+	pm->add_ast_transform (new List_shredder (), s("lish"), s("List shredder - simplify to array assignments"));
+	pm->add_ast_transform (new Shredder (), s("ashred"), s("Shredder - turn the AST into three-address-code, replacing complex expressions with a temporary variable"));
+	pm->add_ast_transform (new Pre_post_op_shredder (), s("pps"), s("Shred pre- and post-ops, removing post-ops"));
+	pm->add_ast_transform (new Switch_bin_op (), s("swbin"), s("Switch '>=' and '>' bin-ops"));
+	pm->add_ast_transform (new Remove_solo_exprs (), s("rse"), s("Remove expressions which are not stored"));
+	pm->add_ast_pass (new Fake_pass (s("AST-to-HIR"), s("The HIR in AST form")));
+
+	// These only rewrite nodes locally, so they can share a traversal
+	pm->fuse_ast_transforms (new List<String*> (s("desug"), s("sma"), s("sui"), s("ecs")));
+	pm->fuse_ast_transforms (new List<String*> (s("swbin"), s("rse")));
+
+
+	pm->add_hir_pass (new Fake_pass (s("hir"), s("High-level Internal Representation - the smallest subset of PHP which can represent the entire language")));
+	pm->add_hir_transform (new Copy_propagation (), s("prc"), s("Propagate copies - Remove some copies introduced as a result of lowering"));
+	pm->add_hir_transform (new Dead_temp_cleanup (), s("dtc"), s("Dead temp cleanup")); // TODO: Description?
+	pm->add_hir_transform (new Lower_dynamic_definitions (), s("ldd"), s("Lower Dynamic Definitions - Lower dynamic class, interface and method definitions using aliases"));
+	pm->add_hir_transform (new Lower_method_invocations (), s("lmi"), s("Lower Method Invocations - Lower parameters using run-time reference checks"));
+	pm->add_hir_transform (new Lower_control_flow (), s("lcf"), s("Lower Control Flow - Use gotos in place of loops, ifs, breaks and continues"));
+	pm->add_hir_pass (new Fake_pass (s("HIR-to-MIR"), s("The MIR in HIR form")));
+
+
+	pm->add_mir_pass (new Fake_pass (s("mir"), s("Medium-level Internal Representation - simple code with high-level constructs lowered to straight-line code")));
+	pm->add_mir_pass (new Obfuscate ());
+//	pm->add_mir_pass (new Process_includes (true, new String ("mir"), pm, "incl2"));
+	pm->add_mir_transform (new Lift_functions_and_classes (), s("lfc"), s("Move statements from global scope into __MAIN__ method"));
+	pm->add_mir_visitor (new Clarify (), s("clar"), s("Clarify - Make implicit definitions explicit"));
+	// TODO: move this into optimization passes
+	pm->add_mir_visitor (new Prune_symbol_table (), s("pst"), s("Prune Symbol Table - Note whether a symbol table is required in generated code"));
+
+
+	// Optimization passes
+	pm->add_local_optimization_pass (new Fake_pass (s("wpa"), s("Whole-program analysis")));
+	pm->add_local_optimization_pass (new Fake_pass (s("cfg"), s("Initial Control-Flow Graph")));
+	pm->add_local_optimization_pass (new Fake_pass (s("build-ssa-ssi"), s("Create SSA/SSI form")));
+	pm->add_local_optimization (new If_simplification (), s("ifsimple"), s("If-simplification"), true);
+	pm->add_local_optimization (new DCE (), s("dce"), s("Aggressive Dead-code elimination"), true);
+	pm->add_local_optimization_pass (new Fake_pass (s("drop-ssa-ssi"), s("Drop SSA/SSI form")));
+	pm->add_local_optimization (new DSE (), s("dse"), s("Dead-store elimination for arrays and fields"), false);
+	pm->add_local_optimization (new Remove_loop_booleans (), s("rlb"), s("Remove loop-booleans"), false);
+
+	pm->add_ipa_optimization (new Inlining (), s("inlining"), s("Method inlining"), false);
+
+	// TODO: we could consider this for resolving isset/empty/unset queries
+	// TODO: I think these should mostly move to WPA
+//	pm->add_optimization (new Mark_initialized (), s("mvi"), s("Mark variable initialization status"), false);
+//	pm->add_optimization (new Misc_annotations (), s("mao"), s("Miscellaneous annotations for optimization"), false);
+
+
+	// codegen passes
+	pm->add_codegen_pass (new Fake_pass(s("codegen"), s("Last pass before codegen generation begins")));
+	pm->add_codegen_pass (new Coalesce_temporaries ());
+	pm->add_codegen_visitor (new Generate_C_annotations, s("cgann"), s("Make annotations for code generation"));
+	pm->add_codegen_pass (new Generate_C_pass (c_code));
+	pm->add_codegen_pass (new Compile_C (c_code));
+}
@@ -0,0 +1,18 @@
+/*
+ * phc -- the open source PHP compiler
+ * See doc/license/README.license for licensing information
+ *
+ * The passes which make up phc, in order. Plugins add theirs afterwards.
+ */
+
+#ifndef PHC_STANDARD_PASSES_H
+#define PHC_STANDARD_PASSES_H
+
+#include <sstream>
+
+class Pass_manager;
+
+// The generated C code is written to C_CODE, from which it is compiled.
+void add_standard_passes (Pass_manager* pm, std::stringstream& c_code);
+
+#endif // PHC_STANDARD_PASSES_H
@@ -55,6 +55,11 @@ public:
 		else
 			in->transform_children (mir_transform);
 	}
+
+	AST::Transform* get_ast_transform ()
+	{
+		return ast_transform;
+	}
 };
 
 #endif // PHC_TRANSFORM_PASS_H
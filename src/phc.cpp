@@ -5,58 +5,27 @@
  * Main application module 
  */
 
+#include <fstream>
 #include <ltdl.h>
 #include <signal.h>
 #include <stdio.h>
 #include <stdlib.h>
 
-#include "ast_to_hir/AST_shredder.h"
-#include "ast_to_hir/Desugar.h"
-#include "ast_to_hir/Early_lower_control_flow.h"
-#include "ast_to_hir/Echo_split.h"
-#include "ast_to_hir/List_shredder.h"
-#include "ast_to_hir/Lower_expr_flow.h"
-#include "ast_to_hir/Pre_post_op_shredder.h"
-#include "ast_to_hir/Remove_solo_exprs.h"
-#include "ast_to_hir/Split_multiple_arguments.h"
-#include "ast_to_hir/Split_unset_isset.h"
-#include "ast_to_hir/Strip_comments.h"
-#include "ast_to_hir/Switch_bin_op.h"
-#include "generated/cmdline.h"
-#include "codegen/Clarify.h"
-#include "codegen/Compile_C.h"
-#include "codegen/Generate_C_annotations.h"
-#include "codegen/Generate_C_pass.h"
-#include "codegen/Lift_functions_and_classes.h"
 #include "embed/embed.h"
-#include "hir_to_mir/HIR_to_MIR.h"
-#include "hir_to_mir/Lower_control_flow.h"
-#include "hir_to_mir/Lower_dynamic_definitions.h"
-#include "hir_to_mir/Lower_method_invocations.h"
-#include "optimize/hacks/Copy_propagation.h"
-#include "optimize/hacks/Dead_temp_cleanup.h"
-#include "optimize/Dead_code_elimination.h"
-#include "optimize/Def_use_web.h"
-#include "optimize/If_simplification.h"
-#include "optimize/Inlining.h"
-#include "optimize/Mark_initialized.h"
-#include "optimize/Misc_annotations.h"
-#include "optimize/Prune_symbol_table.h"
-#include "optimize/Remove_loop_booleans.h"
+#include "generated/cmdline.h"
+#include "lib/Alloc_profile.h"
+#include "lib/Arena.h"
+#include "parsing/Bin_parser.h"
 #include "parsing/parse.h"
+#include "parsing/Parse_cache.h"
 #include "parsing/XML_parser.h"
-#include "pass_manager/Fake_pass.h"
+#include "pass_manager/Pass.h"
 #include "pass_manager/Pass_manager.h"
-#include "process_ast/Constant_folding.h"
-#include "process_ast/DOT_unparser.h"
-#include "process_ast/Invalid_check.h"
-#include "process_ast/Note_top_level_declarations.h"
-#include "process_ast/Pretty_print.h"
-#include "process_ast/Process_includes.h"
-#include "process_ast/Remove_concat_null.h"
-#include "process_ast/Strip_unparser_attributes.h"
-#include "process_ir/XML_unparser.h"
-#include "process_mir/Obfuscate.h"
+#include "pass_manager/Pass_timer.h"
+#include "pass_manager/Standard_passes.h"
+#include "process_ir/fresh.h"
+#include "process_ir/PHP_unparser.h"
+#include "process_ir/stats.h"
 
 using namespace std;
 
@@ -68,6 +37,26 @@ extern struct gengetopt_args_info error_args_info;
 struct gengetopt_args_info args_info;
 Pass_manager* pm;
 
+// For --stream: run the passes on each part of the script as it is parsed
+class Run_passes_on_part : public Stream_handler
+{
+	void handle (AST::PHP_script* part, bool last)
+	{
+		IR::PHP_script* ir = part;
+
+		// Avoid overwriting source variables.
+		ir->visit (
+			new Read_fresh_suffix_counter, 
+			new Read_fresh_suffix_counter, 
+			new Read_fresh_suffix_counter);
+
+		pm->stream_state->continued = !last;
+		pm->run (ir, true);
+	}
+};
+
+void check_stream_options ();
+
 void sighandler(int signum)
 {
 	switch(signum)
@@ -138,80 +127,9 @@ int main(int argc, char** argv)
 
 	pm = new Pass_manager (&args_info);
 
-	// process_ast passes
-	pm->add_ast_pass (new Invalid_check ());
-	pm->add_ast_pass (new Fake_pass (s("ast"), s("Abstract Syntax Tree - a representation of the PHP program, as written")));
-	pm->add_ast_pass (new Process_includes (false, s("incl1"), pm, s("incl1")));
-	pm->add_ast_pass (new Pretty_print ());
-
-	// Begin lowering to hir
-	pm->add_ast_visitor (new Strip_comments (), s("decomment"), s("Remove comments"));
-	pm->add_ast_visitor (new Strip_unparser_attributes (), s("sua"), s("Remove the attributes used to pretty-print source code"));
-	pm->add_ast_visitor (new Note_top_level_declarations (), s("ntld"), s("Make a note of top-level-declarations before the information is lost"));
-
-	// Small optimization on the AST
-	pm->add_ast_transform (new Constant_folding(), s("const-fold"), s("Fold constant expressions"));
-	pm->add_ast_transform (new Remove_concat_null (), s("rcn"), s("Remove concatenations with \"\"")); // TODO: this is wrong - it really should be converted to a cast to string.
-
-
-
-	// Make simple statements simpler
-	pm->add_ast_transform (new Desugar (), s("desug"), s("Canonicalize simple constructs"));
-	pm->add_ast_transform (new Split_multiple_arguments (), s("sma"), s("Split multiple arguments for globals, attributes and static declarations"));
-	pm->add_ast_transform (new Split_unset_isset (), s("sui"), s("Split unset() and isset() into multiple calls with one argument each"));
-	pm->add_ast_transform (new Echo_split (), s("ecs"), s("Split echo() into multiple calls with one argument each"));
-
-	pm->add_ast_transform (new Early_lower_control_flow (), s("elcf"), s("Early Lower Control Flow - lower for, while, do and switch statements")); // AST
-	pm->add_ast_transform (new Lower_expr_flow (), s("lef"), s("Lower Expression Flow - Lower ||, && and ?: expressions"));
-	pm->add_ast_transform (new List_shredder (), s("lish"), s("List shredder - simplify to array assignments"));
-	pm->add_ast_transform (new Shredder (), s("ashred"), s("Shredder - turn the AST into three-address-code, replacing complex expressions with a temporary variable"));
-	pm->add_ast_transform (new Pre_post_op_shredder (), s("pps"), s("Shred pre- and post-ops, removing post-ops"));
-	pm->add_ast_transform (new Switch_bin_op (), s("swbin"), s("Switch '>=' and '>' bin-ops"));
-	pm->add_ast_transform (new Remove_solo_exprs (), s("rse"), s("Remove expressions which are not stored"));
-	pm->add_ast_pass (new Fake_pass (s("AST-to-HIR"), s("The HIR in AST form")));
-
-
-	pm->add_hir_pass (new Fake_pass (s("hir"), s("High-level Internal Representation - the smallest subset of PHP which can represent the entire language")));
-	pm->add_hir_transform (new Copy_propagation (), s("prc"), s("Propagate copies - Remove some copies introduced as a result of lowering"));
-	pm->add_hir_transform (new Dead_temp_cleanup (), s("dtc"), s("Dead temp cleanup")); // TODO: Description?
-	pm->add_hir_transform (new Lower_dynamic_definitions (), s("ldd"), s("Lower Dynamic Definitions - Lower dynamic class, interface and method definitions using aliases"));
-	pm->add_hir_transform (new Lower_method_invocations (), s("lmi"), s("Lower Method Invocations - Lower parameters using run-time reference checks"));
-	pm->add_hir_transform (new Lower_control_flow (), s("lcf"), s("Lower Control Flow - Use gotos in place of loops, ifs, breaks and continues"));
-	pm->add_hir_pass (new Fake_pass (s("HIR-to-MIR"), s("The MIR in HIR form")));
-
-
-	pm->add_mir_pass (new Fake_pass (s("mir"), s("Medium-level Internal Representation - simple code with high-level constructs lowered to straight-line code")));
-	pm->add_mir_pass (new Obfuscate ());
-//	pm->add_mir_pass (new Process_includes (true, new String ("mir"), pm, "incl2"));
-	pm->add_mir_transform (new Lift_functions_and_classes (), s("lfc"), s("Move statements from global scope into __MAIN__ method"));
-	pm->add_mir_visitor (new Clarify (), s("clar"), s("Clarify - Make implicit definitions explicit"));
-	// TODO: move this into optimization passes
-	pm->add_mir_visitor (new Prune_symbol_table (), s("pst"), s("Prune Symbol Table - Note whether a symbol table is required in generated code"));
-
-
-	// Optimization passes
-	pm->add_local_optimization_pass (new Fake_pass (s("wpa"), s("Whole-program analysis")));
-	pm->add_local_optimization_pass (new Fake_pass (s("cfg"), s("Initial Control-Flow Graph")));
-	pm->add_local_optimization_pass (new Fake_pass (s("build-ssa-ssi"), s("Create SSA/SSI form")));
-	pm->add_local_optimization (new If_simplification (), s("ifsimple"), s("If-simplification"), true);
-	pm->add_local_optimization (new DCE (), s("dce"), s("Aggressive Dead-code elimination"), true);
-	pm->add_local_optimization_pass (new Fake_pass (s("drop-ssa-ssi"), s("Drop SSA/SSI form")));
-	pm->add_local_optimization (new Remove_loop_booleans (), s("rlb"), s("Remove loop-booleans"), false);
-
-	pm->add_ipa_optimization (new Inlining (), s("inlining"), s("Method inlining"), false);
-
-	// TODO: we could consider this for resolving isset/empty/unset queries
-	// TODO: I think these should mostly move to WPA
-//	pm->add_optimization (new Mark_initialized (), s("mvi"), s("Mark variable initialization status"), false);
-//	pm->add_optimization (new Misc_annotations (), s("mao"), s("Miscellaneous annotations for optimization"), false);
-
-
-	// codegen passes
+	// The C code is passed from generate-c to compile-c
 	stringstream ss;
-	pm->add_codegen_pass (new Fake_pass(s("codegen"), s("Last pass before codegen generation begins")));
-	pm->add_codegen_visitor (new Generate_C_annotations, s("cgann"), s("Make annotations for code generation"));
-	pm->add_codegen_pass (new Generate_C_pass (ss));
-	pm->add_codegen_pass (new Compile_C (ss));
+	add_standard_passes (pm, ss);
 
 
 	// Plugins add their passes to the pass manager
@@ -227,6 +145,7 @@ int main(int argc, char** argv)
 	// check_passes (stats);
 	check_passes (dump);
 	check_passes (dump_xml);
+	check_passes (dump_bin);
 	check_passes (dump_dot);
 //	check_passes (debug); // we're a bit fast and loose in optimizing
 	check_passes (disable);
@@ -236,6 +155,10 @@ int main(int argc, char** argv)
 		&& !pm->has_pass_named (new String (const_cast<const char*>(args_info.read_xml_arg))))
 		phc_error ("Pass %s, specified with flag --read-xml, is not valid", args_info.read_xml_arg);	\
 
+	if (args_info.read_bin_given
+		&& !pm->has_pass_named (new String (const_cast<const char*>(args_info.read_bin_arg))))
+		phc_error ("Pass %s, specified with flag --read-bin, is not valid", args_info.read_bin_arg);
+
 #undef check_passes
 
 	// Disable passes if asked
@@ -248,6 +171,19 @@ int main(int argc, char** argv)
 	if (args_info.execute_flag)
 		args_info.compile_flag = true;
 
+	if (args_info.stream_flag)
+		check_stream_options ();
+
+	Arena::debug = args_info.debug_arenas_flag;
+
+	if (args_info.alloc_profile_flag)
+		Alloc_profile::enable ();
+
+	// The timer also marks the passes for the allocation profile
+	if (args_info.time_passes_flag || args_info.time_passes_json_given
+		|| args_info.alloc_profile_flag)
+		pm->timer = new Pass_timer;
+
 	if (args_info.web_app_given)
 		phc_error ("Not directly implemented: please instead follow instructions in the \"Compiling web applications\" section of the user manual.");
 
@@ -307,13 +243,46 @@ int main(int argc, char** argv)
 				pm->run_from (pass_name, ir, true);
 			#endif
 		}
+		else if (args_info.read_bin_given)
+		{
+			String* pass_name = new String (args_info.read_bin_arg);
+			pm->maybe_enable_debug (pass_name);
+
+			ir = Bin_parser ().parse_bin_file (filename);
+			if (ir == NULL)
+				phc_error ("File not found", filename, 0, 0);
+
+			ir->visit (
+				new Read_fresh_suffix_counter, 
+				new Read_fresh_suffix_counter, 
+				new Read_fresh_suffix_counter);
+
+			pm->run_from (pass_name, ir, true);
+		}
 		else if (args_info.dump_parse_tree_flag)
 		{
 			dump_parse_tree (filename, NULL);
 		}
+		else if (args_info.stream_flag)
+		{
+			pm->stream_state = new Unparser_state (cout, false);
+
+			if (!parse_stream (filename, NULL, new Run_passes_on_part))
+			{
+				if (args_info.inputs_num != 0)
+					phc_error("File not found", filename, 0, 0);
+				else
+					return -1;
+			}
+		}
 		else
 		{
-			ir = parse (filename, NULL);
+			Pass_timer_scope timing (pm->timer, "ast", "parse");
+			if (args_info.parse_cache_given)
+				ir = parse_cached (filename);
+			else
+				ir = parse (filename, NULL);
+			timing.stop (ir);
 
 			// print error
 			if (ir == NULL)
@@ -337,6 +306,21 @@ int main(int argc, char** argv)
 		pm->post_process ();
 	}
 
+	if (args_info.time_passes_flag)
+		pm->timer->print_table (cerr);
+
+	if (args_info.time_passes_json_given)
+	{
+		ofstream json (args_info.time_passes_json_arg);
+		if (!json)
+			phc_error ("Cannot open %s for writing", args_info.time_passes_json_arg);
+
+		pm->timer->print_json (json);
+	}
+
+	if (args_info.alloc_profile_flag)
+		Alloc_profile::print (cerr);
+
 
 	if (pm->args_info->stats_given)
 	{
@@ -359,6 +343,37 @@ int main(int argc, char** argv)
 	return 0;
 }
 
+/*
+ * Each part of the script is processed and printed before the next is
+ * parsed, so only passes which work on one top-level statement at a time can
+ * be run, and the script can only be printed once.
+ */
+void check_stream_options ()
+{
+	if (args_info.compile_flag || args_info.generate_c_flag)
+		phc_error ("--stream cannot be used when compiling");
+
+	if (args_info.optimize_arg != string ("0"))
+		phc_error ("--stream cannot be used with -O");
+
+	if (args_info.read_xml_given || args_info.dump_xml_given || args_info.dump_dot_given
+		|| args_info.read_bin_given || args_info.dump_bin_given)
+		phc_error ("--stream can only be used with PHP input and output");
+
+	if (args_info.pretty_print_flag + args_info.obfuscate_flag + args_info.dump_given > 1)
+		phc_error ("--stream can only print the script once");
+
+	// Lifting the statements into __MAIN__, and everything after, needs the
+	// whole script.
+	pm->remove_after_named_pass (s("obfuscate"));
+
+	for (unsigned int i = 0; i < args_info.dump_given; i++)
+	{
+		if (!pm->has_pass_named (s(args_info.dump_arg [i])))
+			phc_error ("Pass %s, specified with flag --dump, cannot be used with --stream", args_info.dump_arg [i]);
+	}
+}
+
 void print_stats ()
 {
 	if (args_info.stats_flag)
@@ -142,7 +142,8 @@ void AST_unparser::children_php_script(PHP_script* in)
 
 	// However, to avoid not outputting a closing tag, we do call 
 	// output_end_tag. If one was output already, nothing will happen
-	output_end_tag();
+	if(!ups->continued)
+		output_end_tag();
 }
 
 void AST_unparser::children_interface_def(Interface_def* in)
@@ -9,6 +9,9 @@
  */
 #include "Invalid_check.h"
 #include "process_ir/General.h"
+#include "AST.h"
+#include "HIR.h"
+#include "MIR.h"
 
 using namespace AST;
 
@@ -22,6 +25,19 @@ void check (IR::PHP_script* in, bool use_ice)
 	}
 }
 
+void check (IR::Node* in, bool use_ice)
+{
+	if (isa<AST::Node> (in))
+	{
+		dyc<AST::Node> (in)->assert_valid ();
+		dyc<AST::Node> (in)->visit (new Invalid_check (use_ice));
+	}
+	else if (isa<HIR::Node> (in))
+		dyc<HIR::Node> (in)->assert_valid ();
+	else
+		dyc<MIR::Node> (in)->assert_valid ();
+}
+
 bool is_ref_literal (Expr* in)
 {
 	return (	dynamic_cast <Literal*> (in) 
@@ -43,6 +59,8 @@ Invalid_check::Invalid_check (bool use_ice)
 void Invalid_check::run (IR::PHP_script* in, Pass_manager* pm)
 {
 	in->visit(this);
+	pm->changed_nothing ();
+
 	// Indicate that after this pass, ICEs should be used.
 	pm->check = true;
 }
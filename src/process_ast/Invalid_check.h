@@ -20,6 +20,8 @@ namespace HIR { class Expr; }
 bool is_ref_literal (AST::Expr* in);
 bool is_ref_literal (HIR::Expr* in); // todo avoid duplication
 void check (IR::PHP_script* in, bool use_ice);
+// Check a subtree of the IR (of any kind)
+void check (IR::Node* in, bool use_ice);
 
 class Invalid_check : public AST::Visitor, public Pass
 {
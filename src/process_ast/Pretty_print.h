@@ -24,8 +24,16 @@ public:
 
 	void run (IR::PHP_script* in, Pass_manager* pm)
 	{
-		AST_unparser().unparse (in->as_AST ());
-		set_enabled (false);
+		AST_unparser (pm->get_unparser_state ()).unparse (in->as_AST ());
+		pm->changed_nothing ();
+	}
+
+	// Only print the program, not snippets of code run through the passes.
+	// Each part of the script is the program when streaming.
+	void run_pass (IR::PHP_script* in, Pass_manager* pm, bool main)
+	{
+		if (main)
+			Pass::run_pass (in, pm, main);
 	}
 
 	bool pass_is_enabled (Pass_manager* pm)
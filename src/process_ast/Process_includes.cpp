@@ -7,6 +7,7 @@
  */
 
 #include <libgen.h> // for dirname
+#include <unistd.h> // for sysconf
 #include <iostream>
 #include <fstream>
 #include <boost/regex.hpp> // for regular expression.
@@ -18,6 +19,7 @@
 #include "process_ir/General.h"
 #include "process_ir/fresh.h"
 #include "parsing/parse.h"
+#include "parsing/Parse_cache.h"
 
 using namespace AST;
 
@@ -459,7 +461,7 @@ Process_includes::pre_eval_expr(Eval_expr* in, Statement_list* out)
 	PHP::add_include (full_path);
 
 
-	PHP_script* new_file = parse (full_path, new String_list);
+	PHP_script* new_file = parse_included (full_path);
 	assert (new_file); // will have been checked in full_path
 
 
@@ -491,4 +493,123 @@ Process_includes::pre_eval_expr(Eval_expr* in, Statement_list* out)
 
 	// copy the statements
 	out->push_back_all (new_file->statements);
+	foreach (Statement* statement, *new_file->statements)
+		pm->changed_subtree (statement);
+}
+
+/*
+ * Find the files which IN includes with literal filenames (as pre_eval_expr
+ * would find them), which have not been found before.
+ */
+class Find_includes : public Visitor, virtual public GC_obj
+{
+public:
+	Set<string>* found;
+	String_list* result;
+
+	Find_includes (Set<string>* found)
+	: found (found)
+	, result (new String_list)
+	{
+	}
+
+	void pre_eval_expr (Eval_expr* in)
+	{
+		bool include_once = false;
+		Actual_parameter* param = matching_param (in, NULL, &include_once);
+		if (param == NULL)
+			return;
+
+		STRING* filename = dynamic_cast<STRING*> (param->expr);
+		if (filename == NULL)
+			return;
+
+		String* full_path = search_file (filename->value,
+			get_search_directories (filename->value, in));
+
+		if (full_path == NULL || found->has (*full_path))
+			return;
+
+		found->insert (*full_path);
+		result->push_back (full_path);
+	}
+};
+
+/*
+ * Parse the included files up front, several at a time, rather than one after
+ * another as the includes are processed. The files which IN includes are
+ * parsed together, then the files which they include, and so on, until
+ * nothing new is found. The statements are still spliced in by
+ * pre_eval_expr, in the usual order; it just finds them already parsed.
+ */
+void
+Process_includes::prefetch_includes (PHP_script* in)
+{
+	if (not pm->args_info->include_given)
+		return;
+
+	int jobs = pm->args_info->include_jobs_arg;
+	if (jobs == 0)
+		jobs = sysconf (_SC_NPROCESSORS_ONLN);
+
+	// With one job, it is quicker to parse as we go.
+	if (jobs <= 1)
+		return;
+
+	Find_includes* find = new Find_includes (&found);
+	in->visit (find);
+
+	while (not find->result->empty ())
+	{
+		String_list* wave = find->result;
+		find = new Find_includes (&found);
+
+		// Files in the parse cache need not be parsed again.
+		String_list* to_parse = new String_list;
+		foreach (String* full_path, *wave)
+		{
+			PHP_script* php_script = parse_cache_find (full_path);
+			if (php_script == NULL)
+			{
+				to_parse->push_back (full_path);
+				continue;
+			}
+
+			Parse_result* result = new Parse_result;
+			result->php_script = php_script;
+			result->messages = new String;
+			prefetched[*full_path] = result;
+			php_script->visit (find);
+		}
+
+		Map<string, Parse_result*>* results = parse_all (to_parse, jobs);
+		foreach (String* full_path, *to_parse)
+		{
+			if (not results->has (*full_path))
+				continue;
+
+			Parse_result* result = (*results)[*full_path];
+			parse_cache_add (full_path, result->php_script);
+			prefetched[*full_path] = result;
+			result->php_script->visit (find);
+		}
+	}
+}
+
+/*
+ * Use the script from prefetch_includes, or else parse the included file (or
+ * take it from the parse cache). A file can be included more than once, so
+ * only the first include uses the prefetched script.
+ */
+PHP_script*
+Process_includes::parse_included (String* full_path)
+{
+	if (not prefetched.has (*full_path))
+		return parse_cached (full_path);
+
+	Parse_result* result = prefetched[*full_path];
+	prefetched.erase (*full_path);
+
+	fputs (result->messages->c_str (), stderr);
+	return result->php_script;
 }
@@ -9,7 +9,11 @@
 #define PHC_PROCESS_INCLUDES
 
 #include "ast_to_hir/AST_lower_expr.h"
+#include "lib/Map.h"
+#include "lib/Set.h"
+#include "parsing/parse.h"
 #include "pass_manager/Pass.h"
+#include "pass_manager/Pass_manager.h"
 
 class Process_includes : public AST::Lower_expr, public Pass
 {
@@ -28,6 +32,9 @@ public:
 	Pass_manager* pm;
 	void run (IR::PHP_script* in, Pass_manager* pm)
 	{
+		// Only the included statements are new
+		pm->changed_nothing ();
+		prefetch_includes (dyc<AST::PHP_script> (in));
 		in->transform_children(this);
 	}
 
@@ -37,6 +44,16 @@ public:
 	void pre_method(AST::Method* in, AST::Member_list* out);
 	void pre_eval_expr(AST::Eval_expr* in, AST::Statement_list* out);
 
+	// Parallel parsing (see --include-jobs)
+private:
+	// Included files which have been parsed ahead of time, by full path.
+	Map<std::string, Parse_result*> prefetched;
+
+	// Files which have already been found by prefetch_includes.
+	Set<std::string> found;
+
+	void prefetch_includes (AST::PHP_script* in);
+	AST::PHP_script* parse_included (String* full_path);
 };
 
 #endif // PHC_PROCESS_INCLUDES
@@ -0,0 +1,457 @@
+/*
+ * phc -- the open source PHP compiler
+ * See doc/license/README.license for licensing information
+ *
+ * Convert the phc AST, HIR or MIR to a compact binary format
+ */
+
+#include <cstring>
+#include <ostream>
+#include <typeinfo>
+
+#include "lib/AttrMap.h"
+#include "lib/Boolean.h"
+#include "lib/demangle.h"
+#include "lib/error.h"
+#include "lib/Integer.h"
+#include "lib/List.h"
+#include "lib/String.h"
+
+#include "Bin_unparser.h"
+
+using namespace std;
+
+template
+<
+	class Node,
+	class Visitor,
+	class Identifier,
+	class Literal,
+	class INT,
+	class BOOL,
+	class NIL,
+	class FOREIGN
+>
+class Bin_unparser : public Visitor, virtual public GC_obj
+{
+protected:
+	Bin_unparser_state* state;
+
+public:
+	Bin_unparser (Bin_unparser_state* state)
+	: state (state)
+	{
+	}
+
+	void visit_marker (char const* name, bool value)
+	{
+		state->write_varint (value ? BIN_TRUE : BIN_FALSE);
+	}
+
+	void visit_null (char const* name_space, char const* type_id)
+	{
+		state->write_varint (BIN_NULL);
+	}
+
+	void visit_null_list (char const* name_space, char const* type_id)
+	{
+		state->write_varint (BIN_NULL);
+	}
+
+	void pre_list (char const* name_space, char const* type_id, int size)
+	{
+		state->write_list_type (name_space, type_id);
+	}
+
+	void post_list (char const* name_space, char const* type_id, int size)
+	{
+		state->write_varint (BIN_END);
+	}
+
+	void pre_node (Node* in)
+	{
+		state->write_node_type (in);
+		state->write_attrs (in->attrs);
+	}
+
+	void post_node (Node* in)
+	{
+		state->write_varint (BIN_END);
+	}
+
+	void pre_identifier (Identifier* in)
+	{
+		state->write_varint (BIN_STRING);
+		state->write_string (*in->get_value_as_string ());
+	}
+
+	void pre_literal (Literal* in)
+	{
+		if (INT* i = dynamic_cast<INT*> (in))
+		{
+			state->write_varint (BIN_INTEGER);
+			state->write_signed (i->value);
+		}
+		else if (BOOL* b = dynamic_cast<BOOL*> (in))
+			state->write_varint (b->value ? BIN_TRUE : BIN_FALSE);
+		else if (!isa<NIL> (in))
+		{
+			// REALs are written as strings, as in the XML, with enough digits
+			// to be read back exactly.
+			state->write_varint (BIN_STRING);
+			state->write_string (*in->get_value_as_string ());
+		}
+	}
+
+	// Foreign nodes are written by the unparser for their own IR.
+	void pre_foreign (FOREIGN* in)
+	{
+		bin_unparse (in->value, state);
+	}
+};
+
+#include "AST_visitor.h"
+class AST_bin_unparser : public Bin_unparser
+<
+	AST::Node,
+	AST::Visitor,
+	AST::Identifier,
+	AST::Literal,
+	AST::INT,
+	AST::BOOL,
+	AST::NIL,
+	AST::FOREIGN
+>
+{
+	typedef Bin_unparser <	AST::Node, AST::Visitor, AST::Identifier,
+									AST::Literal, AST::INT, AST::BOOL,
+									AST::NIL, AST::FOREIGN> parent;
+public:
+	AST_bin_unparser (Bin_unparser_state* state)
+	: parent (state)
+	{
+	}
+};
+
+#include "HIR_visitor.h"
+class HIR_bin_unparser : public Bin_unparser
+<
+	HIR::Node,
+	HIR::Visitor,
+	HIR::Identifier,
+	HIR::Literal,
+	HIR::INT,
+	HIR::BOOL,
+	HIR::NIL,
+	HIR::FOREIGN
+>
+{
+	typedef Bin_unparser <	HIR::Node, HIR::Visitor, HIR::Identifier,
+									HIR::Literal, HIR::INT, HIR::BOOL,
+									HIR::NIL, HIR::FOREIGN> parent;
+public:
+	HIR_bin_unparser (Bin_unparser_state* state)
+	: parent (state)
+	{
+	}
+};
+
+#include "MIR_visitor.h"
+class MIR_bin_unparser : public Bin_unparser
+<
+	MIR::Node,
+	MIR::Visitor,
+	MIR::Identifier,
+	MIR::Literal,
+	MIR::INT,
+	MIR::BOOL,
+	MIR::NIL,
+	MIR::FOREIGN
+>
+{
+	typedef Bin_unparser <	MIR::Node, MIR::Visitor, MIR::Identifier,
+									MIR::Literal, MIR::INT, MIR::BOOL,
+									MIR::NIL, MIR::FOREIGN> parent;
+public:
+	MIR_bin_unparser (Bin_unparser_state* state)
+	: parent (state)
+	{
+	}
+
+	void pre_param_index (MIR::PARAM_INDEX* in)
+	{
+		state->write_varint (BIN_INTEGER);
+		state->write_signed (in->value);
+	}
+};
+
+
+// MICG has no literals or foreign nodes, so it doesn't fit the template.
+#include "MICG_visitor.h"
+class MICG_bin_unparser : public MICG::Visitor, virtual public GC_obj
+{
+protected:
+	Bin_unparser_state* state;
+
+public:
+	MICG_bin_unparser (Bin_unparser_state* state)
+	: state (state)
+	{
+	}
+
+	void visit_marker (char const* name, bool value)
+	{
+		state->write_varint (value ? BIN_TRUE : BIN_FALSE);
+	}
+
+	void visit_null (char const* name_space, char const* type_id)
+	{
+		state->write_varint (BIN_NULL);
+	}
+
+	void visit_null_list (char const* name_space, char const* type_id)
+	{
+		state->write_varint (BIN_NULL);
+	}
+
+	void pre_list (char const* name_space, char const* type_id, int size)
+	{
+		state->write_list_type (name_space, type_id);
+	}
+
+	void post_list (char const* name_space, char const* type_id, int size)
+	{
+		state->write_varint (BIN_END);
+	}
+
+	void pre_node (MICG::Node* in)
+	{
+		state->write_node_type (in);
+		state->write_attrs (in->attrs);
+	}
+
+	void post_node (MICG::Node* in)
+	{
+		state->write_varint (BIN_END);
+	}
+
+	void pre_identifier (MICG::Identifier* in)
+	{
+		state->write_varint (BIN_STRING);
+		state->write_string (*in->get_value_as_string ());
+	}
+};
+
+
+
+Bin_unparser_state::Bin_unparser_state ()
+{
+	// Nodes without attributes use the first set.
+	attr_sets.push_back (string (1, '\0'));
+	attr_set_indices[attr_sets.back ()] = 0;
+}
+
+static void
+append_varint (string& out, unsigned long value)
+{
+	while (value >= 0x80)
+	{
+		out += (char) (value | 0x80);
+		value >>= 7;
+	}
+	out += (char) value;
+}
+
+void
+Bin_unparser_state::write_varint (unsigned long value)
+{
+	append_varint (body, value);
+}
+
+void
+Bin_unparser_state::write_signed (long value)
+{
+	// Zigzag encoding keeps small negative numbers small.
+	write_varint (((unsigned long) value << 1) ^ (unsigned long) (value >> (sizeof (long) * 8 - 1)));
+}
+
+unsigned long
+Bin_unparser_state::string_index (const string& value)
+{
+	if (!string_indices.has (value))
+	{
+		string_indices[value] = strings.size ();
+		strings.push_back (value);
+	}
+
+	return string_indices[value];
+}
+
+void
+Bin_unparser_state::write_string (const string& value)
+{
+	write_varint (string_index (value));
+}
+
+void
+Bin_unparser_state::write_node_type (IR::Node* in)
+{
+	// Demangling is slow, so only do it once per type.
+	const char* key = typeid (*in).name ();
+	if (!node_tags.has (key))
+		node_tags[key] = BIN_FIRST_TYPE + string_index (demangle (in, true));
+
+	write_varint (node_tags[key]);
+}
+
+void
+Bin_unparser_state::write_list_type (char const* name_space, char const* type_id)
+{
+	write_varint (BIN_FIRST_TYPE + string_index (string (name_space) + "::" + type_id + "_list"));
+}
+
+bool
+Bin_unparser_state::is_writable (string key, Object* value)
+{
+	if (value == NULL)
+		return false;
+
+	if (isa<String> (value)
+		|| isa<Integer> (value)
+		|| isa<Boolean> (value)
+		|| isa<IR::Node> (value)
+		|| isa<List<String*> > (value)
+		|| isa<IR::Node_list> (value))
+		return true;
+
+	phc_warning ("Don't know how to deal with attribute '%s' of type '%s'", key.c_str (), demangle (value, true));
+	return false;
+}
+
+void
+Bin_unparser_state::write_attrs (AttrMap* attrs)
+{
+	if (attrs->size () == 0)
+	{
+		write_varint (0);
+		return;
+	}
+
+	// Find the set of keys, in the same format as the table.
+	List<Object*> values;
+	string keys;
+
+	AttrMap::const_iterator i;
+	for (i = attrs->begin (); i != attrs->end (); i++)
+	{
+		if (!is_writable ((*i).first, (*i).second))
+			continue;
+
+		append_varint (keys, string_index ((*i).first));
+		values.push_back ((*i).second);
+	}
+
+	string count;
+	append_varint (count, values.size ());
+	keys.insert (0, count);
+
+	if (!attr_set_indices.has (keys))
+	{
+		attr_set_indices[keys] = attr_sets.size ();
+		attr_sets.push_back (keys);
+	}
+
+	write_varint (attr_set_indices[keys]);
+
+	foreach (Object* value, values)
+		write_object (value);
+}
+
+void
+Bin_unparser_state::write_object (Object* value)
+{
+	if (value == NULL)
+	{
+		write_varint (BIN_NULL);
+	}
+	else if (String* str = dynamic_cast<String*> (value))
+	{
+		write_varint (BIN_STRING);
+		write_string (*str);
+	}
+	else if (Integer* i = dynamic_cast<Integer*> (value))
+	{
+		write_varint (BIN_INTEGER);
+		write_signed (i->value ());
+	}
+	else if (Boolean* b = dynamic_cast<Boolean*> (value))
+	{
+		write_varint (b->value () ? BIN_TRUE : BIN_FALSE);
+	}
+	else if (IR::Node* node = dynamic_cast<IR::Node*> (value))
+	{
+		bin_unparse (node, this);
+	}
+	else if (List<String*>* ls = dynamic_cast<List<String*>*> (value))
+	{
+		write_varint (BIN_STRING_LIST);
+		write_varint (ls->size ());
+		foreach (String* s, *ls)
+			write_string (*s);
+	}
+	else if (IR::Node_list* ls = dynamic_cast<IR::Node_list*> (value))
+	{
+		write_varint (BIN_NODE_LIST);
+		write_varint (ls->size ());
+		foreach (IR::Node* node, *ls)
+			write_object (node);
+	}
+	else
+		phc_unreachable ();
+}
+
+void
+Bin_unparser_state::finish (ostream& os)
+{
+	string script;
+	script.swap (body);
+
+	body.assign (BIN_MAGIC, BIN_MAGIC_LENGTH);
+
+	write_varint (BIN_VERSION);
+
+	write_varint (strings.size ());
+	foreach (string& str, strings)
+	{
+		write_varint (str.size ());
+		body += str;
+	}
+
+	write_varint (attr_sets.size ());
+	foreach (string& keys, attr_sets)
+		body += keys;
+
+	os << body << script;
+	body.clear ();
+}
+
+void
+bin_unparse (IR::Node* in, Bin_unparser_state* state)
+{
+	if (isa<AST::Node> (in))
+		dyc<AST::Node> (in)->visit (new AST_bin_unparser (state));
+	else if (isa<HIR::Node> (in))
+		dyc<HIR::Node> (in)->visit (new HIR_bin_unparser (state));
+	else if (isa<MIR::Node> (in))
+		dyc<MIR::Node> (in)->visit (new MIR_bin_unparser (state));
+	else
+		dyc<MICG::Node> (in)->visit (new MICG_bin_unparser (state));
+}
+
+void
+bin_unparse (IR::PHP_script* in, ostream& os)
+{
+	Bin_unparser_state* state = new Bin_unparser_state;
+	bin_unparse (dyc<IR::Node> (in), state);
+	state->finish (os);
+}
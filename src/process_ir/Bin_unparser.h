@@ -0,0 +1,113 @@
+/*
+ * phc -- the open source PHP compiler
+ * See doc/license/README.license for licensing information
+ *
+ * Convert the phc AST, HIR or MIR to a compact binary format
+ *
+ * The binary format holds the same information as the XML (the nodes, the
+ * values of tokens, and the nodes' attributes), but is a fraction of the size
+ * and much quicker to read back (see parsing/Bin_parser.h). It is used to pass
+ * the IR between runs of phc, with --dump-bin and --read-bin. The code
+ * generator's macros (MICG) are also stored in it, when phc is built.
+ *
+ * Numbers are unsigned LEB128 varints; signed numbers are zigzag encoded
+ * first. A file is:
+ *
+ *		magic			"phc\0"
+ *		version		BIN_VERSION
+ *		strings		a count, then the length and bytes of each string
+ *		attr sets	a count, then for each set, a count and the keys' strings
+ *		script		an object
+ *
+ * Every string (type names, attribute keys and values, and tokens' values)
+ * is stored once, and referred to by its index. Each object starts with a
+ * tag:
+ *
+ *		BIN_END					ends a node or a list
+ *		BIN_NULL					a NULL node or list
+ *		BIN_FALSE				a false marker or Boolean
+ *		BIN_TRUE					a true marker or Boolean
+ *		BIN_INTEGER				an Integer, or the value of an INT or PARAM_INDEX
+ *		BIN_STRING				a String, or the value of another token
+ *		BIN_STRING_LIST		a String_list: a count, then the strings
+ *		BIN_NODE_LIST			an IR::Node_list: a count, then the nodes
+ *		BIN_FIRST_TYPE + t	a node or list, whose type's name is string t
+ *
+ * A node's tag is followed by the index of its set of attribute keys, the
+ * values of its attributes in that order, its children (or its value, for a
+ * token), and BIN_END. A list's tag is followed by its elements and BIN_END.
+ * Type names include the namespace (eg "AST::If" or "MIR::Statement_list").
+ *
+ * To write anything other than a script, use a Bin_unparser_state directly:
+ * bin_unparse the node into it, then finish it.
+ */
+
+#ifndef PHC_BIN_UNPARSER
+#define PHC_BIN_UNPARSER
+
+#include <iostream>
+#include <string>
+
+#include "lib/Map.h"
+#include "lib/Vector.h"
+#include "process_ir/IR.h"
+
+class AttrMap;
+
+#define BIN_MAGIC "phc"
+#define BIN_MAGIC_LENGTH 4
+#define BIN_VERSION 1
+
+enum Bin_tag
+{
+	BIN_END,
+	BIN_NULL,
+	BIN_FALSE,
+	BIN_TRUE,
+	BIN_INTEGER,
+	BIN_STRING,
+	BIN_STRING_LIST,
+	BIN_NODE_LIST,
+	BIN_FIRST_TYPE
+};
+
+class Bin_unparser_state : public virtual GC_obj
+{
+public:
+	Bin_unparser_state ();
+
+	void write_varint (unsigned long value);
+	void write_signed (long value);
+	void write_string (const std::string& value);
+	void write_node_type (IR::Node* in);
+	void write_list_type (char const* name_space, char const* type_id);
+	void write_attrs (AttrMap* attrs);
+	void write_object (Object* value);
+
+	// Write the tables, followed by the script, to OS.
+	void finish (std::ostream& os);
+
+private:
+	// The script is built up in BODY, since the tables, which come first,
+	// aren't complete until it has all been written.
+	std::string body;
+
+	Map<std::string, unsigned long> string_indices;
+	Vector<std::string> strings;
+
+	// Node types, by the (unique) name of their type_info
+	Map<const char*, unsigned long> node_tags;
+
+	// Sets of attribute keys, as they are written in the table (the number of
+	// keys, and their indices)
+	Map<std::string, unsigned long> attr_set_indices;
+	Vector<std::string> attr_sets;
+
+	unsigned long string_index (const std::string& value);
+	bool is_writable (std::string key, Object* value);
+};
+
+void bin_unparse (IR::Node* in, Bin_unparser_state* state);
+void bin_unparse (IR::PHP_script* in, std::ostream& os = std::cout);
+
+#endif // PHC_BIN_UNPARSER
@@ -14,9 +14,9 @@ using namespace IR;
 int
 Node::get_line_number ()
 {
-	Integer* i = dynamic_cast<Integer*>(attrs->get("phc.line_number"));
-	if(i != NULL)
-		return i->value();
+	int line_number = attrs->get_line_number ();
+	if (line_number != -1)
+		return line_number;
 	else
 		return 0;
 }
@@ -34,7 +34,7 @@ Node::get_column_number ()
 String*
 Node::get_filename()
 {
-	String* result = dynamic_cast<String*>(attrs->get("phc.filename"));
+	String* result = attrs->get_filename ();
 	if (result == NULL)
 		result = new String ("<unknown>");
 
@@ -42,6 +42,7 @@ Node::get_filename()
 }
 
 Node::Node()
+: reference_count (1)
 {
 	attrs = new AttrMap;
 }
@@ -49,18 +50,20 @@ Node::Node()
 void
 Node::copy_location (Node* source)
 {
-	String* filename = dynamic_cast<String*>(attrs->get("phc.filename"));
-	if (filename == NULL)
-		attrs->set ("phc.filename", source->get_filename ()->clone ());
+	if (attrs->get_filename () == NULL)
+		attrs->set_filename (source->get_filename ());
 
-	Integer* i = dynamic_cast<Integer*>(attrs->get("phc.line_number"));
-	if (i == NULL)
-		attrs->set ("phc.line_number", new Integer (source->get_line_number()));
+	if (attrs->get_line_number () == -1)
+		attrs->set_line_number (source->get_line_number ());
 }
 
 bool
 Node::equals (IR::Node* that)
 {
+	// Shared subtrees are equal to themselves
+	if (this == that)
+		return true;
+
 	if (isa<AST::Node> (this))
 		return dyc<AST::Node> (this)->equals (dyc<AST::Node> (that));
 	else if (isa<HIR::Node> (this))
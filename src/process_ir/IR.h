@@ -45,6 +45,9 @@ class Node : virtual public Object
 public:
 	AttrMap* attrs;
 
+	// The number of owners of the subtree (see share () below)
+	int reference_count;
+
 	Node();
 
 	// Return the line number of the node (or 0 if unknown)
@@ -68,6 +71,50 @@ public:
 	virtual ~Node() {}
 };
 
+/*
+ * Copy-on-write subtrees.
+ *
+ * share () is an O(1) replacement for clone (): rather than copying the
+ * subtree, it returns the same node, with its reference count incremented.
+ * Shared subtrees must not be changed in place. An owner which wants to change
+ * a subtree it may be sharing calls unshare () first, which returns a private
+ * clone if the subtree is shared, and the subtree itself if it is not.
+ *
+ * As with Map, references are not given back when the garbage collector
+ * frees an owner, so unshare () may clone a subtree which is no longer
+ * shared. This costs a clone, but is always safe.
+ */
+template <class T>
+T* share (T* in)
+{
+	if (in)
+		in->reference_count++;
+
+	return in;
+}
+
+template <class T>
+T* unshare (T* in)
+{
+	if (in == NULL || in->reference_count == 1)
+		return in;
+
+	assert (in->reference_count > 1);
+	in->reference_count--;
+	return in->clone ();
+}
+
+// A new list, sharing the elements of IN. The list itself can be changed.
+template <class T>
+List<T*>* share_list (List<T*>* in)
+{
+	List<T*>* result = new List<T*>;
+	foreach (T* elem, *in)
+		result->push_back (share (elem));
+
+	return result;
+}
+
 /*
  * Maketea doesn't provide const versions, so this will have to do.
  */
@@ -140,6 +140,7 @@ Unparser_state::Unparser_state (ostream& os, bool in_php)
 	indent_level = 0;
 	at_start_of_line = true;
 	delayed_newline = false;
+	continued = false;
 }
 	
 
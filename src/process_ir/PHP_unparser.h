@@ -26,6 +26,10 @@ class Unparser_state : virtual public GC_obj
 		std::ostream& os;
 		int indent_level;
 		bool delayed_newline;
+
+		// More of the script follows in another PHP_script (see --stream), so
+		// leave the PHP tags open at the end of this one.
+		bool continued;
 };
 
 class PHP_unparser : virtual public GC_obj
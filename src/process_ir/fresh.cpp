@@ -67,7 +67,7 @@ String* fresh (string prefix)
 	}
 	while (unfresh_vars.find (ss.str()) != unfresh_vars.end());
 
-	return new String(ss.str());
+	return intern (ss.str());
 }
 
 namespace AST
@@ -85,7 +85,7 @@ MIR_unparser::unparse_uppered (IR::PHP_script* in)
 	mir->visit (new Main_uppering);
 	mir->visit (new Goto_uppering);
 	AST::PHP_script* ast = (new MIR_to_AST ())->fold_php_script (mir);
-	AST_unparser().unparse (ast) ;
+	ast_unparser.unparse (ast);
 }
 
 
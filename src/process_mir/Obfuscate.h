@@ -24,7 +24,8 @@ public:
 
 	void run (IR::PHP_script* in, Pass_manager* pm)
 	{
-		MIR_unparser().unparse_uppered (in);
+		MIR_unparser (pm->get_unparser_state ()).unparse_uppered (in);
+		pm->changed_nothing ();
 	}
 
 	bool pass_is_enabled (Pass_manager* pm)
@@ -0,0 +1,374 @@
+/*
+ * phc -- the open source PHP compiler
+ * See doc/license/README.license for licensing information
+ *
+ * Time each stage of the compiler on the benchmark sources, and write the
+ * results as JSON. Compare two sets of results with stage_bench_compare.
+ *
+ * Usage: stage_bench [-n RUNS] [-O LEVEL] [-o FILE] [FILE|DIR ...]
+ *
+ * Each file is compiled (to C, which is discarded) in a separate process, once
+ * to warm up and then RUNS times, so that every run starts from the same
+ * state. The stages are timed in CPU seconds using the pass timer, and the
+ * minimum and median of the runs are reported. Directories are searched for
+ * .php files. Without any files, the benchmarks in test/subjects/benchmarks
+ * are used, so this should be run from the top of the source tree.
+ */
+
+#include <algorithm>
+#include <dirent.h>
+#include <fstream>
+#include <iomanip>
+#include <sys/resource.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <vector>
+
+#include "embed/embed.h"
+#include "generated/cmdline.h"
+#include "lib/escape.h"
+#include "parsing/parse.h"
+#include "parsing/PHP_context.h"
+#include "parsing/Source_buffer.h"
+#include "pass_manager/Pass_manager.h"
+#include "pass_manager/Pass_timer.h"
+#include "pass_manager/Standard_passes.h"
+#include "process_ir/General.h"
+
+using namespace std;
+
+// Used throughout phc
+struct gengetopt_args_info args_info;
+extern struct gengetopt_args_info error_args_info;
+Pass_manager* pm;
+
+static const char* default_dirs[] = {
+	"test/subjects/benchmarks/phpbench-0.8.1",
+	"test/subjects/benchmarks/roadsend",
+	"test/subjects/benchmarks/php_bs",
+	"test/subjects/benchmarks/RUBiS",
+};
+
+static const char* stages[] = {
+	"lex",
+	"parse",
+	"lower",
+	"cfg",
+	"ssa",
+	"wpa",
+	"generate_c",
+	"micg_parse",
+	"micg_instantiate",
+	"total",
+};
+
+#define NUM_STAGES (sizeof (stages) / sizeof (stages[0]))
+
+static bool
+ends_with (string str, string suffix)
+{
+	return str.size () >= suffix.size ()
+		&& str.compare (str.size () - suffix.size (), suffix.size (), suffix) == 0;
+}
+
+// Add FILENAME, or the .php files under it if it is a directory.
+static void
+find_files (string filename, List<string>* files)
+{
+	struct stat st;
+	if (stat (filename.c_str (), &st) != 0)
+		phc_error ("Cannot find %s", filename.c_str ());
+
+	if (!S_ISDIR (st.st_mode))
+	{
+		files->push_back (filename);
+		return;
+	}
+
+	DIR* dir = opendir (filename.c_str ());
+	List<string> entries;
+	while (struct dirent* entry = readdir (dir))
+	{
+		string name = entry->d_name;
+		if (name == "." || name == "..")
+			continue;
+
+		entries.push_back (filename + "/" + name);
+	}
+	closedir (dir);
+
+	// Keep the order repeatable
+	entries.sort ();
+	foreach (string entry, entries)
+	{
+		if (stat (entry.c_str (), &st) == 0 && S_ISDIR (st.st_mode))
+			find_files (entry, files);
+		else if (ends_with (entry, ".php"))
+			files->push_back (entry);
+	}
+}
+
+static double
+cpu_time ()
+{
+	struct rusage usage;
+	getrusage (RUSAGE_SELF, &usage);
+	return usage.ru_utime.tv_sec + usage.ru_utime.tv_usec / 1e6
+		+ usage.ru_stime.tv_sec + usage.ru_stime.tv_usec / 1e6;
+}
+
+/*
+ * In the child process: compile FILENAME, and write the time of each stage to
+ * OUT.
+ */
+static void
+compile (string filename, string level, FILE* out)
+{
+	double start = cpu_time ();
+
+	const char* argv[] = { "phc", "-O", level.c_str (), "--generate-c", filename.c_str () };
+	if (cmdline_parser (5, const_cast<char**> (argv), &args_info) != 0)
+		_exit (1);
+
+	error_args_info = args_info;
+
+	pm = new Pass_manager (&args_info);
+	stringstream c_code;
+	add_standard_passes (pm, c_code);
+	pm->timer = new Pass_timer;
+
+	// Parsing includes lexing, so lex on its own first.
+	{
+		Pass_timer_scope timing (pm->timer, "ast", "lex");
+		Source_buffer* source = Source_buffer::open (s(filename));
+		if (source == NULL)
+			_exit (1);
+
+		PHP_context* context = new PHP_context (source, s(filename));
+		while (context->lex ())
+			;
+
+		source->close ();
+	}
+
+	Pass_timer_scope timing (pm->timer, "ast", "parse");
+	IR::PHP_script* ir = parse (s(filename), NULL);
+	timing.stop ();
+
+	if (ir == NULL)
+		_exit (1);
+
+	pm->run (ir, true);
+	pm->post_process ();
+
+	Pass_timer* timer = pm->timer;
+	double lex = timer->get_cpu ("ast", "lex");
+	double parse = timer->get_cpu ("ast", "parse");
+
+	double times[NUM_STAGES] = {
+		lex,
+		parse,
+		timer->get_cpu ("ast") - lex - parse + timer->get_cpu ("hir") + timer->get_cpu ("mir"),
+		timer->get_cpu ("optimize", "cfg"),
+		timer->get_cpu ("optimize", "build-ssa-ssi") + timer->get_cpu ("optimize", "drop-ssa-ssi"),
+		timer->get_cpu ("wpa", "wpa"),
+		timer->get_cpu ("codegen", "generate-c"),
+		timer->get_cpu ("codegen", "micg-parse"),
+		timer->get_cpu ("codegen", "micg"),
+		cpu_time () - start,
+	};
+
+	for (unsigned int i = 0; i < NUM_STAGES; i++)
+		fprintf (out, "%s %.6f\n", stages[i], times[i]);
+
+	fflush (out);
+}
+
+/*
+ * Compile FILENAME in a new process, and return the time of each stage, or
+ * NULL if it could not be compiled.
+ */
+static Map<string, double>*
+run (string filename, string level)
+{
+	int fds[2];
+	if (pipe (fds) != 0)
+		phc_error ("Cannot create a pipe");
+
+	pid_t pid = fork ();
+	if (pid == -1)
+		phc_error ("Cannot fork");
+
+	if (pid == 0)
+	{
+		close (fds[0]);
+
+		// Discard the generated code and any warnings.
+		freopen ("/dev/null", "w", stdout);
+		freopen ("/dev/null", "w", stderr);
+
+		compile (filename, level, fdopen (fds[1], "w"));
+		_exit (0);
+	}
+
+	close (fds[1]);
+	FILE* in = fdopen (fds[0], "r");
+
+	Map<string, double>* result = new Map<string, double>;
+	char stage[100];
+	double time;
+	while (fscanf (in, "%99s %lf", stage, &time) == 2)
+		(*result)[stage] = time;
+
+	fclose (in);
+
+	int status;
+	waitpid (pid, &status, 0);
+	if (!WIFEXITED (status) || WEXITSTATUS (status) != 0 || result->size () != NUM_STAGES)
+		return NULL;
+
+	return result;
+}
+
+static double
+median (List<double>& times)
+{
+	vector<double> sorted (times.begin (), times.end ());
+	sort (sorted.begin (), sorted.end ());
+
+	size_t middle = sorted.size () / 2;
+	if (sorted.size () % 2)
+		return sorted[middle];
+
+	return (sorted[middle - 1] + sorted[middle]) / 2;
+}
+
+static double
+minimum (List<double>& times)
+{
+	return *min_element (times.begin (), times.end ());
+}
+
+static void
+usage ()
+{
+	cerr << "Usage: stage_bench [-n RUNS] [-O LEVEL] [-o FILE] [FILE|DIR ...]" << endl;
+	exit (1);
+}
+
+int
+main (int argc, char** argv)
+{
+	int runs = 5;
+	string level = "2";
+	const char* output = NULL;
+
+	int opt;
+	while ((opt = getopt (argc, argv, "n:O:o:")) != -1)
+	{
+		switch (opt)
+		{
+			case 'n': runs = atoi (optarg); break;
+			case 'O': level = optarg; break;
+			case 'o': output = optarg; break;
+			default: usage ();
+		}
+	}
+
+	if (runs < 1)
+		usage ();
+
+	List<string>* files = new List<string>;
+	if (optind == argc)
+	{
+		for (unsigned int i = 0; i < sizeof (default_dirs) / sizeof (default_dirs[0]); i++)
+			find_files (default_dirs[i], files);
+	}
+	else
+	{
+		for (int i = optind; i < argc; i++)
+			find_files (argv[i], files);
+	}
+
+	// Started once, and shared by the children.
+	PHP::startup_php ();
+
+	ofstream file;
+	if (output)
+	{
+		file.open (output);
+		if (!file)
+			phc_error ("Cannot open %s for writing", output);
+	}
+	ostream& os = output ? file : cout;
+
+	os << fixed << setprecision (6);
+	os << "{\n";
+	os << "  \"runs\": " << runs << ",\n";
+	os << "  \"optimize\": \"" << level << "\",\n";
+	os << "  \"files\": {";
+
+	Map<string, double> total_mins;
+	Map<string, double> total_medians;
+
+	bool first = true;
+	foreach (string filename, *files)
+	{
+		cerr << filename << endl;
+
+		os << (first ? "\n" : ",\n");
+		first = false;
+		os << "    \"" << *escape_C_dq (s(filename)) << "\": {";
+
+		// Warm up (the file cache, for example).
+		Map<string, double>* result = run (filename, level);
+
+		Map<string, List<double> > times;
+		for (int i = 0; result && i < runs; i++)
+		{
+			result = run (filename, level);
+			if (result == NULL)
+				break;
+
+			for (unsigned int i = 0; i < NUM_STAGES; i++)
+				times[stages[i]].push_back ((*result)[stages[i]]);
+		}
+
+		if (result == NULL)
+		{
+			cerr << "  failed" << endl;
+			os << "\"failed\": true}";
+			continue;
+		}
+
+		for (unsigned int i = 0; i < NUM_STAGES; i++)
+		{
+			double min = minimum (times[stages[i]]);
+			double med = median (times[stages[i]]);
+			total_mins[stages[i]] += min;
+			total_medians[stages[i]] += med;
+
+			os
+			<< (i ? ", " : "")
+			<< "\"" << stages[i] << "\": {\"min\": " << min << ", \"median\": " << med << "}";
+		}
+		os << "}";
+	}
+
+	os << "\n  },\n";
+	os << "  \"total\": {";
+	for (unsigned int i = 0; i < NUM_STAGES; i++)
+	{
+		os
+		<< (i ? ", " : "")
+		<< "\"" << stages[i] << "\": {\"min\": " << total_mins[stages[i]]
+		<< ", \"median\": " << total_medians[stages[i]] << "}";
+	}
+	os << "}\n";
+	os << "}\n";
+
+	PHP::shutdown_php ();
+
+	return 0;
+}
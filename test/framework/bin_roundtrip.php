@@ -0,0 +1,42 @@
+<?php
+/*
+ * phc -- the open source PHP compiler
+ * See doc/license/README.license for licensing information
+ *
+ * Check that passing the IR between phc runs in the binary format (with
+ * --dump-bin and --read-bin) loses nothing, by comparing the XML of the MIR
+ * with that from a single run.
+ */
+
+array_push($tests, new BinRoundtrip ());
+class BinRoundtrip extends AsyncTest
+{
+	function get_test_subjects ()
+	{
+		return get_all_scripts ();
+	}
+
+	function get_dependent_test_names ()
+	{
+		return array ("cb_mir");
+	}
+
+	function run_test ($subject)
+	{
+		global $phc;
+
+		$async = new AsyncBundle ($this, $subject);
+
+		$async->commands[0] = "$phc --no-hash-bang --dump-xml=mir $subject";
+		$async->commands[1] = "$phc --no-hash-bang --dump-bin=ast $subject"
+			. " | $phc --read-bin=ast --dump-bin=hir"
+			. " | $phc --read-bin=hir --dump-bin=mir"
+			. " | $phc --no-hash-bang --read-bin=mir --dump-xml=mir";
+
+		$async->final = "two_command_finish";
+
+		$async->start ();
+	}
+}
+
+?>
@@ -0,0 +1,43 @@
+<?php
+/*
+ * phc -- the open source PHP compiler
+ * See doc/license/README.license for licensing information
+ *
+ * Check that scripts read back from the parse cache (with --parse-cache) are
+ * the same as those parsed from the source.
+ */
+
+array_push($tests, new CachedVsParsed ());
+class CachedVsParsed extends AsyncTest
+{
+	function get_test_subjects ()
+	{
+		return get_all_scripts ();
+	}
+
+	function get_dependent_test_names ()
+	{
+		return array ("cb_sua");
+	}
+
+	function run_test ($subject)
+	{
+		global $phc;
+		global $working_directory;
+
+		$async = new AsyncBundle ($this, $subject);
+
+		// The first run fills the cache, and the second reads from it.
+		$cache = "$working_directory/parse_cache";
+		$cached = "$phc --include --parse-cache=$cache --dump=incl1 $subject";
+
+		$async->commands[0] = "$phc --include --dump=incl1 $subject";
+		$async->commands[1] = "$cached > /dev/null && $cached";
+
+		$async->final = "two_command_finish";
+
+		$async->start ();
+	}
+}
+
+?>
@@ -119,6 +119,9 @@ $tests[] = new BasicTest ("FastOptAnalyse", "$opt $disable $fast", "BasicPrecise
 $tests[] = new BasicTest ("FastOptimize", "$opt $fast", "BasicFastOptAnalyseTest");
 $tests[] = new BasicIgnoreOutputTest ("FastOptimize", "$opt $fast $stats", "BasicFastOptimizeTest");
 
+// Check native constant folding against the interpreter
+$tests[] = new BasicTest ("CheckFolding", "$opt --check-folding", "BasicPreciseOptimizeTest");
+
 $tests[] = new CompareWithPHP ("InterpretOptimized", "$opt --dump=codegen --convert-uppered", "BasicPreciseOptimizeTest");
 require_once ("compile_optimized.php");
 
@@ -130,8 +133,12 @@ $tests[] = new PluginTest ("linear");
 $tests[] = new PluginTest ("cloning");
 $tests[] = new PluginTest ("pre_vs_post_count");
 require_once ("reparse_unparsed.php");
+require_once ("streamed_vs_whole.php");
 require_once ("source_vs_semantic_values.php"); // dont use plugin_test here
 require_once ("xml_roundtrip.php"); // dont use plugin_test here
+require_once ("bin_roundtrip.php");
+require_once ("parallel_includes.php");
+require_once ("cached_vs_parsed.php");
 require_once ("compile_plugin_test.php");
 require_once ("line_numbers.php");
 require_once ("parse_ast_dot.php");
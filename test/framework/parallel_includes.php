@@ -0,0 +1,38 @@
+<?php
+/*
+ * phc -- the open source PHP compiler
+ * See doc/license/README.license for licensing information
+ *
+ * Check that parsing included files several at a time (with --include-jobs)
+ * has the same output as parsing them one after another.
+ */
+
+array_push($tests, new ParallelIncludes ());
+class ParallelIncludes extends AsyncTest
+{
+	function get_test_subjects ()
+	{
+		return get_all_scripts ();
+	}
+
+	function get_dependent_test_names ()
+	{
+		return array ("cb_sua");
+	}
+
+	function run_test ($subject)
+	{
+		global $phc;
+
+		$async = new AsyncBundle ($this, $subject);
+
+		$async->commands[0] = "$phc --include --include-jobs=1 --dump=incl1 $subject";
+		$async->commands[1] = "$phc --include --include-jobs=4 --dump=incl1 $subject";
+
+		$async->final = "two_command_finish";
+
+		$async->start ();
+	}
+}
+
+?>
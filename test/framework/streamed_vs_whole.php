@@ -0,0 +1,38 @@
+<?php
+/*
+ * phc -- the open source PHP compiler
+ * See doc/license/README.license for licensing information
+ *
+ * Check that lowering a script one top-level statement at a time (with
+ * --stream) has the same output as lowering the whole script.
+ */
+
+array_push($tests, new StreamedVsWhole ());
+class StreamedVsWhole extends AsyncTest
+{
+	function get_test_subjects ()
+	{
+		return get_all_scripts ();
+	}
+
+	function get_dependent_test_names ()
+	{
+		return array ("cb_mir");
+	}
+
+	function run_test ($subject)
+	{
+		global $phc;
+
+		$async = new AsyncBundle ($this, $subject);
+
+		$async->commands[0] = "$phc --dump=mir $subject";
+		$async->commands[1] = "$phc --stream --dump=mir $subject";
+
+		$async->final = "two_command_finish";
+
+		$async->start ();
+	}
+}
+
+?>
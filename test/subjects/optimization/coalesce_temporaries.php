@@ -0,0 +1,33 @@
+<?php
+
+	// Each subexpression gets its own temporary, but few are live at once.
+	function f ($x, $y)
+	{
+		$a = ($x + 1) * ($y + 2) - ($x * $y);
+		$b = ($a + $x) . "-" . ($a - $y);
+		return $a . ":" . $b;
+	}
+
+	// Temporaries live across a loop must be kept apart.
+	function g ($n)
+	{
+		$sum = 0;
+		for ($i = 0; $i < $n * 2; $i++)
+			$sum += ($i % 3) + ($i % 5);
+
+		return $sum;
+	}
+
+	// Temporaries passed by reference must not be merged.
+	function h ($arr)
+	{
+		$x = array_merge ($arr, array (3, 1, 2));
+		sort ($x);
+		$y = array_reverse ($x);
+		return implode (",", $x) . " " . implode (",", $y);
+	}
+
+	echo f (3, 4), "\n";
+	echo g (10), "\n";
+	echo h (array (5, 4)), "\n";
+?>
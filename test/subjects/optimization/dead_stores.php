@@ -0,0 +1,52 @@
+<?php
+
+	// Stores which are overwritten before they are read.
+	function f ($x)
+	{
+		$a = array ();
+		$a[0] = $x;
+		$a[0] = $x + 1;
+		$a[1] = $x * 2;
+		return $a[0] + $a[1];
+	}
+
+	// A local array which is never read again.
+	function g ($x)
+	{
+		$a = array ();
+		$a["key"] = $x;
+		$a["key"] = $x + 1;
+		return $x;
+	}
+
+	// These must be kept.
+	function h (&$arr, $x)
+	{
+		$arr[0] = $x;
+		$copy = $arr;
+		$arr[0] = $x + 1;
+		return $copy;
+	}
+
+	class C
+	{
+		public $f;
+	}
+
+	function k ($obj)
+	{
+		$obj->f = 1;
+		$obj->f = 2;
+	}
+
+	var_dump (f (5));
+	var_dump (g (5));
+
+	$arr = array ();
+	var_dump (h ($arr, 7));
+	var_dump ($arr);
+
+	$obj = new C;
+	k ($obj);
+	var_dump ($obj);
+?>
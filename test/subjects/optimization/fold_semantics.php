@@ -0,0 +1,59 @@
+<?php
+
+	// Constant folding with PHP's conversion rules. These are folded natively
+	// and checked against the interpreter with --check-folding.
+	$values = array (NULL, true, false, 0, 1, -1, 7, 2.5, -0.5, 1e20,
+						"", "0", "1", "12abc", " 3", "abc", "1.5e3", ".5", "007");
+
+	var_dump (PHP_INT_MAX + 1);
+	var_dump (PHP_INT_MAX * 2);
+	var_dump (-PHP_INT_MAX - 2);
+	var_dump (7 / 2);
+	var_dump (8 / 2);
+	var_dump (-7 % 3);
+	var_dump (1 << 3);
+	var_dump (-16 >> 2);
+	var_dump ("abc" | "  ");
+	var_dump ("abc" & "ab");
+	var_dump ("12abc" + 1);
+	var_dump ("1.5e3" + 1);
+	var_dump (" 3" * "2");
+	var_dump ("abc" . 1.5 . true . NULL . 10);
+	var_dump (0.1 + 0.2);
+	var_dump (1 / 3);
+	var_dump ((int) "  42 apples");
+	var_dump ((int) 3.99);
+	var_dump ((string) 1.0);
+	var_dump ((float) "1e3");
+	var_dump ((bool) "0");
+	var_dump ((bool) "0.0");
+	var_dump (NULL == false);
+	var_dump (NULL < -1);
+	var_dump ("abc" == 0);
+	var_dump ("1" == "01");
+	var_dump ("10" == "1e1");
+	var_dump ("abc" < "abd");
+	var_dump (100 == "1e2");
+	var_dump ("1" === "01");
+	var_dump (1.0 === 1);
+	var_dump (true xor true);
+	var_dump (~5);
+	var_dump (-"3");
+	var_dump (!"0");
+
+	$str = "hello";
+	var_dump ($str[1]);
+
+	$i = PHP_INT_MAX;
+	$i++;
+	var_dump ($i);
+
+	$n = NULL;
+	$n--;
+	var_dump ($n);
+
+	// The rest of the comparison table
+	foreach ($values as $a)
+		foreach ($values as $b)
+			var_dump ($a == $b, $a < $b);
+?>
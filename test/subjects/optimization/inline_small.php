@@ -0,0 +1,43 @@
+<?php
+
+	// Small functions, which should be inlined.
+	function get_x ($obj)
+	{
+		return $obj->x;
+	}
+
+	function add_one (&$x)
+	{
+		$x++;
+	}
+
+	function maybe_neg ($y, $neg = false)
+	{
+		if ($neg)
+			return -$y;
+
+		return $y;
+	}
+
+	function fact ($n)
+	{
+		if ($n <= 1)
+			return 1;
+		return $n * fact ($n - 1);
+	}
+
+	$obj = new stdClass;
+	$obj->x = 5;
+
+	$sum = 0;
+	for ($i = 0; $i < 10; $i++)
+	{
+		add_one ($sum);
+		$sum += get_x ($obj);
+		var_dump (maybe_neg ($sum, $i % 2));
+	}
+
+	var_dump ($sum);
+	var_dump (maybe_neg (7));
+	var_dump (fact (6));
+?>
@@ -0,0 +1,50 @@
+<?php
+
+	// Pure functions can be evaluated at compile-time when their arguments
+	// are known, removed when their results are unused, and memoized.
+	function square ($x)
+	{
+		return $x * $x;
+	}
+
+	function fib ($n)
+	{
+		if ($n < 2)
+			return $n;
+		return fib ($n - 1) + fib ($n - 2);
+	}
+
+	function greet ($name)
+	{
+		$parts = array ("Hello", $name);
+		return implode (", ", $parts);
+	}
+
+	// Not pure: has an effect other than its result
+	function noisy ($x)
+	{
+		echo "noisy $x\n";
+		return $x;
+	}
+
+	// Not pure: depends on global state
+	function read_global ()
+	{
+		global $g;
+		return $g;
+	}
+
+	$g = 5;
+	var_dump (square (7));
+	var_dump (fib (15));
+	var_dump (greet ("world"));
+	square (8);
+	noisy (3);
+	var_dump (read_global ());
+
+	for ($i = 0; $i < 5; $i++)
+	{
+		var_dump (square ($i));
+		var_dump (fib ($i + 10));
+	}
+?>
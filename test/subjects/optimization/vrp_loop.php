@@ -0,0 +1,22 @@
+<?php
+
+	// The induction variables stay within a long, so their arithmetic can be
+	// done natively. The last loop overflows into a double.
+	for ($i = 0; $i < 10; $i++)
+	{
+		$x = $i * 3;
+		$y = $x - 7;
+		echo "$i $x $y\n";
+	}
+
+	for ($j = 100; $j > 0; $j -= 10)
+		echo "$j\n";
+
+	$k = PHP_INT_MAX - 3;
+	for ($n = 0; $n < 6; $n++)
+	{
+		$k++;
+		var_dump ($k);
+	}
+
+?>
@@ -0,0 +1,20 @@
+<html><head><title>Long runs of inline HTML, comments and strings</title></head>
+<body><p>A paragraph which is long enough to need more than one block of 32 bytes < 64 bytes</p>
+<p><?php echo "a short tag"; ?> and <?= "an echo tag" ?> in the middle of a line</p>
+<?php
+	/* A long comment, with a * and a ** and a *** which don't end it, spanning
+	 * several lines ******************************************************** */
+	// A long single-line comment, with a ? and a ?? which don't end it ??????
+	# The end of the script in a comment ends the comment ?> <p>more HTML</p>
+<?php
+	$var = "world";
+	echo 'A long singly-quoted string, with \'escaped quotes\' and \\ backslashes';
+	echo "A long doubly-quoted string, with \"escaped quotes\", $var and {$var}s";
+	echo `echo A long backticked string, which mentions $var and more $var`;
+	echo <<<END_OF_TEXT
+A long heredoc string, with $var and {$var}s and \$escapes, which has END_OF_TEXT
+in the middle of a line, and starts lines with END_OF and
+END_OF_TEXT_BUT_LONGER, before it ends.
+END_OF_TEXT;
+?>
+</body></html>